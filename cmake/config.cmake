@@ -35,6 +35,7 @@ set(OMR_EXAMPLE ON CACHE BOOL "Enable the Example application")
 set(OMR_TOOLS ON CACHE BOOL "Enable the native build tools")
 set(OMR_DDR OFF CACHE BOOL "Enable DDR")
 set(OMR_RAS_TDF_TRACE ON CACHE BOOL "Enable trace engine")
+set(OMR_RAS_SAMPLER ${OMR_RAS_TDF_TRACE} CACHE BOOL "Enable the timer driven stack sampler")
 set(OMR_FVTEST ON CACHE BOOL "Enable the FV Testing.")
 
 set(OMR_PORT ON CACHE BOOL "Enable portability library")
@@ -67,6 +68,11 @@ if(NOT OMR_COMPILER)
 	endif()
 endif()
 
+## OMR_RAS_TDF_TRACE is required for OMR_RAS_SAMPLER
+if(OMR_RAS_SAMPLER AND NOT OMR_RAS_TDF_TRACE)
+	message(FATAL_ERROR "OMR_RAS_SAMPLER is enabled but OMR_RAS_TDF_TRACE is not enabled")
+endif()
+
 if(OMR_LLJB)
 	if(NOT OMR_JITBUILDER)
 		message(FATAL_ERROR "OMR_LLJB is enabled but OMR_JITBUILDER is not enabled")
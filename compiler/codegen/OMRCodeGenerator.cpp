@@ -983,6 +983,17 @@ void OMR::CodeGenerator::stopUsingRegister(TR::Register *reg)
    if (reg != NULL && _liveRegisters[reg->getKind()]) _liveRegisters[reg->getKind()]->stopUsingRegister(reg);
    }
 
+bool
+OMR::CodeGenerator::useLinearScanRegisterAllocator()
+   {
+   TR::Compilation *comp = self()->comp();
+
+   if (!self()->getSupportsLinearScanRegisterAllocator() || comp->getOption(TR_DisableLinearScanRA))
+      return false;
+
+   return comp->getOption(TR_EnableLinearScanRA) || comp->getMethodHotness() <= cold;
+   }
+
 bool
 OMR::CodeGenerator::isRegisterClobberable(TR::Register *reg, uint16_t count)
    {
@@ -1769,13 +1780,19 @@ OMR::CodeGenerator::reserveCodeCache()
    {
    int32_t numReserved = 0;
    int32_t compThreadID = 0;
+   TR::Compilation *comp = self()->comp();
+
+   // The front end reports how often the method was invoked before it was
+   // compiled; frequently invoked methods go to code caches of their own
+   //
+   bool isHot = false;
+   if (comp->getOption(TR_EnableHotCodeCacheLayout))
+      isHot = comp->getCurrentMethod()->getInvocationCount() >= comp->getOptions()->getHotCodeCacheInvocationThreshold();
 
-   _codeCache = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   _codeCache = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved, isHot);
 
    if (!_codeCache) // Cannot reserve a cache; all are used
       {
-      TR::Compilation *comp = self()->comp();
-
       // We may reach this point if all code caches have been used up.
       // If some code caches have some space but cannot be used because they are reserved
       // we will throw an exception in the call to TR::CodeCacheManager::reserveCodeCache
@@ -450,6 +450,17 @@ public:
    void doRegisterAssignment(TR_RegisterKinds kindsToAssign);
    void doBinaryEncoding();
    bool hasComplexAddressingMode() { return false; }
+
+   /**
+    * \brief Whether registers of this compilation are assigned with a linear
+    *        scan over the instruction stream.
+    *
+    * The linear scan is used when the code generator supports it, by default
+    * for cold and noOpt compilations, where the tactical global register
+    * allocator is then not run, and at any opt level with
+    * TR_EnableLinearScanRA.  TR_DisableLinearScanRA turns it off.
+    */
+   bool useLinearScanRegisterAllocator();
    void removeUnusedLocals();
 
    void identifyUnneededByteConvNodes(TR::Node*, TR::TreeTop *, vcount_t, TR::DataType);
@@ -819,6 +830,12 @@ public:
     */
    uint32_t getJitMethodEntryAlignmentBoundary();
 
+   /** \brief
+    *     Determines whether the code generator honours TR::Compilation::hasPatchableMethodEntry by starting
+    *     the method at its entry point with an instruction that _patchVirtualGuard can replace with a jump.
+    */
+   bool supportsPatchableMethodEntry() { return false; }
+
    uint32_t getJitMethodEntryPaddingSize() {return _jitMethodEntryPaddingSize;}
    uint32_t setJitMethodEntryPaddingSize(uint32_t s) {return (_jitMethodEntryPaddingSize = s);}
 
@@ -1555,6 +1572,9 @@ public:
    bool getSupportsGlRegDeps() {return _flags1.testAny(SupportsGlRegDeps);}
    void setSupportsGlRegDeps() {_flags1.set(SupportsGlRegDeps);}
 
+   bool getSupportsLinearScanRegisterAllocator() {return _flags1.testAny(SupportsLinearScanRegisterAllocator);}
+   void setSupportsLinearScanRegisterAllocator() {_flags1.set(SupportsLinearScanRegisterAllocator);}
+
    /**
     * @brief Query whether this code generator supports recompilation
     * @return true if recompilation supported; false otherwise
@@ -1831,7 +1851,7 @@ public:
       SupportsByteswap                                   = 0x00400000,
       SupportsScaledIndexAddressing                      = 0x00800000,
       SupportsCompactedLocals                            = 0x01000000,
-      // AVAILABLE                                       = 0x02000000,
+      SupportsLinearScanRegisterAllocator                = 0x02000000,
       UsesRegisterPairsForLongs                          = 0x04000000,
       SupportsArraySet                                   = 0x08000000,
       SupportsArrayCmpLen                                = 0x10000000,
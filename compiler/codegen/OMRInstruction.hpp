@@ -217,6 +217,8 @@ class OMR_EXTENSIBLE Instruction
    void setNeedsGCMap(TCollectableReferenceMask regMask = 0xFFFFFFFF) { _gc._GCRegisterMask = regMask; _index |= TO_MASK(NeedsGCMapBit); }
    bool needsAOTRelocation() { return (_index & TO_MASK(NeedsAOTRelocation)) != 0; }
    void setNeedsAOTRelocation(bool v = true) { v ? _index |= TO_MASK(NeedsAOTRelocation) : _index &= ~TO_MASK(NeedsAOTRelocation); }
+   bool isTailJump() { return (_index & TO_MASK(IsTailJump)) != 0; }
+   void setIsTailJump() { _index |= TO_MASK(IsTailJump); }
 
    TR_GCStackMap *getGCMap() { return _gc._GCMap; }
    TR_GCStackMap *setGCMap(TR_GCStackMap *map) { return (_gc._GCMap = map); }
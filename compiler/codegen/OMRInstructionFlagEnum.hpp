@@ -31,3 +31,7 @@ NeedsGCMapBit,
 // Instruction requires an AOT relocation
 //
 NeedsAOTRelocation,
+
+// Instruction leaves the method through a jump to another method
+//
+IsTailJump,
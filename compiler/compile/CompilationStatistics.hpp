@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TR_COMPILATIONSTATISTICS_INCL
+#define TR_COMPILATIONSTATISTICS_INCL
+
+#include <stdint.h>
+#include <string.h>
+
+namespace TR
+{
+
+/**
+ * Measurements of one compilation, filled in for a requester that hands an
+ * instance to the compiler through IlGeneratorMethodDetails.
+ *
+ * Times are in microseconds.  The optimization and code generation times
+ * stay zero for a method loaded from the AOT cache.
+ */
+struct CompilationStatistics
+   {
+   CompilationStatistics() { reset(); }
+
+   void reset() { memset(this, 0, sizeof(*this)); }
+
+   uint64_t _ilGenTime;
+   uint64_t _optimizationTime;
+   uint64_t _codeGenTime;
+   uint64_t _compileTime;      // from the compile request to installed code
+   uint32_t _codeSize;         // in bytes, from the method's start PC
+   int32_t  _nodeCount;        // IL nodes after optimization
+   };
+
+}
+
+#endif
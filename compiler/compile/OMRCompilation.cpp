@@ -38,6 +38,7 @@
 #include "codegen/RecognizedMethods.hpp"
 #include "compile/Compilation.hpp"
 #include "compile/Compilation_inlines.hpp"
+#include "compile/CompilationStatistics.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
 #include "compile/OSRData.hpp"
@@ -98,12 +99,14 @@
 #include "optimizer/RegisterCandidate.hpp"
 #include "optimizer/Structure.hpp"
 #include "optimizer/TransformUtil.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
 #include "ras/Debug.hpp"
 #include "ras/DebugCounter.hpp"
 #include "ras/ILValidationStrategies.hpp"
 #include "ras/ILValidator.hpp"
 #include "ras/IlVerifier.hpp"
 #include "control/Recompilation.hpp"
+#include "runtime/AOTCache.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
 #include "ilgen/IlGen.hpp"
 #include "env/RegionProfiler.hpp"
@@ -270,6 +273,8 @@ OMR::Compilation::Compilation(
    _currentBlock(NULL),
    _verboseOptTransformationCount(0),
    _relocatableMethodCodeStart(NULL),
+   _aotCacheKey(0),
+   _inliningMethodSummaryRecord(NULL),
    _compThreadID(id),
    _failCHtableCommitFlag(false),
    _phaseTimer("Compilation", self()->allocator("phaseTimer"), self()->getOption(TR_Timing)),
@@ -281,6 +286,7 @@ OMR::Compilation::Compilation(
    _scratchSpaceLimit(TR::Options::_scratchSpaceLimit),
    _cpuTimeAtStartOfCompilation(-1),
    _ilVerifier(NULL),
+   _compilationStatistics(NULL),
    _gpuPtxList(m),
    _gpuKernelLineNumberList(m),
    _gpuPtxCount(0),
@@ -1005,7 +1011,9 @@ int32_t OMR::Compilation::compile()
    {
      TR::RegionProfiler rpIlgen(self()->trMemory()->heapMemoryRegion(), *self(), "comp/ilgen");
      if (printCodegenTime) genILTime.startTiming(self());
+     uint64_t ilGenStart = _compilationStatistics ? TR::Compiler->vm.getUSecClock() : 0;
      _ilGenSuccess = _methodSymbol->genIL(self()->fe(), self(), self()->getSymRefTab(), _ilGenRequest);
+     if (_compilationStatistics) _compilationStatistics->_ilGenTime = TR::Compiler->vm.getUSecClock() - ilGenStart;
      if (printCodegenTime) genILTime.stopTiming(self());
    }
 
@@ -1045,6 +1053,12 @@ int32_t OMR::Compilation::compile()
          }
 #endif
 
+      // A method whose IL matches code in the AOT cache is loaded from there
+      // rather than optimized and generated again
+      //
+      if (TR::AOTCache::isActive() && TR::AOTCache::loadMethod(self()))
+         return COMPILATION_SUCCEEDED;
+
       if (_recompilationInfo)
          {
          _recompilationInfo->beforeOptimization();
@@ -1059,12 +1073,18 @@ int32_t OMR::Compilation::compile()
 
       TR_DebuggingCounters::initializeCompilation();
       if (printCodegenTime) optTime.startTiming(self());
+      uint64_t optStart = _compilationStatistics ? TR::Compiler->vm.getUSecClock() : 0;
 
          {
          TR::RegionProfiler rpOpt(self()->trMemory()->heapMemoryRegion(), *self(), "comp/opt");
          self()->performOptimizations();
          }
 
+      if (_compilationStatistics)
+         {
+         _compilationStatistics->_optimizationTime = TR::Compiler->vm.getUSecClock() - optStart;
+         _compilationStatistics->_nodeCount = self()->getNodeCount();
+         }
       if (printCodegenTime) optTime.stopTiming(self());
 
 #ifdef J9_PROJECT_SPECIFIC
@@ -1108,9 +1128,12 @@ int32_t OMR::Compilation::compile()
 
         if (printCodegenTime)
            codegenTime.startTiming(self());
+        uint64_t codeGenStart = _compilationStatistics ? TR::Compiler->vm.getUSecClock() : 0;
 
         self()->cg()->generateCode();
 
+        if (_compilationStatistics)
+           _compilationStatistics->_codeGenTime = TR::Compiler->vm.getUSecClock() - codeGenStart;
         if (printCodegenTime)
            codegenTime.stopTiming(self());
         }
@@ -1264,6 +1287,12 @@ void OMR::Compilation::performOptimizations()
 
    _optimizer = TR::Optimizer::createOptimizer(self(), self()->getJittedMethodSymbol(), false);
 
+   // Summarize the IL as it was generated, before the optimizer changes it,
+   // for the benefit inliner of compilations that call this method
+   //
+   if (_optimizer && TR::InliningMethodSummaryCache::isActive() && !self()->isPeekingMethod())
+      TR::InliningMethodSummaryCache::summarizeMethod(self());
+
    if (_optimizer)
       _optimizer->optimize();
    }
@@ -96,7 +96,9 @@ namespace TR { class CodeGenerator; }
 namespace TR { class Compilation; }
 namespace TR { class IlGenRequest; }
 namespace TR { class IlVerifier; }
+namespace TR { struct CompilationStatistics; }
 namespace TR { class ILValidator; }
+namespace TR { struct InliningMethodSummaryRecord; }
 namespace TR { class Instruction; }
 namespace TR { class KnownObjectTable; }
 namespace TR { class LabelSymbol; }
@@ -580,6 +582,15 @@ public:
    bool hasNativeCall()                         { return _flags.testAny(HasNativeCall); }
    void setHasNativeCall()                      { _flags.set(HasNativeCall); }
 
+   /**
+    * \brief
+    *    Request that the method start with an instruction that can later be
+    *    replaced by a jump while other threads run the method.  Only honoured
+    *    when TR::CodeGenerator::supportsPatchableMethodEntry().
+    */
+   bool hasPatchableMethodEntry()               { return _flags.testAny(HasPatchableMethodEntry); }
+   void setHasPatchableMethodEntry()            { _flags.set(HasPatchableMethodEntry); }
+
    /*
    * \brief
    *    This query tells whether the trees might contain rdbar/wrtbar opcodes
@@ -755,6 +766,10 @@ public:
 
    void setIlVerifier(TR::IlVerifier *ilVerifier) { _ilVerifier = ilVerifier; }
 
+   // Phase times and sizes of this compilation are recorded into statistics when it is set
+   TR::CompilationStatistics *getCompilationStatistics() { return _compilationStatistics; }
+   void setCompilationStatistics(TR::CompilationStatistics *statistics) { _compilationStatistics = statistics; }
+
    typedef std::pair<const void * const, TR::DebugCounterBase *> DebugCounterEntry;
    typedef TR::typed_allocator<DebugCounterEntry, TR::Allocator> DebugCounterMapAllocator;
    typedef std::map<const void *, TR::DebugCounterBase *, std::less<const void *>, DebugCounterMapAllocator> DebugCounterMap;
@@ -1034,6 +1049,14 @@ public:
    void * getRelocatableMethodCodeStart() const { return _relocatableMethodCodeStart; }
    void setRelocatableMethodCodeStart(void *p) { _relocatableMethodCodeStart = p; }
 
+   // Key of the method in the AOT cache, or 0 if its code cannot be cached
+   uint64_t getAOTCacheKey() const { return _aotCacheKey; }
+   void setAOTCacheKey(uint64_t key) { _aotCacheKey = key; }
+
+   // Summary of the method for the inlining method summary cache, or NULL if it was not summarized
+   TR::InliningMethodSummaryRecord *getInliningMethodSummaryRecord() const { return _inliningMethodSummaryRecord; }
+   void setInliningMethodSummaryRecord(TR::InliningMethodSummaryRecord *record) { _inliningMethodSummaryRecord = record; }
+
    bool getFailCHTableCommit() const { return _failCHtableCommitFlag; }
    void setFailCHTableCommit(bool v) { _failCHtableCommitFlag = v; }
 
@@ -1159,7 +1182,7 @@ protected:
    enum // flags
       {
       HasUnsafeSymbol                   = 0x0000001,
-      // AVAILABLE                      = 0x0000002,
+      HasPatchableMethodEntry           = 0x0000002,
       HasNativeCall                     = 0x0000004,
       // AVAILABLE                      = 0x0000008,
       SyncsMarked                       = 0x0000010,
@@ -1299,6 +1322,8 @@ protected:
 
 private:
    void *                            _relocatableMethodCodeStart;
+   uint64_t                          _aotCacheKey;
+   TR::InliningMethodSummaryRecord * _inliningMethodSummaryRecord;
    const int32_t                     _compThreadID; // The ID of the supporting compilation thread; 0 for compilation an application thread
    volatile bool                     _failCHtableCommitFlag;
 
@@ -1320,6 +1345,7 @@ private:
    int64_t                           _cpuTimeAtStartOfCompilation;
 
    TR::IlVerifier                    *_ilVerifier;
+   TR::CompilationStatistics         *_compilationStatistics;
 
    ListHeadAndTail<char*> _gpuPtxList;
    ListHeadAndTail<int32_t> _gpuKernelLineNumberList; //TODO: fix to get real line numbers
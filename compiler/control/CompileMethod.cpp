@@ -34,6 +34,7 @@
 #include "env/FrontEnd.hpp"
 #include "codegen/LinkageConventionsEnum.hpp"
 #include "compile/Compilation.hpp"
+#include "compile/CompilationStatistics.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
 #include "control/OptimizationPlan.hpp"
@@ -59,7 +60,10 @@
 #include "env/SystemSegmentProvider.hpp"
 #include "env/DebugSegmentProvider.hpp"
 #include "omrformatconsts.h"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
+#include "runtime/AOTCache.hpp"
 #include "runtime/CodeCacheManager.hpp"
+#include "runtime/PerfJitDump.hpp"
 #include "control/CompilationController.hpp"
 
 static void
@@ -145,6 +149,12 @@ int32_t commonJitInit(OMR::FrontEnd &fe, char *cmdLineOptions)
    TR::Compiler->target.cpu.setProcessor(TR_DefaultPPCProcessor);
 
    TR_VerboseLog::initialize(jitConfig);
+   if (TR::Options::getCmdLineOptions()->getOption(TR_PerfJitDump))
+      TR::PerfJitDump::initialize();
+   if (TR::Options::getCmdLineOptions()->getAOTCacheFileName())
+      TR::AOTCache::initialize(TR::Options::getCmdLineOptions()->getAOTCacheFileName(), cmdLineOptions);
+   if (TR::Options::getCmdLineOptions()->getOption(TR_EnableBenefitInliner))
+      TR::InliningMethodSummaryCache::initialize();
    TR::Options::setCanJITCompile(true);
    TR::Options::getCmdLineOptions()->setOption(TR_NoRecompile);
    TR::CompilationController::init(NULL);
@@ -229,6 +239,8 @@ registerTrampoline(uint8_t *start, uint32_t size, const char *name)
    {
    if (TR::Options::getCmdLineOptions()->getOption(TR_PerfTool))
       writePerfToolEntry(start, size, name);
+   if (TR::Options::getCmdLineOptions()->getOption(TR_PerfJitDump))
+      TR::PerfJitDump::recordCodeLoad(name, start, size);
    }
 
 static void
@@ -343,6 +355,7 @@ compileMethodFromDetails(
          }
 
       compiler.setIlVerifier(details.getIlVerifier());
+      compiler.setCompilationStatistics(details.getCompilationStatistics());
 
       if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileStart))
          {
@@ -368,13 +381,25 @@ compileMethodFromDetails(
 
       if (rc == COMPILATION_SUCCEEDED) // success!
          {
-
-         // not ready yet...
-         //OMR::MethodMetaDataPOD *metaData = fe.createMethodMetaData(&compiler);
-
          startPC = (uint8_t*)compiler.getMethodSymbol()->getMethodAddress();
+         fe.createMethodMetaData(&compiler);
          uint64_t translationTime = TR::Compiler->vm.getUSecClock() - translationStartTime;
 
+         TR::CompilationStatistics *statistics = compiler.getCompilationStatistics();
+         if (statistics)
+            {
+            statistics->_compileTime = translationTime;
+            statistics->_codeSize = static_cast<uint32_t>(compiler.cg()->getCodeEnd() - startPC);
+            }
+
+         if (TR::AOTCache::isActive())
+            {
+            TR::AOTCache::storeMethod(&compiler);
+            }
+
+         if (TR::InliningMethodSummaryCache::isActive())
+            TR::InliningMethodSummaryCache::storeMethod(&compiler);
+
          if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileEnd, TR_VerbosePerformance))
             {
             const char *signature = compilee.signature(&trMemory);
@@ -421,6 +446,11 @@ compileMethodFromDetails(
                }
             }
 
+         if (compiler.getOption(TR_PerfJitDump))
+            {
+            TR::PerfJitDump::recordMethodLoad(&compiler, startPC, compiler.cg()->getCodeEnd() - startPC);
+            }
+
          if (compiler.getOutFile() != NULL && compiler.getOption(TR_TraceAll))
             traceMsg((&compiler), "<result success=\"true\" startPC=\"%#p\" time=\"%lld.%lldms\"/>\n",
                                   startPC,
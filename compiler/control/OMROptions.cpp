@@ -124,6 +124,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"alwaysFatalAssert",       "I\tAlways execute fatal assertion for testing purposes",           SET_OPTION_BIT(TR_AlwaysFatalAssert), "F"},
    {"alwaysSafeFatalAssert", "I\tAlways issue a safe fatal assertion for testing purposes",      SET_OPTION_BIT(TR_AlwaysSafeFatal), "F"},
    {"alwaysWorthInliningThreshold=", "O<nnn>\t", TR::Options::set32BitNumeric, offsetof(OMR::Options, _alwaysWorthInliningThreshold), 0, "F%d" },
+   {"aotCacheFile=", "M<filename>\tload compiled code from, and store it in, a persistent AOT cache file",
+        TR::Options::setString, offsetof(OMR::Options, _aotCacheFileName), 0, "P%s", NOT_IN_SUBSET},
    {"aotOnlyFromBootstrap", "O\tahead-of-time compilation allowed only for methods from bootstrap classes",
         SET_OPTION_BIT(TR_AOTCompileOnlyFromBootstrap), "F", NOT_IN_SUBSET },
    {"aotrtDebugLevel=", "R<nnn>\tprint aotrt debug output according to level", TR::Options::set32BitNumeric, offsetof(OMR::Options,_newAotrtDebugLevel), 0, "F%d"},
@@ -189,6 +191,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"compilationThreads=",   "R<nnn>\tnumber of compilation threads to use",
                                TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_numUsableCompilationThreads, 0, "F%d", NOT_IN_SUBSET},
    {"compile",                "D\tCompile these methods immediately. Primarily for use with Compiler.command",  SET_OPTION_BIT(TR_CompileBit),  "F" },
+   {"compileMemoryBudget=", "O<nnn>\tskip or downgrade expensive optimizations once a compilation has allocated nnn KB",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _compileMemoryBudget), 0, "F%d"},
+   {"compileTimeBudget=",   "O<nnn>\tskip or downgrade expensive optimizations that are not expected to finish within nnn ms of the start of optimization",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _compileTimeBudget), 0, "F%d"},
    {"compThreadCPUEntitlement=", "M<nnn>\tThreshold for CPU utilization of compilation threads",
                                TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_compThreadCPUEntitlement, 0, "F%d", NOT_IN_SUBSET },
    {"concurrentLPQ", "M\tCompilations from low priority queue can go in parallel with compilations from main queue", SET_OPTION_BIT(TR_ConcurrentLPQ), "F", NOT_IN_SUBSET },
@@ -415,6 +421,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"disableKnownObjectTable",            "O\tdisable support for including heap object info in symbol references", SET_OPTION_BIT(TR_DisableKnownObjectTable), "F"},
    {"disableLastITableCache",             "C\tdisable using class lastITable cache for interface dispatches",  SET_OPTION_BIT(TR_DisableLastITableCache), "F"},
    {"disableLeafRoutineDetection",        "O\tdisable lleaf routine detection on zlinux", SET_OPTION_BIT(TR_DisableLeafRoutineDetection), "F"},
+   {"disableLinearScanRA",                "O\tdon't assign registers with a linear scan in cold compilations on x86-64", SET_OPTION_BIT(TR_DisableLinearScanRA), "F"},
    {"disableLinkageRegisterAllocation",   "O\tdon't turn parm loads into RegLoads in first basic block",  SET_OPTION_BIT(TR_DisableLinkageRegisterAllocation), "F"},
    {"disableLiveMonitorMetadata",         "O\tdisable the creation of live monitor metadata", SET_OPTION_BIT(TR_DisableLiveMonitorMetadata), "F"},
    {"disableLiveRangeSplitter",          "O\tdisable live range splitter",                    SET_OPTION_BIT(TR_DisableLiveRangeSplitter), "F"},
@@ -708,6 +715,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"enableHardwareProfilerDuringStartup", "O\tenable hardware profiler during startup", RESET_OPTION_BIT(TR_DisableHardwareProfilerDuringStartup), "F", NOT_IN_SUBSET},
    {"enableHardwareProfileRecompilation", "O\tenable hardware profile recompilation", SET_OPTION_BIT(TR_EnableHardwareProfileRecompilation), "F", NOT_IN_SUBSET},
    {"enableHCR",                          "O\tenable hot code replacement", SET_OPTION_BIT(TR_EnableHCR), "F", NOT_IN_SUBSET},
+   {"enableHotCodeCacheLayout",           "O\tplace the code of frequently invoked methods in code caches of their own, apart from the rest of the compiled code", SET_OPTION_BIT(TR_EnableHotCodeCacheLayout), "F"},
 #ifdef J9_PROJECT_SPECIFIC
    {"enableIdiomRecognition",             "O\tenable Idiom Recognition", TR::Options::enableOptimization, idiomRecognition, 0, "P"},
 #endif
@@ -725,6 +733,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"enableJProfiling",                   "O\tenable JProfiling", SET_OPTION_BIT(TR_EnableJProfiling), "F"},
    {"enableJProfilingInProfilingCompilations", "O\tEnable the use of jprofiling instrumentation in profiling compilations", RESET_OPTION_BIT(TR_DisableJProfilingInProfilingCompilations), "F"},
    {"enableLastRetrialLogging",          "O\tenable fullTrace logging for last compilation attempt. Needs to have a log defined on the command line", SET_OPTION_BIT(TR_EnableLastCompilationRetrialLogging), "F"},
+   {"enableLinearScanRA",                 "O\tassign registers with a linear scan at any opt level on x86-64", SET_OPTION_BIT(TR_EnableLinearScanRA), "F"},
    {"enableLocalVPSkipLowFreqBlock",     "O\tSkip processing of low frequency blocks in localVP", SET_OPTION_BIT(TR_EnableLocalVPSkipLowFreqBlock), "F" },
    {"enableLoopEntryAlignment",            "O\tenable loop Entry alignment",                          SET_OPTION_BIT(TR_EnableLoopEntryAlignment), "F"},
    {"enableLoopVersionerCountAllocFences", "O\tallow loop versioner to count allocation fence nodes on PPC toward a profiled guard's block total", SET_OPTION_BIT(TR_EnableLoopVersionerCountAllocationFences), "F"},
@@ -836,6 +845,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"highCodeCacheOccupancyPercentage=", "R<nnn>\tthe percentage at which the code cache is considered to be at high occupancy",
     TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_highCodeCacheOccupancyPercentage, 0, "F%d", NOT_IN_SUBSET},
    {"highOpt",            "O\tdeprecated; equivalent to optLevel=hot", TR::Options::set32BitValue, offsetof(OMR::Options, _optLevel), hot},
+   {"hotCodeCacheInvocationThreshold=", "O<nnn>\twith enableHotCodeCacheLayout, methods invoked at least nnn times before compilation are placed in hot code caches",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _hotCodeCacheInvocationThreshold), 0, "F%d"},
    {"hotFieldReductionAlgorithm=",          "O\tcompilation's hot field combined block frequency reduction algorithm", TR::Options::setHotFieldReductionAlgorithm, 0, 0, "F", NOT_IN_SUBSET},
    {"hotFieldThreshold=", "M<nnn>\t The normalized frequency of a reference to a field to be marked as hot.   Values are 0 to 10000.  Default is 10",
                           TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_hotFieldThreshold, 0, "F%d", NOT_IN_SUBSET},
@@ -1032,6 +1043,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"paintAllocatedFrameSlotsFauxObject",   "C\tpaint all slots allocated in method prologue with faux object pointer",    SET_OPTION_BIT(TR_PaintAllocatedFrameSlotsFauxObject), "F"},
    {"paintDataCacheOnFree",     "I\tpaint data cache allocations that are being returned to the pool", SET_OPTION_BIT(TR_PaintDataCacheOnFree), "F"},
    {"paranoidOptCheck",   "O\tcheck the trees and cfgs after every optimization phase", SET_OPTION_BIT(TR_EnableParanoidOptCheck), "F"},
+   {"perfJitDump", "M\twrite compiled code to a jitdump file for perf inject --jit", SET_OPTION_BIT(TR_PerfJitDump), "F", NOT_IN_SUBSET },
+   {"perfJitDumpDebugInfo", "M\twith perfJitDump, also map the compiled code to bytecode indices", SET_OPTION_BIT(TR_PerfJitDumpDebugInfo), "F" },
    {"performLookaheadAtWarmCold", "O\tallow lookahead to be performed at cold and warm", SET_OPTION_BIT(TR_PerformLookaheadAtWarmCold), "F"},
    {"perfTool", "M\tenable PerfTool", SET_OPTION_BIT(TR_PerfTool), "F", NOT_IN_SUBSET },
    {"poisonDeadSlots",    "O\tpaints all dead slots with deadf00d", SET_OPTION_BIT(TR_PoisonDeadSlots), "F"},
@@ -1116,6 +1129,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
         TR::Options::set32BitNumeric,offsetof(OMR::Options,_test390LitPoolBuffer), 0, "F%d"},
    {"test390StackBufferSize=", "L\tInsert buffer in stack to force testing of large stack sizes",
         TR::Options::set32BitNumeric,offsetof(OMR::Options,_test390StackBuffer), 0, "F%d"},
+   {"tieredBackedgeThreshold=", "O<nnn>\tJitBuilder methods compiled with compileMethodBuilderTiered are recompiled hot after nnn loop back edges",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _tieredBackedgeThreshold), 0, "F%d"},
+   {"tieredInvocationThreshold=", "O<nnn>\tJitBuilder methods compiled with compileMethodBuilderTiered are recompiled hot after nnn invocations",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _tieredInvocationThreshold), 0, "F%d"},
    {"timing", "M\ttime individual phases and optimizations", SET_OPTION_BIT(TR_Timing), "F" },
    {"timingCumulative", "M\ttime cumulative phases (ILgen,Optimizer,codegen)", SET_OPTION_BIT(TR_CummTiming), "F" },
 #if defined(TR_HOST_X86) || defined(TR_HOST_POWER)
@@ -1252,6 +1269,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"traceStripMining",                 "L\ttrace strip mining",                           TR::Options::traceOptimization, stripMining, 0, "P"},
    {"traceStructuralAnalysis",          "L\ttrace structural analysis", SET_OPTION_BIT(TR_TraceSA), "P"},
    {"traceSwitchAnalyzer",              "L\ttrace switch analyzer",                        TR::Options::traceOptimization, switchAnalyzer, 0, "P"},
+   {"traceTailRecursionElimination",    "L\ttrace tail recursion elimination",             TR::Options::traceOptimization, tailRecursionElimination, 0, "P"},
    {"traceTreeCleansing",               "L\ttrace tree cleansing",                         TR::Options::traceOptimization, treesCleansing, 0, "P"},
    {"traceTreePatternMatching",         "L\ttrace the functioning of the TR_Pattern framework", SET_OPTION_BIT(TR_TraceTreePatternMatching), "F"},
    {"traceTrees",                       "L\tdump trees after each compilation phase", SET_OPTION_BIT(TR_TraceTrees), "P" },
@@ -4957,7 +4975,8 @@ const char *OMR::Options::_verboseOptionNames[TR_NumVerboseOptions] =
    "vectorAPI",
    "iprofilerPersistence",
    "CheckpointRestore",
-   "CheckpointRestoreDetails"
+   "CheckpointRestoreDetails",
+   "compileBudget"
    };
 
 
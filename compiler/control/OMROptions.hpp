@@ -239,7 +239,7 @@ enum TR_CompilationOptions
    TR_ExperimentalClassLoadPhase          = 0x00000020 + 5,
    TR_DisableLookahead                    = 0x00000040 + 5,
    TR_TraceBFGeneration                   = 0x00000080 + 5,
-   // Available                           = 0x00000100 + 5,
+   TR_EnableLinearScanRA                  = 0x00000100 + 5,
    TR_SuspendEarly                        = 0x00000200 + 5,
    TR_EnableEarlyCompilationDuringIdleCpu = 0x00000400 + 5,
    TR_DisableCallGraphInlining            = 0x00000800 + 5, // interpreter profiling
@@ -356,7 +356,7 @@ enum TR_CompilationOptions
 
    // Option word 9
    //
-   // Available                           = 0x00000020 + 9,
+   TR_DisableLinearScanRA                 = 0x00000020 + 9,
    // Available                           = 0x00000040 + 9,
    TR_DisableTLHPrefetch                  = 0x00000080 + 9,
    TR_DisableJProfilerThread              = 0x00000100 + 9,
@@ -390,9 +390,9 @@ enum TR_CompilationOptions
    // Available                           = 0x00000040 + 10,
    // Available                           = 0x00000080 + 10,
    TR_FirstLevelProfiling                 = 0x00000100 + 10,
-   // Available                           = 0x00000200 + 10,
-   // Available                           = 0x00000400 + 10,
-   // Available                           = 0x00000800 + 10,
+   TR_EnableHotCodeCacheLayout            = 0x00000200 + 10,
+   TR_PerfJitDump                         = 0x00000400 + 10,
+   TR_PerfJitDumpDebugInfo                = 0x00000800 + 10,
    // Available                           = 0x00001000 + 10,
    TR_DisableNewMethodOverride            = 0x00002000 + 10,
    // Available                           = 0x00004000 + 10,
@@ -1072,6 +1072,7 @@ enum TR_VerboseFlags
    TR_VerboseIProfilerPersistence,
    TR_VerboseCheckpointRestore,
    TR_VerboseCheckpointRestoreDetails,
+   TR_VerboseCompileBudget,
    //If adding new options add an entry to _verboseOptionNames as well
    TR_NumVerboseOptions        // Must be the last one;
    };
@@ -1477,6 +1478,11 @@ public:
       _logListForOtherCompThreads = NULL;
       _induceOSR = NULL;
       _bigCalleeThreshold = 0;
+      _compileTimeBudget = 0;
+      _compileMemoryBudget = 0;
+      _hotCodeCacheInvocationThreshold = 1000;
+      _tieredInvocationThreshold = 1000;
+      _tieredBackedgeThreshold = 10000;
       _bigCalleeThresholdForColdCallsAtWarm = 0;
       _bigCalleeFreqCutoffAtWarm = 0;
       _bigCalleeHotOptThreshold = 0;
@@ -1489,6 +1495,7 @@ public:
       _maxSzForVPInliningWarm = 0;
       _loopyAsyncCheckInsertionMaxEntryFreq = 0;
       _objectFileName = 0;
+      _aotCacheFileName = 0;
       _edoRecompSizeThreshold = 0;
       _edoRecompSizeThresholdInStartupMode = 0;
       _catchBlockCounterThreshold = 0;
@@ -1726,6 +1733,13 @@ public:
 
    char* getInduceOSR()                               {return _induceOSR;}
    int32_t getBigCalleeThreshold() const              {return _bigCalleeThreshold;}
+   int32_t getCompileTimeBudget() const               {return _compileTimeBudget;}
+   void    setCompileTimeBudget(int32_t ms)           {_compileTimeBudget = ms;}
+   int32_t getCompileMemoryBudget() const             {return _compileMemoryBudget;}
+   void    setCompileMemoryBudget(int32_t kb)         {_compileMemoryBudget = kb;}
+   int32_t getHotCodeCacheInvocationThreshold() const {return _hotCodeCacheInvocationThreshold;}
+   int32_t getTieredInvocationThreshold() const       {return _tieredInvocationThreshold;}
+   int32_t getTieredBackedgeThreshold() const         {return _tieredBackedgeThreshold;}
    int32_t getBigCalleeThresholdForColdCallsAtWarm() const  {return _bigCalleeThresholdForColdCallsAtWarm;}
    int32_t getBigCalleeFrequencyCutoffAtWarm() const  {return _bigCalleeFreqCutoffAtWarm;}
    int32_t getBigCalleeHotOptThreshold() const        {return _bigCalleeHotOptThreshold;}
@@ -2018,6 +2032,7 @@ public:
    void disableCHOpts(); // disable CHOpts, but also IPA and prex which depend on the chtable
 
    const char *getObjectFileName() { return _objectFileName; }
+   const char *getAOTCacheFileName() { return _aotCacheFileName; }
 
    /**
     * \brief API to process options post restore (from a checkpoint).
@@ -2497,6 +2512,11 @@ protected:
 
    char*                       _induceOSR;
    int32_t                     _bigCalleeThreshold;
+   int32_t                     _compileTimeBudget;   // in milliseconds, 0 for no limit
+   int32_t                     _compileMemoryBudget; // in KB, 0 for no limit
+   int32_t                     _hotCodeCacheInvocationThreshold;
+   int32_t                     _tieredInvocationThreshold;
+   int32_t                     _tieredBackedgeThreshold;
    int32_t                     _bigCalleeThresholdForColdCallsAtWarm; //for inlining
    int32_t                     _bigCalleeFreqCutoffAtWarm; //for inlining
    int32_t                     _bigCalleeHotOptThreshold; // for inlining
@@ -2511,6 +2531,7 @@ protected:
    int32_t                     _loopyAsyncCheckInsertionMaxEntryFreq;
 
    char *                      _objectFileName; //Name of the relocatable ELF file *.o if one is to be generated
+   char *                      _aotCacheFileName; //Name of the file compiled code is kept in between runs
    int32_t                     _edoRecompSizeThreshold; // Size threshold (in nodes) for candidates to recompilation through EDO
    int32_t                     _edoRecompSizeThresholdInStartupMode; // Size threshold (in nodes) for candidates to recompilation through EDO during startup
    int32_t                     _catchBlockCounterThreshold; // Counter threshold for catch blocks to trigger more aggresive inlining on the throw path
@@ -52,10 +52,10 @@ class TR_Debug;
 class TR_FrontEnd;
 class TR_Memory;
 class TR_ResolvedMethod;
-namespace OMR { struct MethodMetaDataPOD; }
 namespace TR { class Compilation; }
 namespace TR { class Options; }
 namespace TR { class PersistentInfo; }
+namespace TR { struct MethodMetaDataPOD; }
 namespace TR { class ResolvedMethodSymbol; }
 namespace TR { class SymbolReference; }
 struct TR_InlinedCallSite;
@@ -110,7 +110,7 @@ public:
    // --------------------------------------------------------------------------
 
    virtual TR_ResolvedMethod * createResolvedMethod(TR_Memory *, TR_OpaqueMethodBlock *, TR_ResolvedMethod * = 0, TR_OpaqueClassBlock * = 0);
-   virtual OMR::MethodMetaDataPOD *createMethodMetaData(TR::Compilation *comp) { return NULL; }
+   virtual TR::MethodMetaDataPOD *createMethodMetaData(TR::Compilation *comp) { return NULL; }
 
    virtual TR_OpaqueMethodBlock * getMethodFromName(const char *className, const char *methodName, const char *signature);
    virtual uint32_t offsetOfIsOverriddenBit();
@@ -94,6 +94,12 @@ Region::deallocate(void * allocation, size_t) throw()
    {
    }
 
+size_t
+Region::segmentProviderBytesAllocated()
+   {
+   return _segmentProvider.bytesAllocated();
+   }
+
 size_t
 Region::round(size_t bytes)
    {
@@ -162,6 +162,13 @@ public:
       }
 
    size_t bytesAllocated() { return _bytesAllocated; }
+
+   /**
+    * \brief Bytes allocated by the segment provider of this region, for every
+    * region it provides segments to, such as the stack regions of a
+    * compilation as well as its heap region.
+    */
+   size_t segmentProviderBytesAllocated();
    static size_t initialSize() { return INITIAL_SEGMENT_SIZE; }
 private:
    friend class TR::RegionProfiler;
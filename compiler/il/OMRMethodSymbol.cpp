@@ -28,6 +28,7 @@ OMR::MethodSymbol::MethodSymbol(TR_LinkageConventions lc, TR::Method *m) :
    TR::Symbol(),
    _methodAddress(NULL),
    _method(m),
+   _preservedRegisters(0),
    _linkageConvention(lc)
    {
    _flags.setValue(KindMask, IsMethod);
@@ -126,6 +126,8 @@ public:
       HasInstanceOfs                = 0x00000008,
       HasBranches                   = 0x00000010,
       HasVectorAPI                  = 0x00000020,
+      FastHelper                    = 0x00000040, ///< native called with register arguments only, see getPreservedRegisters
+      LeafNative                    = 0x00000080, ///< native that makes no calls and needs no stack alignment
       dummyLastFlag2
       };
 
@@ -154,6 +156,20 @@ public:
    bool preservesAllRegisters()                { return _methodFlags.testAny(PreservesAllRegisters);}
    void setPreservesAllRegisters()             { _methodFlags.set(PreservesAllRegisters);}
 
+   /**
+    * A fast helper is passed all its arguments in registers and leaves the
+    * registers in getPreservedRegisters() unchanged, although its linkage
+    * would let it change them.  Bit n of the mask stands for the register
+    * the target linkage numbers n.  Linkages without support for fast
+    * helpers call them as any other method.
+    */
+   bool isFastHelper()                         { return _methodFlags2.testAny(FastHelper);}
+   void setFastHelper(uint64_t preservedRegisters) { _methodFlags2.set(FastHelper); _preservedRegisters = preservedRegisters;}
+   uint64_t getPreservedRegisters()            { return _preservedRegisters;}
+
+   bool isLeafNative()                         { return _methodFlags2.testAny(LeafNative);}
+   void setLeafNative()                        { _methodFlags2.set(LeafNative);}
+
    bool isSystemLinkageDispatch()              { return _methodFlags.testAny(SystemLinkageDispatch);}
    void setSystemLinkageDispatch()             { _methodFlags.set(SystemLinkageDispatch);}
 
@@ -210,6 +226,8 @@ protected:
 
    flags32_t             _methodFlags2;
 
+   uint64_t              _preservedRegisters;
+
    TR_LinkageConventions _linkageConvention;
 
    };
@@ -5825,6 +5825,28 @@ OMR::Node::chkDesynchronizeCall()
    return self()->getOpCode().isCall() && _flags.testAny(desynchronizeCall);
    }
 
+bool
+OMR::Node::isTailCall()
+   {
+   TR_ASSERT(self()->getOpCode().isCall(), "Opcode must be a call");
+   return _flags.testAny(tailCall);
+   }
+
+void
+OMR::Node::setIsTailCall(bool v)
+   {
+   TR::Compilation * c = TR::comp();
+   TR_ASSERT(self()->getOpCode().isCall(), "Opcode must be a call");
+   if (performNodeTransformation2(c, "O^O NODE FLAGS: Setting tailCall flag on node %p to %d\n", self(), v))
+      _flags.set(tailCall, v);
+   }
+
+bool
+OMR::Node::chkTailCall()
+   {
+   return self()->getOpCode().isCall() && _flags.testAny(tailCall);
+   }
+
 bool
 OMR::Node::isPreparedForDirectJNI()
    {
@@ -1137,6 +1137,10 @@ public:
    void setDesynchronizeCall(bool v);
    bool chkDesynchronizeCall();
 
+   bool isTailCall();
+   void setIsTailCall(bool v);
+   bool chkTailCall();
+
    bool isPreparedForDirectJNI();
    void setPreparedForDirectJNI();
 
@@ -1833,6 +1837,7 @@ protected:
       desynchronizeCall                     = 0x00020000,
       preparedForDirectToJNI                = 0x00040000, // TODO: make J9_PROJECT_SPECIFIC
       unsafeFastPathCall                    = 0x00080000, // TODO: make J9_PROJECT_SPECIFIC
+      tailCall                              = 0x00100000, ///< direct call whose result is returned unchanged
 
       // Flag used by TR::ladd and TR::lsub or by TR::lshl and TR::lshr for compressedPointers
       isCompressionSequence                 = 0x00000800,
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "ilgen/InlineCache.hpp"
+
+#include <stddef.h>
+
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+#include "AtomicSupport.hpp"
+#endif
+
+void
+TR::InlineCache::recordMiss(TR::InlineCache *cache, void *target)
+   {
+   for (int32_t t = 0; t < cache->_capacity; t++)
+      {
+      void *cached = cache->_targets[t];
+      if (cached == NULL)
+         {
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+         cached = (void *)VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&cache->_targets[t], 0, (uintptr_t)target);
+         if (cached == NULL)
+            return;
+#else
+         // without atomics two threads may both claim this slot; one target is lost
+         cache->_targets[t] = target;
+         return;
+#endif
+         }
+
+      if (cached == target)
+         return;
+      }
+   }
+
+int32_t
+TR::InlineCache::getNumTargets()
+   {
+   int32_t numTargets = 0;
+   while (numTargets < _capacity && _targets[numTargets] != NULL)
+      numTargets++;
+   return numTargets;
+   }
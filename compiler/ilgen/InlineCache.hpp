@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TR_INLINECACHE_INCL
+#define TR_INLINECACHE_INCL
+
+#include <stdint.h>
+
+namespace TR
+{
+
+/**
+ * @brief Targets and profile of one call site built with
+ *        IlBuilder::InlineCacheCall
+ *
+ * A cache belongs to the MethodBuilder that built the call site and lives as
+ * long as it does, so it is shared by every compilation of that
+ * MethodBuilder.  Compiled code compares the call's target with the targets
+ * the cache held when the code was generated and calls a matching target
+ * directly, counting a hit for it.  Any other target is a miss: it is counted,
+ * called indirectly and, while the cache has a free slot, recorded by
+ * recordMiss so that the next compilation of the method guards it too.
+ *
+ * Targets are recorded by compiled code on any thread, so a slot is claimed
+ * with a compare and swap and, once set, is never changed.  The counters are
+ * updated without synchronization: a lost increment only skews the profile.
+ */
+struct InlineCache
+   {
+   static const int32_t MAX_TARGETS = 8;
+
+   /**
+    * @brief Record target in the first free slot unless it is already cached.
+    *        Called by compiled code on a miss.
+    */
+   static void recordMiss(InlineCache *cache, void *target);
+
+   /**
+    * @brief Number of targets recorded so far, which are in the first slots.
+    */
+   int32_t getNumTargets();
+
+   int32_t           _capacity;
+   void * volatile   _targets[MAX_TARGETS];
+   volatile int64_t  _hits[MAX_TARGETS];
+   volatile int64_t  _misses;
+   };
+
+} // namespace TR
+
+#endif // !defined(TR_INLINECACHE_INCL)
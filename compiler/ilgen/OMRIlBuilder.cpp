@@ -44,6 +44,8 @@
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlReference.hpp"
+#include "ilgen/InlineCache.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "infra/Cfg.hpp"
@@ -54,6 +56,134 @@
 #define TraceEnabled    (comp()->getOption(TR_TraceILGen))
 #define TraceIL(m, ...) {if (TraceEnabled) {traceMsg(comp(), m, ##__VA_ARGS__);}}
 
+// Recording the services shared by several statements. Every ID a statement
+// refers to is assigned before the statement begins, so a replay reading the
+// statement always finds its operands already defined.
+
+static void
+recordUnaryOp(OMR::JitBuilderRecorder::ServiceScope &recording, TR::IlBuilder *b, const char *s,
+              TR::IlValue *result, TR::IlValue *v)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec == NULL)
+      return;
+   rec->EnsureAvailableID(result);
+   rec->BeginStatement(b, s);
+   rec->Value(result);
+   rec->Value(v);
+   rec->EndStatement();
+   }
+
+static void
+recordBinaryOp(OMR::JitBuilderRecorder::ServiceScope &recording, TR::IlBuilder *b, const char *s,
+               TR::IlValue *result, TR::IlValue *left, TR::IlValue *right)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec == NULL)
+      return;
+   rec->EnsureAvailableID(result);
+   rec->BeginStatement(b, s);
+   rec->Value(result);
+   rec->Value(left);
+   rec->Value(right);
+   rec->EndStatement();
+   }
+
+static void
+recordTypedOp(OMR::JitBuilderRecorder::ServiceScope &recording, TR::TypeDictionary *types, TR::IlBuilder *b, const char *s,
+              TR::IlValue *result, TR::IlType *type, TR::IlValue *v)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec == NULL || !rec->EnsureTypeDefined(types, type))
+      return;
+   rec->EnsureAvailableID(result);
+   rec->BeginStatement(b, s);
+   rec->Value(result);
+   rec->Type(type);
+   rec->Value(v);
+   rec->EndStatement();
+   }
+
+static void
+recordOpWithOverflow(OMR::JitBuilderRecorder::ServiceScope &recording, TR::IlBuilder *b, const char *s,
+                     TR::IlValue *result, TR::IlBuilder *handler, TR::IlValue *left, TR::IlValue *right)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec == NULL)
+      return;
+   rec->EnsureAvailableID(result);
+   rec->EnsureAvailableID(handler);
+   rec->BeginStatement(b, s);
+   rec->Value(result);
+   rec->Builder(handler);
+   rec->Value(left);
+   rec->Value(right);
+   rec->EndStatement();
+   }
+
+static void
+recordIfCmp(OMR::JitBuilderRecorder::ServiceScope &recording, TR::IlBuilder *b, const char *s,
+            TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right = NULL)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec == NULL)
+      return;
+   rec->EnsureBuilderDefined(target);
+   rec->BeginStatement(b, s);
+   rec->Builder(target);
+   rec->Value(left);
+   if (right != NULL)
+      rec->Value(right);
+   rec->EndStatement();
+   }
+
+static void
+recordLoop(OMR::JitBuilderRecorder::ServiceScope &recording, TR::IlBuilder *b, const char *s,
+           const char *whileCondition, TR::IlBuilder *body, TR::IlBuilder **breakBuilder, TR::IlBuilder **continueBuilder)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec == NULL)
+      return;
+   rec->EnsureAvailableID(body);
+   if (breakBuilder)
+      rec->EnsureAvailableID(*breakBuilder);
+   if (continueBuilder)
+      rec->EnsureAvailableID(*continueBuilder);
+   rec->BeginStatement(b, s);
+   rec->String(whileCondition);
+   rec->Builder(body);
+   rec->Builder(breakBuilder ? *breakBuilder : NULL);
+   rec->Builder(continueBuilder ? *continueBuilder : NULL);
+   rec->EndStatement();
+   }
+
+static void
+recordCall(OMR::JitBuilderRecorder::ServiceScope &recording, TR::MethodBuilder *mb, TR::IlBuilder *b, const char *s,
+           TR::IlValue *result, const char *functionName, int32_t numArgs, TR::IlValue **argValues)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec == NULL)
+      return;
+   mb->recordFunction(rec, functionName);
+   if (result != NULL)
+      rec->EnsureAvailableID(result);
+   rec->BeginStatement(b, s);
+   rec->Value(result);
+   rec->String(functionName);
+   rec->Number(numArgs);
+   for (int32_t a = 0; a < numArgs; a++)
+      rec->Value(argValues[a]);
+   rec->EndStatement();
+   }
+
+static void
+recordUnsupported(OMR::JitBuilderRecorder::ServiceScope &recording, TR::IlBuilder *b, const char *s)
+   {
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec != NULL)
+      rec->Unsupported(b, s);
+   }
+
 
 // IlBuilder is a class designed to help build Testarossa IL quickly without
 // a lot of knowledge of the intricacies of commoned references, symbols,
@@ -216,6 +346,18 @@ OMR::IlBuilder::setBCIndex(int32_t bcIndex)
    return static_cast<TR::IlBuilder *>(this);
    }
 
+TR::IlBuilder *
+OMR::IlBuilder::asIlBuilder()
+   {
+   return static_cast<TR::IlBuilder *>(this);
+   }
+
+TR::JitBuilderRecorder *
+OMR::IlBuilder::recorder()
+   {
+   return _methodBuilder->recorder();
+   }
+
 /*
  * Call this function before calling services on this builder so they will
  * mark their IL nodes as having this builder's _bcIndex (very handy when
@@ -282,6 +424,7 @@ OMR::IlBuilder::NewValue(TR::IlType *dt)
 TR::IlValue *
 OMR::IlBuilder::Copy(TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::DataType dt = value->getDataType();
    TR::SymbolReference *newSymRef = symRefTab()->createTemporary(_methodSymbol, dt);
    char *name = (char *) _comp->trMemory()->allocateHeapMemory((2+10+1) * sizeof(char)); // 2 ("_T") + max 10 digits + trailing zero
@@ -296,6 +439,7 @@ OMR::IlBuilder::Copy(TR::IlValue *value)
 
    TraceIL("IlBuilder[ %p ]::Copy value (%d) dataType (%d) to newVal (%d) at cpIndex (%d)\n", this, value->getID(), dt.getDataType(), newVal->getID(), newSymRef->getCPIndex());
 
+   recordUnaryOp(recording, asIlBuilder(), StatementName::STATEMENT_COPY, newVal, value);
    return newVal;
    }
 
@@ -511,9 +655,11 @@ OMR::IlBuilder::OrphanBuilder()
 TR::BytecodeBuilder *
 OMR::IlBuilder::OrphanBytecodeBuilder(int32_t bcIndex, char *name)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::BytecodeBuilder *orphan = new (comp()->trHeapMemory()) TR::BytecodeBuilder(_methodBuilder, bcIndex, name);
    orphan->initialize(_details, _methodSymbol, _fe, _symRefTab);
    orphan->setupForBuildIL();
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_NEWBYTECODEBUILDER);
    return orphan;
    }
 
@@ -569,6 +715,7 @@ OMR::IlBuilder::appendBlock(TR::Block *newBlock, bool addEdge)
 void
 OMR::IlBuilder::AppendBuilder(TR::IlBuilder *builder)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(builder->_partOfSequence == false, "builder cannot be in two places");
 
    builder->_partOfSequence = true;
@@ -585,6 +732,13 @@ OMR::IlBuilder::AppendBuilder(TR::IlBuilder *builder)
    // need to add edge explicitly because of this exit block sleight of hand
    appendNoFallThroughBlock();
    cfg()->addEdge(builder->getExit(), _currentBlock);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureBuilderDefined(builder);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_APPENDBUILDER);
+      rec->Builder(builder);
+      rec->EndStatement();
+      }
    }
 
 TR::Node *
@@ -643,12 +797,20 @@ OMR::IlBuilder::indirectLoadNode(TR::IlType *dt, TR::Node *addr, bool isVectorLo
 void
 OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    if (!_methodBuilder->symbolDefined(varName))
       _methodBuilder->defineValue(varName, _types->PrimitiveType(value->getDataType()));
    TR::SymbolReference *symRef = lookupSymbol(varName);
 
    TraceIL("IlBuilder[ %p ]::Store %s %d (%d) gets %d\n", this, varName, symRef->getCPIndex(), symRef->getReferenceNumber(), value->getID());
    storeNode(symRef, loadValue(value));
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_STORE);
+      rec->String(varName);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -659,8 +821,16 @@ OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
 void
 OMR::IlBuilder::StoreOver(TR::IlValue *dest, TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::StoreOver %d gets %d\n", this, dest->getID(), value->getID());
    dest->storeOver(value, _currentBlock);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_STOREOVER);
+      rec->Value(dest);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -673,6 +843,7 @@ OMR::IlBuilder::StoreOver(TR::IlValue *dest, TR::IlValue *value)
 void
 OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *valueNode = loadValue(value);
    TR::DataType dt = valueNode->getDataType();
    if (!dt.isVector())
@@ -687,6 +858,13 @@ OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
 
    TraceIL("IlBuilder[ %p ]::VectorStore %s %d gets %d\n", this, varName, symRef->getCPIndex(), value->getID());
    storeNode(symRef, valueNode);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_VECTORSTORE);
+      rec->String(varName);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -697,10 +875,18 @@ OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
 void
 OMR::IlBuilder::StoreAt(TR::IlValue *address, TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "StoreAt needs an address operand");
 
    TraceIL("IlBuilder[ %p ]::StoreAt address %d gets %d\n", this, address->getID(), value->getID());
    indirectStoreNode(loadValue(address), loadValue(value));
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_STOREAT);
+      rec->Value(address);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -712,6 +898,7 @@ OMR::IlBuilder::StoreAt(TR::IlValue *address, TR::IlValue *value)
 void
 OMR::IlBuilder::VectorStoreAt(TR::IlValue *address, TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "VectorStoreAt needs an address operand");
 
    TraceIL("IlBuilder[ %p ]::VectorStoreAt address %d gets %d\n", this, address->getID(), value->getID());
@@ -726,11 +913,19 @@ OMR::IlBuilder::VectorStoreAt(TR::IlValue *address, TR::IlValue *value)
       }
 
    indirectStoreNode(loadValue(address), valueNode);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_VECTORSTOREAT);
+      rec->Value(address);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 TR::IlValue *
 OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *elementType)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    uint32_t size = static_cast<uint32_t>(numElements * elementType->getSize());
    TR::SymbolReference *localArraySymRef = symRefTab()->createLocalPrimArray(size,
                                                                              methodSymbol(),
@@ -745,6 +940,16 @@ OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *elementType)
    TR::IlValue *arrayAddressValue = newValue(TR::Address, arrayAddress);
 
    TraceIL("IlBuilder[ %p ]::CreateLocalArray array allocated %d bytes, address in %d\n", this, size, arrayAddressValue->getID());
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec && rec->EnsureTypeDefined(_types, elementType))
+      {
+      rec->EnsureAvailableID(arrayAddressValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CREATELOCALARRAY);
+      rec->Value(arrayAddressValue);
+      rec->Number(numElements);
+      rec->Type(elementType);
+      rec->EndStatement();
+      }
    return arrayAddressValue;
 
    }
@@ -752,6 +957,7 @@ OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *elementType)
 TR::IlValue *
 OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    //similar to CreateLocalArray except writing a method in StructType to get the struct size
    uint32_t size = static_cast<uint32_t>(structType->getSize());
    TR::SymbolReference *localStructSymRef = symRefTab()->createLocalPrimArray(size,
@@ -767,33 +973,46 @@ OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
    TR::IlValue *structAddressValue = newValue(TR::Address, structAddress);
 
    TraceIL("IlBuilder[ %p ]::CreateLocalStruct struct allocated %d bytes, address in %d\n", this, size, structAddressValue->getID());
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_CREATELOCALSTRUCT);
    return structAddressValue;
    }
 
 void
 OMR::IlBuilder::StoreIndirect(const char *type, const char *field, TR::IlValue *object, TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlReference *fieldRef = _types->FieldReference(type, field);
    TR::SymbolReference *symRef = fieldRef->symRef();
    TR::DataType fieldType = symRef->getSymbol()->getDataType();
    TraceIL("IlBuilder[ %p ]::StoreIndirect %s.%s (%d) into (%d)\n", this, type, field, value->getID(), object->getID());
    TR::ILOpCodes storeOp = comp()->il.opCodeForIndirectStore(fieldType);
    genTreeTop(TR::Node::createWithSymRef(storeOp, 2, loadValue(object), loadValue(value), 0, symRef));
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_STOREINDIRECT);
    }
 
 TR::IlValue *
 OMR::IlBuilder::Load(const char *name)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::SymbolReference *symRef = lookupSymbol(name);
    TR::Node *valueNode = TR::Node::createLoad(symRef);
    TR::IlValue *returnValue = newValue(symRef->getSymbol()->getDataType(), valueNode);
    TraceIL("IlBuilder[ %p ]::Load %s into %d from symref %d\n", this, name, returnValue->getID(), symRef->getReferenceNumber());
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_LOAD);
+      rec->Value(returnValue);
+      rec->String(name);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::VectorLoad(const char *name)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::SymbolReference *nameSymRef = lookupSymbol(name);
    TR::DataType returnType = nameSymRef->getSymbol()->getDataType();
    TR_ASSERT_FATAL(returnType.isVector(), "VectorLoad must load symbol with a vector type");
@@ -802,41 +1021,56 @@ OMR::IlBuilder::VectorLoad(const char *name)
    TR::IlValue *returnValue = newValue(returnType, loadNode);
    TraceIL("IlBuilder[ %p ]::%d is VectorLoad %s (%d)\n", this, returnValue->getID(), name, nameSymRef->getCPIndex());
 
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_VECTORLOAD);
+      rec->Value(returnValue);
+      rec->String(name);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::LoadIndirect(const char *type, const char *field, TR::IlValue *object)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlReference *fieldRef = _types->FieldReference(type, field);
    TR::SymbolReference *symRef = fieldRef->symRef();
    TR::DataType fieldType = symRef->getSymbol()->getDataType();
    TR::IlValue *returnValue = newValue(fieldType, TR::Node::createWithSymRef(comp()->il.opCodeForIndirectLoad(fieldType), 1, loadValue(object), 0, symRef));
    TraceIL("IlBuilder[ %p ]::%d is LoadIndirect %s.%s from (%d)\n", this, returnValue->getID(), type, field, object->getID());
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_LOADINDIRECT);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::LoadAt(TR::IlType *dt, TR::IlValue *address)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "LoadAt needs an address operand");
    TR::IlValue *returnValue = indirectLoadNode(dt, loadValue(address));
    TraceIL("IlBuilder[ %p ]::%d is LoadAt type %d address %d\n", this, returnValue->getID(), dt->getPrimitiveType().getDataType(), address->getID());
+   recordTypedOp(recording, _types, asIlBuilder(), StatementName::STATEMENT_LOADAT, returnValue, dt, address);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::VectorLoadAt(TR::IlType *dt, TR::IlValue *address)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "LoadAt needs an address operand");
    TR::IlValue *returnValue = indirectLoadNode(dt, loadValue(address), true);
    TraceIL("IlBuilder[ %p ]::%d is VectorLoadAt type %d address %d\n", this, returnValue->getID(), dt->getPrimitiveType().getDataType(), address->getID());
+   recordTypedOp(recording, _types, asIlBuilder(), StatementName::STATEMENT_VECTORLOADAT, returnValue, dt, address);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlType *elemType = dt->baseType();
    TR_ASSERT_FATAL(base->getDataType() == TR::Address, "IndexAt must be called with a pointer base");
    TR_ASSERT_FATAL(elemType != NULL, "IndexAt should be called with pointer type");
@@ -877,6 +1111,17 @@ OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index)
 
    TraceIL("IlBuilder[ %p ]::%d is IndexAt(%s) base %d index %d\n", this, address->getID(), dt->getName(), base->getID(), index->getID());
 
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec && rec->EnsureTypeDefined(_types, dt))
+      {
+      rec->EnsureAvailableID(address);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_INDEXAT);
+      rec->Value(address);
+      rec->Type(dt);
+      rec->Value(base);
+      rec->Value(index);
+      rec->EndStatement();
+      }
    return address;
    }
 
@@ -889,6 +1134,8 @@ OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index)
  */
 TR::IlValue *
 OMR::IlBuilder::StructFieldInstanceAddress(const char* structName, const char* fieldName, TR::IlValue* obj) {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_STRUCTFIELDINSTANCEADDRESS);
    auto offset = typeDictionary()->OffsetOf(structName, fieldName);
    auto ptype = typeDictionary()->PointerTo(typeDictionary()->GetFieldType(structName, fieldName));
    TR::IlValue* offsetValue = NULL;
@@ -912,6 +1159,8 @@ OMR::IlBuilder::StructFieldInstanceAddress(const char* structName, const char* f
  */
 TR::IlValue *
 OMR::IlBuilder::UnionFieldInstanceAddress(const char* unionName, const char* fieldName, TR::IlValue* obj) {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_UNIONFIELDINSTANCEADDRESS);
    auto ptype = typeDictionary()->PointerTo(typeDictionary()->UnionFieldType(unionName, fieldName));
    return ConvertTo(ptype, obj);
 }
@@ -919,76 +1168,156 @@ OMR::IlBuilder::UnionFieldInstanceAddress(const char* unionName, const char* fie
 TR::IlValue *
 OMR::IlBuilder::NullAddress()
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue = newValue(Address, TR::Node::aconst(0));
    TraceIL("IlBuilder[ %p ]::%d is NullAddress\n", this, returnValue->getID());
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_NULLADDRESS);
+      rec->Value(returnValue);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt8(int8_t value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue = newValue(Int8, TR::Node::bconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt8 %d\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTINT8);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt16(int16_t value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue = newValue(Int16, TR::Node::sconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt16 %d\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTINT16);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt32(int32_t value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue = newValue(Int32, TR::Node::iconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt32 %d\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTINT32);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt64(int64_t value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue = newValue(Int64, TR::Node::lconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt64 %lld\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTINT64);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstFloat(float value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *fconstNode = TR::Node::create(0, TR::fconst, 0);
    fconstNode->setFloat(value);
    TR::IlValue *returnValue = newValue(Float, fconstNode);
    TraceIL("IlBuilder[ %p ]::%d is ConstFloat %f\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTFLOAT);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstDouble(double value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *dconstNode = TR::Node::create(0, TR::dconst, 0);
    dconstNode->setDouble(value);
    TR::IlValue *returnValue = newValue(Double, dconstNode);
    TraceIL("IlBuilder[ %p ]::%d is ConstDouble %lf\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTDOUBLE);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstString(const char * const value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue = newValue(Address, TR::Node::aconst((uintptr_t)value));
    TraceIL("IlBuilder[ %p ]::%d is ConstString %p\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTSTRING);
+      rec->Value(returnValue);
+      rec->String(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstAddress(const void * const value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue = newValue(Address, TR::Node::aconst((uintptr_t)value));
    TraceIL("IlBuilder[ %p ]::%d is ConstAddress %p\n", this, returnValue->getID(), value);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_CONSTADDRESS);
+      rec->Value(returnValue);
+      rec->Location(value);
+      rec->EndStatement();
+      }
    return returnValue;
    }
 
@@ -1007,36 +1336,47 @@ OMR::IlBuilder::ConstInteger(TR::IlType *intType, int64_t value)
 TR::IlValue *
 OMR::IlBuilder::ConvertTo(TR::IlType *t, TR::IlValue *v)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::DataType typeFrom = v->getDataType();
    TR::DataType typeTo = t->getPrimitiveType();
+   TR::IlValue *convertedValue = v;
    if (typeFrom == typeTo)
       {
       TraceIL("IlBuilder[ %p ]::%d is ConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(), v->getID());
-      return v;
       }
-   TR::IlValue *convertedValue = convertTo(typeTo, v, false);
-   TraceIL("IlBuilder[ %p ]::%d is ConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+   else
+      {
+      convertedValue = convertTo(typeTo, v, false);
+      TraceIL("IlBuilder[ %p ]::%d is ConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+      }
+   recordTypedOp(recording, _types, asIlBuilder(), StatementName::STATEMENT_CONVERTTO, convertedValue, t, v);
    return convertedValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedConvertTo(TR::IlType *t, TR::IlValue *v)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::DataType typeFrom = v->getDataType();
    TR::DataType typeTo = t->getPrimitiveType();
+   TR::IlValue *convertedValue = v;
    if (typeFrom == typeTo)
       {
       TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(), v->getID());
-      return v;
       }
-   TR::IlValue *convertedValue = convertTo(typeTo, v, true);
-   TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+   else
+      {
+      convertedValue = convertTo(typeTo, v, true);
+      TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+      }
+   recordTypedOp(recording, _types, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDCONVERTTO, convertedValue, t, v);
    return convertedValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Negate(TR::IlValue *v)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::DataType dataType = v->getDataType();
 
    TR::ILOpCodes negateOp = ILOpCode::negateOpCode(dataType);
@@ -1045,6 +1385,7 @@ OMR::IlBuilder::Negate(TR::IlValue *v)
    TR::Node *result = TR::Node::create(negateOp, 1, loadValue(v));
    TR::IlValue *negatedValue = newValue(dataType, result);
    TraceIL("IlBuilder[ %p ]::%d is Negated %d\n", this, negatedValue->getID(), v->getID());
+   recordUnaryOp(recording, asIlBuilder(), StatementName::STATEMENT_NEGATE, negatedValue, v);
    return negatedValue;
    }
 
@@ -1064,12 +1405,14 @@ OMR::IlBuilder::convertTo(TR::DataType typeTo, TR::IlValue *v, bool needUnsigned
 TR::IlValue*
 OMR::IlBuilder::ConvertBitsTo(TR::IlType* t, TR::IlValue* v)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::DataType typeFrom = v->getDataType();
    TR::DataType typeTo = t->getPrimitiveType();
 
    if (typeTo == typeFrom)
       {
       TraceIL("IlBuilder[ %p ]::%d is ConvertBitsTo (already has type %s) %d\n", this, v->getID(), t->getName(), v->getID());
+      recordTypedOp(recording, _types, asIlBuilder(), StatementName::STATEMENT_CONVERTBITSTO, v, t, v);
       return v;
       }
 
@@ -1082,6 +1425,7 @@ OMR::IlBuilder::ConvertBitsTo(TR::IlType* t, TR::IlValue* v)
    TR::Node *result = TR::Node::create(convertOpcode, 1, loadValue(v));
    TR::IlValue *convertedValue = newValue(t, result);
    TraceIL("IlBuilder[ %p ]::%d is CoerceTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+   recordTypedOp(recording, _types, asIlBuilder(), StatementName::STATEMENT_CONVERTBITSTO, convertedValue, t, v);
    return convertedValue;
    }
 
@@ -1202,8 +1546,10 @@ OMR::IlBuilder::compareOp(TR_ComparisonTypes ct,
 TR::IlValue *
 OMR::IlBuilder::NotEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=compareOp(TR_cmpNE, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is NotEqualTo %d != %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_NOTEQUALTO, returnValue, left, right);
    return returnValue;
    }
 
@@ -1217,15 +1563,24 @@ OMR::IlBuilder::Goto(TR::IlBuilder **dest)
 void
 OMR::IlBuilder::Goto(TR::IlBuilder *dest)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(dest != NULL, "This goto implementation requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::Goto %p\n", this, dest);
    appendGoto(dest->getEntry());
    setDoesNotComeBack();
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureBuilderDefined(dest);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_GOTO);
+      rec->Builder(dest);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::Return()
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlBuilder *returnBuilder = _methodBuilder->returnBuilder();
    if (returnBuilder != NULL)
       {
@@ -1243,11 +1598,17 @@ OMR::IlBuilder::Return()
       cfg()->addEdge(_currentBlock, cfg()->getEnd());
       setDoesNotComeBack();
       }
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_RETURN);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::Return(TR::IlValue *value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlBuilder *returnBuilder = _methodBuilder->returnBuilder();
    if (returnBuilder != NULL)
       {
@@ -1279,11 +1640,19 @@ OMR::IlBuilder::Return(TR::IlValue *value)
       cfg()->addEdge(_currentBlock, cfg()->getEnd());
       setDoesNotComeBack();
       }
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_RETURNVALUE);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 TR::IlValue *
 OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    TR::IlValue *returnValue = NULL;
    if (left->getDataType() == TR::Address)
       {
@@ -1331,6 +1700,7 @@ OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
       returnValue=binaryOpFromOpMap(TR::ILOpCode::subtractOpCode, left, right);
       }
    TraceIL("IlBuilder[ %p ]::%d is Sub %d - %d\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_SUB, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
@@ -1347,6 +1717,8 @@ static TR::ILOpCodes unsignedAddOpCode(TR::DataType type)
 TR::IlValue *
 OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    TR::IlValue *returnValue = NULL;
    if (left->getDataType() == TR::Address)
       {
@@ -1365,6 +1737,7 @@ OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
       returnValue = binaryOpFromOpMap(addOpCode, left, right);
       }
    TraceIL("IlBuilder[ %p ]::%d is Add %d + %d\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_ADD, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
@@ -1472,74 +1845,90 @@ OMR::IlBuilder::getOpCode(TR::IlValue *leftValue, TR::IlValue *rightValue)
 TR::IlValue *
 OMR::IlBuilder::AddWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::ILOpCodes opcode = getOpCode(left, right);
    TR::IlValue *addValue = genOperationWithOverflowCHK(opcode, leftNode, rightNode, handler, TR::OverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is AddWithOverflow %d + %d\n", this, addValue->getID(), left->getID(), right->getID());
+   recordOpWithOverflow(recording, asIlBuilder(), StatementName::STATEMENT_ADDWITHOVERFLOW, addValue, *handler, left, right);
    return addValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::AddWithUnsignedOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::ILOpCodes opcode = getOpCode(left, right);
    TR::IlValue *addValue = genOperationWithOverflowCHK(opcode, leftNode, rightNode, handler, TR::UnsignedOverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is AddWithUnsignedOverflow %d + %d\n", this, addValue->getID(), left->getID(), right->getID());
+   recordOpWithOverflow(recording, asIlBuilder(), StatementName::STATEMENT_ADDWITHUNSIGNEDOVERFLOW, addValue, *handler, left, right);
    return addValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::SubWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::IlValue *subValue = genOperationWithOverflowCHK(TR::ILOpCode::subtractOpCode(leftNode->getDataType()), leftNode, rightNode, handler, TR::OverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is SubWithOverflow %d + %d\n", this, subValue->getID(), left->getID(), right->getID());
+   recordOpWithOverflow(recording, asIlBuilder(), StatementName::STATEMENT_SUBWITHOVERFLOW, subValue, *handler, left, right);
    return subValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::SubWithUnsignedOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::IlValue *unsignedSubValue = genOperationWithOverflowCHK(TR::ILOpCode::subtractOpCode(leftNode->getDataType()), leftNode, rightNode, handler, TR::UnsignedOverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedSubWithOverflow %d + %d\n", this, unsignedSubValue->getID(), left->getID(), right->getID());
+   recordOpWithOverflow(recording, asIlBuilder(), StatementName::STATEMENT_SUBWITHUNSIGNEDOVERFLOW, unsignedSubValue, *handler, left, right);
    return unsignedSubValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::MulWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::IlValue *mulValue = genOperationWithOverflowCHK(TR::ILOpCode::multiplyOpCode(leftNode->getDataType()), leftNode, rightNode, handler, TR::OverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is MulWithOverflow %d + %d\n", this, mulValue->getID(), left->getID(), right->getID());
+   recordOpWithOverflow(recording, asIlBuilder(), StatementName::STATEMENT_MULWITHOVERFLOW, mulValue, *handler, left, right);
    return mulValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Mul(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::multiplyOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Mul %d * %d\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_MUL, returnValue, left, right);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Div(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::divideOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Div %d / %d\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_DIV, returnValue, left, right);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedDiv(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    TR::DataType returnType = left->getDataType();
 
    // There are no opcodes for performing unsigned division on 8-bit or 16-bit
@@ -1554,12 +1943,15 @@ OMR::IlBuilder::UnsignedDiv(TR::IlValue *left, TR::IlValue *right)
    if (returnValue->getDataType() != returnType)
       returnValue = UnsignedConvertTo(_types->PrimitiveType(returnType), returnValue);
 
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDDIV, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    TR::DataType returnType = left->getDataType();
 
    // No code generators currently support the brem or srem opcodes. If we
@@ -1575,12 +1967,15 @@ OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
    if (returnValue->getDataType() != returnType)
       returnValue = ConvertTo(_types->PrimitiveType(returnType), returnValue);
 
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_REM, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedRem(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    TR::DataType returnType = left->getDataType();
    TR::IlValue *returnValue;
 
@@ -1612,30 +2007,37 @@ OMR::IlBuilder::UnsignedRem(TR::IlValue *left, TR::IlValue *right)
    if (returnValue->getDataType() != returnType)
       returnValue = UnsignedConvertTo(_types->PrimitiveType(returnType), returnValue);
 
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDREM, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::And(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::andOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is And %d & %d\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_AND, returnValue, left, right);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Or(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::orOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Or %d | %d\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_OR, returnValue, left, right);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Xor(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::xorOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Xor %d ^ %d\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_XOR, returnValue, left, right);
    return returnValue;
    }
 
@@ -1682,24 +2084,30 @@ OMR::IlBuilder::shiftOpFromOpMap(OpCodeMapper mapOp,
 TR::IlValue *
 OMR::IlBuilder::ShiftL(TR::IlValue *v, TR::IlValue *amount)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=shiftOpFromOpMap(TR::ILOpCode::shiftLeftOpCode, v, amount);
    TraceIL("IlBuilder[ %p ]::%d is shr %d << %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_SHIFTL, returnValue, v, amount);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ShiftR(TR::IlValue *v, TR::IlValue *amount)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=shiftOpFromOpMap(TR::ILOpCode::shiftRightOpCode, v, amount);
    TraceIL("IlBuilder[ %p ]::%d is shr %d >> %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_SHIFTR, returnValue, v, amount);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedShiftR(TR::IlValue *v, TR::IlValue *amount)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=shiftOpFromOpMap(TR::ILOpCode::unsignedShiftRightOpCode, v, amount);
    TraceIL("IlBuilder[ %p ]::%d is unsigned shr %d >> %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDSHIFTR, returnValue, v, amount);
    return returnValue;
    }
 
@@ -1728,6 +2136,7 @@ OMR::IlBuilder::UnsignedShiftR(TR::IlValue *v, TR::IlValue *amount)
 void
 OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFalseBuilder, int32_t numTerms, JBCondition **terms)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlBuilder *mergePoint = OrphanBuilder();
    *allTrueBuilder = createBuilderIfNeeded(*allTrueBuilder);
    *anyFalseBuilder = createBuilderIfNeeded(*anyFalseBuilder);
@@ -1753,6 +2162,7 @@ OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFalseBu
 
    // return state for "this" can get confused by the Goto's in this service
    setComesBack();
+   recordConditions(recording.recorder(), StatementName::STATEMENT_IFAND, *allTrueBuilder, *anyFalseBuilder, numTerms, terms);
    }
 
 /**
@@ -1819,6 +2229,7 @@ OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFalseBu
 void
 OMR::IlBuilder::IfOr(TR::IlBuilder **anyTrueBuilder, TR::IlBuilder **allFalseBuilder, int32_t numTerms, JBCondition **terms)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlBuilder *mergePoint = OrphanBuilder();
    *anyTrueBuilder = createBuilderIfNeeded(*anyTrueBuilder);
    *allFalseBuilder = createBuilderIfNeeded(*allFalseBuilder);
@@ -1850,6 +2261,7 @@ OMR::IlBuilder::IfOr(TR::IlBuilder **anyTrueBuilder, TR::IlBuilder **allFalseBui
 
    // return state for "this" can get confused by the Goto's in this service
    setComesBack();
+   recordConditions(recording.recorder(), StatementName::STATEMENT_IFOR, *anyTrueBuilder, *allFalseBuilder, numTerms, terms);
    }
 
 /**
@@ -1891,6 +2303,27 @@ OMR::IlBuilder::IfOr(TR::IlBuilder **anyTrueBuilder, TR::IlBuilder **allFalseBui
    IfOr(anyTrueBuilder, allFalseBuilder, numTerms, terms);
    }
 
+void
+OMR::IlBuilder::recordConditions(OMR::JitBuilderRecorder *rec, const char *s, TR::IlBuilder *firstBuilder, TR::IlBuilder *secondBuilder, int32_t numTerms, JBCondition **terms)
+   {
+   if (rec == NULL)
+      return;
+   rec->EnsureAvailableID(firstBuilder);
+   rec->EnsureAvailableID(secondBuilder);
+   for (int32_t t = 0; t < numTerms; t++)
+      rec->EnsureBuilderDefined(terms[t]->_builder);
+   rec->BeginStatement(asIlBuilder(), s);
+   rec->Builder(firstBuilder);
+   rec->Builder(secondBuilder);
+   rec->Number(numTerms);
+   for (int32_t t = 0; t < numTerms; t++)
+      {
+      rec->Builder(terms[t]->_builder);
+      rec->Value(terms[t]->_condition);
+      }
+   rec->EndStatement();
+   }
+
 TR::IlBuilder::JBCondition *
 OMR::IlBuilder::MakeCondition(TR::IlBuilder *conditionBuilder, TR::IlValue *conditionValue)
    {
@@ -1902,8 +2335,10 @@ OMR::IlBuilder::MakeCondition(TR::IlBuilder *conditionBuilder, TR::IlValue *cond
 TR::IlValue *
 OMR::IlBuilder::EqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR::IlValue *returnValue=compareOp(TR_cmpEQ, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is EqualTo %d == %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_EQUALTO, returnValue, left, right);
    return returnValue;
    }
 
@@ -1922,72 +2357,96 @@ OMR::IlBuilder::integerizeAddresses(TR::IlValue **leftPtr, TR::IlValue **rightPt
 TR::IlValue *
 OMR::IlBuilder::LessThan(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLT, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is LessThan %d < %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_LESSTHAN, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedLessThan(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLT, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedLessThan %d < %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDLESSTHAN, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::LessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLE, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is LessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_LESSOREQUALTO, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedLessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLE, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedLessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDLESSOREQUALTO, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::GreaterThan(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGT, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is GreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_GREATERTHAN, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedGreaterThan(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGT, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDGREATERTHAN, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::GreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGE, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is GreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_GREATEROREQUALTO, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedGreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *leftArg = left, *rightArg = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGE, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_UNSIGNEDGREATEROREQUALTO, returnValue, leftArg, rightArg);
    return returnValue;
    }
 
@@ -2011,11 +2470,25 @@ OMR::IlBuilder::processCallArgs(TR::Compilation *comp, int numArgs, va_list args
 TR::IlValue *
 OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, ...)
    {
-   TraceIL("IlBuilder[ %p ]::ComputedCall %s\n", this, functionName);
    va_list args;
    va_start(args, numArgs);
    TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
    va_end(args);
+
+   return ComputedCall(functionName, numArgs, argValues);
+   }
+
+/*
+ * \param numArgs
+ *    Number of actual arguments for the method  plus 1
+ * \param argValues
+ *    the computed address followed by the actual arguments
+ */
+TR::IlValue *
+OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, TR::IlValue **argValues)
+   {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TraceIL("IlBuilder[ %p ]::ComputedCall %s\n", this, functionName);
    TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
    if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
       resolvedMethod = _methodBuilder->lookupFunction(functionName);
@@ -2023,7 +2496,26 @@ OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, ...)
 
    TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateComputedStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
    methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-   return genCall(methodSymRef, numArgs, argValues, false /*isDirectCall*/);
+   TR::IlValue *returnValue = genCall(methodSymRef, numArgs, argValues, false /*isDirectCall*/);
+   recordCall(recording, _methodBuilder, asIlBuilder(), StatementName::STATEMENT_COMPUTEDCALL, returnValue, functionName, numArgs, argValues);
+   return returnValue;
+   }
+
+/*
+ * \param numArgs
+ *    Number of actual arguments for the method  plus 1
+ * \param ...
+ *    The list is a computed address followed by the actual arguments
+ */
+TR::IlValue *
+OMR::IlBuilder::InlineCacheCall(const char *functionName, int32_t numCachedTargets, int32_t numArgs, ...)
+   {
+   va_list args;
+   va_start(args, numArgs);
+   TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
+   va_end(args);
+
+   return InlineCacheCall(functionName, numCachedTargets, numArgs, argValues);
    }
 
 /*
@@ -2033,17 +2525,78 @@ OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, ...)
  *    the computed address followed by the actual arguments
  */
 TR::IlValue *
-OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, TR::IlValue **argValues)
+OMR::IlBuilder::InlineCacheCall(const char *functionName, int32_t numCachedTargets, int32_t numArgs, TR::IlValue **argValues)
    {
-   TraceIL("IlBuilder[ %p ]::ComputedCall %s\n", this, functionName);
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TraceIL("IlBuilder[ %p ]::InlineCacheCall %s\n", this, functionName);
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_INLINECACHECALL);
    TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
    if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
       resolvedMethod = _methodBuilder->lookupFunction(functionName);
    TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
+   TR_ASSERT_FATAL(numCachedTargets > 0 && numCachedTargets <= TR::InlineCache::MAX_TARGETS, "InlineCacheCall %s: cannot cache %d targets\n", functionName, numCachedTargets);
 
-   TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateComputedStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-   methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-   return genCall(methodSymRef, numArgs, argValues, false /*isDirectCall*/);
+   TR::InlineCache *cache = _methodBuilder->nextInlineCache(numCachedTargets);
+   int32_t numTargets = cache->getNumTargets();
+   TR::IlValue *target = argValues[0];
+
+   // every target's result is stored into the same temporary
+   char *resultSymbol = NULL;
+   if (resolvedMethod->returnType() != TR::NoType)
+      {
+      TR::SymbolReference *newSymRef = symRefTab()->createTemporary(_methodSymbol, resolvedMethod->returnType());
+      resultSymbol = (char *) _comp->trMemory()->allocateHeapMemory((3+10+1) * sizeof(char)); // 3 ("_IC") + max 10 digits + trailing zero
+      sprintf(resultSymbol, "_IC%u", newSymRef->getCPIndex());
+      newSymRef->getSymbol()->getAutoSymbol()->setName(resultSymbol);
+      newSymRef->getSymbol()->setNotCollected();
+      _methodBuilder->defineSymbol(resultSymbol, newSymRef);
+      }
+
+   TR::IlBuilder *dispatch = asIlBuilder();
+   for (int32_t t = 0; t < numTargets; t++)
+      {
+      void *cachedTarget = cache->_targets[t];
+      TraceIL("IlBuilder[ %p ]::InlineCacheCall guarding cached target %p\n", this, cachedTarget);
+
+      TR::IlBuilder *hit = NULL;
+      TR::IlBuilder *next = NULL;
+      dispatch->IfThenElse(&hit, &next,
+      dispatch->   EqualTo(target,
+      dispatch->      ConstAddress(cachedTarget)));
+
+      _methodBuilder->generateProfilingCounter(hit, &cache->_hits[t]);
+
+      // each target is named apart, since code refers to functions by name
+      char *targetName = (char *) _comp->trMemory()->allocateHeapMemory(strlen(functionName) + 7 + 10 + 1); // "_target" + max 10 digits + trailing zero
+      sprintf(targetName, "%s_target%d", functionName, t);
+      TR::ResolvedMethod *targetMethod = new (_comp->trMemory()->heapMemoryRegion()) TR::ResolvedMethod(
+                                                                                    resolvedMethod->classNameChars(),
+                                                                                    (char *)resolvedMethod->getLineNumber(),
+                                                                                    targetName,
+                                                                                    resolvedMethod->getNumArgs(),
+                                                                                    resolvedMethod->getParmTypes(),
+                                                                                    resolvedMethod->returnIlType(),
+                                                                                    cachedTarget,
+                                                                                    0);
+      TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, targetMethod);
+      methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
+      TR::IlValue *result = hit->genCall(methodSymRef, numArgs - 1, argValues + 1);
+      if (resultSymbol != NULL)
+         hit->Store(resultSymbol, result);
+
+      dispatch = next;
+      }
+
+   _methodBuilder->generateProfilingCounter(dispatch, &cache->_misses);
+   if (numTargets < cache->_capacity)
+      _methodBuilder->generateInlineCacheMiss(dispatch, cache, target);
+   TR::IlValue *result = dispatch->ComputedCall(functionName, numArgs, argValues);
+   if (resultSymbol != NULL)
+      dispatch->Store(resultSymbol, result);
+
+   if (resultSymbol == NULL)
+      return NULL;
+   return Load(resultSymbol);
    }
 
 /*
@@ -2082,7 +2635,9 @@ OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, ...)
 TR::IlValue *
 OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, TR::IlValue **argValues)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::Call %s\n", this, calleeMB->GetMethodName());
+   recordUnsupported(recording, asIlBuilder(), StatementName::STATEMENT_CALL);
 
    // set up callee's inline site index
    calleeMB->setInlineSiteIndex(_methodBuilder->getNextInlineSiteIndex());
@@ -2093,9 +2648,12 @@ OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, TR::IlValue *
 
    // get calleeMB ready to be part of this compilation
    // call initialize on calleeMB in case it has earlier been used outside of this compilation
+   calleeMB->forgetCompilation();
    calleeMB->initialize(_details, _methodSymbol, _fe, _symRefTab);
    // setupBuilderForIL MUST be the OMR::IlBuilder implementation, not the OMR::MethodBuilder one
    calleeMB->OMR::IlBuilder::setupForBuildIL();
+   calleeMB->resetInlineCacheSites();
+   calleeMB->resetFunctionILs();
 
    // store arguments into parameter values
    for (int32_t a=0;a < numArgs;a++)
@@ -2134,24 +2692,22 @@ OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, TR::IlValue *
 TR::IlValue *
 OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, ...)
    {
-   TraceIL("IlBuilder[ %p ]::Call %s\n", this, functionName);
    va_list args;
    va_start(args, numArgs);
    TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
    va_end(args);
-   TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
-   if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
-      resolvedMethod = _methodBuilder->lookupFunction(functionName);
-   TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
 
-   TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-   methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-   return genCall(methodSymRef, numArgs, argValues);
+   return Call(functionName, numArgs, argValues);
    }
 
 TR::IlValue *
 OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR::IlValue ** argValues)
    {
+   TR::MethodBuilder *calleeIL = _methodBuilder->claimFunctionIL(functionName);
+   if (calleeIL != NULL)
+      return Call(calleeIL, numArgs, argValues);
+
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::Call %s\n", this, functionName);
    TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
    if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
@@ -2159,8 +2715,17 @@ OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR::IlValue ** a
    TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
 
    TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-   methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-   return genCall(methodSymRef, numArgs, argValues);
+   TR::MethodSymbol *methodSymbol = methodSymRef->getSymbol()->getMethodSymbol();
+   methodSymbol->setLinkage(TR_System);
+   if (resolvedMethod->isFastHelper())
+      {
+      methodSymbol->setFastHelper(resolvedMethod->getPreservedRegisters());
+      if (resolvedMethod->isLeafHelper())
+         methodSymbol->setLeafNative();
+      }
+   TR::IlValue *returnValue = genCall(methodSymRef, numArgs, argValues);
+   recordCall(recording, _methodBuilder, asIlBuilder(), StatementName::STATEMENT_CALL, returnValue, functionName, numArgs, argValues);
+   return returnValue;
    }
 
 TR::IlValue *
@@ -2210,6 +2775,7 @@ OMR::IlBuilder::genCall(TR::SymbolReference *methodSymRef, int32_t numArgs, TR::
 TR::IlValue *
 OMR::IlBuilder::AtomicAdd(TR::IlValue * baseAddress, TR::IlValue * value)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(baseAddress->getDataType() == TR::Address, "baseAddress must be TR::Address");
 
    //Determine the implementation type and returnType by detecting "value"'s type
@@ -2224,6 +2790,7 @@ OMR::IlBuilder::AtomicAdd(TR::IlValue * baseAddress, TR::IlValue * value)
    callNode->setAndIncChild(1, loadValue(value));
 
    TR::IlValue *returnValue = newValue(callNode->getDataType(), callNode);
+   recordBinaryOp(recording, asIlBuilder(), StatementName::STATEMENT_ATOMICADD, returnValue, baseAddress, value);
    return returnValue;
    }
 
@@ -2301,6 +2868,7 @@ OMR::IlBuilder::AtomicAdd(TR::IlValue * baseAddress, TR::IlValue * value)
 void
 OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuilder **transientFailureBuilder, TR::IlBuilder **transactionBuilder)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    //This assertion is to rule out platforms which don't have tstart evaluator yet.
    TR_ASSERT_FATAL(comp()->cg()->hasTMEvaluator(), "this platform doesn't support tstart or tfinish evaluator yet");
 
@@ -2313,6 +2881,18 @@ OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuil
    *transientFailureBuilder = createBuilderIfNeeded(*transientFailureBuilder);
    *transactionBuilder = createBuilderIfNeeded(*transactionBuilder);
 
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(*persistentFailureBuilder);
+      rec->EnsureAvailableID(*transientFailureBuilder);
+      rec->EnsureAvailableID(*transactionBuilder);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_TRANSACTION);
+      rec->Builder(*persistentFailureBuilder);
+      rec->Builder(*transientFailureBuilder);
+      rec->Builder(*transactionBuilder);
+      rec->EndStatement();
+      }
+
    if (!comp()->cg()->getSupportsTM())
       {
       //if user's processor doesn't support TM.
@@ -2368,10 +2948,16 @@ OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuil
 void
 OMR::IlBuilder::TransactionAbort()
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::transactionAbort", this);
    TR::Node *tAbortNode = TR::Node::create(TR::tabort, 0);
    tAbortNode->setSymbolReference(comp()->getSymRefTab()->findOrCreateTransactionAbortSymbolRef(comp()->getMethodSymbol()));
    genTreeTop(tAbortNode);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_TRANSACTIONABORT);
+      rec->EndStatement();
+      }
    }
 
 void
@@ -2384,9 +2970,11 @@ OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder **target, TR::IlValue *condition
 void
 OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqualZero requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpNotEqualZero %d? -> [ %p ] B%d\n", this, condition->getID(), target, target->getEntry()->getNumber());
    ifCmpNotEqualZero(condition, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPNOTEQUALZERO, target, condition);
    }
 
 void
@@ -2399,9 +2987,11 @@ OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlV
 void
 OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpNotEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpNE, false, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPNOTEQUAL, target, left, right);
    }
 
 void
@@ -2414,9 +3004,11 @@ OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder **target, TR::IlValue *condition)
 void
 OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpEqualZero requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpEqualZero %d == 0? -> [ %p ] B%d\n", this, condition->getID(), target, target->getEntry()->getNumber());
    ifCmpEqualZero(condition, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPEQUALZERO, target, condition);
    }
 
 void
@@ -2429,9 +3021,11 @@ OMR::IlBuilder::IfCmpEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValu
 void
 OMR::IlBuilder::IfCmpEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpEQ, false, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPEQUAL, target, left, right);
    }
 
 void
@@ -2444,9 +3038,11 @@ OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlV
 void
 OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpLessThan requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLT, false, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPLESSTHAN, target, left, right);
    }
 
 void
@@ -2459,9 +3055,11 @@ OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder **target, TR::IlValue *left,
 void
 OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessThan requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLT, true, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPUNSIGNEDLESSTHAN, target, left, right);
    }
 
 void
@@ -2474,9 +3072,11 @@ OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::
 void
 OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpLessOrEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLE, false, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPLESSOREQUAL, target, left, right);
    }
 
 void
@@ -2489,9 +3089,11 @@ OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder **target, TR::IlValue *le
 void
 OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessOrEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLE, true, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPUNSIGNEDLESSOREQUAL, target, left, right);
    }
 
 void
@@ -2504,8 +3106,10 @@ OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder **target, TR::IlValue *left, TR::
 void
 OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGT, false, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPGREATERTHAN, target, left, right);
    }
 
 void
@@ -2518,8 +3122,10 @@ OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder **target, TR::IlValue *le
 void
 OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGT, true, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPUNSIGNEDGREATERTHAN, target, left, right);
    }
 
 void
@@ -2532,8 +3138,10 @@ OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *left, T
 void
 OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGE, false, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPGREATEROREQUAL, target, left, right);
    }
 
 void
@@ -2546,8 +3154,10 @@ OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder **target, TR::IlValue
 void
 OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGE, true, left, right, target->getEntry());
+   recordIfCmp(recording, asIlBuilder(), StatementName::STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL, target, left, right);
    }
 
 void
@@ -2595,6 +3205,7 @@ OMR::IlBuilder::appendGoto(TR::Block *destBlock)
 void
 OMR::IlBuilder::IfThenElse(TR::IlBuilder **thenPath, TR::IlBuilder **elsePath, TR::IlValue *condition)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(thenPath != NULL || elsePath != NULL, "IfThenElse needs at least one conditional path");
 
    TR::Block *thenEntry = NULL;
@@ -2657,6 +3268,18 @@ OMR::IlBuilder::IfThenElse(TR::IlBuilder **thenPath, TR::IlBuilder **elsePath, T
 
    // all paths possibly merge back here
    appendBlock(mergeBlock);
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      TR::IlBuilder *thenBuilder = thenPath ? *thenPath : NULL;
+      TR::IlBuilder *elseBuilder = elsePath ? *elsePath : NULL;
+      rec->EnsureAvailableID(thenBuilder);
+      rec->EnsureAvailableID(elseBuilder);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_IFTHENELSE);
+      rec->Builder(thenBuilder);
+      rec->Builder(elseBuilder);
+      rec->Value(condition);
+      rec->EndStatement();
+      }
    }
 
 void
@@ -2665,6 +3288,7 @@ OMR::IlBuilder::Switch(TR::IlValue *selectorValue,
                   uint32_t numCases,
                   JBCase **cases)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(selectorValue->getDataType() == TR::Int32, "Switch only supports selector having type Int32");
    *defaultBuilder = createBuilderIfNeeded(*defaultBuilder);
 
@@ -2672,6 +3296,7 @@ OMR::IlBuilder::Switch(TR::IlValue *selectorValue,
    TR::Node *lookupNode = TR::Node::create(TR::lookup, numCases + 2, loadValue(selectorValue), defaultNode);
 
    generateSwitchCases(lookupNode, defaultNode, defaultBuilder, numCases, cases);
+   recordSwitch(recording.recorder(), StatementName::STATEMENT_SWITCH, selectorValue, *defaultBuilder, numCases, cases, false);
    }
 
 void
@@ -2695,6 +3320,8 @@ OMR::IlBuilder::TableSwitch(TR::IlValue * selectorValue,
                uint32_t numCases,
                JBCase** cases)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   TR::IlValue *selectorArg = selectorValue;
    TR_ASSERT_FATAL(selectorValue->getDataType() == TR::Int32, "TableSwitch only supports selector having type Int32");
    TR_ASSERT_FATAL(numCases > 0, "TableSwitch requires at least 1 case");
    int32_t low = cases[0]->_value;
@@ -2712,6 +3339,7 @@ OMR::IlBuilder::TableSwitch(TR::IlValue * selectorValue,
        tableNode->setIsSafeToSkipTableBoundCheck(true);
 
    generateSwitchCases(tableNode, defaultNode, defaultBuilder, numCases, cases);
+   recordSwitch(recording.recorder(), StatementName::STATEMENT_TABLESWITCH, selectorArg, *defaultBuilder, numCases, cases, generateBoundsCheck);
    }
 
 void
@@ -2741,6 +3369,7 @@ OMR::IlBuilder::MakeCase(int32_t caseValue, TR::IlBuilder **caseBuilder, int32_t
 TR::IlValue *
 OMR::IlBuilder::Select(TR::IlValue * condition, TR::IlValue * trueValue, TR::IlValue * falseValue)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    TR_ASSERT_FATAL(condition != NULL && trueValue != NULL && falseValue != NULL,
                      "Select requires condition, trueValue and falseValue");
    TR::DataType dt = trueValue->getDataType();
@@ -2766,6 +3395,16 @@ OMR::IlBuilder::Select(TR::IlValue * condition, TR::IlValue * trueValue, TR::IlV
       TR::Node * resultNode = createWithoutSymRef(opCode, 3, conditionNode, ifTrueNode, ifFalseNode);
       result = newValue(dt, resultNode);
       }
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->EnsureAvailableID(result);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_SELECT);
+      rec->Value(result);
+      rec->Value(condition);
+      rec->Value(trueValue);
+      rec->Value(falseValue);
+      rec->EndStatement();
+      }
    return result;
    }
 
@@ -2830,6 +3469,28 @@ OMR::IlBuilder::generateSwitchCases(TR::Node *switchNode, TR::Node *defaultNode,
    AppendBuilder(breakBuilder);
    }
 
+void
+OMR::IlBuilder::recordSwitch(OMR::JitBuilderRecorder *rec, const char *s, TR::IlValue *selectorValue, TR::IlBuilder *defaultBuilder, uint32_t numCases, JBCase **cases, bool generateBoundsCheck)
+   {
+   if (rec == NULL)
+      return;
+   rec->EnsureAvailableID(defaultBuilder);
+   for (auto c = 0U; c < numCases; c++)
+      rec->EnsureBuilderDefined(cases[c]->_builder);
+   rec->BeginStatement(asIlBuilder(), s);
+   rec->Value(selectorValue);
+   rec->Builder(defaultBuilder);
+   rec->Number(static_cast<int32_t>(numCases));
+   for (auto c = 0U; c < numCases; c++)
+      {
+      rec->Number(cases[c]->_value);
+      rec->Builder(cases[c]->_builder);
+      rec->Number(cases[c]->_fallsThrough);
+      }
+   rec->Number(static_cast<int8_t>(generateBoundsCheck));
+   rec->EndStatement();
+   }
+
 void
 OMR::IlBuilder::ForLoop(bool countsUp,
                    const char *indVar,
@@ -2840,6 +3501,7 @@ OMR::IlBuilder::ForLoop(bool countsUp,
                    TR::IlValue *end,
                    TR::IlValue *increment)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    methodSymbol()->setMayHaveLoops(true);
    TR_ASSERT_FATAL(loopCode != NULL, "ForLoop needs to have loopCode builder");
    *loopCode = createBuilderIfNeeded(*loopCode);
@@ -2869,6 +3531,8 @@ OMR::IlBuilder::ForLoop(bool countsUp,
       *continueBuilder = loopContinue;
       }
 
+   _methodBuilder->countBackedge(loopContinue);
+
    if (countsUp)
       {
       loopContinue->Store(indVar,
@@ -2892,11 +3556,31 @@ OMR::IlBuilder::ForLoop(bool countsUp,
 
    // make sure any subsequent operations go into their own block *after* the loop
    appendBlock();
+
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      TR::IlBuilder *breakBody = breakBuilder ? *breakBuilder : NULL;
+      TR::IlBuilder *continueBody = continueBuilder ? *continueBuilder : NULL;
+      rec->EnsureAvailableID(*loopCode);
+      rec->EnsureAvailableID(breakBody);
+      rec->EnsureAvailableID(continueBody);
+      rec->BeginStatement(asIlBuilder(), StatementName::STATEMENT_FORLOOP);
+      rec->Number(static_cast<int8_t>(countsUp));
+      rec->String(indVar);
+      rec->Builder(*loopCode);
+      rec->Builder(breakBody);
+      rec->Builder(continueBody);
+      rec->Value(initial);
+      rec->Value(end);
+      rec->Value(increment);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder, TR::IlBuilder **continueBuilder)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    methodSymbol()->setMayHaveLoops(true);
    TR_ASSERT_FATAL(body != NULL, "doWhileLoop needs to have a body");
 
@@ -2918,6 +3602,7 @@ OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR
       loopContinue = OrphanBuilder();
 
    AppendBuilder(loopContinue);
+   _methodBuilder->countBackedge(loopContinue);
    loopContinue->IfCmpNotEqualZero(body,
    loopContinue->   Load(whileCondition));
 
@@ -2930,11 +3615,13 @@ OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR
 
    // make sure any subsequent operations go into their own block *after* the loop
    appendBlock();
+   recordLoop(recording, asIlBuilder(), StatementName::STATEMENT_DOWHILELOOP, whileCondition, *body, breakBuilder, continueBuilder);
    }
 
 void
 OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder, TR::IlBuilder **continueBuilder)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
    methodSymbol()->setMayHaveLoops(true);
    TR_ASSERT_FATAL(body != NULL, "WhileDo needs to have a body");
    TraceIL("IlBuilder[ %p ]::WhileDoLoop while %s do body %p\n", this, whileCondition, *body);
@@ -2954,6 +3641,7 @@ OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR
       }
 
    AppendBuilder(loopContinue);
+   _methodBuilder->countBackedge(loopContinue);
    loopContinue->IfCmpEqualZero(&done,
    loopContinue->   Load(whileCondition));
 
@@ -2964,6 +3652,7 @@ OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR
    setComesBack(); // this goto is on one particular flow path, doesn't mean every path does a goto
 
    AppendBuilder(done);
+   recordLoop(recording, asIlBuilder(), StatementName::STATEMENT_WHILEDOLOOP, whileCondition, *body, breakBuilder, continueBuilder);
    }
 
 void *
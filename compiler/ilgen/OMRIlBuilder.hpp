@@ -30,12 +30,14 @@
 
 #include "ilgen/IlValue.hpp" // must go after IlInjector.hpp or TR_ALLOC isn't cleaned up
 
+namespace OMR { class JitBuilderRecorder; }
 namespace OMR { class MethodBuilder; }
 
 namespace TR { class Block; }
 namespace TR { class BytecodeBuilder; }
 namespace TR { class IlGeneratorMethodDetails; }
 namespace TR { class IlBuilder; }
+namespace TR { class JitBuilderRecorder; }
 namespace TR { class ResolvedMethodSymbol; } 
 namespace TR { class SymbolReference; }
 namespace TR { class SymbolReferenceTable; }
@@ -199,6 +201,11 @@ public:
 
    virtual bool isBytecodeBuilder()             { return false; }
 
+   /**
+    * @brief the recorder services on this builder are recorded to, or NULL if they are not being recorded
+    */
+   TR::JitBuilderRecorder *recorder();
+
    virtual TR::VirtualMachineState *initialVMState()         { return NULL; }
    virtual TR::VirtualMachineState *vmState()                { return NULL; }
    virtual void setVMState(TR::VirtualMachineState *vmState) { }
@@ -399,6 +406,35 @@ public:
     */
    TR::IlValue *ComputedCall(const char *name, int32_t numArgs, TR::IlValue **args);
 
+   /**
+    * @brief Call a function by address through an inline cache, using a list of arguments
+    * @param name the name of a function defined with the signature of every target
+    * @param numCachedTargets the number of targets the call site caches, at most TR::InlineCache::MAX_TARGETS
+    * @param numArgs the number of actual arguments for the method plus 1
+    * @param ... arguments to pass to the function, provided as TR::IlValue pointers, with the first argument providing the function address
+    * @returns the TR::IlValue corresponding to the called function's return value or NULL if return type is None
+    */
+   TR::IlValue *InlineCacheCall(const char *name, int32_t numCachedTargets, int32_t numArgs, ...);
+
+   /**
+    * @brief Call a function by address through an inline cache, using an array of arguments
+    *
+    * Targets already cached for this call site when the IL is generated are
+    * compared with the function address and called directly; any other
+    * address is called as by ComputedCall and recorded in the cache while it
+    * has room, so that the next compilation of the method calls it directly
+    * too.  The cache and its per-target hit and miss counts are kept by the
+    * MethodBuilder, which identifies a call site by the order in which its
+    * buildIL creates them.
+    *
+    * @param name the name of a function defined with the signature of every target
+    * @param numCachedTargets the number of targets the call site caches, at most TR::InlineCache::MAX_TARGETS
+    * @param numArgs the number of actual arguments for the method plus 1
+    * @param argValues array of arguments to pass to the function, with the first argument providing the function address
+    * @returns the TR::IlValue corresponding to the called function's return value or NULL if return type is None
+    */
+   TR::IlValue *InlineCacheCall(const char *name, int32_t numCachedTargets, int32_t numArgs, TR::IlValue **argValues);
+
    TR::IlValue *genCall(TR::SymbolReference *methodSymRef, int32_t numArgs, TR::IlValue ** paramValues, bool isDirectCall = true);
    void Goto(TR::IlBuilder **dest);
    void Goto(TR::IlBuilder *dest);
@@ -745,6 +781,10 @@ protected:
       return true;
       }
 
+   TR::IlBuilder *asIlBuilder();
+   void recordConditions(OMR::JitBuilderRecorder *rec, const char *s, TR::IlBuilder *firstBuilder, TR::IlBuilder *secondBuilder, int32_t numTerms, JBCondition **terms);
+   void recordSwitch(OMR::JitBuilderRecorder *rec, const char *s, TR::IlValue *selectorValue, TR::IlBuilder *defaultBuilder, uint32_t numCases, JBCase **cases, bool generateBoundsCheck);
+
    TR::SymbolReference *lookupSymbol(const char *name);
    void defineSymbol(const char *name, TR::SymbolReference *v);
    TR::IlValue *newValue(TR::IlType *dt, TR::Node *n=NULL);
@@ -20,6 +20,7 @@
  *******************************************************************************/
 
 #include <stdlib.h>
+#include <mutex>
 
 #include "il/DataTypes.hpp"
 #include "il/SymbolReference.hpp"
@@ -36,6 +37,8 @@
 #include "ilgen/IlType.hpp"
 
 
+static std::mutex clientLock;
+
 const char *
 OMR::IlType::signatureNameForType[TR::NumOMRTypes] =
    {
@@ -137,6 +140,9 @@ OMR::IlType::getSize()
 void *
 OMR::IlType::client()
    {
+   // types of a TypeDictionary are shared by the MethodBuilders using it,
+   // which may be on different threads
+   std::lock_guard<std::mutex> lock(clientLock);
    if (_client == NULL && _clientAllocator != NULL)
       _client = _clientAllocator(static_cast<TR::IlType *>(this));
    return _client;
@@ -19,15 +19,27 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#if defined(_MSC_VER)
+#include <process.h>
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
 #include "infra/Assert.hpp"
+#include "ilgen/IlType.hpp"
 #include "ilgen/JitBuilderRecorder.hpp"
-
-namespace TR { class MethodBuilder; }
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/TypeDictionary.hpp"
 
 OMR::JitBuilderRecorder::JitBuilderRecorder(const TR::MethodBuilder *mb, const char *fileName)
-: _mb(mb), _nextID(0), _idSize(8),  _file(fileName, std::fstream::out | std::fstream::trunc)
+: _mb(mb), _nextID(0), _idSize(8), _nesting(0), _failed(false), _file(fileName, std::fstream::out | std::fstream::trunc)
    {
-   start(); // initializes IDs 0 and 1 (reserved)
+   // special reserved value, must do it first !
+   StoreID(0);
+
+   // another special reserved value, so do it first
+   StoreID((const void *)1);
    }
 
 OMR::JitBuilderRecorder::~JitBuilderRecorder()
@@ -35,21 +47,38 @@ OMR::JitBuilderRecorder::~JitBuilderRecorder()
    }
 
 void
-OMR::JitBuilderRecorder::start()
+OMR::JitBuilderRecorder::Start()
    {
-   // special reserved value, must do it first !
-   StoreID(0);
-
-   // another special reserved value, so do it first
-   StoreID((const void *)1);
-
    String(StatementName::RECORDER_SIGNATURE);
    Number(StatementName::VERSION_MAJOR);
    Number(StatementName::VERSION_MINOR);
    Number(StatementName::VERSION_PATCH);
+   Number(processID());
+   Location(processMark());
    EndStatement();
    }
 
+int32_t
+OMR::JitBuilderRecorder::processID()
+   {
+#if defined(_MSC_VER)
+   return static_cast<int32_t>(_getpid());
+#else
+   return static_cast<int32_t>(getpid());
+#endif
+   }
+
+// The address of a static is only the same in another process when the
+// library is loaded at the same address, and the process ID distinguishes
+// processes that did
+//
+const void *
+OMR::JitBuilderRecorder::processMark()
+   {
+   static const char mark = 0;
+   return &mark;
+   }
+
 void 
 OMR::JitBuilderRecorder::Close()                                       
    { 
@@ -61,24 +90,28 @@ OMR::JitBuilderRecorder::TypeID
 OMR::JitBuilderRecorder::getNewID()
    {
    // support for variable sized ID encoding
-   //  to avoid any synchronization issues in how decoders/encoders count IDs, use a statement to signal change
-   // check if we're close to 8-bit / 16-bit boundary
-   // need to leave space for one ID because these statements will not have been defined yet
-   //  and defining the statement needs an ID!
-   if (_nextID == (1 << 8) - 2)
-      {
-      _idSize = 16;
-      Statement(StatementName::STATEMENT_ID16BIT);
-      }
-   else if (_nextID == (1 << 16) - 2)
-      {
-      _idSize = 32;
-      Statement(StatementName::STATEMENT_ID32BIT);
-      }
+   //  to avoid any synchronization issues in how decoders/encoders count IDs, use a statement to signal change:
+   //  the last ID that fits defines that statement, and every ID written after its definition is wider.
+   //  IDs are only allocated between statements, so the definition cannot split one.
+   if (_idSize == 8 && _nextID == (1 << 8) - 1)
+      widenIDs(StatementName::STATEMENT_ID16BIT, 16);
+   else if (_idSize == 16 && _nextID == (1 << 16) - 1)
+      widenIDs(StatementName::STATEMENT_ID32BIT, 32);
 
    return _nextID++;
    }
 
+void
+OMR::JitBuilderRecorder::widenIDs(const char *s, uint8_t idSize)
+   {
+   _idMap.insert(std::make_pair(static_cast<const void *>(s), _nextID++));
+   Builder(0);
+   Statement(s);
+   String(s);
+   EndStatement();
+   _idSize = idSize;
+   }
+
 OMR::JitBuilderRecorder::TypeID
 OMR::JitBuilderRecorder::myID()
    {
@@ -130,8 +163,9 @@ OMR::JitBuilderRecorder::BeginStatement(const char *s)
    }
 
 void
-OMR::JitBuilderRecorder::BeginStatement(const TR::MethodBuilder *b, const char *s)
+OMR::JitBuilderRecorder::BeginStatement(const TR::IlBuilder *b, const char *s)
    {
+   EnsureBuilderDefined(b);
    ensureStatementDefined(s);
    Builder(b);
    Statement(s);
@@ -156,3 +190,69 @@ OMR::JitBuilderRecorder::EnsureAvailableID(const void *ptr)
    StoreID(ptr);
    return false; // ID was not available, but is now
    }
+
+void
+OMR::JitBuilderRecorder::EnsureBuilderDefined(const TR::IlBuilder *b)
+   {
+   if (b == NULL || EnsureAvailableID(b))
+      return;
+
+   // the method builder is the builder every other one is created from
+   const TR::IlBuilder *mb = _mb;
+   if (b == mb)
+      {
+      BeginStatement(b, StatementName::STATEMENT_NEWMETHODBUILDER);
+      }
+   else
+      {
+      BeginStatement(mb, StatementName::STATEMENT_NEWILBUILDER);
+      Builder(b);
+      }
+   EndStatement();
+   }
+
+bool
+OMR::JitBuilderRecorder::EnsureTypeDefined(TR::TypeDictionary *types, TR::IlType *type)
+   {
+   if (knownID(type))
+      return !_failed;
+
+   if (type->isPointer())
+      {
+      TR::IlType *baseType = type->baseType();
+      if (!EnsureTypeDefined(types, baseType))
+         return false;
+      StoreID(type);
+      BeginStatement(StatementName::STATEMENT_POINTERTYPE);
+      Type(type);
+      Type(baseType);
+      EndStatement();
+      }
+   else if (types->PrimitiveType(type->getPrimitiveType()) == type)
+      {
+      StoreID(type);
+      BeginStatement(StatementName::STATEMENT_PRIMITIVETYPE);
+      Type(type);
+      Number(static_cast<int32_t>(type->getPrimitiveType().getDataType()));
+      EndStatement();
+      }
+   else
+      {
+      StoreID(type);
+      Unsupported(_mb, type->isUnion() ? StatementName::STATEMENT_DEFINEUNION : StatementName::STATEMENT_DEFINESTRUCT);
+      }
+
+   return !_failed;
+   }
+
+void
+OMR::JitBuilderRecorder::Unsupported(const TR::IlBuilder *b, const char *s)
+   {
+   if (_failed)
+      return;
+
+   BeginStatement(b, StatementName::STATEMENT_UNSUPPORTED);
+   String(s);
+   EndStatement();
+   _failed = true;
+   }
@@ -31,6 +31,7 @@ namespace TR { class IlBuilder; }
 namespace TR { class MethodBuilder; }
 namespace TR { class IlType; }
 namespace TR { class IlValue; }
+namespace TR { class TypeDictionary; }
 
 namespace OMR
 {
@@ -42,6 +43,36 @@ class JitBuilderRecorder
    typedef uint32_t                      TypeID;
    typedef std::map<const void *,TypeID> TypeMapID;
 
+   /**
+    * @brief Marks a call to a JitBuilder service for as long as it runs.
+    *
+    * Many services are implemented with other services, which must not be
+    * recorded on their own or they would be replayed twice.  Only the
+    * outermost service gets the recorder, and once a service that cannot be
+    * replayed has been recorded no service gets it.
+    */
+   class ServiceScope
+      {
+      public:
+      ServiceScope(JitBuilderRecorder *rec)
+         : _rec(rec), _outermost(rec != NULL && rec->_nesting++ == 0)
+         { }
+      ~ServiceScope()
+         {
+         if (_rec)
+            _rec->_nesting--;
+         }
+
+      /**
+       * @brief the recorder to record the service to, or NULL if it is not recorded
+       */
+      JitBuilderRecorder *recorder() { return (_outermost && !_rec->_failed) ? _rec : NULL; }
+
+      private:
+      JitBuilderRecorder *_rec;
+      bool                _outermost;
+      };
+
    JitBuilderRecorder(const TR::MethodBuilder *mb, const char *fileName);
    virtual ~JitBuilderRecorder();
 
@@ -49,7 +80,11 @@ class JitBuilderRecorder
 
    /**
     * @brief Subclasses override these functions to record to different output formats
+    *
+    * Start() writes the header of the recording.  It is not called by the
+    * constructor, which would only reach the functions of this class.
     */
+   virtual void Start();
    virtual void Close();
    virtual void String(const char * const string)             { }
    virtual void Number(int8_t num)                            { }
@@ -62,32 +97,63 @@ class JitBuilderRecorder
    virtual void Statement(const char *s)                      { }
    virtual void Type(const TR::IlType *type)                  { }
    virtual void Value(const TR::IlValue *v)                   { }
-   virtual void Builder(const TR::MethodBuilder *b)           { }
+   virtual void Builder(const TR::IlBuilder *b)               { }
    virtual void Builder()                                     { }
    virtual void Location(const void * location)               { }
 
-   virtual void BeginStatement(const TR::MethodBuilder *b, const char *s);
+   virtual void BeginStatement(const TR::IlBuilder *b, const char *s);
    virtual void BeginStatement(const char *s);
    virtual void EndStatement()                                { }
 
    void StoreID(const void *ptr);
    bool EnsureAvailableID(const void *ptr);
 
+   /**
+    * @brief Record a builder the first time it is referred to, since builders
+    *        are created by OrphanBuilder or by the services they are passed to
+    *        rather than by recorded statements
+    */
+   void EnsureBuilderDefined(const TR::IlBuilder *b);
+
+   /**
+    * @brief Record a type the first time it is referred to.  Only primitive
+    *        types and pointers to them can be replayed.
+    * @returns false if the type cannot be replayed, in which case recording has stopped
+    */
+   bool EnsureTypeDefined(TR::TypeDictionary *types, TR::IlType *type);
+
+   /**
+    * @brief Record a statement that cannot be replayed and stop recording.
+    *        Replaying the recording fails when it reaches that statement.
+    */
+   void Unsupported(const TR::IlBuilder *b, const char *s);
+
+   bool hasFailed() { return _failed; }
+
+   /**
+    * @brief Identify the process that makes a recording, which is the only one
+    *        where the addresses it records refer to the same memory and code
+    */
+   static int32_t processID();
+   static const void *processMark();
+
    protected:
 
-   void start();
    bool knownID(const void *ptr);
    TypeID lookupID(const void *ptr);
    void ensureStatementDefined(const char *s);
    void end();
 
    TypeID getNewID();
+   void widenIDs(const char *s, uint8_t idSize);
    TypeID myID();
 
    const TR::MethodBuilder * _mb;
    TypeID                            _nextID;
    TypeMapID                         _idMap;
    uint8_t                           _idSize;
+   int32_t                           _nesting;
+   bool                              _failed;
 
    std::fstream _file;
    
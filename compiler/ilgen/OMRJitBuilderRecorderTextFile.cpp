@@ -21,6 +21,7 @@
 
 #include <stdint.h>
 #include <cstring>
+#include <limits>
 
 #include "infra/Assert.hpp"
 #include "ilgen/JitBuilderRecorderTextFile.hpp"
@@ -28,6 +29,8 @@
 OMR::JitBuilderRecorderTextFile::JitBuilderRecorderTextFile(const TR::MethodBuilder *mb, const char *fileName)
    : TR::JitBuilderRecorder(mb, fileName)
    {
+   // enough digits for floating point constants to be read back exactly
+   _file.precision(std::numeric_limits<double>::max_digits10);
    }
 
 void
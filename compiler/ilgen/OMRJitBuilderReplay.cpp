@@ -0,0 +1,1017 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ilgen/JitBuilderRecorder.hpp"
+#include "ilgen/JitBuilderReplay.hpp"
+#include "ilgen/IlBuilder.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/StatementNames.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+// The statements a recording can be replayed from, in no particular order
+//
+#define REPLAYED_STATEMENTS(S) \
+   S(DEFINENAME) S(DEFINEFILE) S(DEFINELINESTRING) S(DEFINELINENUMBER) S(DEFINEPARAMETER) \
+   S(DEFINEARRAYPARAMETER) S(DEFINERETURNTYPE) S(DEFINELOCAL) S(DEFINEMEMORY) S(DEFINEGLOBAL) \
+   S(DEFINEFUNCTION) S(PRIMITIVETYPE) S(POINTERTYPE) S(NEWMETHODBUILDER) S(ALLLOCALSHAVEBEENDEFINED) \
+   S(NEWILBUILDER) S(UNSUPPORTED) \
+   S(NULLADDRESS) S(CONSTINT8) S(CONSTINT16) S(CONSTINT32) S(CONSTINT64) S(CONSTFLOAT) S(CONSTDOUBLE) \
+   S(CONSTSTRING) S(CONSTADDRESS) S(COPY) \
+   S(ADD) S(SUB) S(MUL) S(DIV) S(UNSIGNEDDIV) S(REM) S(UNSIGNEDREM) S(AND) S(OR) S(XOR) \
+   S(SHIFTL) S(SHIFTR) S(UNSIGNEDSHIFTR) S(NEGATE) S(ATOMICADD) \
+   S(ADDWITHOVERFLOW) S(ADDWITHUNSIGNEDOVERFLOW) S(SUBWITHOVERFLOW) S(SUBWITHUNSIGNEDOVERFLOW) S(MULWITHOVERFLOW) \
+   S(NOTEQUALTO) S(EQUALTO) S(LESSTHAN) S(UNSIGNEDLESSTHAN) S(LESSOREQUALTO) S(UNSIGNEDLESSOREQUALTO) \
+   S(GREATERTHAN) S(UNSIGNEDGREATERTHAN) S(GREATEROREQUALTO) S(UNSIGNEDGREATEROREQUALTO) \
+   S(CONVERTTO) S(UNSIGNEDCONVERTTO) S(CONVERTBITSTO) \
+   S(CREATELOCALARRAY) S(LOAD) S(STORE) S(STOREOVER) S(LOADAT) S(STOREAT) S(INDEXAT) \
+   S(VECTORLOAD) S(VECTORLOADAT) S(VECTORSTORE) S(VECTORSTOREAT) \
+   S(APPENDBUILDER) S(CALL) S(COMPUTEDCALL) S(GOTO) S(RETURN) S(RETURNVALUE) \
+   S(FORLOOP) S(DOWHILELOOP) S(WHILEDOLOOP) S(IFTHENELSE) S(IFAND) S(IFOR) S(SWITCH) S(TABLESWITCH) \
+   S(IFCMPNOTEQUALZERO) S(IFCMPNOTEQUAL) S(IFCMPEQUALZERO) S(IFCMPEQUAL) S(IFCMPLESSTHAN) \
+   S(IFCMPUNSIGNEDLESSTHAN) S(IFCMPLESSOREQUAL) S(IFCMPUNSIGNEDLESSOREQUAL) S(IFCMPGREATERTHAN) \
+   S(IFCMPUNSIGNEDGREATERTHAN) S(IFCMPGREATEROREQUAL) S(IFCMPUNSIGNEDGREATEROREQUAL) \
+   S(SELECT) S(TRANSACTION) S(TRANSACTIONABORT)
+
+namespace
+{
+
+#define REPLAYED_STATEMENT_ENUM(name) name,
+enum ReplayedStatement
+   {
+   REPLAYED_STATEMENTS(REPLAYED_STATEMENT_ENUM)
+   NumReplayedStatements
+   };
+#undef REPLAYED_STATEMENT_ENUM
+
+#define REPLAYED_STATEMENT_NAME(name) OMR::StatementName::STATEMENT_##name,
+const char * const replayedStatementNames[] =
+   {
+   REPLAYED_STATEMENTS(REPLAYED_STATEMENT_NAME)
+   };
+#undef REPLAYED_STATEMENT_NAME
+
+}
+
+// IDs are assigned in order as the recording refers to objects, so a much
+// larger ID than any seen so far can only come from a malformed recording
+//
+#define MAX_ID_GAP (1 << 16)
+
+OMR::JitBuilderReplay::JitBuilderReplay()
+   : _idSize(8),
+   _entries(),
+   _strings(),
+   _ilStart(0),
+   _ilStartIDSize(8),
+   _definitionsReplayed(false),
+   _ilReplayed(false),
+   _recordedHere(false),
+   _failed(false),
+   _errorMessage()
+   {
+   }
+
+bool
+OMR::JitBuilderReplay::replayDefinitions(TR::MethodBuilder *mb)
+   {
+   if (_definitionsReplayed)
+      {
+      fail("definitions have already been replayed");
+      return false;
+      }
+   _definitionsReplayed = true;
+
+   if (!readHeader())
+      return false;
+
+   return replay(mb, true);
+   }
+
+bool
+OMR::JitBuilderReplay::replayIL(TR::MethodBuilder *mb)
+   {
+   if (!_definitionsReplayed)
+      fail("definitions must be replayed before IL");
+   if (_failed)
+      return false;
+
+   // builders and values belong to the compilation that created them
+   if (_ilReplayed)
+      {
+      for (size_t id = 0; id < _entries.size(); id++)
+         {
+         if (_entries[id]._perCompilation)
+            _entries[id]._object = NULL;
+         }
+      }
+
+   setPosition(_ilStart);
+   _idSize = _ilStartIDSize;
+   bool replayed = replay(mb, false);
+   _ilReplayed = true;
+   return replayed;
+   }
+
+const char *
+OMR::JitBuilderReplay::saveString(const char *chars, size_t length)
+   {
+   _strings.push_back(std::string(chars, length));
+   return _strings.back().c_str();
+   }
+
+void
+OMR::JitBuilderReplay::fail(const char *format, ...)
+   {
+   if (_failed)
+      return;
+
+   char message[256];
+   va_list args;
+   va_start(args, format);
+   vsnprintf(message, sizeof(message), format, args);
+   va_end(args);
+
+   _errorMessage = message;
+   _failed = true;
+   }
+
+bool
+OMR::JitBuilderReplay::readHeader()
+   {
+   const char *signature = String();
+   int16_t major = Number16();
+   Number16(); // minor
+   Number16(); // patch
+   int32_t processID = Number32();
+   const void *processMark = Location();
+   _recordedHere = processID == TR::JitBuilderRecorder::processID()
+                   && processMark == TR::JitBuilderRecorder::processMark();
+   if (!_failed && strcmp(signature, StatementName::RECORDER_SIGNATURE) != 0)
+      fail("not a JitBuilder recording");
+   if (!_failed && major != StatementName::VERSION_MAJOR)
+      fail("recording version %d cannot be replayed", major);
+   return !_failed;
+   }
+
+OMR::JitBuilderReplay::Entry &
+OMR::JitBuilderReplay::entry(TypeID id)
+   {
+   if (id >= _entries.size())
+      {
+      if (id - _entries.size() > MAX_ID_GAP)
+         {
+         fail("ID %u out of range", id);
+         id = 0;
+         }
+      else
+         {
+         _entries.resize(id + 1);
+         }
+      }
+   return _entries[id];
+   }
+
+void
+OMR::JitBuilderReplay::bind(TypeID id, void *object, bool perCompilation)
+   {
+   if (id <= 1)
+      {
+      fail("reserved ID %u cannot be defined", id);
+      return;
+      }
+
+   Entry &e = entry(id);
+   e._object = object;
+   e._perCompilation = perCompilation;
+   }
+
+void *
+OMR::JitBuilderReplay::lookup(TypeID id)
+   {
+   if (id == 0)
+      return NULL;
+
+   void *object = entry(id)._object;
+   if (object == NULL || entry(id)._statement != -1)
+      fail("ID %u refers to nothing defined so far", id);
+   return object;
+   }
+
+TR::IlBuilder **
+OMR::JitBuilderReplay::builderOutput(TypeID id, TR::IlBuilder **storage)
+   {
+   // A builder passed by pointer is created by the service unless the
+   // recording defined it before, and it is optional where the ID is 0
+   if (id == 0)
+      return NULL;
+   *storage = static_cast<TR::IlBuilder *>(entry(id)._object);
+   return storage;
+   }
+
+void
+OMR::JitBuilderReplay::defineStatement(TypeID id, const char *name)
+   {
+   if (_failed)
+      return;
+
+   Entry &e = entry(id);
+   e._object = const_cast<char *>(name);
+   e._statement = NumReplayedStatements;
+   for (int32_t s = 0; s < NumReplayedStatements; s++)
+      {
+      if (strcmp(name, replayedStatementNames[s]) == 0)
+         {
+         e._statement = s;
+         break;
+         }
+      }
+
+   // IDs written after these definitions are wider
+   if (strcmp(name, StatementName::STATEMENT_ID16BIT) == 0)
+      _idSize = 16;
+   else if (strcmp(name, StatementName::STATEMENT_ID32BIT) == 0)
+      _idSize = 32;
+   }
+
+bool
+OMR::JitBuilderReplay::isDefinition(int32_t s)
+   {
+   switch (s)
+      {
+      case DEFINENAME:
+      case DEFINEFILE:
+      case DEFINELINESTRING:
+      case DEFINELINENUMBER:
+      case DEFINEPARAMETER:
+      case DEFINEARRAYPARAMETER:
+      case DEFINERETURNTYPE:
+      case DEFINELOCAL:
+      case DEFINEMEMORY:
+      case DEFINEGLOBAL:
+      case DEFINEFUNCTION:
+      case PRIMITIVETYPE:
+      case POINTERTYPE:
+      case NEWMETHODBUILDER:
+      case ALLLOCALSHAVEBEENDEFINED:
+         return true;
+      default:
+         return false;
+      }
+   }
+
+bool
+OMR::JitBuilderReplay::replay(TR::MethodBuilder *mb, bool definitionsOnly)
+   {
+   while (!_failed)
+      {
+      size_t start = position();
+      uint8_t idSize = _idSize;
+
+      TypeID builderID = ID();
+      if (_failed)
+         break;
+
+      if (builderID == 0)
+         {
+         TypeID statementID = ID();
+         const char *name = String();
+         defineStatement(statementID, name);
+         continue;
+         }
+
+      if (builderID == 1)
+         {
+         const char *complete = String();
+         if (!_failed && strcmp(complete, StatementName::JBIL_COMPLETE) != 0)
+            fail("recording is not complete");
+         if (definitionsOnly)
+            {
+            _ilStart = start;
+            _ilStartIDSize = idSize;
+            }
+         break;
+         }
+
+      TypeID statementID = ID();
+      int32_t s = entry(statementID)._statement;
+      if (_failed)
+         break;
+      if (s == -1)
+         {
+         fail("ID %u is not a statement", statementID);
+         break;
+         }
+      if (s == NumReplayedStatements)
+         {
+         fail("statement %s cannot be replayed", static_cast<const char *>(entry(statementID)._object));
+         break;
+         }
+
+      if (definitionsOnly && !isDefinition(s))
+         {
+         _ilStart = start;
+         _ilStartIDSize = idSize;
+         break;
+         }
+
+      if (s == NEWMETHODBUILDER)
+         {
+         bind(builderID, static_cast<TR::IlBuilder *>(mb));
+         continue;
+         }
+
+      TR::IlBuilder *b = static_cast<TR::IlBuilder *>(lookup(builderID));
+      if (!_failed)
+         replayStatement(mb, b, s);
+      }
+
+   return !_failed;
+   }
+
+void
+OMR::JitBuilderReplay::replayStatement(TR::MethodBuilder *mb, TR::IlBuilder *b, int32_t s)
+   {
+   TR::TypeDictionary *types = mb->typeDictionary();
+
+   switch (s)
+      {
+      // definitions, which the MethodBuilder keeps across compilations
+
+      case DEFINENAME:
+         {
+         const char *name = String();
+         if (!_failed)
+            mb->DefineName(name);
+         break;
+         }
+      case DEFINEFILE:
+         {
+         const char *file = String();
+         if (!_failed)
+            mb->DefineFile(file);
+         break;
+         }
+      case DEFINELINESTRING:
+         {
+         const char *line = String();
+         if (!_failed)
+            mb->DefineLine(line);
+         break;
+         }
+      case DEFINELINENUMBER:
+         {
+         int32_t line = Number32();
+         if (!_failed)
+            mb->DefineLine(line);
+         break;
+         }
+      case DEFINEPARAMETER:
+      case DEFINEARRAYPARAMETER:
+         {
+         const char *name = String();
+         TR::IlType *type = Type();
+         if (_failed)
+            break;
+         if (s == DEFINEPARAMETER)
+            mb->DefineParameter(name, type);
+         else
+            mb->DefineArrayParameter(name, type);
+         break;
+         }
+      case DEFINERETURNTYPE:
+         {
+         TR::IlType *type = Type();
+         if (!_failed)
+            mb->DefineReturnType(type);
+         break;
+         }
+      case DEFINELOCAL:
+         {
+         const char *name = String();
+         TR::IlType *type = Type();
+         if (!_failed && !_ilReplayed)
+            mb->DefineLocal(name, type);
+         break;
+         }
+      case DEFINEMEMORY:
+      case DEFINEGLOBAL:
+         {
+         const char *name = String();
+         TR::IlType *type = Type();
+         void *location = Location();
+         if (_failed || _ilReplayed)
+            break;
+         if (!_recordedHere)
+            {
+            fail("%s %s refers to the process that recorded it", s == DEFINEMEMORY ? "memory" : "global", name);
+            break;
+            }
+         if (s == DEFINEMEMORY)
+            mb->DefineMemory(name, type, location);
+         else
+            mb->DefineGlobal(name, type, location);
+         break;
+         }
+      case DEFINEFUNCTION:
+         replayFunction(mb);
+         break;
+      case PRIMITIVETYPE:
+         {
+         TypeID id = ID();
+         int32_t dt = Number32();
+         if (_failed)
+            break;
+         if (dt < 0 || dt >= TR::NumAllTypes)
+            fail("unknown primitive type %d", dt);
+         else
+            bind(id, types->PrimitiveType(static_cast<TR::DataTypes>(dt)));
+         break;
+         }
+      case POINTERTYPE:
+         {
+         TypeID id = ID();
+         TR::IlType *baseType = Type();
+         if (!_failed)
+            bind(id, types->PointerTo(baseType));
+         break;
+         }
+      case ALLLOCALSHAVEBEENDEFINED:
+         mb->AllLocalsHaveBeenDefined();
+         break;
+
+      // IL
+
+      case NEWILBUILDER:
+         {
+         TypeID id = ID();
+         if (!_failed)
+            bind(id, b->OrphanBuilder(), true);
+         break;
+         }
+      case UNSUPPORTED:
+         {
+         const char *service = String();
+         if (!_failed)
+            fail("recording stopped at %s, which cannot be replayed", service);
+         break;
+         }
+
+      case NULLADDRESS:
+         {
+         TypeID id = ID();
+         if (!_failed)
+            bind(id, b->NullAddress(), true);
+         break;
+         }
+      case CONSTINT8:
+         {
+         TypeID id = ID();
+         int8_t value = Number8();
+         if (!_failed)
+            bind(id, b->ConstInt8(value), true);
+         break;
+         }
+      case CONSTINT16:
+         {
+         TypeID id = ID();
+         int16_t value = Number16();
+         if (!_failed)
+            bind(id, b->ConstInt16(value), true);
+         break;
+         }
+      case CONSTINT32:
+         {
+         TypeID id = ID();
+         int32_t value = Number32();
+         if (!_failed)
+            bind(id, b->ConstInt32(value), true);
+         break;
+         }
+      case CONSTINT64:
+         {
+         TypeID id = ID();
+         int64_t value = Number64();
+         if (!_failed)
+            bind(id, b->ConstInt64(value), true);
+         break;
+         }
+      case CONSTFLOAT:
+         {
+         TypeID id = ID();
+         float value = NumberFloat();
+         if (!_failed)
+            bind(id, b->ConstFloat(value), true);
+         break;
+         }
+      case CONSTDOUBLE:
+         {
+         TypeID id = ID();
+         double value = NumberDouble();
+         if (!_failed)
+            bind(id, b->ConstDouble(value), true);
+         break;
+         }
+      case CONSTSTRING:
+         {
+         TypeID id = ID();
+         const char *value = String();
+         if (!_failed)
+            bind(id, b->ConstString(value), true);
+         break;
+         }
+      case CONSTADDRESS:
+         {
+         TypeID id = ID();
+         void *value = Location();
+         if (!_failed && value != NULL && !_recordedHere)
+            fail("constant address %p refers to the process that recorded it", value);
+         if (!_failed)
+            bind(id, b->ConstAddress(value), true);
+         break;
+         }
+      case COPY:
+      case NEGATE:
+         {
+         TypeID id = ID();
+         TR::IlValue *v = Value();
+         if (!_failed)
+            bind(id, (s == COPY) ? b->Copy(v) : b->Negate(v), true);
+         break;
+         }
+
+      case ADD:                         replayBinaryOp(b, &OMR::IlBuilder::Add); break;
+      case SUB:                         replayBinaryOp(b, &OMR::IlBuilder::Sub); break;
+      case MUL:                         replayBinaryOp(b, &OMR::IlBuilder::Mul); break;
+      case DIV:                         replayBinaryOp(b, &OMR::IlBuilder::Div); break;
+      case UNSIGNEDDIV:                 replayBinaryOp(b, &OMR::IlBuilder::UnsignedDiv); break;
+      case REM:                         replayBinaryOp(b, &OMR::IlBuilder::Rem); break;
+      case UNSIGNEDREM:                 replayBinaryOp(b, &OMR::IlBuilder::UnsignedRem); break;
+      case AND:                         replayBinaryOp(b, &OMR::IlBuilder::And); break;
+      case OR:                          replayBinaryOp(b, &OMR::IlBuilder::Or); break;
+      case XOR:                         replayBinaryOp(b, &OMR::IlBuilder::Xor); break;
+      case SHIFTL:                      replayBinaryOp(b, &OMR::IlBuilder::ShiftL); break;
+      case SHIFTR:                      replayBinaryOp(b, &OMR::IlBuilder::ShiftR); break;
+      case UNSIGNEDSHIFTR:              replayBinaryOp(b, &OMR::IlBuilder::UnsignedShiftR); break;
+      case ATOMICADD:                   replayBinaryOp(b, &OMR::IlBuilder::AtomicAdd); break;
+      case NOTEQUALTO:                  replayBinaryOp(b, &OMR::IlBuilder::NotEqualTo); break;
+      case EQUALTO:                     replayBinaryOp(b, &OMR::IlBuilder::EqualTo); break;
+      case LESSTHAN:                    replayBinaryOp(b, &OMR::IlBuilder::LessThan); break;
+      case UNSIGNEDLESSTHAN:            replayBinaryOp(b, &OMR::IlBuilder::UnsignedLessThan); break;
+      case LESSOREQUALTO:               replayBinaryOp(b, &OMR::IlBuilder::LessOrEqualTo); break;
+      case UNSIGNEDLESSOREQUALTO:       replayBinaryOp(b, &OMR::IlBuilder::UnsignedLessOrEqualTo); break;
+      case GREATERTHAN:                 replayBinaryOp(b, &OMR::IlBuilder::GreaterThan); break;
+      case UNSIGNEDGREATERTHAN:         replayBinaryOp(b, &OMR::IlBuilder::UnsignedGreaterThan); break;
+      case GREATEROREQUALTO:            replayBinaryOp(b, &OMR::IlBuilder::GreaterOrEqualTo); break;
+      case UNSIGNEDGREATEROREQUALTO:    replayBinaryOp(b, &OMR::IlBuilder::UnsignedGreaterOrEqualTo); break;
+
+      case ADDWITHOVERFLOW:             replayOpWithOverflow(b, &OMR::IlBuilder::AddWithOverflow); break;
+      case ADDWITHUNSIGNEDOVERFLOW:     replayOpWithOverflow(b, &OMR::IlBuilder::AddWithUnsignedOverflow); break;
+      case SUBWITHOVERFLOW:             replayOpWithOverflow(b, &OMR::IlBuilder::SubWithOverflow); break;
+      case SUBWITHUNSIGNEDOVERFLOW:     replayOpWithOverflow(b, &OMR::IlBuilder::SubWithUnsignedOverflow); break;
+      case MULWITHOVERFLOW:             replayOpWithOverflow(b, &OMR::IlBuilder::MulWithOverflow); break;
+
+      case CONVERTTO:                   replayTypedOp(b, &OMR::IlBuilder::ConvertTo); break;
+      case UNSIGNEDCONVERTTO:           replayTypedOp(b, &OMR::IlBuilder::UnsignedConvertTo); break;
+      case CONVERTBITSTO:               replayTypedOp(b, &OMR::IlBuilder::ConvertBitsTo); break;
+      case LOADAT:                      replayTypedOp(b, &OMR::IlBuilder::LoadAt); break;
+      case VECTORLOADAT:                replayTypedOp(b, &OMR::IlBuilder::VectorLoadAt); break;
+
+      case IFCMPNOTEQUALZERO:           replayIfCmpZero(b, &OMR::IlBuilder::IfCmpNotEqualZero); break;
+      case IFCMPEQUALZERO:              replayIfCmpZero(b, &OMR::IlBuilder::IfCmpEqualZero); break;
+      case IFCMPNOTEQUAL:               replayIfCmp(b, &OMR::IlBuilder::IfCmpNotEqual); break;
+      case IFCMPEQUAL:                  replayIfCmp(b, &OMR::IlBuilder::IfCmpEqual); break;
+      case IFCMPLESSTHAN:               replayIfCmp(b, &OMR::IlBuilder::IfCmpLessThan); break;
+      case IFCMPUNSIGNEDLESSTHAN:       replayIfCmp(b, &OMR::IlBuilder::IfCmpUnsignedLessThan); break;
+      case IFCMPLESSOREQUAL:            replayIfCmp(b, &OMR::IlBuilder::IfCmpLessOrEqual); break;
+      case IFCMPUNSIGNEDLESSOREQUAL:    replayIfCmp(b, &OMR::IlBuilder::IfCmpUnsignedLessOrEqual); break;
+      case IFCMPGREATERTHAN:            replayIfCmp(b, &OMR::IlBuilder::IfCmpGreaterThan); break;
+      case IFCMPUNSIGNEDGREATERTHAN:    replayIfCmp(b, &OMR::IlBuilder::IfCmpUnsignedGreaterThan); break;
+      case IFCMPGREATEROREQUAL:         replayIfCmp(b, &OMR::IlBuilder::IfCmpGreaterOrEqual); break;
+      case IFCMPUNSIGNEDGREATEROREQUAL: replayIfCmp(b, &OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual); break;
+
+      case CREATELOCALARRAY:
+         {
+         TypeID id = ID();
+         int32_t numElements = Number32();
+         TR::IlType *elementType = Type();
+         if (!_failed)
+            bind(id, b->CreateLocalArray(numElements, elementType), true);
+         break;
+         }
+      case LOAD:
+      case VECTORLOAD:
+         {
+         TypeID id = ID();
+         const char *name = String();
+         if (!_failed)
+            bind(id, (s == LOAD) ? b->Load(name) : b->VectorLoad(name), true);
+         break;
+         }
+      case STORE:
+      case VECTORSTORE:
+         {
+         const char *name = String();
+         TR::IlValue *value = Value();
+         if (_failed)
+            break;
+         if (s == STORE)
+            b->Store(name, value);
+         else
+            b->VectorStore(name, value);
+         break;
+         }
+      case STOREOVER:
+      case STOREAT:
+      case VECTORSTOREAT:
+         {
+         TR::IlValue *dest = Value();
+         TR::IlValue *value = Value();
+         if (_failed)
+            break;
+         if (s == STOREOVER)
+            b->StoreOver(dest, value);
+         else if (s == STOREAT)
+            b->StoreAt(dest, value);
+         else
+            b->VectorStoreAt(dest, value);
+         break;
+         }
+      case INDEXAT:
+         {
+         TypeID id = ID();
+         TR::IlType *dt = Type();
+         TR::IlValue *base = Value();
+         TR::IlValue *index = Value();
+         if (!_failed)
+            bind(id, b->IndexAt(dt, base, index), true);
+         break;
+         }
+      case SELECT:
+         {
+         TypeID id = ID();
+         TR::IlValue *condition = Value();
+         TR::IlValue *trueValue = Value();
+         TR::IlValue *falseValue = Value();
+         if (!_failed)
+            bind(id, b->Select(condition, trueValue, falseValue), true);
+         break;
+         }
+
+      case APPENDBUILDER:
+         {
+         TR::IlBuilder *builder = Builder();
+         if (!_failed)
+            b->AppendBuilder(builder);
+         break;
+         }
+      case GOTO:
+         {
+         TR::IlBuilder *dest = Builder();
+         if (!_failed)
+            b->Goto(dest);
+         break;
+         }
+      case RETURN:
+         b->Return();
+         break;
+      case RETURNVALUE:
+         {
+         TR::IlValue *value = Value();
+         if (!_failed)
+            b->Return(value);
+         break;
+         }
+      case CALL:
+      case COMPUTEDCALL:
+         replayCall(b, s == COMPUTEDCALL);
+         break;
+
+      case IFTHENELSE:
+         {
+         TypeID thenID = ID();
+         TypeID elseID = ID();
+         TR::IlValue *condition = Value();
+         if (_failed)
+            break;
+         TR::IlBuilder *thenBuilder, *elseBuilder;
+         TR::IlBuilder **thenPath = builderOutput(thenID, &thenBuilder);
+         TR::IlBuilder **elsePath = builderOutput(elseID, &elseBuilder);
+         b->IfThenElse(thenPath, elsePath, condition);
+         if (thenPath)
+            bind(thenID, thenBuilder, true);
+         if (elsePath)
+            bind(elseID, elseBuilder, true);
+         break;
+         }
+      case FORLOOP:
+         {
+         bool countsUp = Number8() != 0;
+         const char *indVar = String();
+         TypeID loopID = ID();
+         TypeID breakID = ID();
+         TypeID continueID = ID();
+         TR::IlValue *initial = Value();
+         TR::IlValue *end = Value();
+         TR::IlValue *increment = Value();
+         if (_failed)
+            break;
+         TR::IlBuilder *loopBuilder, *breakBuilder, *continueBuilder;
+         TR::IlBuilder **loopCode = builderOutput(loopID, &loopBuilder);
+         TR::IlBuilder **breakBody = builderOutput(breakID, &breakBuilder);
+         TR::IlBuilder **continueBody = builderOutput(continueID, &continueBuilder);
+         if (loopCode == NULL)
+            {
+            fail("ForLoop without a loop body");
+            break;
+            }
+         b->ForLoop(countsUp, indVar, loopCode, breakBody, continueBody, initial, end, increment);
+         bind(loopID, loopBuilder, true);
+         if (breakBody)
+            bind(breakID, breakBuilder, true);
+         if (continueBody)
+            bind(continueID, continueBuilder, true);
+         break;
+         }
+      case DOWHILELOOP:
+      case WHILEDOLOOP:
+         replayLoop(b, s == DOWHILELOOP);
+         break;
+      case IFAND:
+      case IFOR:
+         replayConditions(b, s == IFAND);
+         break;
+      case SWITCH:
+      case TABLESWITCH:
+         replaySwitch(b, s == TABLESWITCH);
+         break;
+      case TRANSACTION:
+         {
+         TypeID persistentID = ID();
+         TypeID transientID = ID();
+         TypeID transactionID = ID();
+         if (_failed)
+            break;
+         TR::IlBuilder *persistentBuilder, *transientBuilder, *transactionBuilder;
+         TR::IlBuilder **persistentFailure = builderOutput(persistentID, &persistentBuilder);
+         TR::IlBuilder **transientFailure = builderOutput(transientID, &transientBuilder);
+         TR::IlBuilder **transaction = builderOutput(transactionID, &transactionBuilder);
+         if (persistentFailure == NULL || transientFailure == NULL || transaction == NULL)
+            {
+            fail("Transaction without its builders");
+            break;
+            }
+         b->Transaction(persistentFailure, transientFailure, transaction);
+         bind(persistentID, persistentBuilder, true);
+         bind(transientID, transientBuilder, true);
+         bind(transactionID, transactionBuilder, true);
+         break;
+         }
+      case TRANSACTIONABORT:
+         b->TransactionAbort();
+         break;
+
+      default:
+         fail("statement %s cannot be replayed", replayedStatementNames[s]);
+         break;
+      }
+   }
+
+void
+OMR::JitBuilderReplay::replayBinaryOp(TR::IlBuilder *b, BinaryOp op)
+   {
+   TypeID id = ID();
+   TR::IlValue *left = Value();
+   TR::IlValue *right = Value();
+   if (!_failed)
+      bind(id, (b->*op)(left, right), true);
+   }
+
+void
+OMR::JitBuilderReplay::replayTypedOp(TR::IlBuilder *b, TypedOp op)
+   {
+   TypeID id = ID();
+   TR::IlType *type = Type();
+   TR::IlValue *v = Value();
+   if (!_failed)
+      bind(id, (b->*op)(type, v), true);
+   }
+
+void
+OMR::JitBuilderReplay::replayOpWithOverflow(TR::IlBuilder *b, OpWithOverflow op)
+   {
+   TypeID id = ID();
+   TypeID handlerID = ID();
+   TR::IlValue *left = Value();
+   TR::IlValue *right = Value();
+   if (_failed)
+      return;
+
+   TR::IlBuilder *handlerBuilder;
+   TR::IlBuilder **handler = builderOutput(handlerID, &handlerBuilder);
+   if (handler == NULL)
+      {
+      fail("operation with overflow without a handler");
+      return;
+      }
+   bind(id, (b->*op)(handler, left, right), true);
+   bind(handlerID, handlerBuilder, true);
+   }
+
+void
+OMR::JitBuilderReplay::replayIfCmp(TR::IlBuilder *b, IfCmpOp op)
+   {
+   TR::IlBuilder *target = Builder();
+   TR::IlValue *left = Value();
+   TR::IlValue *right = Value();
+   if (!_failed)
+      (b->*op)(target, left, right);
+   }
+
+void
+OMR::JitBuilderReplay::replayIfCmpZero(TR::IlBuilder *b, IfCmpZeroOp op)
+   {
+   TR::IlBuilder *target = Builder();
+   TR::IlValue *condition = Value();
+   if (!_failed)
+      (b->*op)(target, condition);
+   }
+
+void
+OMR::JitBuilderReplay::replayCall(TR::IlBuilder *b, bool computed)
+   {
+   TypeID id = ID();
+   const char *name = String();
+   int32_t numArgs = Number32();
+   if (!_failed && (numArgs < 0 || numArgs > MAX_ID_GAP))
+      fail("call to %s with %d arguments", name, numArgs);
+
+   std::vector<TR::IlValue *> args;
+   for (int32_t a = 0; a < numArgs && !_failed; a++)
+      args.push_back(Value());
+   if (_failed)
+      return;
+
+   TR::IlValue **argValues = numArgs > 0 ? &args[0] : NULL;
+   TR::IlValue *result = computed ? b->ComputedCall(name, numArgs, argValues) : b->Call(name, numArgs, argValues);
+   if (id != 0)
+      bind(id, result, true);
+   }
+
+void
+OMR::JitBuilderReplay::replayFunction(TR::MethodBuilder *mb)
+   {
+   const char *name = String();
+   const char *fileName = String();
+   const char *lineNumber = String();
+   void *entryPoint = Location();
+   TR::IlType *returnType = Type();
+   int32_t numParms = Number32();
+   if (!_failed && (numParms < 0 || numParms > MAX_ID_GAP))
+      fail("function %s with %d parameters", name, numParms);
+
+   std::vector<TR::IlType *> parmTypes;
+   for (int32_t p = 0; p < numParms && !_failed; p++)
+      parmTypes.push_back(Type());
+   if (_failed)
+      return;
+
+   // functions defined while building IL are kept for later compilations
+   if (mb->lookupFunction(name) != NULL)
+      return;
+
+   // the recorded entry point is only valid in the process that recorded it,
+   // elsewhere the function is requested by name
+   if (_recordedHere)
+      mb->DefineFunction(name, fileName, lineNumber, entryPoint, returnType, numParms, numParms > 0 ? &parmTypes[0] : NULL);
+   else if (!mb->RequestFunction(name) || mb->lookupFunction(name) == NULL)
+      fail("function %s cannot be resolved outside the process that recorded it", name);
+   }
+
+void
+OMR::JitBuilderReplay::replayLoop(TR::IlBuilder *b, bool isDoWhile)
+   {
+   const char *condition = String();
+   TypeID bodyID = ID();
+   TypeID breakID = ID();
+   TypeID continueID = ID();
+   if (_failed)
+      return;
+
+   TR::IlBuilder *bodyBuilder, *breakBuilder, *continueBuilder;
+   TR::IlBuilder **body = builderOutput(bodyID, &bodyBuilder);
+   TR::IlBuilder **breakBody = builderOutput(breakID, &breakBuilder);
+   TR::IlBuilder **continueBody = builderOutput(continueID, &continueBuilder);
+   if (body == NULL)
+      {
+      fail("loop without a body");
+      return;
+      }
+
+   if (isDoWhile)
+      b->DoWhileLoop(condition, body, breakBody, continueBody);
+   else
+      b->WhileDoLoop(condition, body, breakBody, continueBody);
+   bind(bodyID, bodyBuilder, true);
+   if (breakBody)
+      bind(breakID, breakBuilder, true);
+   if (continueBody)
+      bind(continueID, continueBuilder, true);
+   }
+
+void
+OMR::JitBuilderReplay::replayConditions(TR::IlBuilder *b, bool isAnd)
+   {
+   TypeID firstID = ID();
+   TypeID secondID = ID();
+   int32_t numTerms = Number32();
+   if (!_failed && (numTerms < 0 || numTerms > MAX_ID_GAP))
+      fail("condition with %d terms", numTerms);
+
+   std::vector<TR::IlBuilder::JBCondition *> terms;
+   for (int32_t t = 0; t < numTerms && !_failed; t++)
+      {
+      TR::IlBuilder *conditionBuilder = Builder();
+      TR::IlValue *conditionValue = Value();
+      if (!_failed)
+         terms.push_back(b->MakeCondition(conditionBuilder, conditionValue));
+      }
+   if (_failed)
+      return;
+
+   TR::IlBuilder *firstBuilder, *secondBuilder;
+   TR::IlBuilder **first = builderOutput(firstID, &firstBuilder);
+   TR::IlBuilder **second = builderOutput(secondID, &secondBuilder);
+   if (first == NULL || second == NULL)
+      {
+      fail("condition without its outcome builders");
+      return;
+      }
+
+   TR::IlBuilder::JBCondition **termArray = numTerms > 0 ? &terms[0] : NULL;
+   if (isAnd)
+      b->IfAnd(first, second, numTerms, termArray);
+   else
+      b->IfOr(first, second, numTerms, termArray);
+   bind(firstID, firstBuilder, true);
+   bind(secondID, secondBuilder, true);
+   }
+
+void
+OMR::JitBuilderReplay::replaySwitch(TR::IlBuilder *b, bool isTable)
+   {
+   TR::IlValue *selector = Value();
+   TypeID defaultID = ID();
+   int32_t numCases = Number32();
+   if (!_failed && (numCases < 0 || numCases > MAX_ID_GAP))
+      fail("switch with %d cases", numCases);
+
+   std::vector<TR::IlBuilder::JBCase *> cases;
+   for (int32_t c = 0; c < numCases && !_failed; c++)
+      {
+      int32_t value = Number32();
+      TR::IlBuilder *caseBuilder = Builder();
+      int32_t fallsThrough = Number32();
+      if (!_failed)
+         cases.push_back(b->MakeCase(value, &caseBuilder, fallsThrough));
+      }
+   bool generateBoundsCheck = Number8() != 0;
+   if (_failed)
+      return;
+
+   TR::IlBuilder *defaultBuilder;
+   TR::IlBuilder **defaultPath = builderOutput(defaultID, &defaultBuilder);
+   if (defaultPath == NULL)
+      {
+      fail("switch without a default builder");
+      return;
+      }
+
+   TR::IlBuilder::JBCase **caseArray = numCases > 0 ? &cases[0] : NULL;
+   if (isTable)
+      b->TableSwitch(selector, defaultPath, generateBoundsCheck, numCases, caseArray);
+   else
+      b->Switch(selector, defaultPath, numCases, caseArray);
+   bind(defaultID, defaultBuilder, true);
+   }
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_INCL
+#define OMR_JITBUILDERREPLAY_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace TR { class IlBuilder; }
+namespace TR { class IlType; }
+namespace TR { class IlValue; }
+namespace TR { class MethodBuilder; }
+
+namespace OMR
+{
+
+class IlBuilder;
+
+/**
+ * @brief Rebuilds a method from a recording made by a JitBuilderRecorder.
+ *
+ * Subclasses read the tokens of one recording format.  This class maps the
+ * IDs of the recording back to the objects it creates, and calls the
+ * services the recording was made from in the same order.  Like the method it
+ * was recorded from, a recording is replayed in two steps: its definitions
+ * when the MethodBuilder is constructed, and its IL when the MethodBuilder is
+ * compiled (see TR::MethodBuilderReplay).
+ *
+ * Names are kept by the replay object, so it must outlive every compilation
+ * of the MethodBuilder it defined.  Addresses are only replayed in the
+ * process that made the recording.  Elsewhere, functions are requested by name
+ * from the MethodBuilder (see RequestFunction), and a recording that refers to
+ * memory, globals or non-null constant addresses cannot be replayed.
+ */
+class JitBuilderReplay
+   {
+   public:
+
+   typedef uint32_t TypeID;
+
+   JitBuilderReplay();
+   virtual ~JitBuilderReplay() { }
+
+   /**
+    * @brief Replay the definitions recorded before the IL of the method
+    * @returns false if the recording cannot be replayed
+    */
+   bool replayDefinitions(TR::MethodBuilder *mb);
+
+   /**
+    * @brief Replay the IL of the method, while the MethodBuilder builds its IL
+    * @returns false if the recording cannot be replayed
+    */
+   bool replayIL(TR::MethodBuilder *mb);
+
+   bool failed()                      { return _failed; }
+   const char *errorMessage()         { return _errorMessage.c_str(); }
+
+   protected:
+
+   /**
+    * @brief Subclasses read the tokens of their recording format from the
+    *        current position, calling fail() if the input is malformed
+    */
+   virtual size_t position() = 0;
+   virtual void setPosition(size_t position) = 0;
+   virtual const char *String() = 0;
+   virtual int8_t Number8() = 0;
+   virtual int16_t Number16() = 0;
+   virtual int32_t Number32() = 0;
+   virtual int64_t Number64() = 0;
+   virtual float NumberFloat() = 0;
+   virtual double NumberDouble() = 0;
+   virtual TypeID ID() = 0;
+   virtual void *Location() = 0;
+
+   /**
+    * @brief Keep a copy of a string read from the recording for as long as the replay lives
+    */
+   const char *saveString(const char *chars, size_t length);
+
+   void fail(const char *format, ...);
+
+   uint8_t                   _idSize;
+
+   private:
+
+   // An object the recording refers to by ID or, for the ID of a statement,
+   // its name and its index in the table of statements that can be replayed
+   struct Entry
+      {
+      Entry() : _object(NULL), _statement(-1), _perCompilation(false) { }
+
+      void      * _object;
+      int32_t     _statement;
+      bool        _perCompilation; // builders and values, created anew by each compilation
+      };
+
+   bool replay(TR::MethodBuilder *mb, bool definitionsOnly);
+   bool readHeader();
+   void defineStatement(TypeID id, const char *name);
+   bool isDefinition(int32_t s);
+   void replayStatement(TR::MethodBuilder *mb, TR::IlBuilder *b, int32_t s);
+   void replayCall(TR::IlBuilder *b, bool computed);
+   void replayConditions(TR::IlBuilder *b, bool isAnd);
+   void replaySwitch(TR::IlBuilder *b, bool isTable);
+   void replayLoop(TR::IlBuilder *b, bool isDoWhile);
+   void replayFunction(TR::MethodBuilder *mb);
+
+   typedef TR::IlValue *(OMR::IlBuilder::*BinaryOp)(TR::IlValue *, TR::IlValue *);
+   typedef TR::IlValue *(OMR::IlBuilder::*TypedOp)(TR::IlType *, TR::IlValue *);
+   typedef TR::IlValue *(OMR::IlBuilder::*OpWithOverflow)(TR::IlBuilder **, TR::IlValue *, TR::IlValue *);
+   typedef void (OMR::IlBuilder::*IfCmpOp)(TR::IlBuilder *, TR::IlValue *, TR::IlValue *);
+   typedef void (OMR::IlBuilder::*IfCmpZeroOp)(TR::IlBuilder *, TR::IlValue *);
+
+   void replayBinaryOp(TR::IlBuilder *b, BinaryOp op);
+   void replayTypedOp(TR::IlBuilder *b, TypedOp op);
+   void replayOpWithOverflow(TR::IlBuilder *b, OpWithOverflow op);
+   void replayIfCmp(TR::IlBuilder *b, IfCmpOp op);
+   void replayIfCmpZero(TR::IlBuilder *b, IfCmpZeroOp op);
+
+   Entry &entry(TypeID id);
+   void bind(TypeID id, void *object, bool perCompilation = false);
+   void *lookup(TypeID id);
+   TR::IlValue *Value()               { return static_cast<TR::IlValue *>(lookup(ID())); }
+   TR::IlType *Type()                 { return static_cast<TR::IlType *>(lookup(ID())); }
+   TR::IlBuilder *Builder()           { return static_cast<TR::IlBuilder *>(lookup(ID())); }
+   TR::IlBuilder **builderOutput(TypeID id, TR::IlBuilder **storage);
+
+   std::vector<Entry>        _entries;
+   std::deque<std::string>   _strings;
+   size_t                    _ilStart;
+   uint8_t                   _ilStartIDSize;
+   bool                      _definitionsReplayed;
+   bool                      _ilReplayed;
+   bool                      _recordedHere;  // addresses in the recording are valid
+   bool                      _failed;
+   std::string               _errorMessage;
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_INCL)
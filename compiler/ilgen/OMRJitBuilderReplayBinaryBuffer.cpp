@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "ilgen/JitBuilderReplayBinaryBuffer.hpp"
+
+OMR::JitBuilderReplayBinaryBuffer::JitBuilderReplayBinaryBuffer(const std::vector<uint8_t> &buffer)
+   : TR::JitBuilderReplay(), _buf(buffer), _position(0)
+   {
+   }
+
+OMR::JitBuilderReplayBinaryBuffer::JitBuilderReplayBinaryBuffer()
+   : TR::JitBuilderReplay(), _buf(), _position(0)
+   {
+   }
+
+uint64_t
+OMR::JitBuilderReplayBinaryBuffer::littleEndian(size_t numBytes)
+   {
+   if (numBytes > _buf.size() - _position)
+      {
+      fail("recording ends unexpectedly at offset %lu", static_cast<unsigned long>(_position));
+      _position = _buf.size();
+      return 0;
+      }
+
+   uint64_t value = 0;
+   for (size_t i = 0; i < numBytes; i++)
+      value |= static_cast<uint64_t>(_buf[_position + i]) << (8 * i);
+   _position += numBytes;
+   return value;
+   }
+
+// length(int16) characters
+//
+const char *
+OMR::JitBuilderReplayBinaryBuffer::String()
+   {
+   size_t length = static_cast<uint16_t>(Number16());
+   if (failed())
+      return "";
+   if (length > _buf.size() - _position)
+      {
+      fail("string of length %lu runs past the end of the recording", static_cast<unsigned long>(length));
+      return "";
+      }
+
+   const char *string = saveString(reinterpret_cast<const char *>(&_buf[0]) + _position, length);
+   _position += length;
+   return string;
+   }
+
+int8_t
+OMR::JitBuilderReplayBinaryBuffer::Number8()
+   {
+   return static_cast<int8_t>(littleEndian(1));
+   }
+
+int16_t
+OMR::JitBuilderReplayBinaryBuffer::Number16()
+   {
+   return static_cast<int16_t>(littleEndian(2));
+   }
+
+int32_t
+OMR::JitBuilderReplayBinaryBuffer::Number32()
+   {
+   return static_cast<int32_t>(littleEndian(4));
+   }
+
+int64_t
+OMR::JitBuilderReplayBinaryBuffer::Number64()
+   {
+   return static_cast<int64_t>(littleEndian(8));
+   }
+
+float
+OMR::JitBuilderReplayBinaryBuffer::NumberFloat()
+   {
+   uint32_t bits = static_cast<uint32_t>(littleEndian(4));
+   float value;
+   memcpy(&value, &bits, sizeof(value));
+   return value;
+   }
+
+double
+OMR::JitBuilderReplayBinaryBuffer::NumberDouble()
+   {
+   uint64_t bits = littleEndian(8);
+   double value;
+   memcpy(&value, &bits, sizeof(value));
+   return value;
+   }
+
+OMR::JitBuilderReplayBinaryBuffer::TypeID
+OMR::JitBuilderReplayBinaryBuffer::ID()
+   {
+   return static_cast<TypeID>(littleEndian(_idSize / 8));
+   }
+
+void *
+OMR::JitBuilderReplayBinaryBuffer::Location()
+   {
+   return reinterpret_cast<void *>(static_cast<uintptr_t>(littleEndian(8)));
+   }
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL
+#define OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL
+
+#include <vector>
+#include "ilgen/JitBuilderReplay.hpp"
+
+namespace OMR
+{
+
+/**
+ * @brief Replays a recording made by TR::JitBuilderRecorderBinaryBuffer,
+ *        for example one handed over from another thread
+ */
+class JitBuilderReplayBinaryBuffer : public TR::JitBuilderReplay
+   {
+   public:
+   JitBuilderReplayBinaryBuffer(const std::vector<uint8_t> &buffer);
+   virtual ~JitBuilderReplayBinaryBuffer() { }
+
+   protected:
+   JitBuilderReplayBinaryBuffer();
+
+   virtual size_t position()                    { return _position; }
+   virtual void setPosition(size_t position)    { _position = position; }
+   virtual const char *String();
+   virtual int8_t Number8();
+   virtual int16_t Number16();
+   virtual int32_t Number32();
+   virtual int64_t Number64();
+   virtual float NumberFloat();
+   virtual double NumberDouble();
+   virtual TypeID ID();
+   virtual void *Location();
+
+   std::vector<uint8_t> _buf;
+   size_t               _position;
+
+   private:
+   uint64_t littleEndian(size_t numBytes);
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL)
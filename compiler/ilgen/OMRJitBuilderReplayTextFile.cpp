@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+
+#include "ilgen/JitBuilderReplayTextFile.hpp"
+
+OMR::JitBuilderReplayTextFile::JitBuilderReplayTextFile(const char *fileName)
+   : TR::JitBuilderReplay(), _text(), _position(0)
+   {
+   std::ifstream file(fileName);
+   if (!file)
+      {
+      fail("cannot open %s", fileName);
+      return;
+      }
+
+   std::stringstream contents;
+   contents << file.rdbuf();
+   _text = contents.str();
+   }
+
+void
+OMR::JitBuilderReplayTextFile::skipSpaces()
+   {
+   while (_position < _text.size() && isspace(static_cast<unsigned char>(_text[_position])))
+      _position++;
+   }
+
+bool
+OMR::JitBuilderReplayTextFile::expect(char c)
+   {
+   if (_position < _text.size() && _text[_position] == c)
+      {
+      _position++;
+      return true;
+      }
+
+   fail("expected '%c' at offset %lu", c, static_cast<unsigned long>(_position));
+   return false;
+   }
+
+// "length [characters]"
+//
+const char *
+OMR::JitBuilderReplayTextFile::String()
+   {
+   skipSpaces();
+   if (!expect('"'))
+      return "";
+
+   int64_t length = integer();
+   if (failed() || !expect(' ') || !expect('['))
+      return "";
+   if (length < 0 || static_cast<uint64_t>(length) > _text.size() - _position)
+      {
+      fail("string of length %lld runs past the end of the recording", static_cast<long long>(length));
+      return "";
+      }
+
+   const char *string = saveString(_text.c_str() + _position, static_cast<size_t>(length));
+   _position += static_cast<size_t>(length);
+   if (!expect(']') || !expect('"'))
+      return "";
+   return string;
+   }
+
+int64_t
+OMR::JitBuilderReplayTextFile::integer()
+   {
+   skipSpaces();
+   const char *start = _text.c_str() + _position;
+   char *end;
+   int64_t value = strtoll(start, &end, 10);
+   if (end == start)
+      {
+      fail("expected a number at offset %lu", static_cast<unsigned long>(_position));
+      return 0;
+      }
+   _position += end - start;
+   return value;
+   }
+
+double
+OMR::JitBuilderReplayTextFile::floatingPoint()
+   {
+   skipSpaces();
+   const char *start = _text.c_str() + _position;
+   char *end;
+   double value = strtod(start, &end);
+   if (end == start)
+      {
+      fail("expected a floating point number at offset %lu", static_cast<unsigned long>(_position));
+      return 0.0;
+      }
+   _position += end - start;
+   return value;
+   }
+
+// IDs are prefixed by what they refer to (ID, S, T, V or B), except for the
+// NULL builder, which is written as Def
+//
+OMR::JitBuilderReplayTextFile::TypeID
+OMR::JitBuilderReplayTextFile::ID()
+   {
+   skipSpaces();
+   if (_text.compare(_position, 3, "Def") == 0)
+      {
+      _position += 3;
+      return 0;
+      }
+
+   size_t prefix = _position;
+   while (_position < _text.size() && isalpha(static_cast<unsigned char>(_text[_position])))
+      _position++;
+   if (_position == prefix || !isdigit(static_cast<unsigned char>(_text.c_str()[_position])))
+      {
+      fail("expected an ID at offset %lu", static_cast<unsigned long>(prefix));
+      return 0;
+      }
+   return static_cast<TypeID>(integer());
+   }
+
+// {address}
+//
+void *
+OMR::JitBuilderReplayTextFile::Location()
+   {
+   skipSpaces();
+   if (!expect('{'))
+      return NULL;
+
+   const char *start = _text.c_str() + _position;
+   char *end;
+   uintptr_t location = static_cast<uintptr_t>(strtoull(start, &end, 16));
+   _position += end - start;
+   if (end == start || !expect('}'))
+      return NULL;
+   return reinterpret_cast<void *>(location);
+   }
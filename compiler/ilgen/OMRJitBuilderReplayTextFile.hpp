@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_TEXTFILE_INCL
+#define OMR_JITBUILDERREPLAY_TEXTFILE_INCL
+
+#include <string>
+#include "ilgen/JitBuilderReplay.hpp"
+
+namespace OMR
+{
+
+/**
+ * @brief Replays a recording made by TR::JitBuilderRecorderTextFile
+ */
+class JitBuilderReplayTextFile : public TR::JitBuilderReplay
+   {
+   public:
+   JitBuilderReplayTextFile(const char *fileName);
+   virtual ~JitBuilderReplayTextFile() { }
+
+   protected:
+   virtual size_t position()                    { return _position; }
+   virtual void setPosition(size_t position)    { _position = position; }
+   virtual const char *String();
+   virtual int8_t Number8()                     { return static_cast<int8_t>(integer()); }
+   virtual int16_t Number16()                   { return static_cast<int16_t>(integer()); }
+   virtual int32_t Number32()                   { return static_cast<int32_t>(integer()); }
+   virtual int64_t Number64()                   { return integer(); }
+   virtual float NumberFloat()                  { return static_cast<float>(floatingPoint()); }
+   virtual double NumberDouble()                { return floatingPoint(); }
+   virtual TypeID ID();
+   virtual void *Location();
+
+   private:
+   void skipSpaces();
+   bool expect(char c);
+   int64_t integer();
+   double floatingPoint();
+
+   std::string _text;
+   size_t      _position;
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_TEXTFILE_INCL)
@@ -19,10 +19,12 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
 #include <stdint.h>
+#include <string.h>
 #include "compile/Method.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/Region.hpp"
@@ -48,11 +50,21 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlBuilder.hpp"
+#include "ilgen/InlineCache.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/VirtualMachineState.hpp"
 
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+#include "AtomicSupport.hpp"
+#endif
+
+#if defined(TR_TARGET_X86)
+extern "C" void _patchVirtualGuard(uint8_t *locationAddr, uint8_t *destinationAddr, int32_t smpFlag);
+#endif
+
 #define OPT_DETAILS "O^O ILBLD: "
 
 // Size of MethodBuilder memory segments
@@ -105,9 +117,11 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
    _symbolTypes(str_comparator, trMemory()->heapMemoryRegion()),
    _symbolNameFromSlot(std::less<int32_t>(), trMemory()->heapMemoryRegion()),
    _symbolIsArray(str_comparator, trMemory()->heapMemoryRegion()),
+   _symbolsDefinedByCompilation(std::less<const char *>(), trMemory()->heapMemoryRegion()),
    _memoryLocations(str_comparator, trMemory()->heapMemoryRegion()),
    _globals(str_comparator,trMemory()->heapMemoryRegion()),
    _functions(str_comparator, trMemory()->heapMemoryRegion()),
+   _functionILs(str_comparator, trMemory()->heapMemoryRegion()),
    _cachedParameterTypes(0),
    _definingFile(""),
    _newSymbolsAreTemps(false),
@@ -121,8 +135,22 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
    _bytecodeHasBeenInWorklist(NULL),
    _inlineSiteIndex(-1),
    _nextInlineSiteIndex(0),
+   _invocationCount(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _countForRecompilation(false),
+   _invocationThreshold(0),
+   _backedgeThreshold(0),
+   _invocationCounter(0),
+   _backedgeCounter(0),
+   _recompiledEntry(NULL),
+   _entryIsPatchable(false),
+   _patchableEntry(NULL),
+   _inlineCaches(InlineCacheVectorAllocator(trMemory()->heapMemoryRegion())),
+   _inlinedFunctionILs(MethodBuilderVectorAllocator(trMemory()->heapMemoryRegion())),
+   _nextInlineCache(0),
+   _recorder(NULL),
+   _recording(false)
    {
    _definingLine[0] = '\0';
    }
@@ -138,9 +166,11 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
    _symbolTypes(str_comparator, trMemory()->heapMemoryRegion()),
    _symbolNameFromSlot(std::less<int32_t>(), trMemory()->heapMemoryRegion()),
    _symbolIsArray(str_comparator, trMemory()->heapMemoryRegion()),
+   _symbolsDefinedByCompilation(std::less<const char *>(), trMemory()->heapMemoryRegion()),
    _memoryLocations(str_comparator, trMemory()->heapMemoryRegion()),
    _globals(str_comparator,trMemory()->heapMemoryRegion()),
    _functions(str_comparator, trMemory()->heapMemoryRegion()),
+   _functionILs(str_comparator, trMemory()->heapMemoryRegion()),
    _cachedParameterTypes(0),
    _definingFile(""),
    _newSymbolsAreTemps(false),
@@ -154,8 +184,22 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
    _bytecodeHasBeenInWorklist(NULL),
    _inlineSiteIndex(callerMB->getNextInlineSiteIndex()),
    _nextInlineSiteIndex(0),
+   _invocationCount(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _countForRecompilation(false),
+   _invocationThreshold(0),
+   _backedgeThreshold(0),
+   _invocationCounter(0),
+   _backedgeCounter(0),
+   _recompiledEntry(NULL),
+   _entryIsPatchable(false),
+   _patchableEntry(NULL),
+   _inlineCaches(InlineCacheVectorAllocator(trMemory()->heapMemoryRegion())),
+   _inlinedFunctionILs(MethodBuilderVectorAllocator(trMemory()->heapMemoryRegion())),
+   _nextInlineCache(0),
+   _recorder(NULL),
+   _recording(false)
    {
    _definingLine[0] = '\0';
    initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -170,8 +214,12 @@ OMR::MethodBuilder::~MethodBuilder()
    _symbolTypes.clear();
    _symbolNameFromSlot.clear();
    _symbolIsArray.clear();
+   _symbolsDefinedByCompilation.clear();
    _memoryLocations.clear();
    _functions.clear();
+   _functionILs.clear();
+   _inlineCaches.clear();
+   _inlinedFunctionILs.clear();
    }
 
 TR::MethodBuilder *
@@ -214,6 +262,8 @@ void
 OMR::MethodBuilder::setupForBuildIL()
    {
    initSequence();
+   resetInlineCacheSites();
+   resetFunctionILs();
 
    _entryBlock = cfg()->getStart()->asBlock();
    _exitBlock = cfg()->getEnd()->asBlock();
@@ -229,6 +279,307 @@ OMR::MethodBuilder::setupForBuildIL()
 
    // set up initial CFG
    cfg()->addEdge(_entryBlock, _currentBlock);
+
+   if (_countForRecompilation)
+      generateRecompilationPrologue();
+
+   // the recompilation prologue is not part of what the client built
+   if (_recorder)
+      {
+      recordDefinitions();
+      _recording = true;
+      }
+   }
+
+// Records everything defined before building IL, in the order a replay has to
+// define it again. Values, builders and types get IDs as they are referred to.
+//
+void
+OMR::MethodBuilder::recordDefinitions()
+   {
+   TR::JitBuilderRecorder *rec = _recorder;
+   rec->Start();
+   rec->EnsureBuilderDefined(this);
+
+   rec->BeginStatement(this, StatementName::STATEMENT_DEFINENAME);
+   rec->String(_methodName);
+   rec->EndStatement();
+
+   rec->BeginStatement(this, StatementName::STATEMENT_DEFINEFILE);
+   rec->String(_definingFile);
+   rec->EndStatement();
+
+   if (_definingLine[0] != '\0')
+      {
+      rec->BeginStatement(this, StatementName::STATEMENT_DEFINELINESTRING);
+      rec->String(_definingLine);
+      rec->EndStatement();
+      }
+
+   if (!rec->EnsureTypeDefined(_types, _returnType))
+      return;
+   rec->BeginStatement(this, StatementName::STATEMENT_DEFINERETURNTYPE);
+   rec->Type(_returnType);
+   rec->EndStatement();
+
+   for (int32_t p = 0; p < _numParameters; p++)
+      {
+      const char *name = getSymbolName(p);
+      TR::IlType *type = _symbolTypes[name];
+      if (!rec->EnsureTypeDefined(_types, type))
+         return;
+      rec->BeginStatement(this, isSymbolAnArray(name) ? StatementName::STATEMENT_DEFINEARRAYPARAMETER : StatementName::STATEMENT_DEFINEPARAMETER);
+      rec->String(name);
+      rec->Type(type);
+      rec->EndStatement();
+      }
+
+   for (MemoryLocationMap::iterator it = _memoryLocations.begin(); it != _memoryLocations.end(); ++it)
+      {
+      TR::IlType *type = _symbolTypes[it->first];
+      if (!rec->EnsureTypeDefined(_types, type))
+         return;
+      rec->BeginStatement(this, StatementName::STATEMENT_DEFINEMEMORY);
+      rec->String(it->first);
+      rec->Type(type);
+      rec->Location(it->second);
+      rec->EndStatement();
+      }
+
+   for (GlobalMap::iterator it = _globals.begin(); it != _globals.end(); ++it)
+      {
+      TR::IlType *type = _symbolTypes[it->first];
+      if (!rec->EnsureTypeDefined(_types, type))
+         return;
+      rec->BeginStatement(this, StatementName::STATEMENT_DEFINEGLOBAL);
+      rec->String(it->first);
+      rec->Type(type);
+      rec->Location(it->second);
+      rec->EndStatement();
+      }
+
+   for (SymbolTypeMap::iterator it = _symbolTypes.begin(); it != _symbolTypes.end(); ++it)
+      {
+      const char *name = it->first;
+      if (_parameterSlot.find(name) != _parameterSlot.end()
+          || _memoryLocations.find(name) != _memoryLocations.end()
+          || _globals.find(name) != _globals.end())
+         continue;
+      if (!rec->EnsureTypeDefined(_types, it->second))
+         return;
+      rec->BeginStatement(this, StatementName::STATEMENT_DEFINELOCAL);
+      rec->String(name);
+      rec->Type(it->second);
+      rec->EndStatement();
+      }
+
+   for (FunctionMap::iterator it = _functions.begin(); it != _functions.end(); ++it)
+      recordFunction(rec, it->first);
+
+   if (_newSymbolsAreTemps)
+      {
+      rec->BeginStatement(this, StatementName::STATEMENT_ALLLOCALSHAVEBEENDEFINED);
+      rec->EndStatement();
+      }
+   }
+
+// Functions called by the code inserted for recompilation counting; the
+// prefix keeps them apart from any function the client defines
+//
+static const char * const RequestRecompilationName = "__omrjb_requestRecompilation";
+static const char * const RecompiledBodyName = "__omrjb_recompiledBody";
+
+void
+OMR::MethodBuilder::enableRecompilationCounting(void *recompileHelper, int32_t invocationThreshold, int32_t backedgeThreshold)
+   {
+   if (lookupFunction(RequestRecompilationName) == NULL)
+      {
+      DefineFunction(RequestRecompilationName, __FILE__, "0", recompileHelper, NoType, 1, Address);
+      DefineFunction(RecompiledBodyName, __FILE__, "0", NULL, _returnType, _numParameters, getParameterTypes());
+      }
+
+   _invocationThreshold = invocationThreshold;
+   _backedgeThreshold = backedgeThreshold;
+   _invocationCounter = 0;
+   _backedgeCounter = 0;
+   _countForRecompilation = true;
+   }
+
+void
+OMR::MethodBuilder::setRecompiledEntry(void *entry)
+   {
+   // code calling through the new entry must see all of its instructions
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+   VM_AtomicSupport::writeBarrier();
+#endif
+   _recompiledEntry = entry;
+
+   // new calls to the first tier then jump straight to the recompiled body;
+   // its prologue still forwards them if the two are out of reach of a jump
+#if defined(TR_TARGET_X86)
+   if (_patchableEntry != NULL)
+      {
+      intptr_t distance = static_cast<uint8_t *>(entry) - static_cast<uint8_t *>(_patchableEntry);
+      if (distance == static_cast<int32_t>(distance))
+         _patchVirtualGuard(static_cast<uint8_t *>(_patchableEntry), static_cast<uint8_t *>(entry), true);
+      _patchableEntry = NULL;
+      }
+#endif
+   }
+
+void
+OMR::MethodBuilder::countBackedge(TR::IlBuilder *loopBuilder)
+   {
+   if (_countForRecompilation)
+      generateRecompilationCounter(loopBuilder, &_backedgeCounter, _backedgeThreshold);
+   }
+
+void
+OMR::MethodBuilder::generateRecompilationPrologue()
+   {
+   TraceIL("[ %p ] TR::MethodBuilder::generateRecompilationPrologue\n", this);
+
+   // lets setRecompiledEntry patch the entry of this body with a jump
+   if (comp()->cg()->supportsPatchableMethodEntry())
+      {
+      comp()->setHasPatchableMethodEntry();
+      _entryIsPatchable = true;
+      }
+
+   // once the method has been recompiled, this body only forwards to it
+   TR::IlValue *recompiledEntry = LoadAt(_types->pAddress, ConstAddress((void *)&_recompiledEntry));
+   TR::IlBuilder *forward = NULL;
+   IfThen(&forward, NotEqualTo(recompiledEntry, NullAddress()));
+
+   TR::IlValue **args = (TR::IlValue **) comp()->trMemory()->allocateHeapMemory((_numParameters + 1) * sizeof(TR::IlValue *));
+   args[0] = recompiledEntry;
+   for (int32_t p = 0; p < _numParameters; p++)
+      args[p + 1] = forward->Load(getSymbolName(p));
+   TR::IlValue *result = forward->ComputedCall(RecompiledBodyName, _numParameters + 1, args);
+   if (_returnType == NoType)
+      forward->Return();
+   else
+      forward->Return(result);
+
+   generateRecompilationCounter(this, &_invocationCounter, _invocationThreshold);
+   }
+
+// The counters are updated without synchronization: a few lost increments
+// only delay the recompilation request
+//
+void
+OMR::MethodBuilder::generateRecompilationCounter(TR::IlBuilder *b, volatile int32_t *counter, int32_t threshold)
+   {
+   TR::IlValue *counterAddress = b->ConstAddress((void *)counter);
+   TR::IlValue *count = b->Add(b->LoadAt(_types->pInt32, counterAddress), b->ConstInt32(1));
+   b->StoreAt(counterAddress, count);
+
+   TR::IlBuilder *request = NULL;
+   b->IfThen(&request, b->EqualTo(count, b->ConstInt32(threshold)));
+   request->Call(RequestRecompilationName, 1, request->ConstAddress(this));
+   }
+
+// Called by compiled code on an inline cache miss
+//
+static const char * const InlineCacheMissName = "__omrjb_inlineCacheMiss";
+
+TR::InlineCache *
+OMR::MethodBuilder::nextInlineCache(int32_t numTargets)
+   {
+   if (_nextInlineCache == GetNumInlineCaches())
+      {
+      TR::InlineCache *cache = (TR::InlineCache *) trMemory()->heapMemoryRegion().allocate(sizeof(TR::InlineCache));
+      memset(cache, 0, sizeof(TR::InlineCache));
+      cache->_capacity = numTargets;
+      _inlineCaches.push_back(cache);
+      }
+
+   return _inlineCaches[_nextInlineCache++];
+   }
+
+int32_t
+OMR::MethodBuilder::GetInlineCacheNumTargets(int32_t site)
+   {
+   TR_ASSERT_FATAL(site >= 0 && site < GetNumInlineCaches(), "No inline cache for call site %d", site);
+   return _inlineCaches[site]->getNumTargets();
+   }
+
+void *
+OMR::MethodBuilder::GetInlineCacheTarget(int32_t site, int32_t target)
+   {
+   TR_ASSERT_FATAL(target >= 0 && target < GetInlineCacheNumTargets(site), "No target %d in inline cache for call site %d", target, site);
+   return _inlineCaches[site]->_targets[target];
+   }
+
+int64_t
+OMR::MethodBuilder::GetInlineCacheHits(int32_t site, int32_t target)
+   {
+   TR_ASSERT_FATAL(target >= 0 && target < GetInlineCacheNumTargets(site), "No target %d in inline cache for call site %d", target, site);
+   return _inlineCaches[site]->_hits[target];
+   }
+
+int64_t
+OMR::MethodBuilder::GetInlineCacheMisses(int32_t site)
+   {
+   TR_ASSERT_FATAL(site >= 0 && site < GetNumInlineCaches(), "No inline cache for call site %d", site);
+   return _inlineCaches[site]->_misses;
+   }
+
+// Like the recompilation counters, profiling counters are updated without
+// synchronization
+//
+void
+OMR::MethodBuilder::generateProfilingCounter(TR::IlBuilder *b, volatile int64_t *counter)
+   {
+   TR::IlValue *counterAddress = b->ConstAddress((void *)counter);
+   TR::IlValue *count = b->Add(b->LoadAt(_types->pInt64, counterAddress), b->ConstInt64(1));
+   b->StoreAt(counterAddress, count);
+   }
+
+void
+OMR::MethodBuilder::generateInlineCacheMiss(TR::IlBuilder *b, TR::InlineCache *cache, TR::IlValue *target)
+   {
+   if (lookupFunction(InlineCacheMissName) == NULL)
+      DefineFunction(InlineCacheMissName, __FILE__, "0", (void *)&TR::InlineCache::recordMiss, NoType, 2, Address, Address);
+
+   b->Call(InlineCacheMissName, 2, b->ConstAddress(cache), target);
+   }
+
+// Functions can also be defined while building IL, on request from a Call, so
+// each one is recorded when a recorded call first refers to it
+//
+void
+OMR::MethodBuilder::recordFunction(OMR::JitBuilderRecorder *rec, const char *name)
+   {
+   if (strncmp(name, "__omrjb_", 8) == 0)
+      return;
+
+   FunctionMap::iterator it = _functions.find(name);
+   if (it == _functions.end()) // calls this method itself
+      return;
+
+   TR::ResolvedMethod *method = it->second;
+   TR::IlType **parmTypes = method->getParmTypes();
+   if (!rec->EnsureTypeDefined(_types, method->returnIlType()))
+      return;
+   for (int32_t p = 0; p < method->getNumArgs(); p++)
+      {
+      if (!rec->EnsureTypeDefined(_types, parmTypes[p]))
+         return;
+      }
+   if (rec->EnsureAvailableID(method))
+      return;
+
+   rec->BeginStatement(this, StatementName::STATEMENT_DEFINEFUNCTION);
+   rec->String(name);
+   rec->String(method->classNameChars());
+   rec->String(method->getLineNumber());
+   rec->Location(method->getEntryPoint());
+   rec->Type(method->returnIlType());
+   rec->Number(method->getNumArgs());
+   for (int32_t p = 0; p < method->getNumArgs(); p++)
+      rec->Type(parmTypes[p]);
+   rec->EndStatement();
    }
 
 uint32_t
@@ -387,7 +738,8 @@ OMR::MethodBuilder::defineSymbol(const char *name, TR::SymbolReference *symRef)
    _symbolNameFromSlot.insert(std::make_pair(symRef->getCPIndex(), name));
 
    TR::IlType *type = typeDictionary()->PrimitiveType(symRef->getSymbol()->getDataType());
-   _symbolTypes.insert(std::make_pair(name, type));
+   if (_symbolTypes.insert(std::make_pair(name, type)).second)
+      _symbolsDefinedByCompilation.insert(name);
 
    if (!_newSymbolsAreTemps)
       _methodSymbol->setFirstJitTempIndex(_methodSymbol->getTempIndex());
@@ -504,11 +856,34 @@ OMR::MethodBuilder::DefineName(const char *name)
    _methodName = name;
    }
 
+void
+OMR::MethodBuilder::AllLocalsHaveBeenDefined()
+   {
+   _newSymbolsAreTemps = true;
+
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      {
+      rec->BeginStatement(this, StatementName::STATEMENT_ALLLOCALSHAVEBEENDEFINED);
+      rec->EndStatement();
+      }
+   }
+
 void
 OMR::MethodBuilder::DefineLocal(const char *name, TR::IlType *dt)
    {
    TR_ASSERT_FATAL(_symbolTypes.find(name) == _symbolTypes.end(), "Symbol '%s' already defined", name);
    _symbolTypes.insert(std::make_pair(name, dt));
+
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec && rec->EnsureTypeDefined(_types, dt))
+      {
+      rec->BeginStatement(this, StatementName::STATEMENT_DEFINELOCAL);
+      rec->String(name);
+      rec->Type(dt);
+      rec->EndStatement();
+      }
    }
 
 void
@@ -518,6 +893,17 @@ OMR::MethodBuilder::DefineMemory(const char *name, TR::IlType *dt, void *locatio
 
    _symbolTypes.insert(std::make_pair(name, dt));
    _memoryLocations.insert(std::make_pair(name, location));
+
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec && rec->EnsureTypeDefined(_types, dt))
+      {
+      rec->BeginStatement(this, StatementName::STATEMENT_DEFINEMEMORY);
+      rec->String(name);
+      rec->Type(dt);
+      rec->Location(location);
+      rec->EndStatement();
+      }
    }
 
 void
@@ -527,6 +913,17 @@ OMR::MethodBuilder::DefineGlobal(const char *name, TR::IlType *dt, void *locatio
 
    _globals.insert(std::make_pair(name, location));
    _symbolTypes.insert(std::make_pair(name, dt));
+
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   OMR::JitBuilderRecorder *rec = recording.recorder();
+   if (rec && rec->EnsureTypeDefined(_types, dt))
+      {
+      rec->BeginStatement(this, StatementName::STATEMENT_DEFINEGLOBAL);
+      rec->String(name);
+      rec->Type(dt);
+      rec->Location(location);
+      rec->EndStatement();
+      }
    }
 
 void
@@ -603,6 +1000,51 @@ OMR::MethodBuilder::DefineFunction(const char* const name,
    _functions.insert(std::make_pair(name, method));
    }
 
+void
+OMR::MethodBuilder::DefineFastHelper(const char *name, int64_t preservedRegisters, bool isLeaf)
+   {
+   FunctionMap::iterator it = _functions.find(name);
+   TR_ASSERT_FATAL(it != _functions.end(), "Function '%s' must be defined before it is made a fast helper", name);
+   it->second->setFastHelper(static_cast<uint64_t>(preservedRegisters), isLeaf);
+   }
+
+void
+OMR::MethodBuilder::DefineFunctionIL(const char *name, TR::MethodBuilder *il)
+   {
+   TR_ASSERT_FATAL(_functions.find(name) != _functions.end(), "Function '%s' must be defined before it is described as IL", name);
+   TR_ASSERT_FATAL(_functionILs.find(name) == _functionILs.end(), "Function '%s' already described as IL", name);
+   _functionILs.insert(std::make_pair(name, il));
+   lookupFunction(name)->setInjector(il);
+   }
+
+TR::MethodBuilder *
+OMR::MethodBuilder::claimFunctionIL(const char *name)
+   {
+   FunctionILMap::iterator it = _functionILs.find(name);
+   if (it == _functionILs.end())
+      return NULL;
+
+   TR::MethodBuilder *il = it->second;
+
+   // the benefit inliner weighs calls to a function that was compiled on its own
+   if (comp()->getOption(TR_EnableBenefitInliner) && lookupFunction(name)->getEntryPoint() != NULL)
+      {
+      _methodSymbol->setMayHaveInlineableCall(true);
+      return NULL;
+      }
+
+   if (std::find(_inlinedFunctionILs.begin(), _inlinedFunctionILs.end(), il) != _inlinedFunctionILs.end())
+      {
+      TR_ASSERT_FATAL(lookupFunction(name)->getEntryPoint() != NULL, "Function '%s' described as IL is called more than once but has no entry point", name);
+      return NULL;
+      }
+
+   // the builder was placed by an earlier compilation, if at all
+   il->_partOfSequence = false;
+   _inlinedFunctionILs.push_back(il);
+   return il;
+   }
+
 const char *
 OMR::MethodBuilder::getSymbolName(int32_t slot)
    {
@@ -680,6 +1122,9 @@ OMR::MethodBuilder::addToAllBytecodeBuildersList(TR::BytecodeBuilder* bcBuilder)
 void
 OMR::MethodBuilder::AppendBytecodeBuilder(TR::BytecodeBuilder *builder)
    {
+   OMR::JitBuilderRecorder::ServiceScope recording(recorder());
+   if (OMR::JitBuilderRecorder *rec = recording.recorder())
+      rec->Unsupported(this, StatementName::STATEMENT_APPENDBYTECODEBUILDER);
    this->OMR::IlBuilder::AppendBuilder(builder);
    if (_vmState)
       builder->propagateVMState(_vmState);
@@ -718,24 +1163,70 @@ OMR::MethodBuilder::GetNextBytecodeFromWorklist()
 
 int32_t
 OMR::MethodBuilder::Compile(void **entry)
+   {
+   return Compile(entry, warm);
+   }
+
+int32_t
+OMR::MethodBuilder::Compile(void **entry, TR_Hotness hotness)
    {
    TR::ResolvedMethod resolvedMethod(static_cast<TR::MethodBuilder *>(this));
    TR::IlGeneratorMethodDetails details(&resolvedMethod);
 
+   _compilationStatistics.reset();
+   details.setCompilationStatistics(&_compilationStatistics);
+
    int32_t rc=0;
-   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
+   _entryIsPatchable = false;
+   *entry = (void *) compileMethodFromDetails(NULL, details, hotness, rc);
+   if (_entryIsPatchable && *entry != NULL)
+      _patchableEntry = *entry;
+
+   if (_recorder)
+      {
+      _recorder->Close();
+      _recorder = NULL;
+      _recording = false;
+      }
 
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
    typeDictionary()->NotifyCompilationDone();
 
+   forgetCompilation();
+
+   return rc;
+   }
+
+void
+OMR::MethodBuilder::forgetCompilation()
+   {
    // in case this MethodBuilder object is used in another Call()
    // clear out symrefs allocated in this compilation (no dangling pointers)
    // and reset _connectedTrees so MethodBuilder can be inlined if needed
    _symbols.clear();
    _connectedTrees = false;
+   _returnSymbolName = NULL;
 
-   return rc;
+   // likewise forget the symbols this compilation defined and the slots of
+   // its temporaries: their names may have been freed along with it
+   for (SymbolTypeMap::iterator it = _symbolTypes.begin(); it != _symbolTypes.end(); )
+      {
+      if (_symbolsDefinedByCompilation.find(it->first) != _symbolsDefinedByCompilation.end())
+         _symbolTypes.erase(it++);
+      else
+         ++it;
+      }
+   _symbolsDefinedByCompilation.clear();
+   _symbolNameFromSlot.erase(_symbolNameFromSlot.lower_bound(_numParameters), _symbolNameFromSlot.end());
+
+   // the blocks and block count belong to this compilation too: a later
+   // compilation, possibly on another thread, must count and allocate its own
+   _count = -1;
+   _currentBlock = NULL;
+   _blocks = NULL;
+   _numBlocks = 0;
+   _blocksAllocatedUpFront = false;
    }
 
 void *
@@ -24,7 +24,10 @@
 
 #include <map>
 #include <set>
+#include <vector>
 #include <fstream>
+#include "compile/CompilationStatistics.hpp"
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 #include "ilgen/IlBuilder.hpp"
 #include "env/TypedAllocator.hpp"
@@ -34,6 +37,8 @@
 
 class TR_BitVector;
 namespace TR { class BytecodeBuilder; }
+namespace TR { struct InlineCache; }
+namespace TR { class JitBuilderRecorder; }
 namespace TR { class ResolvedMethod; }
 namespace TR { class SymbolReference; }
 namespace TR { class VirtualMachineState; }
@@ -49,6 +54,8 @@ typedef bool (*RequestFunctionCallback)(void *client, const char *name);
 namespace OMR
 {
 
+class JitBuilderRecorder;
+
 class MethodBuilder : public TR::IlBuilder
    {
    public:
@@ -88,7 +95,7 @@ class MethodBuilder : public TR::IlBuilder
    const char *getDefiningLine()                             { return _definingLine; }
 
    const char *GetMethodName()                               { return _methodName; }
-   void AllLocalsHaveBeenDefined()                           { _newSymbolsAreTemps = true; }
+   void AllLocalsHaveBeenDefined();
 
    TR::IlType *getReturnType()                               { return _returnType; }
    int32_t getNumParameters()                                { return _numParameters; }
@@ -122,6 +129,110 @@ class MethodBuilder : public TR::IlBuilder
    void DefineLocal(const char *name, TR::IlType *dt);
    void DefineMemory(const char *name, TR::IlType *dt, void *location);
 
+   /**
+    * @brief Report how many times the method has been invoked so far, for
+    *        example by an interpreter that counts calls before compiling.
+    *
+    * With -Xjit:enableHotCodeCacheLayout, methods whose count reaches
+    * hotCodeCacheInvocationThreshold= are placed in code caches reserved for
+    * hot code.
+    */
+   void SetInvocationCount(int64_t count)                    { _invocationCount = count; }
+   int64_t getInvocationCount()                              { return _invocationCount; }
+
+   /**
+    * @brief Make code compiled from this MethodBuilder count its invocations
+    *        and loop back edges until it has been recompiled.
+    *
+    * While counting is enabled, compiled code first checks whether an entry
+    * has been published with setRecompiledEntry and, if so, forwards the call
+    * to it.  Otherwise it increments the invocation counter and, once that
+    * counter reaches invocationThreshold, calls recompileHelper with this
+    * MethodBuilder as its only argument.  The back edges of loops built with
+    * ForLoop, WhileDoLoop and DoWhileLoop at the top level of the method are
+    * counted the same way against backedgeThreshold; loops built with Goto
+    * and loops in inlined MethodBuilders are not counted.
+    *
+    * recompileHelper is called at most once per threshold crossing and must
+    * be safe to call from any thread running the compiled code.
+    */
+   void enableRecompilationCounting(void *recompileHelper, int32_t invocationThreshold, int32_t backedgeThreshold);
+
+   /**
+    * @brief Stop inserting counters in subsequent compilations, typically
+    *        before recompiling the method at a higher optimization level.
+    */
+   void disableRecompilationCounting()                       { _countForRecompilation = false; }
+   bool countsForRecompilation()                             { return _countForRecompilation; }
+
+   /**
+    * @brief Publish the entry point that code compiled while counting was
+    *        enabled forwards its calls to.  Where the code generator supports
+    *        it, the entry of the last such compilation is also patched with a
+    *        jump to the new entry point.
+    */
+   void setRecompiledEntry(void *entry);
+   void *getRecompiledEntry()                                { return _recompiledEntry; }
+
+   /**
+    * @brief Insert a back edge counter at the current position of the given
+    *        builder, which must belong to this MethodBuilder.
+    */
+   void countBackedge(TR::IlBuilder *loopBuilder);
+
+   /**
+    * @brief Number of call sites built with InlineCacheCall so far, which are
+    *        numbered in the order buildIL builds them
+    */
+   int32_t GetNumInlineCaches()                              { return static_cast<int32_t>(_inlineCaches.size()); }
+
+   /**
+    * @brief Number of targets recorded by the inline cache of a call site
+    */
+   int32_t GetInlineCacheNumTargets(int32_t site);
+
+   /**
+    * @brief A target recorded by the inline cache of a call site, in the
+    *        order the targets were first called
+    */
+   void *GetInlineCacheTarget(int32_t site, int32_t target);
+
+   /**
+    * @brief Number of calls to a target that compiled code made directly
+    */
+   int64_t GetInlineCacheHits(int32_t site, int32_t target);
+
+   /**
+    * @brief Number of calls at a call site that missed every target guarded
+    *        by the code making them
+    */
+   int64_t GetInlineCacheMisses(int32_t site);
+
+   /**
+    * @brief The inline cache of the next call site built by InlineCacheCall,
+    *        created with room for numTargets targets the first time the site
+    *        is built.
+    */
+   TR::InlineCache *nextInlineCache(int32_t numTargets);
+
+   /**
+    * @brief Make nextInlineCache return the cache of the first call site
+    *        again, as each buildIL builds every call site anew.
+    */
+   void resetInlineCacheSites()                              { _nextInlineCache = 0; }
+
+   /**
+    * @brief Insert an increment of counter at the current position of the
+    *        given builder, which must belong to this MethodBuilder.
+    */
+   void generateProfilingCounter(TR::IlBuilder *b, volatile int64_t *counter);
+
+   /**
+    * @brief Insert a call recording target in cache at the current position
+    *        of the given builder, which must belong to this MethodBuilder.
+    */
+   void generateInlineCacheMiss(TR::IlBuilder *b, TR::InlineCache *cache, TR::IlValue *target);
+
    /**
     * @brief Define a global symbol
     * @param name the name by which the global symbol will be referred to
@@ -144,8 +255,103 @@ class MethodBuilder : public TR::IlBuilder
                        int32_t          numParms,
                        TR::IlType     ** parmTypes);
 
+   /**
+    * @brief Call an already defined function through the fast helper linkage.
+    *
+    * A fast helper is passed all its arguments in registers and is trusted to
+    * preserve the registers in preservedRegisters across the call, so values
+    * held in them do not have to be spilled around calls to it.  On x86-64 bit
+    * n of the mask stands for the general purpose register with hardware
+    * encoding n (rax is 0, rcx 1, ..., r15 15) and bit 16+n for xmmn.  A leaf
+    * helper makes no calls itself and does not need the caller to keep the
+    * stack aligned for it.  Code generators that do not support the fast
+    * helper linkage call the function through the system linkage.
+    */
+   void DefineFastHelper(const char *name, int64_t preservedRegisters, bool isLeaf);
+
+   /**
+    * @brief Describe an already defined function as IL so that a call to it
+    *        inlines the given MethodBuilder rather than calling entryPoint.
+    *
+    * A MethodBuilder can only be inlined at one call site, so it is inlined
+    * at the first call to the function each compilation builds and the
+    * remaining calls call entryPoint.
+    *
+    * With -Xjit:enableBenefitInliner, a function that already has an
+    * entryPoint is called instead, and the benefit inliner decides at each
+    * call, from the arguments and the summary kept when the MethodBuilder was
+    * compiled, whether to inline it.
+    */
+   void DefineFunctionIL(const char *name, TR::MethodBuilder *il);
+
+   /**
+    * @brief the MethodBuilder describing function name if it can be inlined
+    *        at the call being built, or NULL if the function has to be called
+    */
+   TR::MethodBuilder *claimFunctionIL(const char *name);
+
+   /**
+    * @brief forget which functions described as IL have been inlined, before
+    *        this builder builds IL for a new compilation
+    */
+   void resetFunctionILs()                                   { _inlinedFunctionILs.clear(); }
+
+   /**
+    * @brief forget the symbols and blocks the last compilation that built IL
+    *        for this builder allocated, which it may have freed since
+    */
+   void forgetCompilation();
+
    int32_t Compile(void **entry);
 
+   /**
+    * @brief Compile the method at the given optimization level rather than
+    *        the default warm.
+    */
+   int32_t Compile(void **entry, TR_Hotness hotness);
+
+   /**
+    * @brief Time, in microseconds, that the most recent compilation of this
+    *        method took from request to installed code, and the time it spent
+    *        generating IL, optimizing and generating code
+    */
+   int64_t GetCompileTime()                                  { return _compilationStatistics._compileTime; }
+   int64_t GetIlGenTime()                                    { return _compilationStatistics._ilGenTime; }
+   int64_t GetOptimizationTime()                             { return _compilationStatistics._optimizationTime; }
+   int64_t GetCodeGenTime()                                  { return _compilationStatistics._codeGenTime; }
+
+   /**
+    * @brief Size in bytes of the code generated by the most recent
+    *        compilation of this method
+    */
+   int32_t GetCompiledCodeSize()                             { return _compilationStatistics._codeSize; }
+
+   /**
+    * @brief Number of IL nodes the most recent compilation of this method
+    *        ended with, the size the inliner weighs it by
+    */
+   int32_t getCompiledNodeCount()                            { return _compilationStatistics._nodeCount; }
+
+   /**
+    * @brief Record the IL built by the next compilation of this method.
+    *
+    * The definitions of the method are recorded when the compilation starts
+    * building IL, followed by every service called while it does, and the
+    * recorder is closed and forgotten once the compilation is done.  A
+    * recording can be compiled again with TR::MethodBuilderReplay.
+    */
+   void setRecorder(TR::JitBuilderRecorder *recorder)       { _recorder = recorder; }
+
+   /**
+    * @brief the recorder services must record to, or NULL if IL is not being recorded
+    */
+   TR::JitBuilderRecorder *recorder()                        { return _recording ? _recorder : NULL; }
+
+   /**
+    * @brief Record the definition of a function the first time a recorded call refers to it
+    */
+   void recordFunction(OMR::JitBuilderRecorder *rec, const char *name);
+
    /**
     * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
     *        mechanism for MethodBuilder subclasses to provide method lookup on demand rather than all up
@@ -296,6 +502,10 @@ class MethodBuilder : public TR::IlBuilder
     */
    const char * adjustNameForInlinedSite(const char *name);
 
+   void generateRecompilationPrologue();
+   void recordDefinitions();
+   void generateRecompilationCounter(TR::IlBuilder *b, volatile int32_t *counter, int32_t threshold);
+
    private:
    // We have MemoryManager as the first member of TypeDictionary, so that
    // it is the last one to get destroyed and all objects allocated using
@@ -348,6 +558,12 @@ class MethodBuilder : public TR::IlBuilder
    // This set acts as an identifier for symbols which correspond to arrays
    ArrayIdentifierSet          _symbolIsArray;
 
+   // Names added to _symbolTypes while compiling, which can point into the
+   // compilation's memory (see IlValue::storeToAuto), compared by address
+   // because they are only removed once that memory is gone
+   typedef std::set<const char *, std::less<const char *>, StringSetAllocator> SymbolNameSet;
+   SymbolNameSet               _symbolsDefinedByCompilation;
+
    typedef TR::typed_allocator<std::pair<const char * const, void *>, TR::Region &> MemoryLocationMapAllocator;
    typedef std::map<const char *, void *, StrComparator, MemoryLocationMapAllocator> MemoryLocationMap;
    MemoryLocationMap           _memoryLocations;
@@ -365,6 +581,10 @@ class MethodBuilder : public TR::IlBuilder
    typedef std::map<const char *, TR::ResolvedMethod *, StrComparator, FunctionMapAllocator> FunctionMap;
    FunctionMap                 _functions;
 
+   typedef TR::typed_allocator<std::pair<const char * const, TR::MethodBuilder *>, TR::Region &> FunctionILMapAllocator;
+   typedef std::map<const char *, TR::MethodBuilder *, StrComparator, FunctionILMapAllocator> FunctionILMap;
+   FunctionILMap               _functionILs;
+
    TR::IlType                ** _cachedParameterTypes;
    const char                * _definingFile;
    char                        _definingLine[MAX_LINE_NUM_LEN];
@@ -385,9 +605,35 @@ class MethodBuilder : public TR::IlBuilder
 
    int32_t                     _inlineSiteIndex;
    int32_t                     _nextInlineSiteIndex;
+   int64_t                     _invocationCount;
    TR::IlBuilder             * _returnBuilder;
    const char                * _returnSymbolName;
 
+   bool                        _countForRecompilation;
+   int32_t                     _invocationThreshold;
+   int32_t                     _backedgeThreshold;
+   volatile int32_t            _invocationCounter;
+   volatile int32_t            _backedgeCounter;
+   void * volatile             _recompiledEntry;
+   bool                        _entryIsPatchable; // set while building IL for a patchable entry
+   void                      * _patchableEntry;
+
+   // Inline caches live as long as this MethodBuilder, so that compiled code
+   // may record targets in them and later compilations may guard those
+   typedef TR::typed_allocator<TR::InlineCache *, TR::Region &> InlineCacheVectorAllocator;
+   typedef std::vector<TR::InlineCache *, InlineCacheVectorAllocator> InlineCacheVector;
+   InlineCacheVector           _inlineCaches;
+
+   typedef TR::typed_allocator<TR::MethodBuilder *, TR::Region &> MethodBuilderVectorAllocator;
+   typedef std::vector<TR::MethodBuilder *, MethodBuilderVectorAllocator> MethodBuilderVector;
+   MethodBuilderVector         _inlinedFunctionILs;
+   int32_t                     _nextInlineCache;
+
+   TR::CompilationStatistics   _compilationStatistics;
+
+   TR::JitBuilderRecorder    * _recorder;
+   bool                        _recording;
+
 private:
    static ClientAllocator      _clientAllocator;
    static ImplGetter _getImpl;
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_METHODBUILDERREPLAY_INCL
+#define OMR_METHODBUILDERREPLAY_INCL
+
+#include "ilgen/MethodBuilder.hpp"
+
+namespace TR { class JitBuilderReplay; }
+
+namespace OMR
+{
+
+/**
+ * @brief a MethodBuilder whose definitions and IL come from a recording
+ *
+ * A MethodBuilder that was given a recorder with setRecorder() writes down
+ * every service it is asked for while it is defined and while it builds its
+ * IL.  MethodBuilderReplay asks for the same services in the same order, so
+ * the method can be compiled again later, on another thread or in another
+ * process, without the code that originally built it.  Recordings also make
+ * a corpus of methods for measuring compile time.
+ *
+ * Check failed() on the replay object after construction and after
+ * compilation: a recording that cannot be replayed fails to compile.
+ */
+class MethodBuilderReplay : public TR::MethodBuilder
+   {
+   public:
+   TR_ALLOC(TR_Memory::IlGenerator)
+
+   /**
+    * @brief construct a MethodBuilder from the definitions in a recording
+    * @param types TypeDictionary object that will be used by the MethodBuilderReplay object
+    * @param replay reader for the recording, which must outlive the compiled method
+    * @param vmState optional virtual machine state, as for any MethodBuilder
+    */
+   MethodBuilderReplay(TR::TypeDictionary *types, TR::JitBuilderReplay *replay, TR::VirtualMachineState *vmState = NULL);
+   virtual ~MethodBuilderReplay() { }
+
+   virtual bool buildIL();
+
+   private:
+   TR::JitBuilderReplay * _replay;
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_METHODBUILDERREPLAY_INCL)
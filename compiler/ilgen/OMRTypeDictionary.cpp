@@ -32,7 +32,6 @@
 #include "env/SystemSegmentProvider.hpp"
 #include "env/TRMemory.hpp"
 #include "infra/Assert.hpp"
-#include "infra/BitVector.hpp"
 #include "infra/STLUtils.hpp"
 
 
@@ -75,15 +74,10 @@ public:
       _next(0),
       _name(name),
       _offset(offset),
-      _type(type),
-      _symRef(0)
+      _type(type)
       {
       }
 
-   void cacheSymRef(TR::SymbolReference *symRef)    { _symRef = symRef; }
-   TR::SymbolReference *getSymRef()                 { return _symRef; }
-   void clearSymRef()                               { _symRef = NULL; }
-
    TR::IlType *getType()                            { return _type; }
 
    TR::IlType *primitiveType(TR::TypeDictionary *d) { return _type->primitiveType(d); }
@@ -100,7 +94,6 @@ public:
    const char          * _name;
    size_t                _offset;
    TR::IlType          * _type;
-   TR::SymbolReference * _symRef;
    };
 
 
@@ -129,12 +122,10 @@ public:
    TR::IlType * getFieldType(const char *fieldName);
    size_t getFieldOffset(const char *fieldName);
 
-   TR::SymbolReference *getFieldSymRef(const char *name);
+   TR::SymbolReference *getFieldSymRef(const char *name, OMR::FieldSymRefs &symRefs);
    bool isStruct() { return true; }
    virtual size_t getSize() { return _size; }
 
-   void clearSymRefs();
-
 protected:
    FieldInfo * findField(const char *fieldName);
 
@@ -149,14 +140,12 @@ class UnionType : public TR::IlType
 public:
    TR_ALLOC(TR_Memory::IlGenerator)
 
-   UnionType(const char *name, TR_Memory* trMemory) :
+   UnionType(const char *name) :
       TR::IlType(name),
       _firstField(0),
       _lastField(0),
       _size(0),
-      _closed(false),
-      _symRefBV(4, trMemory),
-      _trMemory(trMemory)
+      _closed(false)
       { }
    virtual ~UnionType()
       { }
@@ -168,12 +157,10 @@ public:
    void AddField(const char *name, TR::IlType *fieldType);
    TR::IlType * getFieldType(const char *fieldName);
 
-   TR::SymbolReference *getFieldSymRef(const char *name);
+   TR::SymbolReference *getFieldSymRef(const char *name, OMR::FieldSymRefs &symRefs);
    virtual bool isUnion() { return true; }
    virtual size_t getSize() { return _size; }
 
-   void clearSymRefs();
-
 protected:
    FieldInfo *  findField(const char *fieldName);
 
@@ -181,8 +168,6 @@ protected:
    FieldInfo *  _lastField;
    size_t       _size;
    bool         _closed;
-   TR_BitVector _symRefBV;
-   TR_Memory*   _trMemory;
    };
 
 class PointerType : public TR::IlType
@@ -287,13 +272,13 @@ OMR::StructType::getFieldOffset(const char *fieldName)
    }
 
 TR::SymbolReference *
-OMR::StructType::getFieldSymRef(const char *fieldName)
+OMR::StructType::getFieldSymRef(const char *fieldName, OMR::FieldSymRefs &symRefs)
    {
    OMR::FieldInfo *info = findField(fieldName);
    if (NULL == info)
       return NULL;
 
-   TR::SymbolReference *symRef = info->getSymRef();
+   TR::SymbolReference *&symRef = symRefs._fields[info];
    if (NULL == symRef)
       {
       TR::Compilation *comp = TR::comp();
@@ -316,24 +301,11 @@ OMR::StructType::getFieldSymRef(const char *fieldName)
          comp->getSymRefTab()->aliasBuilder.intShadowSymRefs().set(refNum);
       else
          comp->getSymRefTab()->aliasBuilder.nonIntPrimitiveShadowSymRefs().set(refNum);
-
-      info->cacheSymRef(symRef);
       }
 
    return symRef;
    }
 
-void
-OMR::StructType::clearSymRefs()
-   {
-   OMR::FieldInfo *field = _firstField;
-   while (field)
-      {
-      field->clearSymRef();
-      field = field->_next;
-      }
-   }
-
 
 void
 OMR::UnionType::AddField(const char *name, TR::IlType *typeInfo)
@@ -381,15 +353,15 @@ OMR::UnionType::getFieldType(const char *fieldName)
    }
 
 TR::SymbolReference *
-OMR::UnionType::getFieldSymRef(const char *fieldName)
+OMR::UnionType::getFieldSymRef(const char *fieldName, OMR::FieldSymRefs &symRefs)
    {
    OMR::FieldInfo *info = findField(fieldName);
    TR_ASSERT_FATAL(info, "Struct %s has no field with name %s\n", getName(), fieldName);
 
-   TR::SymbolReference *symRef = info->getSymRef();
+   TR::SymbolReference *&symRef = symRefs._fields[info];
    if (NULL == symRef)
       {
-      // create a symref for the new field and set its bitvector
+      // create a symref for the new field, aliased with the other fields of this union used by the compilation
       TR::Compilation *comp = TR::comp();
       auto symRefTab = comp->getSymRefTab();
       TR::DataType type = info->getPrimitiveType();
@@ -401,32 +373,16 @@ OMR::UnionType::getFieldSymRef(const char *fieldName)
       symRef->setOffset(0);
       symRef->setReallySharesSymbol();
 
-      TR_SymRefIterator sit(_symRefBV, symRefTab);
-      for (TR::SymbolReference *sr = sit.getNext(); sr; sr = sit.getNext())
-          {
-          symRefTab->makeSharedAliases(symRef, sr);
-          }
-
-      _symRefBV.set(symRef->getReferenceNumber());
+      std::vector<TR::SymbolReference *> &unionFields = symRefs._unionFields[this];
+      for (size_t i = 0; i < unionFields.size(); i++)
+         symRefTab->makeSharedAliases(symRef, unionFields[i]);
 
-      info->cacheSymRef(symRef);
+      unionFields.push_back(symRef);
       }
 
    return symRef;
    }
 
-void
-OMR::UnionType::clearSymRefs()
-   {
-   OMR::FieldInfo *field = _firstField;
-   while (field)
-      {
-      field->clearSymRef();
-      field = field->_next;
-      }
-   _symRefBV.init(4, _trMemory);
-   }
-
 
 // Note: _memoryRegion and the corresponding TR::SegmentProvider and TR::Memory instances are stored as pointers within TypeDictionary
 // in order to avoid increasing the number of header files needed to compile against the JitBuilder library. Because we are storing
@@ -517,18 +473,21 @@ OMR::TypeDictionary::~TypeDictionary() throw()
 TR::IlType *
 OMR::TypeDictionary::LookupStruct(const char *structName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    return getStruct(structName);
    }
 
 TR::IlType *
 OMR::TypeDictionary::LookupUnion(const char *unionName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    return getUnion(unionName);
    }
 
 TR::IlType *
 OMR::TypeDictionary::DefineStruct(const char *structName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    TR_ASSERT_FATAL(_structsByName.find(structName) == _structsByName.end(), "Struct '%s' already exists", structName);
 
    OMR::StructType *newType = new (PERSISTENT_NEW) OMR::StructType(structName);
@@ -540,45 +499,52 @@ OMR::TypeDictionary::DefineStruct(const char *structName)
 void
 OMR::TypeDictionary::DefineField(const char *structName, const char *fieldName, TR::IlType *type, size_t offset)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    getStruct(structName)->AddField(fieldName, type, offset);
    }
 
 void
 OMR::TypeDictionary::DefineField(const char *structName, const char *fieldName, TR::IlType *type)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    getStruct(structName)->AddField(fieldName, type);
    }
 
 TR::IlType *
 OMR::TypeDictionary::GetFieldType(const char *structName, const char *fieldName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    return getStruct(structName)->getFieldType(fieldName);
    }
 
 size_t
 OMR::TypeDictionary::OffsetOf(const char *structName, const char *fieldName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    return getStruct(structName)->getFieldOffset(fieldName);
    }
 
 void
 OMR::TypeDictionary::CloseStruct(const char *structName, size_t finalSize)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    getStruct(structName)->Close(finalSize);
    }
 
 void
 OMR::TypeDictionary::CloseStruct(const char *structName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    getStruct(structName)->Close();
    }
 
 TR::IlType *
 OMR::TypeDictionary::DefineUnion(const char *unionName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    TR_ASSERT_FATAL(_unionsByName.find(unionName) == _unionsByName.end(), "Union '%s' already exists", unionName);
 
-   OMR::UnionType *newType = new (PERSISTENT_NEW) OMR::UnionType(unionName, trMemory());
+   OMR::UnionType *newType = new (PERSISTENT_NEW) OMR::UnionType(unionName);
    _unionsByName.insert(std::make_pair(unionName, newType));
 
    return newType;
@@ -587,18 +553,21 @@ OMR::TypeDictionary::DefineUnion(const char *unionName)
 void
 OMR::TypeDictionary::UnionField(const char *unionName, const char *fieldName, TR::IlType *type)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    getUnion(unionName)->AddField(fieldName, type);
    }
 
 void
 OMR::TypeDictionary::CloseUnion(const char *unionName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    getUnion(unionName)->Close();
    }
 
 TR::IlType *
 OMR::TypeDictionary::UnionFieldType(const char *unionName, const char *fieldName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
    return getUnion(unionName)->getFieldType(fieldName);
    }
 
@@ -617,18 +586,21 @@ OMR::TypeDictionary::PointerTo(TR::IlType *baseType)
 TR::IlReference *
 OMR::TypeDictionary::FieldReference(const char *typeName, const char *fieldName)
    {
+   std::lock_guard<std::mutex> lock(_lock);
+   OMR::FieldSymRefs &symRefs = _fieldSymRefs[std::this_thread::get_id()];
+
    StructMap::iterator structIterator = _structsByName.find(typeName);
    if (structIterator != _structsByName.end())
       {
       OMR::StructType *theStruct = structIterator->second;
-      return new (PERSISTENT_NEW) TR::IlReference(theStruct->getFieldSymRef(fieldName));
+      return new (PERSISTENT_NEW) TR::IlReference(theStruct->getFieldSymRef(fieldName, symRefs));
       }
 
    UnionMap::iterator unionIterator = _unionsByName.find(typeName);
    if (unionIterator != _unionsByName.end())
       {
       OMR::UnionType *theUnion = unionIterator->second;
-      return new (PERSISTENT_NEW) TR::IlReference(theUnion->getFieldSymRef(fieldName));
+      return new (PERSISTENT_NEW) TR::IlReference(theUnion->getFieldSymRef(fieldName, symRefs));
       }
 
    TR_ASSERT_FATAL(false, "No type with name '%s'", typeName);
@@ -638,19 +610,10 @@ OMR::TypeDictionary::FieldReference(const char *typeName, const char *fieldName)
 void
 OMR::TypeDictionary::NotifyCompilationDone()
    {
-   // clear all symbol references for fields
-   for (StructMap::iterator it = _structsByName.begin(); it != _structsByName.end(); it++)
-      {
-      OMR::StructType *aStruct = it->second;
-      aStruct->clearSymRefs();
-      }
-
-   // clear all symbol references for union fields
-   for (UnionMap::iterator it = _unionsByName.begin(); it != _unionsByName.end(); it++)
-      {
-      OMR::UnionType *aUnion = it->second;
-      aUnion->clearSymRefs();
-      }
+   // only the symbol references of the compilation that ran on this thread
+   // are dead, others may be in use by compilations on other threads
+   std::lock_guard<std::mutex> lock(_lock);
+   _fieldSymRefs.erase(std::this_thread::get_id());
    }
 
 OMR::StructType *
@@ -24,15 +24,20 @@
 
 
 #include "map"
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "ilgen/IlBuilder.hpp"
 #include "env/TypedAllocator.hpp"
 #include "infra/Uncopyable.hpp"
 
 class TR_Memory;
 
+namespace OMR { class FieldInfo; }
 namespace OMR { class StructType; }
 namespace OMR { class UnionType; }
 namespace TR  { class IlReference; }
+namespace TR  { class SymbolReference; }
 namespace TR  { class SegmentProvider; }
 namespace TR  { class Region; }
 
@@ -44,6 +49,22 @@ typedef void * (*ImplGetter)(void *client);
 namespace OMR
 {
 
+/**
+ * @brief the symbol references created for fields by one compilation
+ */
+struct FieldSymRefs
+   {
+   std::map<OMR::FieldInfo *, TR::SymbolReference *> _fields;
+
+   // the symbol references of each union's fields, which all alias each other
+   std::map<OMR::UnionType *, std::vector<TR::SymbolReference *> > _unionFields;
+   };
+
+/**
+ * A TypeDictionary can be shared by MethodBuilders generating IL and compiling
+ * on different threads.  Types are best defined before the dictionary is
+ * shared, but every operation is safe to call from any thread.
+ */
 class TypeDictionary : private TR::Uncopyable
    {
 public:
@@ -157,7 +178,7 @@ public:
    TR::IlType *getWord() { return Word; }
 
    /*
-    * @brief advise that compilation is complete so compilation-specific objects like symbol references can be cleared from caches
+    * @brief advise that the compilation running on the calling thread is complete so compilation-specific objects like symbol references can be cleared from caches
     */
    void NotifyCompilationDone();
 
@@ -239,6 +260,20 @@ protected:
    typedef std::map<const char *, OMR::UnionType *, StrComparator, UnionMapAllocator> UnionMap;
    UnionMap           _unionsByName;
 
+   /**
+    * @brief symbol references for fields, by the thread whose compilation created them
+    *
+    * A thread runs one compilation at a time, so keeping them per thread keeps
+    * compilations on different threads from using each other's symbol references.
+    */
+   typedef std::map<std::thread::id, OMR::FieldSymRefs> FieldSymRefsMap;
+   FieldSymRefsMap    _fieldSymRefs;
+
+   /**
+    * @brief guards the type maps, the fields of the types and _fieldSymRefs
+    */
+   std::mutex         _lock;
+
 public:
    // convenience for primitive types
    TR::IlType       * _primitiveType[TR::NumAllTypes];
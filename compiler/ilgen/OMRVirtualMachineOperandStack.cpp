@@ -37,6 +37,7 @@ OMR::VirtualMachineOperandStack::VirtualMachineOperandStack(TR::MethodBuilder *m
    _stackTopRegister(stackTopRegister),
    _stackMax(sizeHint),
    _stackTop(-1),
+   _elideCommits(false),
    _elementType(elementType),
    _pushAmount(growsUp ? +1 : -1),
    _stackOffset(stackInitialOffset)
@@ -50,6 +51,7 @@ OMR::VirtualMachineOperandStack::VirtualMachineOperandStack(TR::VirtualMachineOp
    _stackTopRegister(other->_stackTopRegister),
    _stackMax(other->_stackMax),
    _stackTop(other->_stackTop),
+   _elideCommits(other->_elideCommits),
    _elementType(other->_elementType),
    _pushAmount(other->_pushAmount),
    _stackOffset(other->_stackOffset),
@@ -58,6 +60,8 @@ OMR::VirtualMachineOperandStack::VirtualMachineOperandStack(TR::VirtualMachineOp
    int32_t numBytes = _stackMax * sizeof(TR::IlValue *);
    _stack = (TR::IlValue **) TR::comp()->trMemory()->allocateHeapMemory(numBytes);
    memcpy(_stack, other->_stack, numBytes);
+   _committed = (bool *) TR::comp()->trMemory()->allocateHeapMemory(_stackMax * sizeof(bool));
+   memcpy(_committed, other->_committed, _stackMax * sizeof(bool));
    }
 
 
@@ -65,12 +69,25 @@ OMR::VirtualMachineOperandStack::VirtualMachineOperandStack(TR::VirtualMachineOp
 // the given builder object is where the operations to commit the state will be inserted
 // the top of the stack is assumed to be managed independently, most likely
 //    as a VirtualMachineRegister or a VirtualMachineRegisterInStruct
+// with commit elision, values the virtual machine stack already holds are not stored again
 void
 OMR::VirtualMachineOperandStack::Commit(TR::IlBuilder *b)
    {
-   TR::IlType *Element = _elementType;
-   TR::IlType *pElement = _mb->typeDictionary()->PointerTo(Element);
+   commitElements(b, _stackTop+1);
+   }
 
+// commits only the top "depth" values, the ones live across the commit point
+// deeper values not yet on the virtual machine stack are left to the next Commit
+void
+OMR::VirtualMachineOperandStack::CommitTop(TR::IlBuilder *b, int32_t depth)
+   {
+   TR_ASSERT_FATAL(depth >= 0 && depth <= _stackTop+1, "commit depth exceeds stack depth");
+   commitElements(b, depth);
+   }
+
+void
+OMR::VirtualMachineOperandStack::commitElements(TR::IlBuilder *b, int32_t depth)
+   {
    TR::IlValue *stack = b->Load(_stackBaseName);
 
    // Adjust the vm _stackTopRegister by number of elements that have been pushed onto the stack.
@@ -78,33 +95,57 @@ OMR::VirtualMachineOperandStack::Commit(TR::IlBuilder *b)
    _stackTopRegister->Store(b, stack);
    _stackTopRegister->Adjust(b, (_stackTop+1)*_pushAmount);
 
-   for (int32_t i = _stackTop;i >= 0;i--)
+   for (int32_t i = _stackTop;i > _stackTop - depth;i--)
       {
       // TBD: how to handle hitting the end of stack?
-
-      b->StoreAt(
-      b->   IndexAt(pElement,
-               stack,
-      b->      ConstInt32(i - _stackOffset)),
-            Pick(_stackTop-i)); // should generalize, maybe delegate element storage ?
+      if (!_elideCommits || !_committed[i])
+         storeElement(b, stack, i);
+      _committed[i] = true;
       }
    }
 
+void
+OMR::VirtualMachineOperandStack::storeElement(TR::IlBuilder *b, TR::IlValue *stack, int32_t i)
+   {
+   TR::IlType *Element = _elementType;
+   TR::IlType *pElement = _mb->typeDictionary()->PointerTo(Element);
+
+   b->StoreAt(
+   b->   IndexAt(pElement,
+            stack,
+   b->      ConstInt32(i - _stackOffset)),
+         _stack[i]); // should generalize, maybe delegate element storage ?
+   }
+
 void
 OMR::VirtualMachineOperandStack::Reload(TR::IlBuilder* b)
+   {
+   // If the # of stack element has changed, the user should adjust the # of elements
+   // using Drop beforehand to add/delete stack elements.
+   reloadElements(b, _stackTop+1);
+   }
+
+void
+OMR::VirtualMachineOperandStack::ReloadTop(TR::IlBuilder* b, int32_t depth)
+   {
+   TR_ASSERT_FATAL(depth >= 0 && depth <= _stackTop+1, "reload depth exceeds stack depth");
+   reloadElements(b, depth);
+   }
+
+void
+OMR::VirtualMachineOperandStack::reloadElements(TR::IlBuilder* b, int32_t depth)
    {
    TR::IlType* Element = _elementType;
    TR::IlType* pElement = _mb->typeDictionary()->PointerTo(Element);
    // reload the elements back into the simulated operand stack
-   // If the # of stack element has changed, the user should adjust the # of elements
-   // using Drop beforehand to add/delete stack elements.
    TR::IlValue* stack = b->Load(_stackBaseName);
-   for (int32_t i = _stackTop; i >= 0; i--)
+   for (int32_t i = _stackTop; i > _stackTop - depth; i--)
       {
       _stack[i] = b->LoadAt(pElement,
                   b->   IndexAt(pElement,
                            stack,
                   b->      ConstInt32(i - _stackOffset)));
+      _committed[i] = true;
        }
    }
 
@@ -113,8 +154,18 @@ OMR::VirtualMachineOperandStack::MergeInto(TR::VirtualMachineState* o, TR::IlBui
    {
    TR::VirtualMachineOperandStack *other = static_cast<TR::VirtualMachineOperandStack *>(o);
    TR_ASSERT_FATAL(_stackTop == other->_stackTop, "stacks are not same size");
+   TR::IlValue *stack = NULL;
    for (int32_t i=_stackTop;i >= 0;i--)
       {
+      // code at the merge point may count on the virtual machine stack holding
+      // a value that it does not hold on this path
+      if (_elideCommits && other->_committed[i] && !_committed[i])
+         {
+         if (stack == NULL)
+            stack = b->Load(_stackBaseName);
+         storeElement(b, stack, i);
+         }
+
       // only need to do something if the two entries aren't already the same
       if (other->_stack[i]->getID() != _stack[i]->getID())
          {
@@ -135,6 +186,9 @@ void
 OMR::VirtualMachineOperandStack::UpdateStack(TR::IlBuilder *b, TR::IlValue *stack)
    {
    b->Store(_stackBaseName, stack);
+
+   // the moved stack cannot be assumed to hold any committed value
+   memset(_committed, 0, _stackMax * sizeof(bool));
    }
 
 // Allocate a new operand stack and copy everything in this state
@@ -153,6 +207,7 @@ OMR::VirtualMachineOperandStack::Push(TR::IlBuilder *b, TR::IlValue *value)
    {
    checkSize();
    _stack[++_stackTop] = value;
+   _committed[_stackTop] = false;
    }
 
 TR::IlValue *
@@ -181,6 +236,10 @@ OMR::VirtualMachineOperandStack::Drop(TR::IlBuilder *b, int32_t depth)
    {
    TR_ASSERT_FATAL(_stackTop >= depth-1, "stack underflow");
    _stackTop-=depth;
+
+   // a negative depth adds elements the virtual machine stack is yet to be reloaded from
+   for (int32_t i = _stackTop + depth + 1; i <= _stackTop; i++)
+      _committed[i] = false;
    }
 
 void
@@ -222,7 +281,12 @@ OMR::VirtualMachineOperandStack::grow(int32_t growAmount)
    int32_t numBytes = _stackMax * sizeof(TR::IlValue *);
    memcpy(newStack, _stack, numBytes);
 
+   bool *newCommitted = (bool *) TR::comp()->trMemory()->allocateHeapMemory(newMax * sizeof(bool));
+   memset(newCommitted, 0, newMax * sizeof(bool));
+   memcpy(newCommitted, _committed, _stackMax * sizeof(bool));
+
    _stack = newStack;
+   _committed = newCommitted;
    _stackMax = newMax;
    }
 
@@ -243,6 +307,8 @@ OMR::VirtualMachineOperandStack::init()
    int32_t numBytes = _stackMax * sizeof(TR::IlValue *);
    _stack = (TR::IlValue **) TR::comp()->trMemory()->allocateHeapMemory(numBytes);
    memset(_stack, 0, numBytes);
+   _committed = (bool *) TR::comp()->trMemory()->allocateHeapMemory(_stackMax * sizeof(bool));
+   memset(_committed, 0, _stackMax * sizeof(bool));
 
    TR::Compilation *comp = TR::comp();
    // Create a temp for the OperandStack base
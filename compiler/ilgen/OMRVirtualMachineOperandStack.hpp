@@ -59,9 +59,16 @@ namespace OMR
  * VirtualMachineOperandStack implements VirtualMachineState:
  * Commit() simply iterates over the simulated operand stack and stores each
  *   value onto the virtual machine's operand stack (more details at definition).
+ *   With SetCommitElision(true), only the values that the virtual machine's
+ *   operand stack may not already hold are stored.
+ * CommitTop() stores only the values that are live across the commit point:
+ *   the given number of values at the top of the stack. Deeper values that
+ *   have not been stored stay in the simulated operand stack until a later
+ *   Commit() writes them, typically where control leaves compiled code.
  * Reload() is left empty; assumption is that each BytecodeBuilder handler will
  *   update the state of the operand stack appropriately on return from the
  *   interpreter.
+ * ReloadTop() reloads only the given number of values at the top of the stack.
  * MakeCopy() copies the state of the operand stack
  * MergeInto() is slightly subtle. Operations may have been already created
  *   below the merge point, and those operations will have assumed the
@@ -116,6 +123,30 @@ class VirtualMachineOperandStack : public TR::VirtualMachineState
     */
    virtual void Commit(TR::IlBuilder *b);
    
+   /**
+    * @brief only store, on Commit, the values that may differ from those on the virtual machine stack
+    * @param elide true to elide the stores of values already on the virtual machine stack
+    * A value is known to be on the virtual machine stack from the Commit or Reload that
+    * stored or loaded it, on every path to the Commit, until it is popped or dropped.
+    * Values pushed since, and all values after an UpdateStack, are stored as usual.
+    * Elision assumes that nothing but Commit writes the virtual machine stack
+    * elements that are still on the simulated operand stack; code that does must
+    * Reload them. Must be set before the stack is first copied.
+    */
+   void SetCommitElision(bool elide) { _elideCommits = elide; }
+
+   /**
+    * @brief write the top of the simulated operand stack to the virtual machine
+    * @param b the builder where the operations will be placed to recreate the virtual machine operand stack
+    * @param depth how many values at the top of the stack are live across the commit point
+    * The virtual machine stack top is adjusted for the whole stack, but only the top
+    * depth values are stored; with commit elision, only those not already stored.
+    * Deeper values keep their simulated values and are stored by the next Commit.
+    * Code reached before that Commit must only access the top depth elements of the
+    * virtual machine stack; use ReloadTop to read back any it writes.
+    */
+   void CommitTop(TR::IlBuilder *b, int32_t depth);
+
    /**
     * @brief read the virtual machine stack back into the simulated operand stack
     * @param b the builder where the operations will be placed to recreate the simulated operand stack 
@@ -124,6 +155,14 @@ class VirtualMachineOperandStack : public TR::VirtualMachineState
     */
    virtual void Reload(TR::IlBuilder *b);
 
+   /**
+    * @brief read the top of the virtual machine stack back into the simulated operand stack
+    * @param b the builder where the operations will be placed to recreate the simulated operand stack
+    * @param depth how many values at the top of the stack to reload
+    * Deeper values keep their simulated values, so this is the counterpart of CommitTop.
+    */
+   void ReloadTop(TR::IlBuilder *b, int32_t depth);
+
    /**
     * @brief create an identical copy of the current object.
     * @returns the copy of the current object
@@ -212,6 +251,9 @@ class VirtualMachineOperandStack : public TR::VirtualMachineState
    void checkSize();
    void grow(int32_t growAmount = 0);
    void init();
+   void storeElement(TR::IlBuilder *b, TR::IlValue *stack, int32_t i);
+   void commitElements(TR::IlBuilder *b, int32_t depth);
+   void reloadElements(TR::IlBuilder *b, int32_t depth);
 
    private:
    TR::MethodBuilder *_mb;
@@ -219,6 +261,8 @@ class VirtualMachineOperandStack : public TR::VirtualMachineState
    int32_t _stackMax;
    int32_t _stackTop;
    TR::IlValue **_stack;
+   bool *_committed;          // whether the virtual machine stack holds each value of _stack
+   bool _elideCommits;
    TR::IlType *_elementType;
    int32_t _pushAmount;
    int32_t _stackOffset;
@@ -0,0 +1,885 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "infra/AdaptiveBitVector.hpp"
+
+#include <stdint.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "env/Region.hpp"
+#include "infra/Bit.hpp"
+#include "infra/BitVector.hpp"
+#include "ras/Debug.hpp"
+
+#define BLOCK_OFFSET_MASK       (ADAPTIVE_BV_BLOCK_BITS - 1)
+#define INITIAL_ARRAY_CAPACITY  4
+#define INITIAL_BLOCK_CAPACITY  4
+
+static inline uint64_t bitMask(int32_t offset)
+   {
+   return ((uint64_t)1) << (offset & 63);
+   }
+
+// Mask covering bits lo to hi inclusive of a single word
+//
+static inline uint64_t rangeMask(int32_t lo, int32_t hi)
+   {
+   uint64_t upper = (hi == 63) ? ~((uint64_t)0) : ((((uint64_t)1) << (hi + 1)) - 1);
+   return upper & ~(bitMask(lo) - 1);
+   }
+
+static inline int32_t countBitmap(uint64_t *words)
+   {
+   int32_t count = 0;
+   for (int32_t w = 0; w < ADAPTIVE_BV_BITMAP_WORDS; w++)
+      count += populationCount((int64_t)words[w]);
+   return count;
+   }
+
+// Return the position of offset in a sorted array, or where it would be inserted
+//
+static inline int32_t searchArray(uint16_t *data, int32_t count, uint16_t offset)
+   {
+   int32_t lo = 0, hi = count;
+   while (lo < hi)
+      {
+      int32_t mid = (lo + hi) >> 1;
+      if (data[mid] < offset)
+         lo = mid + 1;
+      else
+         hi = mid;
+      }
+   return lo;
+   }
+
+TR_AdaptiveBitVector::TR_AdaptiveBitVector(TR::Region &region)
+   : _region(&region), _blocks(NULL), _numBlocks(0), _blockCapacity(0)
+   {
+   }
+
+TR_AdaptiveBitVector::TR_AdaptiveBitVector(int64_t initBits, TR::Region &region)
+   : _region(&region), _blocks(NULL), _numBlocks(0), _blockCapacity(0)
+   {
+   }
+
+TR_AdaptiveBitVector::TR_AdaptiveBitVector(int64_t initBits, TR_Memory *m, TR_AllocationKind allocKind)
+   : _region(NULL), _blocks(NULL), _numBlocks(0), _blockCapacity(0)
+   {
+   switch (allocKind)
+      {
+      case heapAlloc:
+         _region = &(m->heapMemoryRegion());
+         break;
+      case stackAlloc:
+         _region = &(m->currentStackRegion());
+         break;
+      case persistentAlloc:
+         _region = NULL;
+         break;
+      default:
+         TR_ASSERT(false, "Unhandled allocation type!");
+      }
+   }
+
+void *TR_AdaptiveBitVector::allocateData(size_t size)
+   {
+   if (_region != NULL)
+      return _region->allocate(size);
+   return TR_Memory::jitPersistentAlloc(size, TR_Memory::BitVector);
+   }
+
+void TR_AdaptiveBitVector::releaseData(void *p, size_t size)
+   {
+   if (p == NULL)
+      return;
+   if (_region != NULL)
+      _region->deallocate(p, size);
+   else
+      TR_Memory::jitPersistentFree(p);
+   }
+
+// Return the index of the block with the given key, or -(insertion point)-1
+// if there is no such block
+//
+int32_t TR_AdaptiveBitVector::findBlock(uint32_t key)
+   {
+   int32_t lo = 0, hi = _numBlocks - 1;
+   while (lo <= hi)
+      {
+      int32_t mid = (lo + hi) >> 1;
+      uint32_t midKey = _blocks[mid]._key;
+      if (midKey < key)
+         lo = mid + 1;
+      else if (midKey > key)
+         hi = mid - 1;
+      else
+         return mid;
+      }
+   return -lo - 1;
+   }
+
+TR_AdaptiveBitVector::Block *TR_AdaptiveBitVector::findOrInsertBlock(uint32_t key)
+   {
+   int32_t index = findBlock(key);
+   if (index >= 0)
+      return &_blocks[index];
+
+   index = -index - 1;
+   ensureBlockCapacity(_numBlocks + 1);
+
+   // The slot just past the live blocks holds the storage of a retired block,
+   // if any; carry it into the new block
+   //
+   Block spare = _blocks[_numBlocks];
+   memmove(&_blocks[index + 1], &_blocks[index], (_numBlocks - index) * sizeof(Block));
+   _numBlocks++;
+
+   Block &block = _blocks[index];
+   block = spare;
+   block._key = key;
+   block._count = 0;
+   block._isBitmap = false;
+   return &block;
+   }
+
+void TR_AdaptiveBitVector::removeBlock(int32_t index)
+   {
+   Block retired = _blocks[index];
+   memmove(&_blocks[index], &_blocks[index + 1], (_numBlocks - index - 1) * sizeof(Block));
+   _numBlocks--;
+   _blocks[_numBlocks] = retired;
+   }
+
+void TR_AdaptiveBitVector::ensureBlockCapacity(int32_t numBlocks)
+   {
+   if (numBlocks <= _blockCapacity)
+      return;
+
+   int32_t newCapacity = _blockCapacity ? _blockCapacity * 2 : INITIAL_BLOCK_CAPACITY;
+   if (newCapacity < numBlocks)
+      newCapacity = numBlocks;
+
+   Block *newBlocks = (Block *)allocateData(newCapacity * sizeof(Block));
+   if (_blockCapacity)
+      memcpy(newBlocks, _blocks, _blockCapacity * sizeof(Block));
+   memset(&newBlocks[_blockCapacity], 0, (newCapacity - _blockCapacity) * sizeof(Block));
+   releaseData(_blocks, _blockCapacity * sizeof(Block));
+
+   _blocks = newBlocks;
+   _blockCapacity = newCapacity;
+   }
+
+void TR_AdaptiveBitVector::ensureDataCapacity(Block &block, int32_t capacity, bool preserveContents)
+   {
+   if (block._capacity >= capacity)
+      return;
+
+   TR_ASSERT(capacity <= ADAPTIVE_BV_ARRAY_LIMIT, "adaptive bit vector block capacity %d exceeds the block size", capacity);
+   int32_t newCapacity = block._capacity ? block._capacity * 2 : INITIAL_ARRAY_CAPACITY;
+   while (newCapacity < capacity)
+      newCapacity *= 2;
+   if (newCapacity > ADAPTIVE_BV_ARRAY_LIMIT)
+      newCapacity = ADAPTIVE_BV_ARRAY_LIMIT;
+
+   uint16_t *newData = (uint16_t *)allocateData(newCapacity * sizeof(uint16_t));
+   if (preserveContents)
+      {
+      TR_ASSERT(!block._isBitmap, "only arrays are grown in place");
+      memcpy(newData, block._data, block._count * sizeof(uint16_t));
+      }
+   releaseData(block._data, block._capacity * sizeof(uint16_t));
+
+   block._data = newData;
+   block._capacity = newCapacity;
+   }
+
+void TR_AdaptiveBitVector::toBitmap(Block &block)
+   {
+   TR_ASSERT(!block._isBitmap, "block is already a bitmap");
+   uint16_t offsets[ADAPTIVE_BV_ARRAY_LIMIT];
+   int32_t count = block._count;
+   memcpy(offsets, block._data, count * sizeof(uint16_t));
+
+   ensureDataCapacity(block, ADAPTIVE_BV_ARRAY_LIMIT, false);
+   uint64_t *words = block.bitmap();
+   memset(words, 0, ADAPTIVE_BV_BITMAP_WORDS * sizeof(uint64_t));
+   for (int32_t i = 0; i < count; i++)
+      words[offsets[i] >> 6] |= bitMask(offsets[i]);
+   block._isBitmap = true;
+   }
+
+void TR_AdaptiveBitVector::toArray(Block &block)
+   {
+   TR_ASSERT(block._isBitmap, "block is already an array");
+   TR_ASSERT(block._count <= ADAPTIVE_BV_ARRAY_LIMIT, "too many bits to convert block to an array");
+   uint64_t words[ADAPTIVE_BV_BITMAP_WORDS];
+   memcpy(words, block._data, sizeof(words));
+
+   int32_t n = 0;
+   for (int32_t w = 0; w < ADAPTIVE_BV_BITMAP_WORDS; w++)
+      {
+      for (uint64_t word = words[w]; word; word &= word - 1)
+         block._data[n++] = (uint16_t)((w << 6) + trailingZeroes(word));
+      }
+   block._isBitmap = false;
+   }
+
+void TR_AdaptiveBitVector::normalize(Block &block)
+   {
+   if (block._isBitmap)
+      {
+      if (block._count <= ADAPTIVE_BV_ARRAY_LIMIT / 2)
+         toArray(block);
+      }
+   else if (block._count > ADAPTIVE_BV_ARRAY_LIMIT)
+      {
+      toBitmap(block);
+      }
+   }
+
+void TR_AdaptiveBitVector::setInBlock(Block &block, uint16_t offset)
+   {
+   if (block._isBitmap)
+      {
+      uint64_t &word = block.bitmap()[offset >> 6];
+      if (!(word & bitMask(offset)))
+         {
+         word |= bitMask(offset);
+         block._count++;
+         }
+      return;
+      }
+
+   int32_t pos = searchArray(block._data, block._count, offset);
+   if (pos < block._count && block._data[pos] == offset)
+      return;
+
+   if (block._count == ADAPTIVE_BV_ARRAY_LIMIT)
+      {
+      toBitmap(block);
+      setInBlock(block, offset);
+      return;
+      }
+
+   ensureDataCapacity(block, block._count + 1, true);
+   memmove(&block._data[pos + 1], &block._data[pos], (block._count - pos) * sizeof(uint16_t));
+   block._data[pos] = offset;
+   block._count++;
+   }
+
+bool TR_AdaptiveBitVector::resetInBlock(Block &block, uint16_t offset)
+   {
+   if (block._isBitmap)
+      {
+      uint64_t &word = block.bitmap()[offset >> 6];
+      if (!(word & bitMask(offset)))
+         return false;
+      word &= ~bitMask(offset);
+      block._count--;
+      normalize(block);
+      return true;
+      }
+
+   int32_t pos = searchArray(block._data, block._count, offset);
+   if (pos >= block._count || block._data[pos] != offset)
+      return false;
+   memmove(&block._data[pos], &block._data[pos + 1], (block._count - pos - 1) * sizeof(uint16_t));
+   block._count--;
+   return true;
+   }
+
+int32_t TR_AdaptiveBitVector::get(int64_t n)
+   {
+   int32_t index = findBlock((uint32_t)(n >> ADAPTIVE_BV_BLOCK_SHIFT));
+   if (index < 0)
+      return 0;
+
+   Block &block = _blocks[index];
+   uint16_t offset = (uint16_t)(n & BLOCK_OFFSET_MASK);
+   if (block._isBitmap)
+      return (block.bitmap()[offset >> 6] & bitMask(offset)) ? 1 : 0;
+
+   int32_t pos = searchArray(block._data, block._count, offset);
+   return (pos < block._count && block._data[pos] == offset) ? 1 : 0;
+   }
+
+void TR_AdaptiveBitVector::set(int64_t n)
+   {
+   Block *block = findOrInsertBlock((uint32_t)(n >> ADAPTIVE_BV_BLOCK_SHIFT));
+   setInBlock(*block, (uint16_t)(n & BLOCK_OFFSET_MASK));
+   }
+
+void TR_AdaptiveBitVector::reset(int64_t n)
+   {
+   int32_t index = findBlock((uint32_t)(n >> ADAPTIVE_BV_BLOCK_SHIFT));
+   if (index < 0)
+      return;
+   if (resetInBlock(_blocks[index], (uint16_t)(n & BLOCK_OFFSET_MASK)) && _blocks[index]._count == 0)
+      removeBlock(index);
+   }
+
+int32_t TR_AdaptiveBitVector::elementCount()
+   {
+   int32_t count = 0;
+   for (int32_t i = 0; i < _numBlocks; i++)
+      count += _blocks[i]._count;
+   return count;
+   }
+
+void TR_AdaptiveBitVector::setAll(int64_t m, int64_t n)
+   {
+   if (n < m)
+      return;
+
+   uint32_t firstKey = (uint32_t)(m >> ADAPTIVE_BV_BLOCK_SHIFT);
+   uint32_t lastKey = (uint32_t)(n >> ADAPTIVE_BV_BLOCK_SHIFT);
+   for (uint32_t key = firstKey; key <= lastKey; key++)
+      {
+      int32_t first = (key == firstKey) ? (int32_t)(m & BLOCK_OFFSET_MASK) : 0;
+      int32_t last = (key == lastKey) ? (int32_t)(n & BLOCK_OFFSET_MASK) : ADAPTIVE_BV_BLOCK_BITS - 1;
+      Block &block = *findOrInsertBlock(key);
+
+      if (!block._isBitmap && block._count + (last - first + 1) <= ADAPTIVE_BV_ARRAY_LIMIT)
+         {
+         for (int32_t offset = first; offset <= last; offset++)
+            setInBlock(block, (uint16_t)offset);
+         continue;
+         }
+
+      if (!block._isBitmap)
+         toBitmap(block);
+      uint64_t *words = block.bitmap();
+      for (int32_t w = first >> 6; w <= (last >> 6); w++)
+         {
+         int32_t lo = (w == (first >> 6)) ? (first & 63) : 0;
+         int32_t hi = (w == (last >> 6)) ? (last & 63) : 63;
+         words[w] |= rangeMask(lo, hi);
+         }
+      block._count = countBitmap(words);
+      }
+   }
+
+void TR_AdaptiveBitVector::resetAll(int64_t m, int64_t n)
+   {
+   if (n < m)
+      return;
+
+   uint32_t firstKey = (uint32_t)(m >> ADAPTIVE_BV_BLOCK_SHIFT);
+   uint32_t lastKey = (uint32_t)(n >> ADAPTIVE_BV_BLOCK_SHIFT);
+   int32_t index = findBlock(firstKey);
+   if (index < 0)
+      index = -index - 1;
+
+   while (index < _numBlocks && _blocks[index]._key <= lastKey)
+      {
+      Block &block = _blocks[index];
+      int32_t first = (block._key == firstKey) ? (int32_t)(m & BLOCK_OFFSET_MASK) : 0;
+      int32_t last = (block._key == lastKey) ? (int32_t)(n & BLOCK_OFFSET_MASK) : ADAPTIVE_BV_BLOCK_BITS - 1;
+
+      if (first == 0 && last == ADAPTIVE_BV_BLOCK_BITS - 1)
+         {
+         block._count = 0;
+         }
+      else if (block._isBitmap)
+         {
+         uint64_t *words = block.bitmap();
+         for (int32_t w = first >> 6; w <= (last >> 6); w++)
+            {
+            int32_t lo = (w == (first >> 6)) ? (first & 63) : 0;
+            int32_t hi = (w == (last >> 6)) ? (last & 63) : 63;
+            words[w] &= ~rangeMask(lo, hi);
+            }
+         block._count = countBitmap(words);
+         normalize(block);
+         }
+      else
+         {
+         int32_t lo = searchArray(block._data, block._count, (uint16_t)first);
+         int32_t hi = searchArray(block._data, block._count, (uint16_t)(last + 1));
+         if (last == ADAPTIVE_BV_BLOCK_BITS - 1)
+            hi = block._count;
+         memmove(&block._data[lo], &block._data[hi], (block._count - hi) * sizeof(uint16_t));
+         block._count -= (hi - lo);
+         }
+
+      if (block._count == 0)
+         removeBlock(index);
+      else
+         index++;
+      }
+   }
+
+void TR_AdaptiveBitVector::copyBlock(Block &target, Block &source)
+   {
+   int32_t size = source._isBitmap ? ADAPTIVE_BV_ARRAY_LIMIT : source._count;
+   ensureDataCapacity(target, size, false);
+   memcpy(target._data, source._data, size * sizeof(uint16_t));
+   target._key = source._key;
+   target._count = source._count;
+   target._isBitmap = source._isBitmap;
+   }
+
+void TR_AdaptiveBitVector::orBlock(Block &target, Block &source)
+   {
+   if (source._isBitmap)
+      {
+      if (!target._isBitmap)
+         toBitmap(target);
+      uint64_t *t = target.bitmap();
+      uint64_t *s = source.bitmap();
+      for (int32_t w = 0; w < ADAPTIVE_BV_BITMAP_WORDS; w++)
+         t[w] |= s[w];
+      target._count = countBitmap(t);
+      }
+   else if (target._isBitmap || target._count + source._count > ADAPTIVE_BV_ARRAY_LIMIT)
+      {
+      if (!target._isBitmap)
+         toBitmap(target);
+      for (int32_t i = 0; i < source._count; i++)
+         setInBlock(target, source._data[i]);
+      normalize(target);
+      }
+   else
+      {
+      // Merge the two sorted arrays from the back, so that the target can be
+      // merged into in place, then slide the result down over any gap left by
+      // offsets present in both
+      //
+      int32_t size = target._count + source._count;
+      ensureDataCapacity(target, size, true);
+      uint16_t *t = target._data;
+      uint16_t *s = source._data;
+      int32_t i = target._count - 1, j = source._count - 1, k = size - 1;
+      while (j >= 0)
+         {
+         if (i >= 0 && t[i] > s[j])
+            t[k--] = t[i--];
+         else if (i >= 0 && t[i] == s[j])
+            {
+            t[k--] = t[i--];
+            j--;
+            }
+         else
+            t[k--] = s[j--];
+         }
+      while (i >= 0)
+         t[k--] = t[i--];
+
+      int32_t count = size - 1 - k;
+      memmove(t, &t[k + 1], count * sizeof(uint16_t));
+      target._count = count;
+      }
+   }
+
+void TR_AdaptiveBitVector::andBlock(Block &target, Block &source)
+   {
+   if (target._isBitmap && source._isBitmap)
+      {
+      uint64_t *t = target.bitmap();
+      uint64_t *s = source.bitmap();
+      for (int32_t w = 0; w < ADAPTIVE_BV_BITMAP_WORDS; w++)
+         t[w] &= s[w];
+      target._count = countBitmap(t);
+      normalize(target);
+      }
+   else if (target._isBitmap)
+      {
+      // The result is a subset of the source offsets
+      //
+      uint16_t offsets[ADAPTIVE_BV_ARRAY_LIMIT];
+      uint64_t *t = target.bitmap();
+      int32_t n = 0;
+      for (int32_t i = 0; i < source._count; i++)
+         {
+         uint16_t offset = source._data[i];
+         if (t[offset >> 6] & bitMask(offset))
+            offsets[n++] = offset;
+         }
+      memcpy(target._data, offsets, n * sizeof(uint16_t));
+      target._count = n;
+      target._isBitmap = false;
+      }
+   else if (source._isBitmap)
+      {
+      uint64_t *s = source.bitmap();
+      int32_t n = 0;
+      for (int32_t i = 0; i < target._count; i++)
+         {
+         uint16_t offset = target._data[i];
+         if (s[offset >> 6] & bitMask(offset))
+            target._data[n++] = offset;
+         }
+      target._count = n;
+      }
+   else
+      {
+      int32_t i = 0, j = 0, n = 0;
+      while (i < target._count && j < source._count)
+         {
+         if (target._data[i] < source._data[j])
+            i++;
+         else if (target._data[i] > source._data[j])
+            j++;
+         else
+            {
+            target._data[n++] = target._data[i++];
+            j++;
+            }
+         }
+      target._count = n;
+      }
+   }
+
+void TR_AdaptiveBitVector::subtractBlock(Block &target, Block &source)
+   {
+   if (target._isBitmap && source._isBitmap)
+      {
+      uint64_t *t = target.bitmap();
+      uint64_t *s = source.bitmap();
+      for (int32_t w = 0; w < ADAPTIVE_BV_BITMAP_WORDS; w++)
+         t[w] &= ~s[w];
+      target._count = countBitmap(t);
+      normalize(target);
+      }
+   else if (target._isBitmap)
+      {
+      uint64_t *t = target.bitmap();
+      for (int32_t i = 0; i < source._count; i++)
+         {
+         uint16_t offset = source._data[i];
+         if (t[offset >> 6] & bitMask(offset))
+            {
+            t[offset >> 6] &= ~bitMask(offset);
+            target._count--;
+            }
+         }
+      normalize(target);
+      }
+   else if (source._isBitmap)
+      {
+      uint64_t *s = source.bitmap();
+      int32_t n = 0;
+      for (int32_t i = 0; i < target._count; i++)
+         {
+         uint16_t offset = target._data[i];
+         if (!(s[offset >> 6] & bitMask(offset)))
+            target._data[n++] = offset;
+         }
+      target._count = n;
+      }
+   else
+      {
+      int32_t i = 0, j = 0, n = 0;
+      while (i < target._count)
+         {
+         while (j < source._count && source._data[j] < target._data[i])
+            j++;
+         if (j < source._count && source._data[j] == target._data[i])
+            i++;
+         else
+            target._data[n++] = target._data[i++];
+         }
+      target._count = n;
+      }
+   }
+
+bool TR_AdaptiveBitVector::blocksIntersect(Block &a, Block &b)
+   {
+   if (a._isBitmap && b._isBitmap)
+      {
+      for (int32_t w = 0; w < ADAPTIVE_BV_BITMAP_WORDS; w++)
+         {
+         if (a.bitmap()[w] & b.bitmap()[w])
+            return true;
+         }
+      return false;
+      }
+
+   if (a._isBitmap || b._isBitmap)
+      {
+      Block &bitmapBlock = a._isBitmap ? a : b;
+      Block &arrayBlock = a._isBitmap ? b : a;
+      for (int32_t i = 0; i < arrayBlock._count; i++)
+         {
+         uint16_t offset = arrayBlock._data[i];
+         if (bitmapBlock.bitmap()[offset >> 6] & bitMask(offset))
+            return true;
+         }
+      return false;
+      }
+
+   int32_t i = 0, j = 0;
+   while (i < a._count && j < b._count)
+      {
+      if (a._data[i] < b._data[j])
+         i++;
+      else if (a._data[i] > b._data[j])
+         j++;
+      else
+         return true;
+      }
+   return false;
+   }
+
+// Compare the contents of two blocks already known to hold the same number of bits
+//
+bool TR_AdaptiveBitVector::blocksEqual(Block &a, Block &b)
+   {
+   if (a._isBitmap == b._isBitmap)
+      {
+      int32_t size = a._isBitmap ? ADAPTIVE_BV_ARRAY_LIMIT : a._count;
+      return memcmp(a._data, b._data, size * sizeof(uint16_t)) == 0;
+      }
+
+   // With equal counts every offset of the array being in the bitmap is enough
+   //
+   Block &bitmapBlock = a._isBitmap ? a : b;
+   Block &arrayBlock = a._isBitmap ? b : a;
+   for (int32_t i = 0; i < arrayBlock._count; i++)
+      {
+      uint16_t offset = arrayBlock._data[i];
+      if (!(bitmapBlock.bitmap()[offset >> 6] & bitMask(offset)))
+         return false;
+      }
+   return true;
+   }
+
+bool TR_AdaptiveBitVector::intersects(TR_AdaptiveBitVector &other)
+   {
+   int32_t i = 0, j = 0;
+   while (i < _numBlocks && j < other._numBlocks)
+      {
+      if (_blocks[i]._key < other._blocks[j]._key)
+         i++;
+      else if (_blocks[i]._key > other._blocks[j]._key)
+         j++;
+      else if (blocksIntersect(_blocks[i++], other._blocks[j++]))
+         return true;
+      }
+   return false;
+   }
+
+bool TR_AdaptiveBitVector::operator==(TR_AdaptiveBitVector &other)
+   {
+   if (_numBlocks != other._numBlocks)
+      return false;
+   for (int32_t i = 0; i < _numBlocks; i++)
+      {
+      Block &a = _blocks[i];
+      Block &b = other._blocks[i];
+      if (a._key != b._key || a._count != b._count || !blocksEqual(a, b))
+         return false;
+      }
+   return true;
+   }
+
+void TR_AdaptiveBitVector::operator=(TR_AdaptiveBitVector &other)
+   {
+   if (this == &other)
+      return;
+   ensureBlockCapacity(other._numBlocks);
+   for (int32_t i = 0; i < other._numBlocks; i++)
+      copyBlock(_blocks[i], other._blocks[i]);
+   _numBlocks = other._numBlocks;
+   }
+
+void TR_AdaptiveBitVector::operator|=(TR_AdaptiveBitVector &other)
+   {
+   if (this == &other || other._numBlocks == 0)
+      return;
+
+   int32_t missing = 0;
+   for (int32_t i = 0, j = 0; j < other._numBlocks; )
+      {
+      if (i < _numBlocks && _blocks[i]._key < other._blocks[j]._key)
+         i++;
+      else if (i < _numBlocks && _blocks[i]._key == other._blocks[j]._key)
+         {
+         i++;
+         j++;
+         }
+      else
+         {
+         missing++;
+         j++;
+         }
+      }
+
+   // Merge from the back.  Blocks are swapped rather than copied into their
+   // final slot so that the storage of the spare blocks being overwritten moves
+   // into the slots that new blocks are copied into.
+   //
+   int32_t total = _numBlocks + missing;
+   ensureBlockCapacity(total);
+   int32_t i = _numBlocks - 1, j = other._numBlocks - 1, k = total - 1;
+   while (j >= 0)
+      {
+      if (i >= 0 && _blocks[i]._key >= other._blocks[j]._key)
+         {
+         bool merge = _blocks[i]._key == other._blocks[j]._key;
+         Block temp = _blocks[k];
+         _blocks[k] = _blocks[i];
+         _blocks[i] = temp;
+         if (merge)
+            orBlock(_blocks[k], other._blocks[j--]);
+         i--;
+         }
+      else
+         {
+         copyBlock(_blocks[k], other._blocks[j--]);
+         }
+      k--;
+      }
+   _numBlocks = total;
+   }
+
+void TR_AdaptiveBitVector::operator&=(TR_AdaptiveBitVector &other)
+   {
+   if (this == &other)
+      return;
+
+   // Blocks that survive are swapped down so the storage of dropped blocks
+   // stays past the live ones for reuse
+   //
+   int32_t i = 0, j = 0, n = 0;
+   while (i < _numBlocks && j < other._numBlocks)
+      {
+      if (_blocks[i]._key < other._blocks[j]._key)
+         i++;
+      else if (_blocks[i]._key > other._blocks[j]._key)
+         j++;
+      else
+         {
+         andBlock(_blocks[i], other._blocks[j]);
+         if (_blocks[i]._count > 0)
+            {
+            Block temp = _blocks[n];
+            _blocks[n++] = _blocks[i];
+            _blocks[i] = temp;
+            }
+         i++;
+         j++;
+         }
+      }
+   _numBlocks = n;
+   }
+
+void TR_AdaptiveBitVector::operator-=(TR_AdaptiveBitVector &other)
+   {
+   if (this == &other)
+      {
+      empty();
+      return;
+      }
+   if (other._numBlocks == 0)
+      return;
+
+   int32_t j = 0, n = 0;
+   for (int32_t i = 0; i < _numBlocks; i++)
+      {
+      while (j < other._numBlocks && other._blocks[j]._key < _blocks[i]._key)
+         j++;
+      if (j < other._numBlocks && other._blocks[j]._key == _blocks[i]._key)
+         subtractBlock(_blocks[i], other._blocks[j]);
+      if (_blocks[i]._count > 0)
+         {
+         Block temp = _blocks[n];
+         _blocks[n++] = _blocks[i];
+         _blocks[i] = temp;
+         }
+      }
+   _numBlocks = n;
+   }
+
+void TR_AdaptiveBitVector::operator|=(TR_BitVector &other)
+   {
+   TR_BitVectorIterator bvi(other);
+   while (bvi.hasMoreElements())
+      set(bvi.getNextElement());
+   }
+
+void TR_AdaptiveBitVector::operator-=(TR_BitVector &other)
+   {
+   if (isEmpty())
+      return;
+   TR_BitVectorIterator bvi(other);
+   while (bvi.hasMoreElements())
+      reset(bvi.getNextElement());
+   }
+
+void operator|=(TR_BitVector &target, TR_AdaptiveBitVector &source)
+   {
+   TR_AdaptiveBitVectorIterator abvi(source);
+   while (abvi.hasMoreElements())
+      target.set(abvi.getNextElement());
+   }
+
+void operator&=(TR_BitVector &target, TR_AdaptiveBitVector &source)
+   {
+   TR_BitVectorIterator bvi(target);
+   while (bvi.hasMoreElements())
+      {
+      int32_t element = bvi.getNextElement();
+      if (!source.get(element))
+         target.reset(element);
+      }
+   }
+
+void TR_AdaptiveBitVector::print(TR::Compilation *comp, TR::FILE *file)
+   {
+   if (comp->getDebug())
+      {
+      if (file == NULL)
+         file = comp->getOutFile();
+      comp->getDebug()->print(file, this);
+      }
+   }
+
+void TR_AdaptiveBitVectorIterator::advance()
+   {
+   while (_blockIndex < _bitVector->_numBlocks)
+      {
+      TR_AdaptiveBitVector::Block &block = _bitVector->_blocks[_blockIndex];
+      int32_t base = (int32_t)(block._key << ADAPTIVE_BV_BLOCK_SHIFT);
+      if (block._isBitmap)
+         {
+         uint64_t *words = block.bitmap();
+         for (int32_t bit = _position + 1; bit < ADAPTIVE_BV_BLOCK_BITS; bit = ((bit >> 6) + 1) << 6)
+            {
+            uint64_t word = words[bit >> 6] >> (bit & 63);
+            if (word)
+               {
+               _position = bit + trailingZeroes(word);
+               _current = base + _position;
+               return;
+               }
+            }
+         }
+      else if (_position + 1 < block._count)
+         {
+         _position++;
+         _current = base + block._data[_position];
+         return;
+         }
+      _blockIndex++;
+      _position = -1;
+      }
+   }
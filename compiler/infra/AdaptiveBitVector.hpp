@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef ADAPTIVEBITVECTOR_INCL
+#define ADAPTIVEBITVECTOR_INCL
+
+#include <stdint.h>
+#include "env/FilePointerDecl.hpp"
+#include "env/TRMemory.hpp"
+#include "infra/Assert.hpp"
+
+class TR_BitVector;
+class TR_AdaptiveBitVectorIterator;
+namespace TR { class Compilation; }
+namespace TR { class Region; }
+
+#define ADAPTIVE_BV_BLOCK_SHIFT   12
+#define ADAPTIVE_BV_BLOCK_BITS    (1 << ADAPTIVE_BV_BLOCK_SHIFT)
+#define ADAPTIVE_BV_BITMAP_WORDS  (ADAPTIVE_BV_BLOCK_BITS / 64)
+#define ADAPTIVE_BV_ARRAY_LIMIT   (ADAPTIVE_BV_BITMAP_WORDS * 4) // 16-bit offsets that fit in the space of a bitmap
+
+/**
+ * A bit vector for use with the data flow engine on very large index spaces.
+ *
+ * The index space is split into blocks of ADAPTIVE_BV_BLOCK_BITS bits and only
+ * blocks containing at least one set bit are stored, in a sorted array keyed by
+ * block number.  Each stored block picks its own representation from its
+ * density: a sorted array of 16-bit offsets while it holds no more than
+ * ADAPTIVE_BV_ARRAY_LIMIT bits, and a plain bitmap once it holds more.  A
+ * bitmap is only turned back into an array when its population falls to half
+ * the limit, so a block oscillating around the limit does not flip on every
+ * update.
+ *
+ * Both representations occupy at most the same number of bytes, so storage of
+ * a block that is emptied or reassigned is kept and reused rather than handed
+ * back to the region.  This keeps the repeated copies the data flow engine
+ * performs between iterations from growing the stack region.
+ *
+ * The container implements the TR_BitVector-style interface the data flow
+ * engine relies on, plus the few mixed operations with TR_BitVector needed by
+ * the clients of reaching definitions.
+ */
+class TR_AdaptiveBitVector
+   {
+   public:
+   TR_ALLOC(TR_Memory::BitVector)
+   typedef int32_t containerCharacteristic; // used by data flow
+   static const containerCharacteristic nullContainerCharacteristic = -1;
+
+   TR_AdaptiveBitVector(TR::Region &region);
+   TR_AdaptiveBitVector(int64_t initBits, TR_Memory *m, TR_AllocationKind allocKind = heapAlloc);
+   TR_AdaptiveBitVector(int64_t initBits, TR::Region &region);
+
+   int32_t get(int64_t n);
+   void set(int64_t n);
+   void reset(int64_t n);
+   bool isEmpty() { return _numBlocks == 0; }
+
+   bool intersects(TR_AdaptiveBitVector &other);
+   bool operator==(TR_AdaptiveBitVector &other);
+   bool operator!=(TR_AdaptiveBitVector &other) { return !operator==(other); }
+   void operator|=(TR_AdaptiveBitVector &other);
+   void operator&=(TR_AdaptiveBitVector &other);
+   void operator-=(TR_AdaptiveBitVector &other);
+   void operator=(TR_AdaptiveBitVector &other);
+
+   void operator|=(TR_BitVector &other);
+   void operator-=(TR_BitVector &other);
+
+   // Set/reset the bits from 0 to n-1
+   //
+   void setAll(int64_t n) { if (n > 0) setAll(0, n-1); }
+   void resetAll(int64_t n) { if (n > 0) resetAll(0, n-1); }
+
+   // Set/reset the bits from m to n inclusive
+   //
+   void setAll(int64_t m, int64_t n);
+   void resetAll(int64_t m, int64_t n);
+
+   void empty() { _numBlocks = 0; }
+   bool hasMoreThanOneElement() { return _numBlocks > 1 || (_numBlocks == 1 && _blocks[0]._count > 1); }
+   int32_t elementCount();
+   int32_t numUsedChunks() { return _numBlocks; }
+   int32_t numNonZeroChunks() { return _numBlocks; }
+
+   void print(TR::Compilation *comp, TR::FILE *file = NULL);
+
+   private:
+
+   struct Block
+      {
+      uint32_t  _key;      // index of the first bit in the block, shifted right by ADAPTIVE_BV_BLOCK_SHIFT
+      uint16_t  _count;    // number of bits set in the block
+      uint16_t  _capacity; // size of _data in 16-bit units
+      bool      _isBitmap;
+      uint16_t *_data;     // sorted offsets, or a bitmap of uint64_t words
+
+      uint64_t *bitmap() { return reinterpret_cast<uint64_t *>(_data); }
+      };
+
+   int32_t findBlock(uint32_t key);
+   Block *findOrInsertBlock(uint32_t key);
+   void removeBlock(int32_t index);
+   void ensureBlockCapacity(int32_t numBlocks);
+   void ensureDataCapacity(Block &block, int32_t capacity, bool preserveContents);
+   void *allocateData(size_t size);
+   void releaseData(void *p, size_t size);
+
+   void setInBlock(Block &block, uint16_t offset);
+   bool resetInBlock(Block &block, uint16_t offset);
+   void toBitmap(Block &block);
+   void toArray(Block &block);
+   void normalize(Block &block);
+   void copyBlock(Block &target, Block &source);
+   void orBlock(Block &target, Block &source);
+   void andBlock(Block &target, Block &source);
+   void subtractBlock(Block &target, Block &source);
+   bool blocksIntersect(Block &a, Block &b);
+   bool blocksEqual(Block &a, Block &b);
+
+   TR::Region *_region;
+   Block      *_blocks;
+   int32_t     _numBlocks;
+   int32_t     _blockCapacity;
+
+   friend class TR_AdaptiveBitVectorIterator;
+   };
+
+// Mixed operations used when reaching definitions results are combined with
+// per-symbol definition sets held in plain bit vectors
+//
+void operator|=(TR_BitVector &target, TR_AdaptiveBitVector &source);
+void operator&=(TR_BitVector &target, TR_AdaptiveBitVector &source);
+
+// Iterate over the set bits of an adaptive bit vector in increasing order
+//
+class TR_AdaptiveBitVectorIterator
+   {
+   public:
+
+   TR_AdaptiveBitVectorIterator(TR_AdaptiveBitVector &bv)
+      : _bitVector(&bv), _blockIndex(0), _position(-1)
+      {
+      advance();
+      }
+
+   bool hasMoreElements() { return _blockIndex < _bitVector->_numBlocks; }
+
+   int32_t getNextElement()
+      {
+      TR_ASSERT(hasMoreElements(), "iterating past the end of an adaptive bit vector");
+      int32_t result = _current;
+      advance();
+      return result;
+      }
+
+   private:
+
+   void advance();
+
+   TR_AdaptiveBitVector *_bitVector;
+   int32_t               _blockIndex;
+   int32_t               _position;
+   int32_t               _current;
+   };
+
+#endif
@@ -222,10 +222,8 @@ bool TR::BenefitInlinerBase::inlineIntoIDTNode(TR::ResolvedMethodSymbol *symbol,
       if (node->getVisitCount() == _visitCount)
          continue;
 
-      TR_ByteCodeInfo &bcInfo = node->getByteCodeInfo();
-
       //The actual call target to inline
-      TR::IDTNode *childToInline = idtNode->findChildWithBytecodeIndex(bcInfo.getByteCodeIndex());
+      TR::IDTNode *childToInline = idtNode->findChildForCall(node);
 
       if (!childToInline)
          continue;
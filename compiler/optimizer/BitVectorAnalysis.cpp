@@ -1593,3 +1593,5 @@ template class TR_BasicDFSetAnalysis<TR_BitVector *>;
 template class TR_ForwardDFSetAnalysis<TR_BitVector *>;
 template class TR_BasicDFSetAnalysis<TR_SingleBitContainer *>;
 template class TR_ForwardDFSetAnalysis<TR_SingleBitContainer *>;
+template class TR_BasicDFSetAnalysis<TR_AdaptiveBitVector *>;
+template class TR_ForwardDFSetAnalysis<TR_AdaptiveBitVector *>;
@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/CompileBudget.hpp"
+
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "optimizer/OptimizationManager.hpp"
+#include "optimizer/Optimizer.hpp"
+
+// How many times more expensive per node than an average pass each of the
+// budget checked optimizations is assumed to be
+//
+static uint64_t relativeCost(OMR::Optimizations optNum)
+   {
+   switch (optNum)
+      {
+      case OMR::globalValuePropagation:
+         return 8;
+      case OMR::partialRedundancyElimination:
+         return 6;
+      case OMR::loopVersioner:
+         return 4;
+      default:
+         return 1;
+      }
+   }
+
+static const char *decisionName(TR::CompileBudget::Decision decision)
+   {
+   switch (decision)
+      {
+      case TR::CompileBudget::Run:
+         return "running";
+      case TR::CompileBudget::Downgrade:
+         return "downgrading";
+      default:
+         return "skipping";
+      }
+   }
+
+TR::CompileBudget::CompileBudget(TR::Compilation *comp)
+   : _comp(comp),
+     _startTime(TR::Compiler->vm.getUSecClock()),
+     _timeBudget((uint64_t)comp->getOptions()->getCompileTimeBudget() * 1000),
+     _memoryBudget((size_t)comp->getOptions()->getCompileMemoryBudget() * 1024),
+     _measuredTime(0),
+     _measuredNodes(0),
+     _passTime(NULL),
+     _passCount(NULL),
+     _passDowngrades(NULL),
+     _passSkips(NULL),
+     _logPasses(TR::Options::getVerboseOption(TR_VerboseCompileBudget))
+   {
+   if (_logPasses)
+      {
+      _passTime = (uint64_t *)comp->trMemory()->allocateHeapMemory(OMR::numOpts * sizeof(uint64_t));
+      _passCount = (uint32_t *)comp->trMemory()->allocateHeapMemory(OMR::numOpts * sizeof(uint32_t));
+      _passDowngrades = (uint32_t *)comp->trMemory()->allocateHeapMemory(OMR::numOpts * sizeof(uint32_t));
+      _passSkips = (uint32_t *)comp->trMemory()->allocateHeapMemory(OMR::numOpts * sizeof(uint32_t));
+      memset(_passTime, 0, OMR::numOpts * sizeof(uint64_t));
+      memset(_passCount, 0, OMR::numOpts * sizeof(uint32_t));
+      memset(_passDowngrades, 0, OMR::numOpts * sizeof(uint32_t));
+      memset(_passSkips, 0, OMR::numOpts * sizeof(uint32_t));
+      }
+   }
+
+OMR::Optimizations
+TR::CompileBudget::cheaperAlternative(OMR::Optimizations optNum)
+   {
+   switch (optNum)
+      {
+      case OMR::globalValuePropagation:
+         return OMR::localValuePropagation;
+      case OMR::partialRedundancyElimination:
+         return OMR::localCSE;
+      default:
+         return OMR::endOpts;
+      }
+   }
+
+// Everything the compilation has allocated from its segment provider, the
+// stack regions of the optimizations included
+//
+size_t
+TR::CompileBudget::bytesAllocated()
+   {
+   return _comp->trMemory()->heapMemoryRegion().segmentProviderBytesAllocated();
+   }
+
+uint64_t
+TR::CompileBudget::estimatePassTime(OMR::Optimizations optNum, int32_t nodeCount)
+   {
+   // Nothing has been measured yet, so only the time already spent counts
+   //
+   if (_measuredNodes == 0)
+      return 0;
+   return (uint64_t)nodeCount * _measuredTime * relativeCost(optNum) / _measuredNodes;
+   }
+
+TR::CompileBudget::Decision
+TR::CompileBudget::check(TR::OptimizationManager *manager)
+   {
+   OMR::Optimizations optNum = manager->id();
+   const char *reason = NULL;
+   uint64_t estimate = 0;
+
+   if (_memoryBudget != 0 &&
+       bytesAllocated() > _memoryBudget)
+      {
+      reason = "memory budget exhausted";
+      }
+   else if (_timeBudget != 0)
+      {
+      uint64_t elapsed = TR::Compiler->vm.getUSecClock() - _startTime;
+      estimate = estimatePassTime(optNum, _comp->getNodeCount());
+      if (elapsed >= _timeBudget)
+         reason = "time budget exhausted";
+      else if (estimate > _timeBudget - elapsed)
+         reason = "estimate exceeds remaining time";
+      }
+
+   if (reason == NULL)
+      return Run;
+
+   Decision decision = cheaperAlternative(optNum) != OMR::endOpts ? Downgrade : Skip;
+   if (_logPasses && optNum < OMR::numOpts)
+      {
+      if (decision == Downgrade)
+         _passDowngrades[optNum]++;
+      else
+         _passSkips[optNum]++;
+      }
+   logDecision(manager, decision, reason, estimate);
+   return decision;
+   }
+
+void
+TR::CompileBudget::logDecision(TR::OptimizationManager *manager, Decision decision, const char *reason, uint64_t estimate)
+   {
+   if (_comp->getOption(TR_TraceOpts))
+      traceMsg(_comp, "Compile budget: %s %s, %s\n", decisionName(decision), manager->name(), reason);
+
+   if (!_logPasses)
+      return;
+
+   TR_VerboseLog::writeLineLocked(TR_Vlog_BUDGET,
+      "%s %s (%s): elapsed=%" OMR_PRIu64 " usec estimate=%" OMR_PRIu64 " usec memory=%u KB nodes=%u %s",
+      decisionName(decision),
+      manager->name(),
+      reason,
+      TR::Compiler->vm.getUSecClock() - _startTime,
+      estimate,
+      (uint32_t)(bytesAllocated() / 1024),
+      (uint32_t)_comp->getNodeCount(),
+      _comp->signature());
+   }
+
+uint64_t
+TR::CompileBudget::startPass()
+   {
+   return TR::Compiler->vm.getUSecClock();
+   }
+
+void
+TR::CompileBudget::endPass(OMR::Optimizations optNum, uint64_t startTime, int32_t nodeCount)
+   {
+   uint64_t time = TR::Compiler->vm.getUSecClock() - startTime;
+
+   // Normalize by the relative cost so the average reflects an ordinary pass
+   //
+   _measuredTime += time / relativeCost(optNum);
+   _measuredNodes += nodeCount;
+
+   if (_logPasses && optNum < OMR::numOpts)
+      {
+      _passTime[optNum] += time;
+      _passCount[optNum]++;
+      }
+   }
+
+void
+TR::CompileBudget::report(TR::Optimizer *optimizer)
+   {
+   if (!_logPasses)
+      return;
+
+   TR_VerboseLog::CriticalSection vlogLock;
+   TR_VerboseLog::writeLine(TR_Vlog_BUDGET, "optimizer time=%" OMR_PRIu64 " usec memory=%u KB %s",
+      TR::Compiler->vm.getUSecClock() - _startTime,
+      (uint32_t)(bytesAllocated() / 1024),
+      _comp->signature());
+
+   for (int32_t i = 0; i < OMR::numOpts; i++)
+      {
+      if (_passCount[i] == 0 && _passDowngrades[i] == 0 && _passSkips[i] == 0)
+         continue;
+      TR_VerboseLog::writeLine(TR_Vlog_BUDGET, "   %-40s runs=%u downgraded=%u skipped=%u time=%" OMR_PRIu64 " usec",
+         optimizer->getOptimizationName((OMR::Optimizations)i),
+         _passCount[i],
+         _passDowngrades[i],
+         _passSkips[i],
+         _passTime[i]);
+      }
+   }
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TR_COMPILEBUDGET_INCL
+#define TR_COMPILEBUDGET_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "optimizer/Optimizations.hpp"
+
+namespace TR { class Compilation; }
+namespace TR { class OptimizationManager; }
+namespace TR { class Optimizer; }
+
+namespace TR
+{
+
+/**
+ * Tracks the time and memory an optimizer run has consumed against the
+ * budget given by the compileTimeBudget= and compileMemoryBudget= options.
+ *
+ * Optimizations flagged as checking the budget (see
+ * OptimizationManager::getChecksCompileBudget) ask for a decision before
+ * running.  Their cost is estimated from the node count and the average time
+ * per node the passes of this compilation have taken so far, scaled by how
+ * much more expensive than an average pass the optimization is known to be.
+ * When the estimate does not fit in the time remaining, or the memory budget
+ * is already spent, the optimization is replaced by a cheaper local variant
+ * if one exists and skipped otherwise.  Memory is what the compilation's
+ * segment provider has handed out, so stack regions count as well as the heap
+ * region.
+ *
+ * With -Xjit:verbose={compileBudget} every pass is timed and a per pass
+ * summary, including the passes downgraded or skipped, is written to the
+ * verbose log at the end of the optimizer run.
+ */
+class CompileBudget
+   {
+   public:
+   TR_ALLOC(TR_Memory::Optimizer)
+
+   enum Decision
+      {
+      Run,
+      Downgrade,
+      Skip
+      };
+
+   /**
+    * Makes a budget the one an optimizer run checks for the duration of a
+    * scope, and restores the previous one however the scope is left.
+    */
+   class ActiveScope
+      {
+      public:
+      ActiveScope(TR::CompileBudget *&activeBudget, TR::CompileBudget *budget)
+         : _activeBudget(activeBudget), _previousBudget(activeBudget)
+         {
+         _activeBudget = budget;
+         }
+
+      ~ActiveScope() { _activeBudget = _previousBudget; }
+
+      private:
+      TR::CompileBudget *&_activeBudget;
+      TR::CompileBudget *_previousBudget;
+      };
+
+   CompileBudget(TR::Compilation *comp);
+
+   /**
+    * True when there is a budget to enforce or pass times are to be logged.
+    * Passes need not be timed otherwise.
+    */
+   bool isActive() { return _timeBudget != 0 || _memoryBudget != 0 || _logPasses; }
+
+   Decision check(TR::OptimizationManager *manager);
+
+   /**
+    * Optimization to run in place of one that does not fit in the budget, or
+    * endOpts if it should simply be skipped.
+    */
+   static OMR::Optimizations cheaperAlternative(OMR::Optimizations optNum);
+
+   uint64_t startPass();
+   void endPass(OMR::Optimizations optNum, uint64_t startTime, int32_t nodeCount);
+
+   void report(TR::Optimizer *optimizer);
+
+   private:
+
+   size_t bytesAllocated();
+   uint64_t estimatePassTime(OMR::Optimizations optNum, int32_t nodeCount);
+   void logDecision(TR::OptimizationManager *manager, Decision decision, const char *reason, uint64_t estimate);
+
+   TR::Compilation *_comp;
+   uint64_t         _startTime;
+   uint64_t         _timeBudget;    // in usec, 0 when unlimited
+   size_t           _memoryBudget;  // in bytes, 0 when unlimited
+
+   uint64_t         _measuredTime;  // usec spent in the passes timed so far
+   uint64_t         _measuredNodes; // sum of the node counts those passes ran over
+
+   uint64_t        *_passTime;
+   uint32_t        *_passCount;
+   uint32_t        *_passDowngrades;
+   uint32_t        *_passSkips;
+   bool             _logPasses;
+   };
+
+}
+
+#endif
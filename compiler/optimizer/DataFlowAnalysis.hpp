@@ -29,6 +29,7 @@
 #include "control/Options_inlines.hpp"
 #include "env/TRMemory.hpp"
 #include "il/Node.hpp"
+#include "infra/AdaptiveBitVector.hpp"
 #include "infra/Array.hpp"
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
@@ -480,7 +481,20 @@ class TR_UnionSingleBitContainerAnalysis : public TR_UnionDFSetAnalysis<TR_Singl
       TR_UnionDFSetAnalysis<TR_SingleBitContainer *>(comp, cfg, optimizer, trace) {}
   };
 
-class TR_ReachingDefinitions : public TR_UnionBitVectorAnalysis
+class TR_UnionAdaptiveBitVectorAnalysis : public TR_UnionDFSetAnalysis<TR_AdaptiveBitVector *>
+   {
+   public:
+   typedef TR_AdaptiveBitVector ContainerType;
+   TR_UnionAdaptiveBitVectorAnalysis(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, bool trace) :
+      TR_UnionDFSetAnalysis<TR_AdaptiveBitVector *>(comp, cfg, optimizer, trace) {}
+   };
+
+// Reaching definitions is indexed by expanded definition, which grows with the
+// size of the method, while the definitions reaching any one block tend to be
+// clustered.  Use the adaptive container so that each block only pays for the
+// parts of the index space in which definitions actually reach it.
+//
+class TR_ReachingDefinitions : public TR_UnionAdaptiveBitVectorAnalysis
    {
    public:
 
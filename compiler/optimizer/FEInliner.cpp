@@ -22,7 +22,14 @@
 #include <algorithm>
 #include <stddef.h>
 #include <stdint.h>
+#include "compile/Compilation.hpp"
 #include "env/TRMemory.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "ilgen/IlGenRequest.hpp"
+#include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "infra/Assert.hpp"
 #include "infra/Cfg.hpp"
 #include "optimizer/CallInfo.hpp"
@@ -51,19 +58,50 @@ TR_CallSite* TR_CallSite::create(TR::TreeTop* callNodeTreeTop,
                            bool allConsts)
 
    {
-   TR_ASSERT(0, "static ctor TR_CallSite::create must be implemented");
-   return NULL;
+   // Methods are only ever called directly, so the callee is the one of the
+   // symbol, if it is resolved.  A call without one finds no target.
+   TR::ResolvedMethodSymbol *calleeSymbol = symRef->getSymbol()->getResolvedMethodSymbol();
+   TR_ResolvedMethod *callerMethod = caller ? caller : symRef->getOwningMethod(comp);
+
+   return new (trMemory, kind) TR_DirectCallSite(callerMethod,
+                                                 callNodeTreeTop,
+                                                 parent,
+                                                 callNode,
+                                                 NULL,
+                                                 receiverClass,
+                                                 -1,
+                                                 symRef->getCPIndex(),
+                                                 calleeSymbol ? calleeSymbol->getResolvedMethod() : resolvedMethod,
+                                                 calleeSymbol,
+                                                 callNode->getOpCode().isCallIndirect(),
+                                                 false,
+                                                 callNode->getByteCodeInfo(),
+                                                 comp,
+                                                 depth,
+                                                 allConsts);
    }
 
 bool TR_InlinerBase::tryToGenerateILForMethod (TR::ResolvedMethodSymbol* calleeSymbol, TR::ResolvedMethodSymbol* callerSymbol, TR_CallTarget* calltarget)
    {
-   return false;
+   TR::IlGeneratorMethodDetails storage;
+   TR::IlGeneratorMethodDetails &ilGenMethodDetails = TR::IlGeneratorMethodDetails::create(storage, calleeSymbol->getResolvedMethod());
+   TR::InliningIlGenRequest ilGenRequest(ilGenMethodDetails, callerSymbol);
+
+   return calleeSymbol->genIL(fe(), comp(), comp()->getSymRefTab(), ilGenRequest);
    }
 
 bool TR_InlinerBase::inlineCallTarget(TR_CallStack *callStack, TR_CallTarget *calltarget, bool inlinefromgraph, TR_PrexArgInfo *argInfo, TR::TreeTop** cursorTreeTop)
    {
-   TR_ASSERT(0, "TR_InlinerBase::inlineCallTarget must be implemented");
-   return false;
+   TR_CallSite *callsite = calltarget->_myCallSite;
+
+   if (!comp()->incInlineDepth(calltarget->_calleeSymbol, callsite->_callNode, !callsite->isIndirectCall(), calltarget->_guard, calltarget->_receiverClass, argInfo))
+      return false;
+
+   bool successful = inlineCallTarget2(callStack, calltarget, cursorTreeTop, inlinefromgraph, 0);
+
+   // a failed inline leaves no inlined call site behind
+   comp()->decInlineDepth(!successful);
+   return successful;
    }
 
 void TR_InlinerBase::getBorderFrequencies(int32_t &hotBorderFrequency, int32_t &coldBorderFrequency, TR_ResolvedMethod * calleeResolvedMethod, TR::Node *callNode)
@@ -302,6 +302,16 @@ TR_GlobalRegisterAllocator::perform()
       return 0;
       }
 
+   // Cold compilations assign registers with a linear scan, which keeps
+   // values in registers only within the instruction stream it sees
+   //
+   if (comp()->cg()->useLinearScanRegisterAllocator() && comp()->getMethodHotness() <= cold)
+      {
+      if (trace())
+         traceMsg(comp(), "Skipping GRA: registers are assigned with a linear scan\n");
+      return 0;
+      }
+
    comp()->cg()->setGRACompleted();  // means "full GRA"
 
    if (comp()->getOption(TR_MimicInterpreterFrameShape) && ((!comp()->getOption(TR_EnableOSR) && !comp()->getOption(TR_FSDGRA)) || comp()->getJittedMethodSymbol()->sharesStackSlots(comp())))
@@ -2315,6 +2315,16 @@ TR_ParameterToArgumentMapper::initialize(TR_CallStack *callStack)
 
       if (parmMap->_parmSymbol->getParameterOffset() == argOffset)
          {
+         // Callers that pass an Int32 as a word, like JitBuilder methods
+         // calling through the system linkage, have it narrowed back here
+         if (arg->getDataType() == TR::Int64 && parmMap->_parmSymbol->getDataType() == TR::Int32)
+            {
+            TR::Node * narrowedArg = TR::Node::create(TR::l2i, 1, arg);
+            _callNode->setAndIncChild(argIndex, narrowedArg);
+            arg->decReferenceCount();
+            arg = narrowedArg;
+            }
+
          parmMap->_argIndex = argIndex;
          if (!parmMap->_parmIsModified && (!arg->getOpCode().isFloatingPoint() || comp()->cg()->getSupportsJavaFloatSemantics()))
             {
@@ -310,10 +310,10 @@ void OMR::LocalCSE::transformBlock(TR::TreeTop * entryTree, TR::TreeTop * exitTr
    memset(_replacedNodesAsArray, 0, _numNodes*sizeof(TR::Node*));
    memset(_replacedNodesByAsArray, 0, _numNodes*sizeof(TR::Node*));
 
-   _hashTable = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-   _hashTableWithSyms = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-   _hashTableWithCalls = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-   _hashTableWithConsts = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
+   _hashTable = new (stackMemoryRegion) HashTable(stackMemoryRegion);
+   _hashTableWithSyms = new (stackMemoryRegion) HashTable(stackMemoryRegion);
+   _hashTableWithCalls = new (stackMemoryRegion) HashTable(stackMemoryRegion);
+   _hashTableWithConsts = new (stackMemoryRegion) HashTable(stackMemoryRegion);
 
    _nextReplacedNode = 0;
    TR_BitVector seenAvailableLoadedSymbolReferences(stackMemoryRegion);
@@ -1307,11 +1307,10 @@ TR::Node* OMR::LocalCSE::getAvailableExpression(TR::Node *parent, TR::Node *node
       hashTable = _hashTable;
 
    int32_t hashValue = hash(parent, node);
-   auto range = hashTable->equal_range(hashValue);
 
-   for(auto it = range.first; it != range.second;)
+   for (HashTable::Cursor cursor(*hashTable, hashValue); cursor.isValid();)
       {
-      TR::Node *other = it->second;
+      TR::Node *other = cursor.getNode();
       bool remove = false;
       if (areSyntacticallyEquivalent(other, node, &remove))
          {
@@ -1324,15 +1323,12 @@ TR::Node* OMR::LocalCSE::getAvailableExpression(TR::Node *parent, TR::Node *node
          {
          if (trace())
             traceMsg(comp(), "remove is true, removing entry %p\n", other);
-         auto nextIt = it;
-         ++nextIt;
-         hashTable->erase(it);
-         it = nextIt;
+         cursor.remove();
          _killedNodes.set(other->getGlobalIndex());
          }
       else
          {
-         ++it;
+         cursor.advance();
          }
       }
 
@@ -1461,14 +1457,12 @@ void OMR::LocalCSE::killAvailableExpressionsUsingBitVector(HashTable *hashTable,
    while (bvi.hasMoreElements())
       {
       int32_t nextSymRefNum = bvi.getNextElement();
-      auto range = hashTable->equal_range(nextSymRefNum);
-      if (range.first != range.second)
+      TR::Node *lastNode = hashTable->getLast(nextSymRefNum);
+      if (lastNode != NULL)
          {
-         auto lastItem = range.second;
-         --lastItem;
-         _killedNodes.set(lastItem->second->getGlobalIndex());
+         _killedNodes.set(lastNode->getGlobalIndex());
 
-         hashTable->erase(range.first, range.second);
+         hashTable->removeAll(nextSymRefNum);
          }
       }
    }
@@ -1667,32 +1661,204 @@ void OMR::LocalCSE::addToHashTable(TR::Node *node, int32_t hashValue)
       _arrayRefNodes->add(node);
       }
 
-   auto pair = std::make_pair(hashValue, node);
-
    if (node->getOpCode().hasSymbolReference() && ((node->getOpCodeValue() != TR::loadaddr) || _loadaddrAsLoad))
       {
       if (node->getOpCode().isCall())
          {
-         _hashTableWithCalls->insert(pair);
+         _hashTableWithCalls->add(hashValue, node);
          _availableCallExprs.set(node->getSymbolReference()->getReferenceNumber());
          }
       else
          {
-         _hashTableWithSyms->insert(pair);
+         _hashTableWithSyms->add(hashValue, node);
          _availableLoadExprs.set(node->getSymbolReference()->getReferenceNumber());
          }
       }
    else if (node->getOpCode().isLoadConst())
-      _hashTableWithConsts->insert(pair);
+      _hashTableWithConsts->add(hashValue, node);
    else
-      _hashTable->insert(pair);
+      _hashTable->add(hashValue, node);
    }
 
 
 void OMR::LocalCSE::removeFromHashTable(HashTable *hashTable, int32_t hashValue)
    {
-   auto range = hashTable->equal_range(hashValue);
-   hashTable->erase(range.first, range.second);
+   hashTable->removeAll(hashValue);
+   }
+
+
+// Initial number of slots is 2^HASH_TABLE_INITIAL_LOG2_CAPACITY; it is doubled as needed
+// to keep at most half of the slots in use.
+//
+#define HASH_TABLE_INITIAL_LOG2_CAPACITY 6
+
+OMR::LocalCSE::HashTable::HashTable(TR::Region &region)
+   : _region(region),
+     _slots(NULL),
+     _freeEntries(NULL),
+     _log2Capacity(HASH_TABLE_INITIAL_LOG2_CAPACITY),
+     _numUsedSlots(0)
+   {
+   size_t size = sizeof(Slot) << _log2Capacity;
+   _slots = static_cast<Slot *>(_region.allocate(size));
+   memset(_slots, 0, size);
+   }
+
+OMR::LocalCSE::HashTable::Slot *OMR::LocalCSE::HashTable::findSlot(int32_t key)
+   {
+   uint32_t mask = (1u << _log2Capacity) - 1;
+   for (uint32_t i = slotIndex(key); _slots[i]._used; i = (i + 1) & mask)
+      {
+      if (_slots[i]._key == key)
+         return &_slots[i];
+      }
+   return NULL;
+   }
+
+OMR::LocalCSE::HashTable::Slot *OMR::LocalCSE::HashTable::findOrCreateSlot(int32_t key)
+   {
+   Slot *slot = findSlot(key);
+   if (slot != NULL)
+      return slot;
+
+   if ((_numUsedSlots + 1) * 2 > (1u << _log2Capacity))
+      grow();
+
+   uint32_t mask = (1u << _log2Capacity) - 1;
+   uint32_t i = slotIndex(key);
+   while (_slots[i]._used)
+      i = (i + 1) & mask;
+
+   slot = &_slots[i];
+   slot->_used = true;
+   slot->_key = key;
+   slot->_head = NULL;
+   slot->_tail = NULL;
+   _numUsedSlots++;
+   return slot;
+   }
+
+// Rehash into a slot array that leaves at least three quarters of its slots
+// free, dropping the slots of keys that no longer have any nodes.
+//
+void OMR::LocalCSE::HashTable::grow()
+   {
+   Slot *oldSlots = _slots;
+   uint32_t oldCapacity = 1u << _log2Capacity;
+
+   uint32_t numLiveSlots = 0;
+   for (uint32_t i = 0; i < oldCapacity; i++)
+      {
+      if (oldSlots[i]._used && (oldSlots[i]._head != NULL))
+         numLiveSlots++;
+      }
+
+   while ((numLiveSlots + 1) * 4 > (1u << _log2Capacity))
+      _log2Capacity++;
+
+   size_t size = sizeof(Slot) << _log2Capacity;
+   _slots = static_cast<Slot *>(_region.allocate(size));
+   memset(_slots, 0, size);
+
+   uint32_t mask = (1u << _log2Capacity) - 1;
+   for (uint32_t i = 0; i < oldCapacity; i++)
+      {
+      if (!oldSlots[i]._used || (oldSlots[i]._head == NULL))
+         continue;
+
+      uint32_t j = slotIndex(oldSlots[i]._key);
+      while (_slots[j]._used)
+         j = (j + 1) & mask;
+      _slots[j] = oldSlots[i];
+      }
+
+   _numUsedSlots = numLiveSlots;
+   _region.deallocate(oldSlots, sizeof(Slot) * oldCapacity);
+   }
+
+void OMR::LocalCSE::HashTable::releaseChain(Entry *head, Entry *tail)
+   {
+   tail->_next = _freeEntries;
+   _freeEntries = head;
+   }
+
+void OMR::LocalCSE::HashTable::add(int32_t key, TR::Node *node)
+   {
+   Slot *slot = findOrCreateSlot(key);
+
+   Entry *entry = _freeEntries;
+   if (entry != NULL)
+      _freeEntries = entry->_next;
+   else
+      entry = static_cast<Entry *>(_region.allocate(sizeof(Entry)));
+
+   entry->_node = node;
+   entry->_next = NULL;
+   if (slot->_tail != NULL)
+      slot->_tail->_next = entry;
+   else
+      slot->_head = entry;
+   slot->_tail = entry;
+   }
+
+void OMR::LocalCSE::HashTable::removeAll(int32_t key)
+   {
+   Slot *slot = findSlot(key);
+   if ((slot == NULL) || (slot->_head == NULL))
+      return;
+
+   releaseChain(slot->_head, slot->_tail);
+   slot->_head = NULL;
+   slot->_tail = NULL;
+   }
+
+TR::Node *OMR::LocalCSE::HashTable::getLast(int32_t key)
+   {
+   Slot *slot = findSlot(key);
+   if ((slot == NULL) || (slot->_tail == NULL))
+      return NULL;
+   return slot->_tail->_node;
+   }
+
+void OMR::LocalCSE::HashTable::clear()
+   {
+   if (_numUsedSlots == 0)
+      return;
+
+   uint32_t capacity = 1u << _log2Capacity;
+   for (uint32_t i = 0; i < capacity; i++)
+      {
+      if (_slots[i]._used && (_slots[i]._head != NULL))
+         releaseChain(_slots[i]._head, _slots[i]._tail);
+      }
+
+   memset(_slots, 0, sizeof(Slot) * capacity);
+   _numUsedSlots = 0;
+   }
+
+OMR::LocalCSE::HashTable::Cursor::Cursor(HashTable &table, int32_t key)
+   : _table(table),
+     _slot(table.findSlot(key)),
+     _prev(NULL),
+     _link(NULL),
+     _none(NULL)
+   {
+   _link = (_slot != NULL) ? &_slot->_head : &_none;
+   }
+
+void OMR::LocalCSE::HashTable::Cursor::advance()
+   {
+   _prev = *_link;
+   _link = &_prev->_next;
+   }
+
+void OMR::LocalCSE::HashTable::Cursor::remove()
+   {
+   Entry *entry = *_link;
+   *_link = entry->_next;
+   if (_slot->_tail == entry)
+      _slot->_tail = _prev;
+   _table.releaseChain(entry, entry);
    }
 
 
@@ -84,8 +84,92 @@ class LocalCSE : public TR::Optimization
    virtual void postPerformOnBlocks();
    virtual const char * optDetailString() const throw();
 
-   typedef TR::typed_allocator< std::pair< const int32_t, TR::Node* >, TR::Region & > HashTableAllocator;
-   typedef std::multimap< int32_t, TR::Node*, std::less<int32_t>, HashTableAllocator > HashTable;
+   /**
+    * Table of available expressions keyed by the value computed by LocalCSE::hash.
+    *
+    * Each key maps to the nodes added under it in insertion order. Keys live in a
+    * flat, open-addressed (linearly probed) slot array and the nodes for a key are
+    * chained through entries allocated from the region the table was created in.
+    * Entries released by removals are recycled, and keys whose chain becomes empty
+    * keep their slot until the next time the slot array grows, so no tombstones are
+    * needed.
+    */
+   class HashTable
+      {
+      struct Entry
+         {
+         TR::Node *_node;
+         Entry *_next;
+         };
+
+      struct Slot
+         {
+         Entry *_head;
+         Entry *_tail;
+         int32_t _key;
+         bool _used;
+         };
+
+      public:
+
+      HashTable(TR::Region &region);
+
+      /// Append \p node to the nodes available under \p key
+      void add(int32_t key, TR::Node *node);
+
+      /// Remove every node available under \p key
+      void removeAll(int32_t key);
+
+      /// The node most recently added under \p key, or NULL if there is none
+      TR::Node *getLast(int32_t key);
+
+      void clear();
+
+      /**
+       * Walks the nodes available under one key, oldest first, and allows the
+       * current node to be removed. The table must not be added to while a
+       * Cursor on it is in use.
+       */
+      class Cursor
+         {
+         public:
+         Cursor(HashTable &table, int32_t key);
+
+         bool isValid() { return *_link != NULL; }
+         TR::Node *getNode() { return (*_link)->_node; }
+         void advance();
+
+         /// Remove the current node; the cursor moves to the following one
+         void remove();
+
+         private:
+         HashTable &_table;
+         Slot *_slot;
+         Entry *_prev;
+         Entry **_link;
+         Entry *_none;
+         };
+
+      private:
+
+      Slot *findSlot(int32_t key);
+      Slot *findOrCreateSlot(int32_t key);
+      void grow();
+      void releaseChain(Entry *head, Entry *tail);
+
+      uint32_t slotIndex(int32_t key)
+         {
+         // Fibonacci hashing spreads the small, dense symbol reference numbers
+         // that make up most keys across the whole slot array.
+         return ((uint32_t)key * 2654435769u) >> (32 - _log2Capacity);
+         }
+
+      TR::Region &_region;
+      Slot *_slots;
+      Entry *_freeEntries;
+      uint32_t _log2Capacity;
+      uint32_t _numUsedSlots;
+      };
 
    protected:
 
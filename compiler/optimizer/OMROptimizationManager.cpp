@@ -86,7 +86,7 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
          _flags.set(requiresStructure | checkStructure | dumpStructure | requiresAccurateNodeCount);
          break;
       case OMR::loopVersioner:
-         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         _flags.set(requiresStructure | checkStructure | dumpStructure | checksCompileBudget);
          if (self()->comp()->getMethodHotness() >= hot)
             _flags.set(requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs | requiresLocalsValueNumbering);
          break;
@@ -98,10 +98,10 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
          break;
       case OMR::globalValuePropagation:
          _flags.set(requiresStructure | checkStructure | dumpStructure |
-                    requiresLocalsUseDefInfo | requiresLocalsValueNumbering);
+                    requiresLocalsUseDefInfo | requiresLocalsValueNumbering | checksCompileBudget);
          break;
       case OMR::partialRedundancyElimination:
-         _flags.set(requiresStructure | canAddSymbolReference);
+         _flags.set(requiresStructure | canAddSymbolReference | checksCompileBudget);
          break;
       case OMR::globalCopyPropagation:
          _flags.set(requiresStructure | requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
@@ -157,6 +157,7 @@ class OMR_EXTENSIBLE OptimizationManager
       maintainsUseDefInfo                  = 0x00400000,
       requiresAccurateNodeCount            = 0x00800000,
       doNotSetFrequencies                  = 0x01000000,
+      checksCompileBudget                  = 0x02000000, // expensive enough to be skipped or downgraded when over the compile budget
       dummyLastEnum
       };
 
@@ -187,6 +188,7 @@ class OMR_EXTENSIBLE OptimizationManager
    bool getCannotOmitTrivialDefs()       { return _flags.testAny(cannotOmitTrivialDefs); }
    bool getMaintainsUseDefInfo()         { return _flags.testAny(maintainsUseDefInfo); }
    bool getDoNotSetFrequencies()         { return _flags.testAny(doNotSetFrequencies); }
+   bool getChecksCompileBudget()         { return _flags.testAny(checksCompileBudget); }
 
    void setRequiresStructure(bool b)           { _flags.set(requiresStructure, b); }
    void setRequiresGlobalsUseDefInfo(bool b)   { _flags.set(requiresGlobalsUseDefInfo, b); }
@@ -212,6 +214,7 @@ class OMR_EXTENSIBLE OptimizationManager
    void setCannotOmitTrivialDefs(bool b)       { _flags.set(cannotOmitTrivialDefs, b); }
    void setMaintainsUseDefInfo(bool b)         { _flags.set(maintainsUseDefInfo, b); }
    void setDoNotSetFrequencies(bool b)         { _flags.set(doNotSetFrequencies, b); }
+   void setChecksCompileBudget(bool b)         { _flags.set(checksCompileBudget, b); }
 
    protected:
 
@@ -79,6 +79,7 @@
 #include "optimizer/CatchBlockRemover.hpp"
 #include "optimizer/CFGSimplifier.hpp"
 #include "optimizer/CompactLocals.hpp"
+#include "optimizer/CompileBudget.hpp"
 #include "optimizer/CopyPropagation.hpp"
 #include "optimizer/ExpressionsSimplification.hpp"
 #include "optimizer/GeneralLoopUnroller.hpp"
@@ -111,6 +112,7 @@
 #include "optimizer/GlobalRegisterAllocator.hpp"
 #include "optimizer/RecognizedCallTransformer.hpp"
 #include "optimizer/SwitchAnalyzer.hpp"
+#include "optimizer/TailRecursionElimination.hpp"
 #include "env/RegionProfiler.hpp"
 
 namespace TR { class AutomaticSymbol; }
@@ -564,6 +566,7 @@ static const OptimizationStrategy omrColdStrategyOpts[] =
 
 static const OptimizationStrategy omrWarmStrategyOpts[] =
    {
+   { tailRecursionElimination             },
    { basicBlockExtension                  },
    { localCSE                             },
    //{ localValuePropagation               },
@@ -576,6 +579,7 @@ static const OptimizationStrategy omrWarmStrategyOpts[] =
 
 static const OptimizationStrategy omrHotStrategyOpts[] =
    {
+   { OMR::tailRecursionElimination                           },
    { OMR::coldBlockOutlining },
    { OMR::earlyGlobalGroup                                   },
    { OMR::earlyLocalGroup                                    },
@@ -714,7 +718,8 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
      _successorBitsGRA(NULL),
      _stackedOptimizer(false),
      _firstTimeStructureIsBuilt(true),
-     _disableLoopOptsThatCanCreateLoops(false)
+     _disableLoopOptsThatCanCreateLoops(false),
+     _compileBudget(NULL)
    {
    // zero opts table
    memset(_opts, 0, sizeof(_opts));
@@ -854,6 +859,8 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), TR::RecognizedCallTransformer::create, OMR::recognizedCallTransformer);
    _opts[OMR::switchAnalyzer] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
+   _opts[OMR::tailRecursionElimination] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR::TailRecursionElimination::create, OMR::tailRecursionElimination);
    // NOTE: Please add new OMR optimizations here!
 
    // initialize OMR optimization groups
@@ -934,6 +941,40 @@ OMR::Optimizer::isEnabled(OMR::Optimizations i)
    return false;
    }
 
+bool
+OMR::Optimizer::strategyRuns(OptimizationFactory factory)
+   {
+   return _strategy != NULL && self()->strategyRuns(_strategy, factory, 0);
+   }
+
+bool
+OMR::Optimizer::strategyRuns(const OptimizationStrategy *strategy, OptimizationFactory factory, int32_t depth)
+   {
+   // Groups nest only a few levels deep
+   //
+   if (depth > 6)
+      return false;
+
+   for (const OptimizationStrategy *opt = strategy; opt->_num != endOpts && opt->_num != endGroup; opt++)
+      {
+      TR::OptimizationManager *manager = _opts[opt->_num];
+      if (manager == NULL)
+         continue;
+
+      if (opt->_num > endGroup && opt->_num < OMR::numGroups)
+         {
+         if (manager->groupOfOpts() && self()->strategyRuns(manager->groupOfOpts(), factory, depth + 1))
+            return true;
+         }
+      else if (manager->factory() == factory)
+         {
+         return true;
+         }
+      }
+
+   return false;
+   }
+
 TR_Debug *OMR::Optimizer::getDebug()
    {
    return _compilation->getDebug();
@@ -1115,6 +1156,13 @@ void OMR::Optimizer::optimize()
       self()->switchToProfiling(2, 30);
       }
 
+   // The budget lives on this frame, so it must stop being checked however
+   // the optimizer run ends, including by an exception
+   //
+   TR::CompileBudget compileBudget(comp());
+   TR::CompileBudget::ActiveScope budgeting(_compileBudget,
+      !isIlGenOpt() && comp()->isOutermostMethod() && compileBudget.isActive() ? &compileBudget : NULL);
+
    const OptimizationStrategy *opt = _strategy;
    while (opt->_num != endOpts)
       {
@@ -1126,6 +1174,9 @@ void OMR::Optimizer::optimize()
          }
       }
 
+   if (_compileBudget)
+      _compileBudget->report(self());
+
    if (comp()->getOption(TR_EnableDeterministicOrientedCompilation) &&
        comp()->isOutermostMethod() &&
        (comp()->getMethodHotness() > cold) &&
@@ -1702,6 +1753,36 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
          return 0;
          }
 
+      // Only an optimization that would really run is downgraded or skipped,
+      // and the decision is counted in the budget's pass summary
+      //
+      if (_compileBudget && !mustBeDone && manager->getChecksCompileBudget())
+         {
+         TR::CompileBudget::Decision decision = _compileBudget->check(manager);
+         if (decision != TR::CompileBudget::Run)
+            {
+            delete opt;
+            manager->setRequested(false);
+
+            // The cheaper variant runs wherever this optimization would have
+            // run, under its index so that later indexes do not shift
+            //
+            const OptimizationStrategy cheaperOpt = { TR::CompileBudget::cheaperAlternative(optNum), Always };
+            if (decision == TR::CompileBudget::Downgrade && getOptimization(cheaperOpt._num) != NULL)
+               {
+               if (comp()->isOutermostMethod())
+                  comp()->setOptIndex(comp()->getOptIndex() - 1);
+               return performOptimization(&cheaperOpt, firstOptIndex, lastOptIndex, doTiming);
+               }
+            return 0;
+            }
+         }
+
+      uint64_t passStartTime = 0;
+      int32_t passNodeCount = comp()->getNodeCount();
+      if (_compileBudget)
+         passStartTime = _compileBudget->startPass();
+
       if (comp()->getOption(TR_TraceOptDetails))
          {
          if (comp()->isOutermostMethod())
@@ -2088,6 +2169,10 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
          }
 
       delete opt;
+
+      if (_compileBudget)
+         _compileBudget->endPass(optNum, passStartTime, passNodeCount);
+
       // we cannot easily invalidate during IL gen since we could be peeking and we cannot destroy our
       // caller's alias sets
       if (!isIlGenOpt())
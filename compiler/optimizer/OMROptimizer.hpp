@@ -50,11 +50,14 @@ class TR_UseDefInfo;
 class TR_ValueNumberInfo;
 namespace TR { class Block; }
 namespace TR { class CodeGenerator; }
+namespace TR { class CompileBudget; }
 namespace TR { class Compilation; }
+namespace TR { class Optimization; }
 namespace TR { class OptimizationManager; }
 namespace TR { class Optimizer; }
 namespace TR { class ResolvedMethodSymbol; }
 struct OptimizationStrategy;
+typedef TR::Optimization *(*OptimizationFactory)(TR::OptimizationManager *m);
 class OMR_InlinerPolicy;
 class OMR_InlinerUtil;
 
@@ -322,6 +325,12 @@ class Optimizer
 
    bool isEnabled(OMR::Optimizations i);
 
+   /**
+    * Whether the strategy of this optimizer, including the groups it runs,
+    * has an optimization created by \p factory
+    */
+   bool strategyRuns(OptimizationFactory factory);
+
    enum // RAS
       {
       // Analyses start with "A", but not "A0" because that's "After Optimization"
@@ -353,6 +362,8 @@ class Optimizer
 
    void dumpStrategy(const OptimizationStrategy *);
 
+   bool strategyRuns(const OptimizationStrategy *strategy, OptimizationFactory factory, int32_t depth);
+
 
    TR::Compilation *            _compilation;
    TR_Memory *                   _trMemory;
@@ -410,6 +421,8 @@ class Optimizer
    TR_BitVector *                _seenBlocksGRA; // used during the GRA as a global
    TR_BitVector *                _resetExitsGRA; // used during the GRA as a global
    TR_BitVector *                _successorBitsGRA; // used during the GRA as a global
+
+   TR::CompileBudget *           _compileBudget; // only set while an outermost optimizer run is being budgeted
    };
 
 }
@@ -57,7 +57,7 @@ bool TR_ReachingDefinitions::supportsGenAndKillSets()
 
 
 TR_ReachingDefinitions::TR_ReachingDefinitions(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, TR_UseDefInfo *useDefInfo, TR_UseDefInfo::AuxiliaryData &aux, bool trace)
-   : TR_UnionBitVectorAnalysis(comp, cfg, optimizer, trace),
+   : TR_UnionAdaptiveBitVectorAnalysis(comp, cfg, optimizer, trace),
      _useDefInfo(useDefInfo),
      _aux(aux)
    {
@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/TailRecursionElimination.hpp"
+
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/MethodSymbol.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/CfgEdge.hpp"
+#include "infra/ILWalk.hpp"
+#include "infra/List.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+
+int32_t
+TR::TailRecursionElimination::perform()
+   {
+   if (comp()->getOption(TR_DisableTailRecursion))
+      return 0;
+
+   TR::ResolvedMethodSymbol *methodSymbol = comp()->getMethodSymbol();
+   if (methodSymbol->isSynchronised() || localsMayEscape())
+      return 0;
+
+   _loopHead = NULL;
+
+   int32_t numTailCalls = 0;
+   for (TR::Block *block = comp()->getStartTree()->getNode()->getBlock(); block; block = block->getNextBlock())
+      {
+      TR::Node *callNode = findTailCall(block);
+      if (!callNode)
+         continue;
+
+      if (comp()->isRecursiveMethodTarget(callNode->getSymbol()) &&
+          canLoopBack(callNode) &&
+          performTransformation(comp(), "%sturning self tail call [%p] in block_%d into a loop\n", optDetailString(), callNode, block->getNumber()))
+         {
+         loopBack(block, callNode);
+         numTailCalls++;
+         }
+      else if (!callNode->isTailCall())
+         {
+         callNode->setIsTailCall(true);
+         numTailCalls++;
+         }
+      }
+
+   if (_loopHead)
+      {
+      methodSymbol->setMayHaveLoops(true);
+      comp()->getFlowGraph()->invalidateStructure();
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      }
+
+   return numTailCalls;
+   }
+
+// A callee reached through a jump, or a loop iteration standing in for a
+// recursive call, shares storage with the frame it replaces, so any address
+// taken of a local or parameter rules both out for the whole method
+//
+bool
+TR::TailRecursionElimination::localsMayEscape()
+   {
+   for (TR::PreorderNodeIterator iter(comp()->getStartTree(), comp()); iter.currentTree() != NULL; ++iter)
+      {
+      TR::Node *node = iter.currentNode();
+      if (node->getOpCodeValue() == TR::loadaddr && node->getSymbol()->isAutoOrParm())
+         {
+         if (trace())
+            traceMsg(comp(), "Address of local taken at node [%p], no tail calls in this method\n", node);
+         return true;
+         }
+      }
+
+   return false;
+   }
+
+static bool
+anchorsCall(TR::TreeTop *tree, TR::Node *callNode)
+   {
+   TR::Node *node = tree->getNode();
+   return node == callNode || (node->getOpCodeValue() == TR::treetop && node->getFirstChild() == callNode);
+   }
+
+// Answers the direct call whose result is returned at the end of the block,
+// if there is one.  The call may be anchored just before the return or be
+// evaluated by the return itself, but not referenced anywhere earlier.
+//
+TR::Node *
+TR::TailRecursionElimination::findTailCall(TR::Block *block)
+   {
+   // An exception raised by the callee has to reach this method's handlers
+   //
+   if (!block->getExceptionSuccessors().empty())
+      return NULL;
+
+   TR::TreeTop *returnTree = block->getLastRealTreeTop();
+   TR::Node *returnNode = returnTree->getNode();
+   if (!returnNode->getOpCode().isReturn())
+      return NULL;
+
+   TR::TreeTop *prevTree = returnTree->getPrevTreeTop();
+   TR::Node *callNode = NULL;
+   if (returnNode->getNumChildren() > 0)
+      callNode = returnNode->getFirstChild();
+   else if (prevTree != block->getEntry())
+      callNode = prevTree->getNode()->getOpCodeValue() == TR::treetop ? prevTree->getNode()->getFirstChild() : prevTree->getNode();
+
+   if (!callNode ||
+       !callNode->getOpCode().isCallDirect() ||
+       callNode->getSymbolReference()->isUnresolved() ||
+       callNode->getSymbol()->castToMethodSymbol()->isHelper())
+      return NULL;
+
+   bool isAnchored = anchorsCall(prevTree, callNode);
+   rcount_t expectedReferences = (isAnchored ? 1 : 0) + returnNode->getNumChildren();
+   if (callNode->getReferenceCount() != expectedReferences)
+      return NULL;
+
+   return callNode;
+   }
+
+bool
+TR::TailRecursionElimination::canLoopBack(TR::Node *callNode)
+   {
+   TR::ResolvedMethodSymbol *methodSymbol = comp()->getMethodSymbol();
+   int32_t firstArgIndex = callNode->getFirstArgumentIndex();
+   if (callNode->getNumChildren() - firstArgIndex != methodSymbol->getParameterList().getSize())
+      return false;
+
+   ListIterator<TR::ParameterSymbol> parms(&methodSymbol->getParameterList());
+   int32_t childIndex = firstArgIndex;
+   for (TR::ParameterSymbol *p = parms.getFirst(); p != NULL; p = parms.getNext(), childIndex++)
+      {
+      TR::DataType argType = callNode->getChild(childIndex)->getDataType();
+      TR::DataType parmType = p->getDataType();
+      if (argType == parmType)
+         continue;
+
+      if (argType == TR::Aggregate || parmType == TR::Aggregate ||
+          TR::ILOpCode::getProperConversion(argType, parmType, false) == TR::BadILOp)
+         {
+         if (trace())
+            traceMsg(comp(), "Argument %d of self call [%p] cannot be stored to its parameter\n", childIndex - firstArgIndex, callNode);
+         return false;
+         }
+      }
+
+   return true;
+   }
+
+// Replaces the call and the return that ends the block by stores of the
+// arguments to the parameters and a goto back to the original first block.
+// A new empty block is put in front of that one so the method entry does
+// not become a loop header.
+//
+void
+TR::TailRecursionElimination::loopBack(TR::Block *block, TR::Node *callNode)
+   {
+   TR::ResolvedMethodSymbol *methodSymbol = comp()->getMethodSymbol();
+   TR::CFG *cfg = comp()->getFlowGraph();
+
+   if (!_loopHead)
+      {
+      _loopHead = comp()->getStartTree()->getNode()->getBlock();
+      methodSymbol->prependEmptyFirstBlock();
+      }
+
+   TR::TreeTop *returnTree = block->getLastRealTreeTop();
+   TR::TreeTop *callTree = returnTree->getPrevTreeTop();
+   if (!anchorsCall(callTree, callNode))
+      callTree = returnTree;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   // Every argument is stored to a temp before any parameter is overwritten,
+   // since the arguments may still be computed from the old values.  An
+   // argument that just passes a parameter along needs neither store.
+   //
+   int32_t numParms = methodSymbol->getParameterList().getSize();
+   TR::SymbolReference **temps = (TR::SymbolReference **)trMemory()->allocateStackMemory(numParms * sizeof(TR::SymbolReference *));
+
+   ListIterator<TR::ParameterSymbol> parms(&methodSymbol->getParameterList());
+   int32_t childIndex = callNode->getFirstArgumentIndex();
+   int32_t parmIndex = 0;
+   for (TR::ParameterSymbol *p = parms.getFirst(); p != NULL; p = parms.getNext(), childIndex++, parmIndex++)
+      {
+      TR::Node *arg = callNode->getChild(childIndex);
+      TR::SymbolReference *parmSymRef = methodSymbol->getParmSymRef(p->getSlot());
+      if (arg->getOpCode().isLoadVarDirect() && arg->getSymbolReference() == parmSymRef)
+         {
+         temps[parmIndex] = NULL;
+         continue;
+         }
+
+      if (arg->getDataType() != p->getDataType())
+         arg = TR::Node::create(TR::ILOpCode::getProperConversion(arg->getDataType(), p->getDataType(), false), 1, arg);
+
+      temps[parmIndex] = comp()->getSymRefTab()->createTemporary(methodSymbol, p->getDataType());
+      callTree->insertBefore(TR::TreeTop::create(comp(), TR::Node::createStore(temps[parmIndex], arg)));
+      }
+
+   parmIndex = 0;
+   for (TR::ParameterSymbol *p = parms.getFirst(); p != NULL; p = parms.getNext(), parmIndex++)
+      {
+      if (!temps[parmIndex])
+         continue;
+
+      TR::SymbolReference *parmSymRef = methodSymbol->getParmSymRef(p->getSlot());
+      TR::Node *store = TR::Node::createStore(parmSymRef, TR::Node::createLoad(callNode, temps[parmIndex]));
+      callTree->insertBefore(TR::TreeTop::create(comp(), store));
+      }
+
+   TR::Node *gotoNode = TR::Node::create(callNode, TR::Goto, 0, _loopHead->getEntry());
+   returnTree->unlink(true);
+   if (callTree != returnTree)
+      callTree->unlink(true);
+   block->append(TR::TreeTop::create(comp(), gotoNode));
+
+   cfg->addEdge(block, _loopHead)->setCreatedByTailRecursionElimination(true);
+   cfg->removeEdge(block, cfg->getEnd());
+   }
+
+const char *
+TR::TailRecursionElimination::optDetailString() const throw()
+   {
+   return "O^O TAIL RECURSION ELIMINATION: ";
+   }
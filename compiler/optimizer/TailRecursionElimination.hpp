@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TAILRECURSIONELIMINATION_INCL
+#define TAILRECURSIONELIMINATION_INCL
+
+#include <stdint.h>
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class TreeTop; }
+
+namespace TR {
+
+/**
+ * \brief
+ *    Turns calls whose result is returned straight away into jumps.
+ *
+ * \details
+ *    A direct call of the method being compiled in tail position becomes a
+ *    loop back to the start of the method: the arguments are stored over the
+ *    parameters and the call and return are replaced by a goto.  Any other
+ *    direct call in tail position is marked with the tailCall node flag so
+ *    that a code generator whose linkage allows it can leave the method
+ *    through a jump instead of a call.
+ *
+ *    Neither is done when a local or parameter may have had its address
+ *    taken, since the callee could still be using the caller's frame.
+ */
+class TailRecursionElimination : public TR::Optimization
+   {
+   public:
+
+   TailRecursionElimination(TR::OptimizationManager *manager)
+      : TR::Optimization(manager), _loopHead(NULL)
+      {}
+
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR::TailRecursionElimination(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   bool localsMayEscape();
+   TR::Node *findTailCall(TR::Block *block);
+   bool canLoopBack(TR::Node *callNode);
+   void loopBack(TR::Block *block, TR::Node *callNode);
+
+   TR::Block *_loopHead;
+   };
+
+}
+
+#endif
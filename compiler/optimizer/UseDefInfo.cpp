@@ -1896,7 +1896,7 @@ void TR_UseDefInfo::buildUseDefs(void *vblockInfo, AuxiliaryData &aux)
 
       int32_t i, ii;
       TR::Method *method = comp()->getMethodSymbol()->getMethod();
-      TR_BitVectorIterator bvi(*analysisInfo);
+      TR_AdaptiveBitVectorIterator bvi(*analysisInfo);
       while (bvi.hasMoreElements())
          {
          // Convert from expanded index to normal index
@@ -20,6 +20,8 @@
  *******************************************************************************/
 
 #include "optimizer/abstractinterpreter/IDTNode.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
 
 #define SINGLE_CHILD_BIT 1
 
@@ -160,6 +162,22 @@ TR::IDTNode* TR::IDTNode::findChildWithBytecodeIndex(uint32_t bcIndex)
    return NULL;
    }
 
+TR::IDTNode* TR::IDTNode::findChildForCall(TR::Node* callNode)
+   {
+   const uint32_t size = getNumChildren();
+
+   for (uint32_t i = 0; i < size; i ++)
+      {
+      TR::IDTNode* child = getChild(i);
+      TR::Node* childCallNode = child->getCallTarget()->_myCallSite->_callNode;
+
+      if (childCallNode ? childCallNode == callNode : child->getByteCodeIndex() == static_cast<uint32_t>(callNode->getByteCodeIndex()))
+         return child;
+      }
+
+   return NULL;
+   }
+
 TR::IDTNode* TR::IDTNode::getOnlyChild()
    {
    if (((uintptr_t)_children) & SINGLE_CHILD_BIT)
@@ -94,6 +94,15 @@ class IDTNode
 
    TR::IDTNode* findChildWithBytecodeIndex(uint32_t bcIndex);
 
+   /**
+    * @brief Find the child for a call in the trees of this node's method.
+    *
+    * A child found in those same trees is the one for exactly that call node,
+    * as calls that were not built from bytecodes can share a bytecode index.
+    * Any other child is the one at the call's bytecode index.
+    */
+   TR::IDTNode* findChildForCall(TR::Node* callNode);
+
    TR::ResolvedMethodSymbol* getResolvedMethodSymbol() { return _symbol; }
    TR_ResolvedMethod* getResolvedMethod() { return _callTarget->_calleeMethod; }
 
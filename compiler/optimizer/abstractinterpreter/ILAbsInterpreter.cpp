@@ -0,0 +1,518 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/abstractinterpreter/ILAbsInterpreter.hpp"
+
+#include <limits.h>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "il/Block.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/CfgEdge.hpp"
+#include "infra/List.hpp"
+#include "optimizer/CallInfo.hpp"
+#include "optimizer/GlobalValuePropagation.hpp"
+#include "optimizer/OptimizationManager.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/VPConstraint.hpp"
+
+// Passes over the reachable blocks before the values of all symbols are
+// widened to top
+//
+#define MAX_PASSES 8
+
+static TR::VPConstraint *
+constraintOf(TR::AbsValue *value)
+   {
+   if (value == NULL || value->isTop())
+      return NULL;
+   return static_cast<TR::AbsVPValue *>(value)->getConstraint();
+   }
+
+static bool
+isParameter(TR::AbsValue *value)
+   {
+   return value != NULL && value->getParameterPosition() >= 0;
+   }
+
+static bool
+compareResult(TR::ILOpCode &op, bool less, bool equal, bool greater)
+   {
+   return (less && op.isCompareTrueIfLess())
+       || (equal && op.isCompareTrueIfEqual())
+       || (greater && op.isCompareTrueIfGreater());
+   }
+
+/**
+ * Decide a comparison of two values, when their constraints are precise
+ * enough to.
+ */
+static TR_YesNoMaybe
+decideCompare(TR::ILOpCode &op, TR::Node *operand, TR::AbsValue *first, TR::AbsValue *second)
+   {
+   TR::VPConstraint *c1 = constraintOf(first);
+   TR::VPConstraint *c2 = constraintOf(second);
+   if (c1 == NULL || c2 == NULL)
+      return TR_maybe;
+
+   if (operand->getDataType() == TR::Int32 && c1->asIntConst() && c2->asIntConst())
+      {
+      int32_t v1 = c1->asIntConst()->getLowInt();
+      int32_t v2 = c2->asIntConst()->getLowInt();
+      bool less = op.isUnsignedCompare() ? (uint32_t)v1 < (uint32_t)v2 : v1 < v2;
+      bool greater = op.isUnsignedCompare() ? (uint32_t)v1 > (uint32_t)v2 : v1 > v2;
+      return compareResult(op, less, v1 == v2, greater) ? TR_yes : TR_no;
+      }
+
+   if (operand->getDataType() == TR::Address && op.isCompareForEquality())
+      {
+      if (c1->isNullObject() && c2->isNullObject())
+         return compareResult(op, false, true, false) ? TR_yes : TR_no;
+      if ((c1->isNullObject() && c2->isNonNullObject()) || (c1->isNonNullObject() && c2->isNullObject()))
+         return compareResult(op, true, false, true) ? TR_yes : TR_no;
+      }
+
+   return TR_maybe;
+   }
+
+/**
+ * The range of values v for which v <op> c is true, where op is true if
+ * less, equal and/or greater, if it is a single range.
+ */
+static bool
+rangeWhereTrue(bool less, bool equal, bool greater, int32_t c, int32_t &low, int32_t &high)
+   {
+   if (less && greater)
+      return false;
+   if (!less && !equal && !greater)
+      return false;
+   if (!less && !equal && c == INT_MAX)
+      return false;
+   if (!greater && !equal && c == INT_MIN)
+      return false;
+
+   low = less ? INT_MIN : (equal ? c : c + 1);
+   high = greater ? INT_MAX : (equal ? c : c - 1);
+   return true;
+   }
+
+TR::ILAbsInterpreter::ILAbsInterpreter(TR::ResolvedMethodSymbol *methodSymbol, TR::ValuePropagation *vp, TR::Region &region, TR::Compilation *comp) :
+      _methodSymbol(methodSymbol),
+      _vp(vp),
+      _region(region),
+      _comp(comp),
+      _visitor(NULL),
+      _changed(false),
+      _widened(false),
+      _symbolValues(std::less<TR::Symbol*>(), region),
+      _nodeValues(std::less<TR::Node*>(), region),
+      _reachableBlocks(std::less<TR::Block*>(), region),
+      _potentialOptimizations(region)
+   {}
+
+bool
+TR::ILAbsInterpreter::interpret(TR::vector<TR::AbsValue*, TR::Region&> *arguments, TR::AbsVisitor *visitor)
+   {
+   TR::TreeTop *firstTree = _methodSymbol->getFirstTreeTop();
+   if (firstTree == NULL)
+      return false;
+
+   _visitor = visitor;
+   _widened = false;
+   _symbolValues.clear();
+   _reachableBlocks.clear();
+   _potentialOptimizations.clear();
+
+   ListIterator<TR::ParameterSymbol> parms(&_methodSymbol->getParameterList());
+   for (TR::ParameterSymbol *parm = parms.getFirst(); parm; parm = parms.getNext())
+      {
+      int32_t ordinal = parm->getOrdinal();
+      TR::AbsValue *argument = arguments && ordinal < arguments->size() ? arguments->at(ordinal) : NULL;
+      TR::AbsValue *value = argument && argument->getDataType() == parm->getDataType() ? argument->clone(region()) : createTopValue(parm->getDataType());
+      value->setParameterPosition(ordinal);
+      _symbolValues[parm] = value;
+      }
+
+   markReachable(firstTree->getNode()->getBlock());
+
+   int32_t pass = 0;
+   do
+      {
+      _changed = false;
+      for (TR::Block *block = firstTree->getNode()->getBlock(); block; block = block->getNextBlock())
+         {
+         if (_reachableBlocks.find(block) != _reachableBlocks.end())
+            interpretBlock(block, false);
+         }
+      }
+   while (_changed && ++pass < MAX_PASSES);
+
+   if (_changed)
+      {
+      // Give up on the values and branch decisions found so far
+      //
+      _widened = true;
+      for (SymbolValueMap::iterator it = _symbolValues.begin(); it != _symbolValues.end(); ++it)
+         it->second->setToTop();
+      for (TR::Block *block = firstTree->getNode()->getBlock(); block; block = block->getNextBlock())
+         markReachable(block);
+      }
+
+   for (TR::Block *block = firstTree->getNode()->getBlock(); block; block = block->getNextBlock())
+      {
+      if (_reachableBlocks.find(block) != _reachableBlocks.end())
+         interpretBlock(block, true);
+      }
+
+   _visitor = NULL;
+   return true;
+   }
+
+void
+TR::ILAbsInterpreter::interpretBlock(TR::Block *block, bool finalPass)
+   {
+   _nodeValues.clear();
+
+   for (TR::TreeTop *tt = block->getEntry()->getNextTreeTop(); tt != block->getExit(); tt = tt->getNextTreeTop())
+      interpretNode(tt->getNode(), tt, block, finalPass);
+
+   TR::Node *lastNode = block->getLastRealTreeTop()->getNode();
+   if (lastNode->getOpCode().isIf())
+      {
+      interpretBranch(lastNode, block, finalPass);
+      }
+   else
+      {
+      for (auto edge = block->getSuccessors().begin(); edge != block->getSuccessors().end(); ++edge)
+         markReachable((*edge)->getTo()->asBlock());
+      }
+
+   for (auto edge = block->getExceptionSuccessors().begin(); edge != block->getExceptionSuccessors().end(); ++edge)
+      markReachable((*edge)->getTo()->asBlock());
+   }
+
+TR::AbsValue *
+TR::ILAbsInterpreter::interpretNode(TR::Node *node, TR::TreeTop *tt, TR::Block *block, bool finalPass)
+   {
+   NodeValueMap::iterator found = _nodeValues.find(node);
+   if (found != _nodeValues.end())
+      return found->second;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      interpretNode(node->getChild(i), tt, block, finalPass);
+
+   TR::ILOpCode &op = node->getOpCode();
+   TR::AbsValue *value = NULL;
+
+   switch (node->getOpCodeValue())
+      {
+      case TR::iconst:
+         value = new (region()) TR::AbsVPValue(_vp, TR::VPIntConst::create(_vp, node->getInt()), TR::Int32);
+         break;
+      case TR::lconst:
+         value = new (region()) TR::AbsVPValue(_vp, TR::VPLongConst::create(_vp, node->getLongInt()), TR::Int64);
+         break;
+      case TR::aconst:
+         if (node->getAddress() == 0)
+            value = new (region()) TR::AbsVPValue(_vp, TR::VPNullObject::create(_vp), TR::Address);
+         else
+            value = new (region()) TR::AbsVPValue(_vp, TR::VPNonNullObject::create(_vp), TR::Address);
+         break;
+      case TR::i2l:
+         {
+         TR::VPConstraint *c = constraintOf(_nodeValues[node->getFirstChild()]);
+         if (c && c->asIntConst())
+            value = new (region()) TR::AbsVPValue(_vp, TR::VPLongConst::create(_vp, c->asIntConst()->getLowInt()), TR::Int64);
+         }
+         break;
+      case TR::iadd:
+      case TR::isub:
+         {
+         TR::VPConstraint *c1 = constraintOf(_nodeValues[node->getFirstChild()]);
+         TR::VPConstraint *c2 = constraintOf(_nodeValues[node->getSecondChild()]);
+         if (c1 && c2 && c1->asIntConst() && c2->asIntConst())
+            {
+            uint32_t v1 = (uint32_t)c1->asIntConst()->getLowInt();
+            uint32_t v2 = (uint32_t)c2->asIntConst()->getLowInt();
+            int32_t result = (int32_t)(node->getOpCodeValue() == TR::iadd ? v1 + v2 : v1 - v2);
+            value = new (region()) TR::AbsVPValue(_vp, TR::VPIntConst::create(_vp, result), TR::Int32);
+            }
+         }
+         break;
+      default:
+         if (op.isLoadVarDirect() && node->getSymbol()->isAutoOrParm())
+            {
+            value = getSymbolValue(node->getSymbol(), node->getDataType());
+            }
+         else if (op.isStoreDirect() && node->getSymbol()->isAutoOrParm())
+            {
+            interpretStore(node, _nodeValues[node->getFirstChild()]);
+            }
+         else if (op.isCallDirect())
+            {
+            if (finalPass && _visitor)
+               interpretCall(node, tt, block);
+            }
+         else if (op.isBooleanCompare() && !op.isBranch() && node->getNumChildren() == 2)
+            {
+            TR_YesNoMaybe result = decideCompare(op, node->getFirstChild(), _nodeValues[node->getFirstChild()], _nodeValues[node->getSecondChild()]);
+            if (result != TR_maybe)
+               value = new (region()) TR::AbsVPValue(_vp, TR::VPIntConst::create(_vp, result == TR_yes ? 1 : 0), TR::Int32);
+            }
+         break;
+      }
+
+   if (value == NULL && node->getDataType() != TR::NoType)
+      value = createTopValue(node->getDataType());
+
+   _nodeValues[node] = value;
+   return value;
+   }
+
+TR::AbsValue *
+TR::ILAbsInterpreter::interpretStore(TR::Node *node, TR::AbsValue *value)
+   {
+   TR::Symbol *symbol = node->getSymbol();
+
+   TR::AbsValue *stored = value ? value->clone(region()) : createTopValue(node->getDataType());
+   if (_widened)
+      stored->setToTop();
+
+   SymbolValueMap::iterator it = _symbolValues.find(symbol);
+   if (it == _symbolValues.end())
+      {
+      _symbolValues[symbol] = stored;
+      _changed = true;
+      return stored;
+      }
+
+   TR::AbsVPValue *current = static_cast<TR::AbsVPValue *>(it->second);
+   TR::VPConstraint *oldConstraint = current->getConstraint();
+   int32_t oldParamPos = current->getParameterPosition();
+   TR::DataType oldDataType = current->getDataType();
+
+   current->merge(stored);
+
+   if (current->getConstraint() != oldConstraint
+       || current->getParameterPosition() != oldParamPos
+       || current->getDataType() != oldDataType)
+      _changed = true;
+
+   return current;
+   }
+
+void
+TR::ILAbsInterpreter::interpretCall(TR::Node *node, TR::TreeTop *tt, TR::Block *block)
+   {
+   TR::ResolvedMethodSymbol *calleeSymbol = node->getSymbol()->getResolvedMethodSymbol();
+   if (calleeSymbol == NULL)
+      return;
+
+   TR_ResolvedMethod *callee = calleeSymbol->getResolvedMethod();
+
+   TR::vector<TR::AbsValue*, TR::Region&> *arguments = new (region()) TR::vector<TR::AbsValue*, TR::Region&>(region());
+   for (int32_t i = node->getFirstArgumentIndex(); i < node->getNumChildren(); i++)
+      {
+      TR::AbsValue *argument = _nodeValues[node->getChild(i)];
+      if (argument == NULL)
+         argument = createTopValue(node->getChild(i)->getDataType());
+
+      // JitBuilder widens Int32 arguments to the word size, which the callee narrows again
+      //
+      int32_t parmIndex = i - node->getFirstArgumentIndex();
+      TR::VPConstraint *c = constraintOf(argument);
+      if (c && c->asLongConst() && parmIndex < callee->numberOfParameterSlots() && callee->parmType(parmIndex) == TR::Int32
+          && c->asLongConst()->getLong() == (int32_t)c->asLongConst()->getLong())
+         argument = new (region()) TR::AbsVPValue(_vp, TR::VPIntConst::create(_vp, (int32_t)c->asLongConst()->getLong()), TR::Int32);
+
+      arguments->push_back(argument);
+      }
+
+   TR_CallSite *callSite = new (region()) TR_DirectCallSite(
+                                             _methodSymbol->getResolvedMethod(),
+                                             tt,
+                                             tt->getNode() != node ? tt->getNode() : NULL,
+                                             node,
+                                             NULL,
+                                             NULL,
+                                             -1,
+                                             node->getSymbolReference()->getCPIndex(),
+                                             callee,
+                                             calleeSymbol,
+                                             false,
+                                             false,
+                                             node->getByteCodeInfo(),
+                                             comp());
+
+   _visitor->visitCallSite(callSite, block, arguments);
+   }
+
+void
+TR::ILAbsInterpreter::interpretBranch(TR::Node *node, TR::Block *block, bool finalPass)
+   {
+   if (finalPass)
+      {
+      // Conditions computed by a comparison are branched on by comparing
+      // them with zero, as JitBuilder does
+      //
+      TR::Node *compare = node;
+      TR::Node *condition = node->getFirstChild();
+      if (condition->getOpCode().isBooleanCompare() && !condition->getOpCode().isBranch()
+          && condition->getNumChildren() == 2 && node->getSecondChild()->getOpCodeValue() == TR::iconst)
+         compare = condition;
+      recordBranch(compare, node);
+      }
+
+   TR_YesNoMaybe taken = decideCompare(node->getOpCode(), node->getFirstChild(), _nodeValues[node->getFirstChild()], _nodeValues[node->getSecondChild()]);
+   TR::Block *destination = node->getBranchDestination()->getNode()->getBlock();
+
+   for (auto edge = block->getSuccessors().begin(); edge != block->getSuccessors().end(); ++edge)
+      {
+      TR::Block *successor = (*edge)->getTo()->asBlock();
+      if (successor == destination ? taken != TR_no : taken != TR_yes)
+         markReachable(successor);
+      }
+   }
+
+void
+TR::ILAbsInterpreter::recordBranch(TR::Node *compare, TR::Node *branch)
+   {
+   TR::ILOpCode &op = compare->getOpCode();
+   if (op.isUnsignedCompare())
+      return;
+
+   TR::AbsValue *operand = _nodeValues[compare->getFirstChild()];
+   TR::AbsValue *other = _nodeValues[compare->getSecondChild()];
+   bool less = op.isCompareTrueIfLess();
+   bool equal = op.isCompareTrueIfEqual();
+   bool greater = op.isCompareTrueIfGreater();
+
+   if (!isParameter(operand) && isParameter(other))
+      {
+      std::swap(operand, other);
+      std::swap(less, greater);
+      }
+
+   TR::VPConstraint *constant = constraintOf(other);
+   if (!isParameter(operand) || constant == NULL)
+      return;
+
+   uint32_t argPos = operand->getParameterPosition();
+   uint32_t bytecodeIndex = branch->getByteCodeIndex();
+
+   if (compare->getFirstChild()->getDataType() == TR::Int32 && constant->asIntConst())
+      {
+      int32_t c = constant->asIntConst()->getLowInt();
+      int32_t low, high;
+      if (rangeWhereTrue(less, equal, greater, c, low, high))
+         recordIntRange(argPos, bytecodeIndex, low, high);
+      if (rangeWhereTrue(!less, !equal, !greater, c, low, high))
+         recordIntRange(argPos, bytecodeIndex, low, high);
+      }
+   else if (compare->getFirstChild()->getDataType() == TR::Address && op.isCompareForEquality() && constant->isNullObject())
+      {
+      TR::PotentialOptimizationRecord record = { argPos, bytecodeIndex, TR::PotentialOptimizationPredicate::BranchFolding, TR::PotentialOptimizationRecord::NullObject, 0, 0 };
+      _potentialOptimizations.push_back(record);
+      record._constraintKind = TR::PotentialOptimizationRecord::NonNullObject;
+      _potentialOptimizations.push_back(record);
+      }
+   }
+
+void
+TR::ILAbsInterpreter::recordIntRange(uint32_t argPos, uint32_t bytecodeIndex, int32_t low, int32_t high)
+   {
+   TR::PotentialOptimizationRecord record = { argPos, bytecodeIndex, TR::PotentialOptimizationPredicate::BranchFolding, TR::PotentialOptimizationRecord::IntRange, low, high };
+   _potentialOptimizations.push_back(record);
+   }
+
+TR::AbsVPValue *
+TR::ILAbsInterpreter::createTopValue(TR::DataType dataType)
+   {
+   return new (region()) TR::AbsVPValue(_vp, NULL, dataType);
+   }
+
+TR::AbsValue *
+TR::ILAbsInterpreter::getSymbolValue(TR::Symbol *symbol, TR::DataType dataType)
+   {
+   SymbolValueMap::iterator it = _symbolValues.find(symbol);
+   if (it == _symbolValues.end())
+      return createTopValue(dataType);
+   return it->second->clone(region());
+   }
+
+void
+TR::ILAbsInterpreter::markReachable(TR::Block *block)
+   {
+   if (block == NULL || block == _methodSymbol->getFlowGraph()->getEnd())
+      return;
+   if (_reachableBlocks.insert(block).second)
+      _changed = true;
+   }
+
+TR::InliningMethodSummary *
+TR::ILAbsInterpreter::createInliningMethodSummary(const TR::PotentialOptimizationRecord *records, size_t numRecords, TR::ValuePropagation *vp, TR::Region &region)
+   {
+   TR::InliningMethodSummary *summary = new (region) TR::InliningMethodSummary(region);
+
+   for (size_t i = 0; i < numRecords; i++)
+      {
+      const TR::PotentialOptimizationRecord &record = records[i];
+      TR::VPConstraint *constraint;
+      switch (record._constraintKind)
+         {
+         case TR::PotentialOptimizationRecord::IntRange:
+            constraint = TR::VPIntRange::create(vp, record._low, record._high);
+            break;
+         case TR::PotentialOptimizationRecord::NullObject:
+            constraint = TR::VPNullObject::create(vp);
+            break;
+         default:
+            constraint = TR::VPNonNullObject::create(vp);
+            break;
+         }
+
+      TR::PotentialOptimizationPredicate *predicate = new (region) TR::PotentialOptimizationVPPredicate(constraint, record._bytecodeIndex, record._kind, vp);
+      summary->addPotentialOptimizationByArgument(predicate, record._argPos);
+      }
+
+   return summary;
+   }
+
+TR::ValuePropagation *
+TR::ILAbsInterpreter::createValuePropagation(TR::Compilation *comp)
+   {
+   TR::OptimizationManager *manager = comp->getOptimizer()->getOptimization(OMR::globalValuePropagation);
+   if (manager == NULL)
+      manager = new (comp->allocator()) TR::OptimizationManager(comp->getOptimizer(), TR::GlobalValuePropagation::create, OMR::globalValuePropagation);
+
+   TR::ValuePropagation *vp = static_cast<TR::ValuePropagation *>(manager->factory()(manager));
+   vp->initialize();
+   return vp;
+   }
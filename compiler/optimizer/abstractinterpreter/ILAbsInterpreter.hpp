@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef IL_ABS_INTERPRETER_INCL
+#define IL_ABS_INTERPRETER_INCL
+
+#include <map>
+#include <set>
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "env/Region.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/abstractinterpreter/AbsValue.hpp"
+#include "optimizer/abstractinterpreter/AbsVisitor.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummary.hpp"
+
+namespace TR { class Block; }
+namespace TR { class Compilation; }
+namespace TR { class Node; }
+namespace TR { class ResolvedMethodSymbol; }
+namespace TR { class Symbol; }
+namespace TR { class TreeTop; }
+namespace TR { class ValuePropagation; }
+
+namespace TR {
+
+/**
+ * A potential optimization of a method that depends on one of its arguments,
+ * in a form that does not refer to any compilation so that it can outlive the
+ * compilation that found it.
+ */
+struct PotentialOptimizationRecord
+   {
+   enum ConstraintKind
+      {
+      IntRange,
+      NullObject,
+      NonNullObject
+      };
+
+   uint32_t _argPos;
+   uint32_t _bytecodeIndex;
+   TR::PotentialOptimizationPredicate::Kind _kind;
+   ConstraintKind _constraintKind;
+   int32_t _low;     // bounds of an IntRange constraint
+   int32_t _high;
+   };
+
+/**
+ * Abstract interpreter for methods whose IL has already been generated, for
+ * front ends such as JitBuilder and Tril that have no bytecode to interpret.
+ *
+ * The interpreter walks the trees of the method's reachable blocks, tracking
+ * the values of its autos and parameters as AbsVPValues.  Stores merge into
+ * the value of their symbol regardless of where they are in the method, and
+ * the blocks are walked again until no value changes, or are given up on and
+ * every symbol widened to top after a few passes.  A conditional branch whose
+ * operands are constants only makes its taken or its fall through block
+ * reachable, so interpreting a method with the arguments of a call site finds
+ * the call sites that remain once the method is inlined there.
+ *
+ * Each branch that compares a parameter with a constant, either directly or
+ * through a comparison it tests, is recorded as a potential optimization of
+ * that argument: an int range that decides the branch, or the nullness of an
+ * address.  Only the signed comparisons of Int32 values and the comparisons of
+ * addresses with null are understood.
+ */
+class ILAbsInterpreter
+   {
+   public:
+
+   ILAbsInterpreter(TR::ResolvedMethodSymbol *methodSymbol, TR::ValuePropagation *vp, TR::Region &region, TR::Compilation *comp);
+
+   /**
+    * @brief Interpret the method.
+    *
+    * @param arguments the values of the arguments passed by the caller, or NULL if they are unknown
+    * @param visitor the visitor to call back for each direct call in a reachable block, or NULL
+    *
+    * @return false if the method has no trees to interpret
+    */
+   bool interpret(TR::vector<TR::AbsValue*, TR::Region&> *arguments, TR::AbsVisitor *visitor);
+
+   /**
+    * The potential optimizations found by the last interpretation.  They are
+    * only complete when it was given no arguments.
+    */
+   const TR::vector<TR::PotentialOptimizationRecord, TR::Region&> &getPotentialOptimizations() { return _potentialOptimizations; }
+
+   /**
+    * @brief Build an inlining method summary for the given potential optimizations.
+    */
+   static TR::InliningMethodSummary *createInliningMethodSummary(const TR::PotentialOptimizationRecord *records, size_t numRecords, TR::ValuePropagation *vp, TR::Region &region);
+
+   /**
+    * @brief Create a value propagation for the constraints of abstract values
+    * outside of any optimization pass.  The compilation must have an optimizer.
+    */
+   static TR::ValuePropagation *createValuePropagation(TR::Compilation *comp);
+
+   private:
+
+   TR::Compilation *comp() { return _comp; }
+   TR::Region &region() { return _region; }
+
+   void interpretBlock(TR::Block *block, bool finalPass);
+   TR::AbsValue *interpretNode(TR::Node *node, TR::TreeTop *tt, TR::Block *block, bool finalPass);
+   TR::AbsValue *interpretStore(TR::Node *node, TR::AbsValue *value);
+   void interpretCall(TR::Node *node, TR::TreeTop *tt, TR::Block *block);
+   void interpretBranch(TR::Node *node, TR::Block *block, bool finalPass);
+
+   TR::AbsVPValue *createTopValue(TR::DataType dataType);
+   TR::AbsValue *getSymbolValue(TR::Symbol *symbol, TR::DataType dataType);
+
+   void markReachable(TR::Block *block);
+   void recordBranch(TR::Node *compareNode, TR::Node *branchNode);
+   void recordIntRange(uint32_t argPos, uint32_t bytecodeIndex, int32_t low, int32_t high);
+
+   TR::ResolvedMethodSymbol *_methodSymbol;
+   TR::ValuePropagation *_vp;
+   TR::Region &_region;
+   TR::Compilation *_comp;
+   TR::AbsVisitor *_visitor;
+   bool _changed;
+   bool _widened;
+
+   typedef TR::typed_allocator<std::pair<TR::Symbol* const, TR::AbsValue*>, TR::Region&> SymbolValueMapAllocator;
+   typedef std::map<TR::Symbol*, TR::AbsValue*, std::less<TR::Symbol*>, SymbolValueMapAllocator> SymbolValueMap;
+   SymbolValueMap _symbolValues;
+
+   typedef TR::typed_allocator<std::pair<TR::Node* const, TR::AbsValue*>, TR::Region&> NodeValueMapAllocator;
+   typedef std::map<TR::Node*, TR::AbsValue*, std::less<TR::Node*>, NodeValueMapAllocator> NodeValueMap;
+   NodeValueMap _nodeValues;
+
+   typedef TR::typed_allocator<TR::Block*, TR::Region&> BlockSetAllocator;
+   typedef std::set<TR::Block*, std::less<TR::Block*>, BlockSetAllocator> BlockSet;
+   BlockSet _reachableBlocks;
+
+   TR::vector<TR::PotentialOptimizationRecord, TR::Region&> _potentialOptimizations;
+   };
+
+}
+
+#endif
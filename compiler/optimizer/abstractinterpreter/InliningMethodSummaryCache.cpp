@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "env/TRMemory.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "optimizer/BenefitInliner.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/abstractinterpreter/ILAbsInterpreter.hpp"
+
+#define SUMMARY_CACHE_INDEX_SIZE 1024
+
+struct SummaryCacheEntry
+   {
+   void                            *entryPoint;
+   TR::InliningMethodSummaryRecord  record;
+   SummaryCacheEntry               *next;
+   };
+
+static SummaryCacheEntry *cacheIndex[SUMMARY_CACHE_INDEX_SIZE];
+static TR::Monitor       *cacheMonitor = NULL;
+
+static size_t
+indexOf(void *entryPoint)
+   {
+   return (reinterpret_cast<uintptr_t>(entryPoint) >> 4) % SUMMARY_CACHE_INDEX_SIZE;
+   }
+
+void
+TR::InliningMethodSummaryCache::initialize()
+   {
+   memset(cacheIndex, 0, sizeof(cacheIndex));
+   cacheMonitor = TR::Monitor::create("JIT-InliningMethodSummaryCacheMonitor");
+   }
+
+void
+TR::InliningMethodSummaryCache::shutdown()
+   {
+   if (cacheMonitor == NULL)
+      return;
+
+   for (size_t i = 0; i < SUMMARY_CACHE_INDEX_SIZE; i++)
+      {
+      while (cacheIndex[i])
+         {
+         SummaryCacheEntry *entry = cacheIndex[i];
+         cacheIndex[i] = entry->next;
+         free(entry);
+         }
+      }
+
+   TR::Monitor::destroy(cacheMonitor);
+   cacheMonitor = NULL;
+   }
+
+bool
+TR::InliningMethodSummaryCache::isActive()
+   {
+   return cacheMonitor != NULL;
+   }
+
+void
+TR::InliningMethodSummaryCache::summarizeMethod(TR::Compilation *comp)
+   {
+   // Abstract interpretation is only worth its cost when the benefit inliner
+   // reads the summaries.  Compilations share their strategy with the ones
+   // that would look this method up.
+   //
+   if (comp->getOptimizer() == NULL || !comp->getOptimizer()->strategyRuns(TR::BenefitInlinerWrapper::create))
+      return;
+
+   TR::ResolvedMethodSymbol *methodSymbol = comp->getMethodSymbol();
+   TR::ValuePropagation *vp = TR::ILAbsInterpreter::createValuePropagation(comp);
+
+   TR::InliningMethodSummaryRecord *record = static_cast<TR::InliningMethodSummaryRecord *>(comp->trMemory()->allocateHeapMemory(sizeof(TR::InliningMethodSummaryRecord)));
+   record->_numOptimizations = 0;
+   record->_optimizations = NULL;
+
+      {
+      TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+      TR::ILAbsInterpreter interpreter(methodSymbol, vp, stackMemoryRegion, comp);
+      if (!interpreter.interpret(NULL, NULL))
+         return;
+
+      const TR::vector<TR::PotentialOptimizationRecord, TR::Region&> &optimizations = interpreter.getPotentialOptimizations();
+      if (!optimizations.empty())
+         {
+         record->_numOptimizations = optimizations.size();
+         record->_optimizations = static_cast<TR::PotentialOptimizationRecord *>(comp->trMemory()->allocateHeapMemory(optimizations.size() * sizeof(TR::PotentialOptimizationRecord)));
+         memcpy(record->_optimizations, &optimizations[0], optimizations.size() * sizeof(TR::PotentialOptimizationRecord));
+         }
+      }
+
+   if (comp->getOption(TR_TraceBISummary))
+      {
+      TR::InliningMethodSummary *summary = TR::ILAbsInterpreter::createInliningMethodSummary(record->_optimizations, record->_numOptimizations, vp, comp->trMemory()->heapMemoryRegion());
+      traceMsg(comp, "Summary of %s for the inlining method summary cache\n", comp->signature());
+      summary->trace(comp);
+      }
+
+   comp->setInliningMethodSummaryRecord(record);
+   }
+
+void
+TR::InliningMethodSummaryCache::storeMethod(TR::Compilation *comp)
+   {
+   const TR::InliningMethodSummaryRecord *record = comp->getInliningMethodSummaryRecord();
+   void *entryPoint = comp->getMethodSymbol()->getMethodAddress();
+   if (record == NULL || entryPoint == NULL)
+      return;
+
+   size_t optimizationsSize = record->_numOptimizations * sizeof(TR::PotentialOptimizationRecord);
+   SummaryCacheEntry *entry = static_cast<SummaryCacheEntry *>(malloc(sizeof(SummaryCacheEntry) + optimizationsSize));
+   if (entry == NULL)
+      return;
+
+   entry->entryPoint = entryPoint;
+   entry->record._numOptimizations = record->_numOptimizations;
+   entry->record._optimizations = reinterpret_cast<TR::PotentialOptimizationRecord *>(entry + 1);
+   if (optimizationsSize > 0)
+      memcpy(entry->record._optimizations, record->_optimizations, optimizationsSize);
+
+   OMR::CriticalSection store(cacheMonitor);
+
+   // A method compiled again at the same address replaces its summary
+   //
+   for (SummaryCacheEntry **cursor = &cacheIndex[indexOf(entryPoint)]; *cursor; cursor = &(*cursor)->next)
+      {
+      if ((*cursor)->entryPoint == entryPoint)
+         {
+         SummaryCacheEntry *replaced = *cursor;
+         *cursor = replaced->next;
+         free(replaced);
+         break;
+         }
+      }
+
+   entry->next = cacheIndex[indexOf(entryPoint)];
+   cacheIndex[indexOf(entryPoint)] = entry;
+   }
+
+void
+TR::InliningMethodSummaryCache::removeMethod(void *entryPoint)
+   {
+   if (cacheMonitor == NULL || entryPoint == NULL)
+      return;
+
+   OMR::CriticalSection remove(cacheMonitor);
+
+   for (SummaryCacheEntry **cursor = &cacheIndex[indexOf(entryPoint)]; *cursor; cursor = &(*cursor)->next)
+      {
+      if ((*cursor)->entryPoint == entryPoint)
+         {
+         SummaryCacheEntry *removed = *cursor;
+         *cursor = removed->next;
+         free(removed);
+         return;
+         }
+      }
+   }
+
+static SummaryCacheEntry *
+findEntry(void *entryPoint)
+   {
+   for (SummaryCacheEntry *entry = cacheIndex[indexOf(entryPoint)]; entry; entry = entry->next)
+      {
+      if (entry->entryPoint == entryPoint)
+         return entry;
+      }
+   return NULL;
+   }
+
+bool
+TR::InliningMethodSummaryCache::hasSummary(void *entryPoint)
+   {
+   if (cacheMonitor == NULL || entryPoint == NULL)
+      return false;
+
+   OMR::CriticalSection lookup(cacheMonitor);
+   return findEntry(entryPoint) != NULL;
+   }
+
+TR::InliningMethodSummary *
+TR::InliningMethodSummaryCache::findSummary(void *entryPoint, TR::ValuePropagation *vp, TR::Region &region)
+   {
+   if (cacheMonitor == NULL || entryPoint == NULL)
+      return NULL;
+
+   OMR::CriticalSection lookup(cacheMonitor);
+
+   SummaryCacheEntry *entry = findEntry(entryPoint);
+   if (entry == NULL)
+      return NULL;
+
+   return TR::ILAbsInterpreter::createInliningMethodSummary(entry->record._optimizations, entry->record._numOptimizations, vp, region);
+   }
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef INLINING_METHOD_SUMMARY_CACHE_INCL
+#define INLINING_METHOD_SUMMARY_CACHE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace TR { class Compilation; }
+namespace TR { class InliningMethodSummary; }
+namespace TR { class Region; }
+namespace TR { class ValuePropagation; }
+namespace TR { struct PotentialOptimizationRecord; }
+
+namespace TR
+{
+
+/**
+ * The potential optimizations found in the IL of a method.
+ */
+struct InliningMethodSummaryRecord
+   {
+   size_t _numOptimizations;
+   TR::PotentialOptimizationRecord *_optimizations;
+   };
+
+/**
+ * Keeps the inlining method summaries of compiled methods, enabled with
+ * -Xjit:enableBenefitInliner, so that the benefit inliner can weigh calls to
+ * methods whose IL is not available to it, such as the functions a JitBuilder
+ * method calls after they were compiled on their own.
+ *
+ * A method is summarized by TR::ILAbsInterpreter right after its IL is
+ * generated, before it is optimized, and the summary is kept under the entry
+ * point of its code once the compilation succeeds.  The summary is kept as
+ * TR::PotentialOptimizationRecords and turned back into an
+ * InliningMethodSummary, with constraints of the value propagation of the
+ * compilation that looks it up, every time it is used.
+ *
+ * Only compilations whose optimization strategy runs the benefit inliner are
+ * summarized.  A summary is dropped when the code of its method is retired, as
+ * the entry point may be reused by another method once the code is reclaimed.
+ */
+class InliningMethodSummaryCache
+   {
+   public:
+
+   /**
+    * Must be called once before any method is compiled, while only one
+    * thread is running.
+    */
+   static void initialize();
+
+   static void shutdown();
+
+   static bool isActive();
+
+   /**
+    * Summarize the method whose IL was just generated and keep the summary
+    * on the compilation until the method is stored.
+    */
+   static void summarizeMethod(TR::Compilation *comp);
+
+   /**
+    * Keep the summary of a method just compiled under its entry point.
+    */
+   static void storeMethod(TR::Compilation *comp);
+
+   /**
+    * Drop the summary of the method whose code starts at entryPoint.
+    */
+   static void removeMethod(void *entryPoint);
+
+   static bool hasSummary(void *entryPoint);
+
+   /**
+    * @brief Find the summary of the method whose code starts at entryPoint.
+    *
+    * @return the summary, allocated in region, or NULL if the method was not summarized
+    */
+   static TR::InliningMethodSummary *findSummary(void *entryPoint, TR::ValuePropagation *vp, TR::Region &region);
+   };
+
+}
+
+#endif
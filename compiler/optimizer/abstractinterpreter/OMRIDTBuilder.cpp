@@ -21,7 +21,10 @@
 
 #include "optimizer/abstractinterpreter/IDTBuilder.hpp"
 #include "optimizer/abstractinterpreter/IDT.hpp"
+#include "optimizer/abstractinterpreter/ILAbsInterpreter.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
 #include "il/Block.hpp"
+#include "infra/Cfg.hpp"
 #ifdef J9_PROJECT_SPECIFIC
 #include "env/j9method.h"
 #include "control/RecompilationInfo.hpp"
@@ -35,7 +38,8 @@ OMR::IDTBuilder::IDTBuilder(TR::ResolvedMethodSymbol* symbol, int32_t budget, TR
       _rootBudget(budget),
       _region(region),
       _comp(comp),
-      _inliner(inliner)
+      _inliner(inliner),
+      _valuePropagation(NULL)
    {}
 
 TR::IDTBuilder* OMR::IDTBuilder::self()
@@ -101,6 +105,65 @@ TR::IDT* OMR::IDTBuilder::buildIDT()
    return _idt;
    }
 
+TR::ValuePropagation* OMR::IDTBuilder::getValuePropagation()
+   {
+   if (_valuePropagation == NULL)
+      _valuePropagation = TR::ILAbsInterpreter::createValuePropagation(comp());
+
+   return _valuePropagation;
+   }
+
+TR::CFG* OMR::IDTBuilder::generateControlFlowGraph(TR_CallTarget* callTarget)
+   {
+   TR::ResolvedMethodSymbol* symbol = callTarget->_calleeSymbol;
+
+   if (symbol && symbol->getFirstTreeTop() && symbol->getFlowGraph())
+      {
+      callTarget->_cfg = symbol->getFlowGraph();
+      return callTarget->_cfg;
+      }
+
+   // A method compiled on its own can only be weighed by the summary kept when it was compiled,
+   // and only inlined if its IL can be generated again.
+   // None of its call sites are explored, so its flow graph is left empty.
+   TR_ResolvedMethod* method = callTarget->_calleeMethod;
+   if (method->isInterpreted() || !TR::InliningMethodSummaryCache::hasSummary(method->startAddressForJittedMethod())
+       || !method->isInlineable(comp()))
+      return NULL;
+
+   callTarget->_cfg = new (region()) TR::CFG(comp(), symbol, region());
+   return callTarget->_cfg;
+   }
+
+void OMR::IDTBuilder::performAbstractInterpretation(TR::IDTNode* node, OMR::IDTBuilder::Visitor& visitor, TR::vector<TR::AbsValue*, TR::Region&>* arguments)
+   {
+   TR::ILAbsInterpreter interpreter(node->getResolvedMethodSymbol(), getValuePropagation(), region(), comp());
+   TR::InliningMethodSummary* summary = NULL;
+
+   // The summary has to be found with unknown arguments.
+   // The call sites are then found with those of this call, so that the ones in code they rule out are not explored.
+   if (interpreter.interpret(NULL, arguments ? NULL : &visitor))
+      {
+      const TR::vector<TR::PotentialOptimizationRecord, TR::Region&> &optimizations = interpreter.getPotentialOptimizations();
+      summary = TR::ILAbsInterpreter::createInliningMethodSummary(optimizations.empty() ? NULL : &optimizations[0], optimizations.size(), getValuePropagation(), region());
+
+      if (arguments)
+         interpreter.interpret(arguments, &visitor);
+      }
+   else if (!node->getResolvedMethod()->isInterpreted())
+      {
+      summary = TR::InliningMethodSummaryCache::findSummary(node->getResolvedMethod()->startAddressForJittedMethod(), getValuePropagation(), region());
+      }
+
+   node->setInliningMethodSummary(summary);
+
+   if (summary && comp()->getOption(TR_TraceBISummary))
+      {
+      traceMsg(comp(), "Inlining method summary of %s\n", node->getName(comp()->trMemory()));
+      summary->trace(comp());
+      }
+   }
+
 void OMR::IDTBuilder::buildIDT2(TR::IDTNode* node, TR::vector<TR::AbsValue*, TR::Region&>* arguments, int32_t budget, TR_CallStack* callStack)
    {
    TR::ResolvedMethodSymbol* symbol = node->getResolvedMethodSymbol();
@@ -237,7 +300,20 @@ uint32_t OMR::IDTBuilder::computeStaticBenefit(TR::InliningMethodSummary* summar
 
 void OMR::IDTBuilder::Visitor::visitCallSite(TR_CallSite* callSite, TR::Block* callBlock, TR::vector<TR::AbsValue*, TR::Region&>* arguments)
    {
-   float callRatio = (float)callBlock->getFrequency() / (float)_idtNode->getCallTarget()->_cfg->getStart()->asBlock()->getFrequency();
+   int32_t startFrequency = _idtNode->getCallTarget()->_cfg->getStart()->asBlock()->getFrequency();
+
+   // Methods whose IL was generated without profiling information have no block frequencies.
+   // Every call site that is not in a cold block is then as frequent as the method itself.
+   if (startFrequency <= 0)
+      {
+      if (callBlock->isCold() || callBlock->isSuperCold())
+         return;
+
+      _idtBuilder->addNodesToIDT(_idtNode, callSite, 1.0f, arguments, _callStack);
+      return;
+      }
+
+   float callRatio = (float)callBlock->getFrequency() / (float)startFrequency;
 
    if (callBlock->getFrequency() < 6 || callBlock->isCold() || callBlock->isSuperCold())
       return;
@@ -40,6 +40,7 @@ namespace OMR { typedef OMR::IDTBuilder IDTBuilderConnector; }
 namespace TR { class Compilation; }
 namespace TR { class IDT; }
 namespace TR { class IDTBuilder; }
+namespace TR { class ValuePropagation; }
 
 namespace OMR
 {
@@ -88,24 +89,34 @@ class OMR_EXTENSIBLE IDTBuilder
    /**
     * @brief generate the control flow graph of a call target so that the abstract interpretation can use.
     *
-    * @note: This method needs language specific implementation.
+    * @note: The default implementation is for methods whose IL is already generated, such as
+    * those of JitBuilder and Tril: it is the flow graph of a method that has trees, or an empty
+    * flow graph for a method compiled on its own whose summary is in the InliningMethodSummaryCache.
+    * Languages that interpret bytecode override it.
     *
     * @param callTarget the call target to generate CFG for
-    * @return the control flow graph
+    * @return the control flow graph, or NULL if the call target cannot be interpreted
     */
-   TR::CFG* generateControlFlowGraph(TR_CallTarget* callTarget) { TR_UNIMPLEMENTED(); return NULL; }
+   TR::CFG* generateControlFlowGraph(TR_CallTarget* callTarget);
 
    /**
     * @brief Perform the abstract interpretation on the method in the IDTNode.
     *
-    * @note: This method needs language specific implementation.
+    * @note: The default implementation interprets the trees of the method with TR::ILAbsInterpreter,
+    * or only finds its summary in the InliningMethodSummaryCache when it has none.
+    * Languages that interpret bytecode override it.
     *
     * @param node the node to be abstract interpreted
     * @param visitor the visitor which defines the callback method
     *                that will be called when visiting a call site during abtract interpretation.
     * @param arguments the arguments are the AbsValues passed from the caller method.
     */
-   void performAbstractInterpretation(TR::IDTNode* node, OMR::IDTBuilder::Visitor& visitor, TR::vector<TR::AbsValue*, TR::Region&>* arguments) { TR_UNIMPLEMENTED(); }
+   void performAbstractInterpretation(TR::IDTNode* node, OMR::IDTBuilder::Visitor& visitor, TR::vector<TR::AbsValue*, TR::Region&>* arguments);
+
+   /**
+    * @brief the value propagation that the constraints of abstract values are created with.
+    */
+   TR::ValuePropagation* getValuePropagation();
 
    /**
     * @param node the node to build a sub IDT for
@@ -135,6 +146,7 @@ class OMR_EXTENSIBLE IDTBuilder
    TR::Region& _region;
    TR::Compilation* _comp;
    TR_InlinerBase* _inliner;
+   TR::ValuePropagation* _valuePropagation;
    };
 }
 
@@ -80,6 +80,7 @@
 #include "il/SymbolReference.hpp"
 #include "il/TreeTop.hpp"
 #include "il/TreeTop_inlines.hpp"
+#include "infra/AdaptiveBitVector.hpp"
 #include "infra/Array.hpp"
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
@@ -842,6 +843,33 @@ TR_Debug::print(TR::FILE *pOutFile, TR_BitVector * bv)
    trfprintf(pOutFile,"}");
    }
 
+void
+TR_Debug::print(TR::FILE *pOutFile, TR_AdaptiveBitVector *abv)
+   {
+   if (pOutFile == NULL) return;
+
+   trfprintf(pOutFile,"{");
+   bool firstOne = true;
+   TR_AdaptiveBitVectorIterator abvi(*abv);
+   int32_t num = 0;
+   while (abvi.hasMoreElements())
+      {
+      if (!firstOne)
+         trfprintf(pOutFile,", ");
+      else
+         firstOne = false;
+      trfprintf(pOutFile,"%d",abvi.getNextElement());
+
+      if (num > 30)
+         {
+         trfprintf(pOutFile,"\n");
+         num = 0;
+         }
+      num++;
+      }
+   trfprintf(pOutFile,"}");
+   }
+
 void
 TR_Debug::print(TR::FILE *pOutFile, TR_SingleBitContainer *sbc)
    {
@@ -999,6 +1027,7 @@ TR_Debug::nodePrintAllFlags(TR::Node *node, TR_PrettyPrinterString &output)
    FLAG(chkDontTransformArrayCopyCall, "dontTransformArrayCopyCall");
    FLAG(chkNodeRecognizedArrayCopyCall, "nodeRecognizedArrayCopyCall");
    FLAG(chkDesynchronizeCall, "desynchronizeCall");
+   FLAG(chkTailCall, "tailCall");
    FLAG(chkCompressionSequence, "compressionSequence");
    FLAG(isInternalPointer, "internalPtr");
    FLAG(isMaxLoopIterationGuard, "maxLoopIternGuard");
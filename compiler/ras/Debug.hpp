@@ -57,6 +57,7 @@
 #include "codegen/RegisterRematerializationInfo.hpp"
 
 class TR_Debug;
+class TR_AdaptiveBitVector;
 class TR_BlockStructure;
 class TR_CHTable;
 namespace TR { class CompilationFilters; }
@@ -541,6 +542,7 @@ public:
    virtual void         print(TR::LabelSymbol *, TR_PrettyPrinterString&);
    virtual void         print(TR::FILE *, TR_BitVector *);
    virtual void         print(TR::FILE *, TR_SingleBitContainer *);
+   virtual void         print(TR::FILE *, TR_AdaptiveBitVector *);
    virtual void         print(TR::FILE *pOutFile, TR::BitVector * bv);
    virtual void         print(TR::FILE *pOutFile, TR::SparseBitVector * sparse);
    virtual void         print(TR::FILE *, TR::SymbolReferenceTable *);
@@ -0,0 +1,753 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "runtime/AOTCache.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Relocation.hpp"
+#include "codegen/StaticRelocation.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "env/defines.h"
+#include "il/Block.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/List.hpp"
+#include "infra/Monitor.hpp"
+
+#if (HOST_OS == OMR_LINUX) && defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT)
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define AOTCACHE_VERSION       1
+#define AOTCACHE_RECORD_MAGIC  0x52544F41 // "AOTR"
+#define AOTCACHE_INDEX_SIZE    4096
+
+static const char AOTCacheMagic[8] = { 'O', 'M', 'R', 'A', 'O', 'T', 'C', '\0' };
+
+struct AOTCacheFileHeader
+   {
+   char     magic[8];
+   uint32_t version;
+   uint32_t headerSize;
+   };
+
+// Records are appended to the file one after another, each padded to a
+// multiple of 8 bytes
+//
+struct AOTCacheRecord
+   {
+   uint32_t magic;
+   uint32_t totalSize;
+   uint64_t key;
+   uint32_t codeSize;
+   uint32_t entryOffset;    // of the method's entry point in the code
+   uint32_t numRelocations;
+   uint32_t checksum;       // of everything that follows the record header
+   // followed by the code, the relocations and the names of their symbols
+   };
+
+enum AOTCacheRelocationKind
+   {
+   CodeAddress     = 1,     // the stored value is an offset into the code
+   FunctionAddress = 2      // the address of the function named by symbol
+   };
+
+struct AOTCacheRelocation
+   {
+   uint32_t offset;         // of the 64-bit value to update in the code
+   uint32_t kind;
+   uint32_t symbol;         // offset of the name from the end of the relocations
+   };
+
+struct AOTCacheIndexEntry
+   {
+   const AOTCacheRecord *record;
+   bool                  ownsRecord;
+   AOTCacheIndexEntry   *next;
+   };
+
+// The functions called by the method being compiled, which the names in
+// function relocations refer to
+//
+struct AOTCacheFunction
+   {
+   const char       *name;
+   void             *address;
+   AOTCacheFunction *next;
+   };
+
+static int                  cacheFile = -1;
+static void                *cacheMapping = NULL;
+static size_t               cacheMappingSize = 0;
+static TR::Monitor         *cacheMonitor = NULL;
+static uint64_t             cacheEnvironment = 0;
+static AOTCacheIndexEntry  *cacheIndex[AOTCACHE_INDEX_SIZE];
+
+static uint64_t
+hashBytes(uint64_t hash, const void *data, size_t size)
+   {
+   const uint8_t *bytes = static_cast<const uint8_t *>(data);
+   for (size_t i = 0; i < size; i++)
+      {
+      hash ^= bytes[i];
+      hash *= 0x100000001b3ULL;
+      }
+   return hash;
+   }
+
+static uint64_t
+hashValue(uint64_t hash, uint64_t value)
+   {
+   return hashBytes(hash, &value, sizeof(value));
+   }
+
+static uint64_t
+hashString(uint64_t hash, const char *string)
+   {
+   return hashBytes(hash, string, strlen(string) + 1);
+   }
+
+static uint32_t
+checksum(const uint8_t *data, size_t size)
+   {
+   uint64_t hash = hashBytes(0xcbf29ce484222325ULL, data, size);
+   return static_cast<uint32_t>(hash ^ (hash >> 32));
+   }
+
+static const uint8_t *
+recordCode(const AOTCacheRecord *record)
+   {
+   return reinterpret_cast<const uint8_t *>(record + 1);
+   }
+
+// The relocations follow the code at the next 4-byte boundary
+//
+static uint32_t
+alignedCodeSize(uint32_t codeSize)
+   {
+   return (codeSize + 3) & ~(uint32_t)3;
+   }
+
+static const AOTCacheRelocation *
+recordRelocations(const AOTCacheRecord *record)
+   {
+   return reinterpret_cast<const AOTCacheRelocation *>(recordCode(record) + alignedCodeSize(record->codeSize));
+   }
+
+static const char *
+recordSymbol(const AOTCacheRecord *record, const AOTCacheRelocation *relocation)
+   {
+   return reinterpret_cast<const char *>(recordRelocations(record) + record->numRelocations) + relocation->symbol;
+   }
+
+static bool
+isValidRecord(const AOTCacheRecord *record, size_t available)
+   {
+   if (available < sizeof(AOTCacheRecord)
+       || record->magic != AOTCACHE_RECORD_MAGIC
+       || record->totalSize < sizeof(AOTCacheRecord)
+       || record->totalSize > available
+       || record->totalSize % 8 != 0)
+      return false;
+
+   size_t contents = record->totalSize - sizeof(AOTCacheRecord);
+   if (record->codeSize > contents
+       || alignedCodeSize(record->codeSize) > contents
+       || record->entryOffset >= record->codeSize
+       || record->numRelocations > (contents - alignedCodeSize(record->codeSize)) / sizeof(AOTCacheRelocation))
+      return false;
+
+   if (checksum(recordCode(record), contents) != record->checksum)
+      return false;
+
+   const char *symbols = reinterpret_cast<const char *>(recordRelocations(record) + record->numRelocations);
+   size_t symbolsSize = reinterpret_cast<const char *>(record) + record->totalSize - symbols;
+   for (uint32_t i = 0; i < record->numRelocations; i++)
+      {
+      const AOTCacheRelocation *relocation = recordRelocations(record) + i;
+      if (record->codeSize < sizeof(uint64_t) || relocation->offset > record->codeSize - sizeof(uint64_t))
+         return false;
+      if (relocation->kind == FunctionAddress
+          && (relocation->symbol >= symbolsSize || !memchr(symbols + relocation->symbol, 0, symbolsSize - relocation->symbol)))
+         return false;
+      if (relocation->kind != CodeAddress && relocation->kind != FunctionAddress)
+         return false;
+      }
+   return true;
+   }
+
+static const AOTCacheRecord *
+findRecord(uint64_t key)
+   {
+   for (AOTCacheIndexEntry *entry = cacheIndex[key % AOTCACHE_INDEX_SIZE]; entry; entry = entry->next)
+      {
+      if (entry->record->key == key)
+         return entry->record;
+      }
+   return NULL;
+   }
+
+static void
+addRecord(const AOTCacheRecord *record, bool ownsRecord)
+   {
+   AOTCacheIndexEntry *entry = static_cast<AOTCacheIndexEntry *>(malloc(sizeof(AOTCacheIndexEntry)));
+   if (!entry)
+      return;
+   entry->record = record;
+   entry->ownsRecord = ownsRecord;
+   entry->next = cacheIndex[record->key % AOTCACHE_INDEX_SIZE];
+   cacheIndex[record->key % AOTCACHE_INDEX_SIZE] = entry;
+   }
+
+static bool
+writeFully(const void *buffer, size_t size)
+   {
+   const uint8_t *cursor = static_cast<const uint8_t *>(buffer);
+   while (size > 0)
+      {
+      ssize_t written = write(cacheFile, cursor, size);
+      if (written < 0)
+         {
+         if (errno == EINTR)
+            continue;
+         return false;
+         }
+      cursor += written;
+      size -= written;
+      }
+   return true;
+   }
+
+// Everything outside of the IL that the generated code depends on: the
+// options, the processor and the compiler itself, identified by the file it
+// was loaded from
+//
+static uint64_t
+environmentHash(const char *cmdLineOptions)
+   {
+   uint64_t hash = 0xcbf29ce484222325ULL;
+   hash = hashValue(hash, AOTCACHE_VERSION);
+   hash = hashString(hash, cmdLineOptions ? cmdLineOptions : "");
+
+   OMRProcessorDesc processor = TR::Compiler->target.cpu.getProcessorDescription();
+   hash = hashValue(hash, processor.processor);
+   hash = hashBytes(hash, processor.features, sizeof(processor.features));
+
+   Dl_info info;
+   struct stat status;
+   if (dladdr(reinterpret_cast<void *>(&TR::AOTCache::initialize), &info) && info.dli_fname && stat(info.dli_fname, &status) == 0)
+      {
+      hash = hashString(hash, info.dli_fname);
+      hash = hashValue(hash, status.st_size);
+      hash = hashValue(hash, status.st_mtime);
+      }
+   return hash;
+   }
+
+static bool hashNode(TR::Compilation *comp, TR::Node *node, vcount_t visitCount, uint64_t &hash, AOTCacheFunction *&functions);
+
+static bool
+hashSymbolReference(TR::Compilation *comp, TR::Node *node, uint64_t &hash, AOTCacheFunction *&functions)
+   {
+   TR::SymbolReference *symRef = node->getSymbolReference();
+   TR::Symbol *symbol = symRef->getSymbol();
+   hash = hashValue(hash, symRef->getReferenceNumber());
+   hash = hashValue(hash, symRef->getCPIndex());
+   hash = hashValue(hash, symRef->getOffset());
+   hash = hashValue(hash, symbol->getFlags());
+   hash = hashValue(hash, symbol->getSize());
+
+   // The address of a static differs from run to run, and the code generator
+   // folds it together with offsets into displacements that cannot be told
+   // apart from other constants to relocate them
+   //
+   if (symbol->isStatic())
+      {
+      if (symbol->castToStaticSymbol()->getStaticAddress())
+         return false;
+      }
+   else if (symbol->isMethod())
+      {
+      TR::MethodSymbol *method = symbol->castToMethodSymbol();
+      if (method->isHelper())
+         return false;
+
+      hash = hashValue(hash, method->getLinkageConvention());
+      if (method->isFastHelper())
+         {
+         hash = hashValue(hash, method->getPreservedRegisters());
+         hash = hashValue(hash, method->isLeafNative());
+         }
+
+      // An indirect call takes its target from its first child
+      //
+      if (!node->getOpCode().isCallIndirect())
+         {
+         if (!symbol->isResolvedMethod() || !method->getMethodAddress())
+            return false;
+
+         const char *name = symbol->castToResolvedMethodSymbol()->getResolvedMethod()->externalName(comp->trMemory());
+         hash = hashString(hash, name);
+
+         AOTCacheFunction *function = static_cast<AOTCacheFunction *>(comp->trMemory()->allocateHeapMemory(sizeof(AOTCacheFunction)));
+         function->name = name;
+         function->address = method->getMethodAddress();
+         function->next = functions;
+         functions = function;
+         }
+      }
+   return true;
+   }
+
+static bool
+hashNode(TR::Compilation *comp, TR::Node *node, vcount_t visitCount, uint64_t &hash, AOTCacheFunction *&functions)
+   {
+   hash = hashValue(hash, node->getGlobalIndex());
+   if (node->getVisitCount() == visitCount)
+      return true;
+   node->setVisitCount(visitCount);
+
+   // x86 allocates branch tables apart from the code of the method
+   //
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.getOpCodeValue() == TR::table)
+      return false;
+
+   hash = hashValue(hash, op.getOpCodeValue());
+   hash = hashValue(hash, node->getDataType().getDataType());
+   hash = hashValue(hash, node->getFlags().getValue());
+   hash = hashValue(hash, node->getNumChildren());
+
+   if (op.isLoadConst())
+      {
+      if (node->getDataType().isIntegral())
+         hash = hashValue(hash, node->getConstValue());
+      else if (node->getDataType() == TR::Float)
+         hash = hashValue(hash, node->getFloatBits());
+      else if (node->getDataType() == TR::Double)
+         hash = hashValue(hash, node->getDoubleBits());
+      else if (node->getDataType() == TR::Address && node->getAddress() == 0)
+         hash = hashValue(hash, node->getAddress());
+      else
+         return false;
+      }
+
+   if (op.getOpCodeValue() == TR::BBStart)
+      {
+      TR::Block *block = node->getBlock();
+      hash = hashValue(hash, block->getNumber());
+      hash = hashValue(hash, block->isCatchBlock());
+      for (auto edge = block->getExceptionSuccessors().begin(); edge != block->getExceptionSuccessors().end(); ++edge)
+         hash = hashValue(hash, (*edge)->getTo()->getNumber());
+      }
+
+   if (op.isBranch() || op.isCase())
+      hash = hashValue(hash, node->getBranchDestination()->getNode()->getBlock()->getNumber());
+   if (op.isCase())
+      hash = hashValue(hash, node->getCaseConstant());
+
+   if (op.hasSymbolReference() && node->getSymbolReference() && !hashSymbolReference(comp, node, hash, functions))
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!hashNode(comp, node->getChild(i), visitCount, hash, functions))
+         return false;
+      }
+   return true;
+   }
+
+// The key of the method whose IL was just generated, or 0 if its code cannot
+// be cached
+//
+static uint64_t
+computeKey(TR::Compilation *comp, AOTCacheFunction *&functions)
+   {
+   TR::ResolvedMethodSymbol *methodSymbol = comp->getMethodSymbol();
+   uint64_t hash = cacheEnvironment;
+   hash = hashString(hash, comp->signature());
+   hash = hashValue(hash, comp->getMethodHotness());
+   hash = hashValue(hash, methodSymbol->getResolvedMethod()->returnType().getDataType());
+
+   ListIterator<TR::ParameterSymbol> parms(&methodSymbol->getParameterList());
+   for (TR::ParameterSymbol *p = parms.getFirst(); p; p = parms.getNext())
+      hash = hashValue(hash, p->getDataType().getDataType());
+
+   vcount_t visitCount = comp->incOrResetVisitCount();
+   for (TR::TreeTop *tt = comp->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      if (!hashNode(comp, tt->getNode(), visitCount, hash, functions))
+         return 0;
+      }
+   return hash != 0 ? hash : 1;
+   }
+
+static void *
+functionAddress(AOTCacheFunction *functions, const char *name)
+   {
+   for (AOTCacheFunction *function = functions; function; function = function->next)
+      {
+      if (strcmp(function->name, name) == 0)
+         return function->address;
+      }
+   return NULL;
+   }
+
+bool
+TR::AOTCache::initialize(const char *fileName, const char *cmdLineOptions)
+   {
+   if (cacheFile >= 0)
+      return true;
+
+   cacheFile = open(fileName, O_CREAT | O_RDWR | O_APPEND, 0666);
+   if (cacheFile < 0)
+      {
+      if (TR::Options::isAnyVerboseOptionSet(TR_VerbosePerformance, TR_VerboseCompFailure))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "cannot open AOT cache file %s: %s", fileName, strerror(errno));
+      return false;
+      }
+
+   // Another process may be writing the header of a new file, or appending a
+   // record, at this time
+   //
+   flock(cacheFile, LOCK_EX);
+   struct stat status;
+   bool valid = fstat(cacheFile, &status) == 0;
+   size_t fileSize = valid ? status.st_size : 0;
+   if (valid && fileSize == 0)
+      {
+      AOTCacheFileHeader header;
+      memcpy(header.magic, AOTCacheMagic, sizeof(header.magic));
+      header.version = AOTCACHE_VERSION;
+      header.headerSize = sizeof(header);
+      valid = writeFully(&header, sizeof(header));
+      fileSize = sizeof(header);
+      }
+
+   if (valid)
+      {
+      cacheMapping = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, cacheFile, 0);
+      if (cacheMapping == MAP_FAILED)
+         {
+         cacheMapping = NULL;
+         valid = false;
+         }
+      else
+         {
+         cacheMappingSize = fileSize;
+         }
+      }
+
+   if (cacheMapping)
+      {
+      const AOTCacheFileHeader *header = static_cast<const AOTCacheFileHeader *>(cacheMapping);
+      valid = fileSize >= sizeof(AOTCacheFileHeader)
+         && memcmp(header->magic, AOTCacheMagic, sizeof(header->magic)) == 0
+         && header->version == AOTCACHE_VERSION
+         && header->headerSize >= sizeof(AOTCacheFileHeader)
+         && header->headerSize <= fileSize;
+
+      size_t offset = valid ? header->headerSize : fileSize;
+      while (offset < fileSize)
+         {
+         const AOTCacheRecord *record = reinterpret_cast<const AOTCacheRecord *>(static_cast<uint8_t *>(cacheMapping) + offset);
+         if (!isValidRecord(record, fileSize - offset))
+            break;
+         if (!findRecord(record->key))
+            addRecord(record, false);
+         offset += record->totalSize;
+         }
+
+      // Appends are made under the lock, so a damaged record was left by a
+      // writer that did not finish.  Cut it off, along with anything after
+      // it, so that the records appended from now on can be found again.
+      // Other processes have indexed no further than this record either.
+      //
+      if (offset < fileSize)
+         {
+         if (ftruncate(cacheFile, offset) != 0)
+            {
+            if (TR::Options::isAnyVerboseOptionSet(TR_VerbosePerformance, TR_VerboseCompFailure))
+               TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "cannot truncate AOT cache file %s: %s", fileName, strerror(errno));
+            flock(cacheFile, LOCK_UN);
+            TR::AOTCache::shutdown();
+            return false;
+            }
+         if (TR::Options::getVerboseOption(TR_VerboseCompileEnd))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "truncated %s at a damaged record, from %zu to %zu bytes", fileName, fileSize, offset);
+         }
+      }
+   flock(cacheFile, LOCK_UN);
+
+   if (!valid)
+      {
+      if (TR::Options::isAnyVerboseOptionSet(TR_VerbosePerformance, TR_VerboseCompFailure))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "%s is not an AOT cache file", fileName);
+      TR::AOTCache::shutdown();
+      return false;
+      }
+
+   cacheEnvironment = environmentHash(cmdLineOptions);
+   cacheMonitor = TR::Monitor::create("JIT-AOTCacheMonitor");
+   return true;
+   }
+
+void
+TR::AOTCache::shutdown()
+   {
+   if (cacheFile < 0)
+      return;
+
+   for (size_t i = 0; i < AOTCACHE_INDEX_SIZE; i++)
+      {
+      while (cacheIndex[i])
+         {
+         AOTCacheIndexEntry *entry = cacheIndex[i];
+         cacheIndex[i] = entry->next;
+         if (entry->ownsRecord)
+            free(const_cast<AOTCacheRecord *>(entry->record));
+         free(entry);
+         }
+      }
+
+   if (cacheMapping)
+      munmap(cacheMapping, cacheMappingSize);
+   cacheMapping = NULL;
+   cacheMappingSize = 0;
+   close(cacheFile);
+   cacheFile = -1;
+
+   if (cacheMonitor)
+      TR::Monitor::destroy(cacheMonitor);
+   cacheMonitor = NULL;
+   }
+
+bool
+TR::AOTCache::isActive()
+   {
+   return cacheFile >= 0;
+   }
+
+bool
+TR::AOTCache::loadMethod(TR::Compilation *comp)
+   {
+   if (cacheFile < 0)
+      return false;
+
+   AOTCacheFunction *functions = NULL;
+   uint64_t key = computeKey(comp, functions);
+   comp->setAOTCacheKey(key);
+   if (key == 0)
+      return false;
+
+   // Records stay in the index until the cache is shut down
+   //
+   const AOTCacheRecord *record;
+      {
+      OMR::CriticalSection lookup(cacheMonitor);
+      record = findRecord(key);
+      }
+   if (!record)
+      return false;
+
+   const AOTCacheRelocation *relocations = recordRelocations(record);
+   for (uint32_t i = 0; i < record->numRelocations; i++)
+      {
+      if (relocations[i].kind == FunctionAddress && !functionAddress(functions, recordSymbol(record, &relocations[i])))
+         return false;
+      }
+
+   TR::CodeGenerator *cg = comp->cg();
+   cg->reserveCodeCache();
+   uint8_t *coldCode;
+   uint8_t *code = cg->allocateCodeMemory(record->codeSize, 0, &coldCode);
+   memcpy(code, recordCode(record), record->codeSize);
+
+   for (uint32_t i = 0; i < record->numRelocations; i++)
+      {
+      uint8_t *location = code + relocations[i].offset;
+      uint64_t value;
+      if (relocations[i].kind == CodeAddress)
+         {
+         memcpy(&value, location, sizeof(value));
+         value += reinterpret_cast<uintptr_t>(code);
+         }
+      else
+         {
+         const char *name = recordSymbol(record, &relocations[i]);
+         value = reinterpret_cast<uintptr_t>(functionAddress(functions, name));
+         if (comp->getOption(TR_EmitRelocatableELFFile))
+            cg->addStaticRelocation(TR::StaticRelocation(location, name, TR::StaticRelocationSize::word64, TR::StaticRelocationType::Absolute));
+         }
+      memcpy(location, &value, sizeof(value));
+      }
+   TR::CodeGenerator::syncCode(code, record->codeSize);
+
+   cg->setBinaryBufferStart(code);
+   cg->setBinaryBufferCursor(code + record->codeSize);
+   comp->getMethodSymbol()->setMethodAddress(code + record->entryOffset);
+
+   if (TR::Options::getVerboseOption(TR_VerboseCompileEnd))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "loaded %s from the AOT cache", comp->signature());
+   return true;
+   }
+
+void
+TR::AOTCache::storeMethod(TR::Compilation *comp)
+   {
+   uint64_t key = comp->getAOTCacheKey();
+   if (cacheFile < 0 || key == 0)
+      return;
+
+      {
+      OMR::CriticalSection lookup(cacheMonitor);
+      if (findRecord(key))
+         return;
+      }
+
+   TR::CodeGenerator *cg = comp->cg();
+   uint8_t *start = cg->getBinaryBufferStart();
+   uint32_t codeSize = static_cast<uint32_t>(cg->getCodeEnd() - start);
+   uint32_t entryOffset = static_cast<uint32_t>(static_cast<uint8_t *>(comp->getMethodSymbol()->getMethodAddress()) - start);
+
+   // Only code that refers to nothing but itself and named functions can be
+   // moved; anything else was already part of the key
+   //
+   uint32_t numRelocations = 0;
+   size_t symbolsSize = 0;
+   for (auto it = cg->getRelocationList().begin(); it != cg->getRelocationList().end(); ++it)
+      {
+      if ((*it)->isLabelAbsoluteRelocation())
+         numRelocations++;
+      }
+   for (auto it = cg->getStaticRelocations().begin(); it != cg->getStaticRelocations().end(); ++it)
+      {
+      if (it->size() != TR::StaticRelocationSize::word64 || it->type() != TR::StaticRelocationType::Absolute)
+         return;
+      numRelocations++;
+      symbolsSize += strlen(it->symbol()) + 1;
+      }
+
+   size_t totalSize = sizeof(AOTCacheRecord) + alignedCodeSize(codeSize) + numRelocations * sizeof(AOTCacheRelocation) + symbolsSize;
+   totalSize = (totalSize + 7) & ~(size_t)7;
+   AOTCacheRecord *record = static_cast<AOTCacheRecord *>(calloc(1, totalSize));
+   if (!record)
+      return;
+
+   record->magic = AOTCACHE_RECORD_MAGIC;
+   record->totalSize = static_cast<uint32_t>(totalSize);
+   record->key = key;
+   record->codeSize = codeSize;
+   record->entryOffset = entryOffset;
+   record->numRelocations = numRelocations;
+
+   uint8_t *code = const_cast<uint8_t *>(recordCode(record));
+   AOTCacheRelocation *relocation = const_cast<AOTCacheRelocation *>(recordRelocations(record));
+   char *firstSymbol = reinterpret_cast<char *>(relocation + numRelocations);
+   char *symbols = firstSymbol;
+   memcpy(code, start, codeSize);
+
+   bool movable = codeSize >= sizeof(uint64_t);
+   for (auto it = cg->getRelocationList().begin(); movable && it != cg->getRelocationList().end(); ++it)
+      {
+      if (!(*it)->isLabelAbsoluteRelocation())
+         continue;
+
+      uint64_t value;
+      relocation->offset = static_cast<uint32_t>((*it)->getUpdateLocation() - start);
+      relocation->kind = CodeAddress;
+      relocation->symbol = 0;
+      movable = relocation->offset <= codeSize - sizeof(value);
+      if (movable)
+         {
+         memcpy(&value, code + relocation->offset, sizeof(value));
+         value -= reinterpret_cast<uintptr_t>(start);
+         movable = value < codeSize;
+         memcpy(code + relocation->offset, &value, sizeof(value));
+         }
+      relocation++;
+      }
+   for (auto it = cg->getStaticRelocations().begin(); movable && it != cg->getStaticRelocations().end(); ++it)
+      {
+      relocation->offset = static_cast<uint32_t>(it->location() - start);
+      relocation->kind = FunctionAddress;
+      relocation->symbol = static_cast<uint32_t>(symbols - firstSymbol);
+      movable = relocation->offset <= codeSize - sizeof(uint64_t);
+      if (movable)
+         memset(code + relocation->offset, 0, sizeof(uint64_t));
+      strcpy(symbols, it->symbol());
+      symbols += strlen(it->symbol()) + 1;
+      relocation++;
+      }
+
+   if (!movable)
+      {
+      free(record);
+      return;
+      }
+
+   record->checksum = checksum(code, totalSize - sizeof(AOTCacheRecord));
+
+   OMR::CriticalSection append(cacheMonitor);
+   if (findRecord(key))
+      {
+      free(record);
+      return;
+      }
+
+   flock(cacheFile, LOCK_EX);
+   bool written = writeFully(record, totalSize);
+   flock(cacheFile, LOCK_UN);
+   addRecord(record, true);
+
+   if (written && TR::Options::getVerboseOption(TR_VerboseCompileEnd))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "stored %s in the AOT cache", comp->signature());
+   }
+
+#else
+
+bool TR::AOTCache::initialize(const char *fileName, const char *cmdLineOptions) { return false; }
+void TR::AOTCache::shutdown()                                                    { }
+bool TR::AOTCache::isActive()                                                    { return false; }
+bool TR::AOTCache::loadMethod(TR::Compilation *comp)                             { return false; }
+void TR::AOTCache::storeMethod(TR::Compilation *comp)                            { }
+
+#endif
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TR_AOTCACHE_INCL
+#define TR_AOTCACHE_INCL
+
+#include <stdint.h>
+
+namespace TR { class Compilation; }
+
+namespace TR
+{
+
+/**
+ * Keeps compiled code in a file, enabled with -Xjit:aotCacheFile=<file>, so
+ * that later runs load it instead of compiling the same methods again.
+ *
+ * A method is identified by a hash of its IL right after IL generation: the
+ * trees, the constants and symbols they use and the names of the functions
+ * they call, along with the compilation's hotness.  When that key is found in
+ * the cache the code is copied into the code cache and relocated instead of
+ * being optimized and generated.  Otherwise the code generated for it is
+ * appended to the file once the compilation succeeds.
+ *
+ * Only two kinds of references are relocated: the absolute addresses of
+ * functions called by name, which are looked up among the functions the new
+ * IL calls, and absolute addresses within the method itself.  Methods whose
+ * code embeds any other address are never cached: the addresses of statics
+ * and address constants change from run to run, and the code generator folds
+ * them into displacements that cannot be found to relocate them.  Methods
+ * that call runtime helpers or use branch tables, whose code is not
+ * self-contained, are not cached either.
+ *
+ * The key is a 64-bit hash and a record is used when its key matches; the IL
+ * it was compiled from is not kept to compare against.  Two different methods
+ * whose keys collide would therefore share code.  The chance of that is
+ * negligible for the number of methods a cache holds, but it is not zero.
+ *
+ * The key also covers the options the JIT was started with, the processor
+ * features and the compiler library, so a run that differs in any of them
+ * finds none of the records of another.  Any number of processes may share a
+ * file: appends are serialized with a file lock, and a record that was not
+ * written completely is cut off the file, along with anything after it, by
+ * the next run that opens the file.
+ *
+ * Only Linux x86-64 hosts are supported; elsewhere all of the functions do
+ * nothing.
+ */
+class AOTCache
+   {
+   public:
+
+   /**
+    * Open the cache file, creating it if needed, and index its methods.  Must
+    * be called once before any method is compiled, while only one thread is
+    * running.
+    */
+   static bool initialize(const char *fileName, const char *cmdLineOptions);
+
+   static void shutdown();
+
+   static bool isActive();
+
+   /**
+    * Compute the key of the method whose IL was just generated and load its
+    * code if the cache has it.  Returns true when the method was loaded, in
+    * which case the code generator's buffer and the method address describe
+    * the loaded code and the compilation is finished.
+    */
+   static bool loadMethod(TR::Compilation *comp);
+
+   /**
+    * Append the code of a method just compiled under a key computed by
+    * loadMethod.
+    */
+   static void storeMethod(TR::Compilation *comp);
+   };
+
+}
+
+#endif
@@ -264,6 +264,183 @@ OMR::CodeCache::trimCodeMemoryAllocation(void *codeMemoryStart, size_t actualSiz
    }
 
 
+// Find the start of the allocated block containing pc by walking the blocks
+// of the warm or cold region.  Allocated blocks start with a method header and
+// free blocks are found on the address ordered list of free blocks.
+//
+uint8_t *
+OMR::CodeCache::findAllocatedBlock(uint8_t *pc)
+   {
+   TR::CodeCacheConfig &config = _manager->codeCacheConfig();
+   uint8_t *start;
+   uint8_t *end;
+   const char *eyeCatcher;
+
+   if (pc < _warmCodeAlloc)
+      {
+      // The warm region starts where initialize placed the first _warmCodeAlloc
+      //
+      start = (uint8_t *)align((size_t)(_segment->segmentBase() + sizeof(this)), config.codeCacheAlignment());
+      end = _warmCodeAlloc;
+      eyeCatcher = config.warmEyeCatcher();
+      }
+   else if (pc >= _coldCodeAlloc && pc < _CCPreLoadedCodeBase)
+      {
+      start = _coldCodeAlloc;
+      end = _CCPreLoadedCodeBase;
+      eyeCatcher = config.coldEyeCatcher();
+      }
+   else
+      {
+      return NULL;
+      }
+
+   CodeCacheFreeCacheBlock *freeBlock = _freeBlockList;
+   for (uint8_t *block = start; block < end && block <= pc; )
+      {
+      while (freeBlock && (uint8_t *)freeBlock < block)
+         freeBlock = freeBlock->_next;
+
+      size_t size;
+      bool isFree = ((uint8_t *)freeBlock == block);
+      if (isFree)
+         {
+         size = freeBlock->_size;
+         }
+      else
+         {
+         // Memory allocated without a method header cannot be walked past
+         //
+         CodeCacheMethodHeader *header = (CodeCacheMethodHeader *)block;
+         if (header->_eyeCatcher[0] != eyeCatcher[0] || header->_size == 0)
+            return NULL;
+         size = header->_size;
+         }
+
+      if (pc < block + size)
+         return isFree ? NULL : block;
+
+      block += size;
+      }
+
+   return NULL;
+   }
+
+
+bool
+OMR::CodeCache::freeCodeBlock(void *pc)
+   {
+   TR::CodeCacheConfig &config = _manager->codeCacheConfig();
+   CacheCriticalSection freeingBlock(self());
+
+   uint8_t *block = self()->findAllocatedBlock((uint8_t *)pc);
+   if (!block)
+      return false;
+
+   uint8_t *blockEnd = block + ((CodeCacheMethodHeader *)block)->_size;
+
+   if (config.verboseReclamation())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,"--freeCodeBlock-- CC=%p pc=%p block=%p-%p warmCodeAlloc=%p coldCodeAlloc=%p",
+         this, pc, block, blockEnd, _warmCodeAlloc, _coldCodeAlloc);
+      }
+
+   if (blockEnd == _warmCodeAlloc || block == _coldCodeAlloc)
+      {
+      omrthread_jit_write_protect_disable();
+      ((CodeCacheMethodHeader *)block)->_eyeCatcher[0] = 0;
+      omrthread_jit_write_protect_enable();
+
+      _manager->decreaseCurrTotalUsedInBytes(blockEnd - block);
+      if (blockEnd == _warmCodeAlloc)
+         _warmCodeAlloc = block;
+      else
+         _coldCodeAlloc = blockEnd;
+      return true;
+      }
+
+   return self()->addFreeBlock2(block, blockEnd);
+   }
+
+
+size_t
+OMR::CodeCache::compactFreeBlocks()
+   {
+   TR::CodeCacheConfig &config = _manager->codeCacheConfig();
+   CacheCriticalSection compacting(self());
+
+   // Adjacent free blocks are always coalesced, so at most one free block can
+   // border each of the two allocation pointers
+   //
+   size_t returnedBytes = 0;
+   CodeCacheFreeCacheBlock *prev = NULL;
+   CodeCacheFreeCacheBlock *curr = _freeBlockList;
+
+   omrthread_jit_write_protect_disable();
+
+   while (curr)
+      {
+      CodeCacheFreeCacheBlock *next = curr->_next;
+      uint8_t *blockStart = (uint8_t *)curr;
+      uint8_t *blockEnd = blockStart + curr->_size;
+
+      if (blockEnd == _warmCodeAlloc || blockStart == _coldCodeAlloc)
+         {
+         if (blockEnd == _warmCodeAlloc)
+            _warmCodeAlloc = blockStart;
+         else
+            _coldCodeAlloc = blockEnd;
+
+         returnedBytes += curr->_size;
+         if (prev)
+            prev->_next = next;
+         else
+            _freeBlockList = next;
+         }
+      else
+         {
+         prev = curr;
+         }
+
+      curr = next;
+      }
+
+   omrthread_jit_write_protect_enable();
+
+   if (returnedBytes > 0)
+      {
+      // The largest free blocks may have been among those returned
+      //
+      _sizeOfLargestFreeWarmBlock = 0;
+      _sizeOfLargestFreeColdBlock = 0;
+      for (curr = _freeBlockList; curr; curr = curr->_next)
+         self()->updateMaxSizeOfFreeBlocks(curr, curr->_size);
+
+      if (config.verboseReclamation())
+         {
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,"--compactFreeBlocks-- CC=%p returned=%u warmCodeAlloc=%p coldCodeAlloc=%p",
+            this, (uint32_t)returnedBytes, _warmCodeAlloc, _coldCodeAlloc);
+         }
+      }
+
+   if (config.doSanityChecks())
+      self()->checkForErrors();
+
+   return returnedBytes;
+   }
+
+
+void
+OMR::CodeCache::removeResolvedMethod(TR_OpaqueMethodBlock *method)
+   {
+   CacheCriticalSection removingTrampoline(self());
+
+   CodeCacheHashEntry *entry = _resolvedMethodHT->findResolvedMethod(method);
+   if (entry && _resolvedMethodHT->remove(entry))
+      self()->freeHashEntry(entry);
+   }
+
+
 // Initialize a code cache
 //
 bool
@@ -306,6 +483,7 @@ OMR::CodeCache::initialize(TR::CodeCacheManager *manager,
    _CCPreLoadedCodeInitialized = false;
    self()->unreserve();
    _almostFull = TR_no;
+   _hot = false;
    _sizeOfLargestFreeColdBlock = 0;
    _sizeOfLargestFreeWarmBlock = 0;
    _lastAllocatedBlock = NULL; // MP
@@ -109,6 +109,47 @@ public:
     */
    bool trimCodeMemoryAllocation(void *codeMemoryStart, size_t actualSizeInBytes);
 
+   /**
+    * @brief Frees the block of code memory containing the given address.
+    *        The block must have been allocated with a method header.
+    *
+    * @details
+    *    A block at the edge of the warm or cold allocation region is returned
+    *    to the contiguous free space directly; any other block is added to
+    *    the list of free blocks.  The caller must guarantee that no thread is
+    *    executing, or can still branch to, the code in the block.
+    *
+    * @param[in] pc : an address within the warm or cold block to free
+    *
+    * @return true if an allocated block containing pc was found and freed;
+    *         false otherwise.
+    */
+   bool freeCodeBlock(void *pc);
+
+   /**
+    * @brief Returns the free blocks bordering the space between the warm and
+    *        cold allocation regions to that space.
+    *
+    * @details
+    *    Blocks freed at the top of the warm region, or at the bottom of the
+    *    cold region, would otherwise stay on the list of free blocks and only
+    *    satisfy requests that fit in them.  Returning them restores
+    *    contiguous space for large methods and lets new code be allocated
+    *    next to the most recently compiled code.
+    *
+    * @return the number of bytes returned to the contiguous free space
+    */
+   size_t compactFreeBlocks();
+
+   /**
+    * @brief Forgets the trampoline of a method whose compiled body is being
+    *        freed, so that no further calls are routed to it.  The trampoline
+    *        space itself is not reclaimed.
+    *
+    * @param[in] method : the method whose trampoline hash entry is removed
+    */
+   void removeResolvedMethod(TR_OpaqueMethodBlock *method);
+
    CodeCacheMethodHeader *addFreeBlock(void *metaData);
 
    uint8_t *findFreeBlock(size_t size, bool isCold, bool isMethodHeaderNeeded);
@@ -122,6 +163,13 @@ public:
    TR_YesNoMaybe almostFull()                 { return _almostFull; }
    void setAlmostFull(TR_YesNoMaybe fullness) { _almostFull = fullness; }
 
+   /**
+    * @brief Whether this code cache only receives the code of frequently
+    *        invoked methods (see -Xjit:enableHotCodeCacheLayout)
+    */
+   bool isHot()                               { return _hot; }
+   void setHot(bool hot)                      { _hot = hot; }
+
    /**
     * @brief DEPRECATED Reserve space for a trampoline in the current code cache.
     *        This function simply calls reserveSpaceForTrampoline and will exist only
@@ -222,6 +270,8 @@ public:
 private:
    void                       updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, size_t blockSize);
 
+   uint8_t *                  findAllocatedBlock(uint8_t *pc);
+
    CodeCacheFreeCacheBlock *  removeFreeBlock(size_t blockSize,
                                               CodeCacheFreeCacheBlock *prev,
                                               CodeCacheFreeCacheBlock *curr);
@@ -422,6 +472,7 @@ public:
    // TODO: When we move to C++11 replace volatile with something that actually enforces ordering semantics.
    volatile bool _reserved;
    int32_t _reservingCompThreadID;
+   bool _hot;
 
    size_t _sizeOfLargestFreeColdBlock;
    size_t _sizeOfLargestFreeWarmBlock;
@@ -39,10 +39,15 @@
 #include "infra/CriticalSection.hpp"
 #include "infra/Monitor.hpp"
 #include "omrformatconsts.h"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
+#include "runtime/AOTCache.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
 #include "runtime/CodeCacheConfig.hpp"
+#include "runtime/CodeMetaDataManager.hpp"
+#include "runtime/CodeMetaDataManager_inlines.hpp"
+#include "runtime/PerfJitDump.hpp"
 #include "runtime/Runtime.hpp"
 
 #if (HOST_OS == OMR_LINUX)
@@ -59,7 +64,8 @@ OMR::CodeCacheManager::CodeCacheManager(TR::RawAllocator rawAllocator) :
    _initialized(false),
    _codeCacheFull(false),
    _currTotalUsedInBytes(0),
-   _maxUsedInBytes(0)
+   _maxUsedInBytes(0),
+   _retiredMethodBodies(NULL)
    {
    }
 
@@ -225,6 +231,10 @@ OMR::CodeCacheManager::destroy()
    }
 #endif // HOST_OS == OMR_LINUX
 
+   TR::PerfJitDump::shutdown();
+   TR::AOTCache::shutdown();
+   TR::InliningMethodSummaryCache::shutdown();
+
    TR::CodeCache *codeCache = self()->getFirstCodeCache();
    while (codeCache != NULL)
       {
@@ -303,11 +313,71 @@ OMR::CodeCacheManager::unreserveCodeCache(TR::CodeCache *codeCache)
 // A compThreadID of -1 means unknown. This ID will be written into the code cache
 // The ID of the thread that last reserved the cache will remain written after the
 // reservation is over. This will allow us to implement some affinity.
+// Hot code is kept apart from other code for as long as new code caches can be
+// added for either; after that any code cache with space will do.
 TR::CodeCache *
 OMR::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous,
                                       size_t sizeEstimate,
                                       int32_t compThreadID,
-                                      int32_t *numReserved)
+                                      int32_t *numReserved,
+                                      bool isHot)
+   {
+   TR::CodeCache *codeCache = self()->reserveCodeCacheFromList(compilationCodeAllocationsMustBeContiguous,
+                                                               sizeEstimate,
+                                                               compThreadID,
+                                                               numReserved,
+                                                               true,
+                                                               isHot);
+   if (codeCache)
+      {
+      TR_ASSERT(codeCache->isReserved(), "cache must be reserved\n");
+      return codeCache;
+      }
+
+   // No existing code cache is available; try to allocate a new one
+   if (self()->canAddNewCodeCache())
+      {
+      TR::CodeCacheConfig &config = self()->codeCacheConfig();
+      codeCache = self()->allocateCodeCacheFromNewSegment(config.codeCacheKB() << 10, compThreadID);
+      if (codeCache)
+         codeCache->setHot(isHot);
+      }
+   else
+      {
+      codeCache = self()->reserveCodeCacheFromList(compilationCodeAllocationsMustBeContiguous,
+                                                   sizeEstimate,
+                                                   compThreadID,
+                                                   numReserved,
+                                                   false,
+                                                   isHot);
+      if (!codeCache && *numReserved > 0)
+         self()->setHasFailedCodeCacheAllocation();
+      }
+
+   if (codeCache)
+      {
+      TR_ASSERT(codeCache->isReserved(), "cache must be reserved\n");
+      }
+   else
+      {
+      if (*numReserved == 0)
+         {
+         // Cannot reserve a cache and there are no other reserved caches, so
+         // no chance to find space for this request. Must declare code cache full.
+         self()->setCodeCacheFull();
+         }
+      }
+
+   return codeCache;
+   }
+
+TR::CodeCache *
+OMR::CodeCacheManager::reserveCodeCacheFromList(bool compilationCodeAllocationsMustBeContiguous,
+                                              size_t sizeEstimate,
+                                              int32_t compThreadID,
+                                              int32_t *numReserved,
+                                              bool matchHotness,
+                                              bool isHot)
    {
    int32_t numCachesAlreadyReserved = 0;
    TR::CodeCache *codeCache = NULL;
@@ -320,6 +390,9 @@ OMR::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCon
          {
          if (!codeCache->isReserved()) // we cannot touch the reserved ones
             {
+            if (matchHotness && codeCache->isHot() != isHot)
+               continue;
+
             TR_YesNoMaybe almostFull = codeCache->almostFull();
             if (almostFull == TR_no || (almostFull == TR_maybe && !compilationCodeAllocationsMustBeContiguous))
                {
@@ -342,39 +415,6 @@ OMR::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCon
       }
 
    *numReserved = numCachesAlreadyReserved;
-
-   if (codeCache)
-      {
-      TR_ASSERT(codeCache->isReserved(), "cache must be reserved\n");
-      return codeCache;
-      }
-
-   // No existing code cache is available; try to allocate a new one
-   if (self()->canAddNewCodeCache())
-      {
-      TR::CodeCacheConfig &config = self()->codeCacheConfig();
-      codeCache = self()->allocateCodeCacheFromNewSegment(config.codeCacheKB() << 10, compThreadID);
-      }
-   else
-      {
-      if (numCachesAlreadyReserved > 0)
-         self()->setHasFailedCodeCacheAllocation();
-      }
-
-   if (codeCache)
-      {
-      TR_ASSERT(codeCache->isReserved(), "cache must be reserved\n");
-      }
-   else
-      {
-      if (numCachesAlreadyReserved == 0)
-         {
-         // Cannot reserve a cache and there are no other reserved caches, so
-         // no chance to find space for this request. Must declare code cache full.
-         self()->setCodeCacheFull();
-         }
-      }
-
    return codeCache;
    }
 
@@ -541,6 +581,102 @@ OMR::CodeCacheManager::synchronizeTrampolines()
       }
    }
 
+// Code Reclamation
+//
+bool
+OMR::CodeCacheManager::retireMethodBody(void *startPC, TR_OpaqueMethodBlock *method, TR::MethodMetaDataPOD *metaData)
+   {
+   if (!self()->findCodeCacheFromPC(startPC))
+      return false;
+
+   RetiredMethodBody *retired = static_cast<RetiredMethodBody *>(self()->getMemory(sizeof(RetiredMethodBody)));
+   if (!retired)
+      return false;
+
+   retired->_startPC = startPC;
+   retired->_method = method;
+   retired->_metaData = metaData;
+
+   TR::InliningMethodSummaryCache::removeMethod(startPC);
+
+   CacheListCriticalSection retiringBody(self());
+   retired->_next = _retiredMethodBodies;
+   _retiredMethodBodies = retired;
+   return true;
+   }
+
+
+int32_t
+OMR::CodeCacheManager::reclaimRetiredMethodBodies()
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   RetiredMethodBody *retired;
+
+      {
+      CacheListCriticalSection takingRetiredBodies(self());
+      retired = _retiredMethodBodies;
+      _retiredMethodBodies = NULL;
+      }
+
+   if (!retired)
+      return 0;
+
+   // Temporary trampolines refer to the hash entries about to be removed
+   //
+   self()->synchronizeTrampolines();
+
+   TR::CodeMetaDataManager *metaDataManager = TR::CodeMetaDataManager::codeMetaDataManager();
+   int32_t numFreed = 0;
+
+   while (retired)
+      {
+      RetiredMethodBody *next = retired->_next;
+
+      if (retired->_metaData && metaDataManager)
+         metaDataManager->removeMetaData(retired->_metaData);
+
+      if (retired->_method && config.needsMethodTrampolines())
+         {
+         CacheListCriticalSection scanCacheList(self());
+         for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
+            codeCache->removeResolvedMethod(retired->_method);
+         }
+
+      TR::CodeCache *codeCache = self()->findCodeCacheFromPC(retired->_startPC);
+      if (codeCache && codeCache->freeCodeBlock(retired->_startPC))
+         numFreed++;
+
+      self()->freeMemory(retired);
+      retired = next;
+      }
+
+   size_t returnedBytes = 0;
+      {
+      CacheListCriticalSection scanCacheList(self());
+      for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
+         {
+         returnedBytes += codeCache->compactFreeBlocks();
+         if (codeCache->almostFull() == TR_yes && codeCache->getFreeContiguousSpace() > 0)
+            codeCache->setAlmostFull(TR_maybe);
+         }
+      }
+
+   if (numFreed > 0)
+      _codeCacheFull = false;
+
+   if (metaDataManager)
+      metaDataManager->reclaimRetiredRangeIndexes();
+
+   if (config.verboseReclamation())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,"--reclaimRetiredMethodBodies-- freed=%d returnedToContiguousSpace=%u currTotalUsed=%u",
+         numFreed, (uint32_t)returnedBytes, (uint32_t)_currTotalUsedInBytes);
+      }
+
+   return numFreed;
+   }
+
+
 // Trampoline Replacement / Patching
 // Replace permanent trampoline code with updated target address
 //
@@ -625,6 +761,7 @@ OMR::CodeCacheManager::allocateCodeMemoryWithRetries(size_t warmCodeSize,
    // However, for the last trial allocate a cache
    int32_t numCachesVisited = 0;
    int32_t numCachesAlreadyReserved = 0;
+   bool keepHotCodeApart = self()->canAddNewCodeCache();
    if (allocationRetries > 0)
       {
       // scope for cache list critical section
@@ -637,6 +774,9 @@ OMR::CodeCacheManager::allocateCodeMemoryWithRetries(size_t warmCodeSize,
             // Our current cache is reserved, so we cannot find it again
             if (!codeCache->isReserved())
                {
+               if (keepHotCodeApart && codeCache->isHot() != (*codeCache_pp)->isHot())
+                  continue;
+
                if (codeCache->almostFull() != TR_yes)
                   {
                   // How about the size
@@ -742,6 +882,8 @@ OMR::CodeCacheManager::allocateCodeMemoryWithRetries(size_t warmCodeSize,
       return NULL;
       }
 
+   codeCache->setHot((*codeCache_pp)->isHot());
+
    // Unreserve the original cache
    TR_ASSERT((*codeCache_pp)->isReserved(), "Code cache must be reserved. Original code cache=%p pp=%p\n", originalCodeCache, *codeCache_pp); // MCT
 
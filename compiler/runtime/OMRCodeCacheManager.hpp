@@ -43,6 +43,7 @@ namespace TR { class CodeCacheManager; }
 namespace TR { class CodeCacheMemorySegment; }
 namespace TR { class CodeGenerator; }
 namespace TR { class Monitor; }
+namespace TR { struct MethodMetaDataPOD; }
 namespace OMR { class CodeCacheHashEntrySlab; }
 namespace OMR { typedef void CodeCacheTrampolineCode; }
 namespace OMR { class CodeCacheManager; }
@@ -169,10 +170,20 @@ public:
    TR::CodeCacheMemorySegment *getNewCodeCacheMemorySegment(size_t segmentSize, size_t & codeCacheSizeAllocated);
 
    void        unreserveCodeCache(TR::CodeCache *codeCache);
+
+   /**
+    * @brief Reserve a code cache for a compilation
+    *
+    * @param[in] isHot : true when the method being compiled is frequently
+    *               invoked.  Hot methods are placed in code caches of their
+    *               own, so that the code executed most often shares as few
+    *               pages and cache lines as possible with code that is not.
+    */
    TR::CodeCache * reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous,
                                     size_t sizeEstimate,
                                     int32_t compThreadID,
-                                    int32_t *numReserved);
+                                    int32_t *numReserved,
+                                    bool isHot = false);
    TR::CodeCache * getNewCodeCache(int32_t reservingCompThreadID);
 
    uint8_t * allocateCodeMemory(size_t warmCodeSize,
@@ -262,6 +273,41 @@ public:
                                                void *newTargetPC,
                                                bool needSync);
 
+   /**
+    * @brief Retires the compiled body of a method so that its code memory can
+    *        be reused.
+    *
+    * @details
+    *    Nothing is freed yet: threads may still be executing the body, or be
+    *    about to return into it.  The body is freed, and its trampoline and
+    *    metadata unregistered, by the next call to reclaimRetiredMethodBodies.
+    *    Only its inlining method summary is dropped right away, so that no
+    *    new compilation weighs a call to it.
+    *
+    * @param[in] startPC : the start PC of the body, or any address within it
+    * @param[in] method : the method the body was compiled for, if trampolines
+    *               may have been created for it; NULL otherwise
+    * @param[in] metaData : the metadata registered with the
+    *               CodeMetaDataManager for the body, if any; NULL otherwise
+    *
+    * @return true if the body was queued; false if startPC is not in any
+    *         code cache or no memory could be allocated to track it.
+    */
+   bool retireMethodBody(void *startPC, TR_OpaqueMethodBlock *method = NULL, TR::MethodMetaDataPOD *metaData = NULL);
+
+   /**
+    * @brief Frees the bodies retired since the last call and compacts the free
+    *        space of every code cache.
+    *
+    * @details
+    *    Must only be called at a point where no thread can be executing, or
+    *    returning into, a retired body, such as a safepoint at which all
+    *    threads running compiled code are stopped.
+    *
+    * @return the number of bodies freed
+    */
+   int32_t reclaimRetiredMethodBodies();
+
    void performSizeAdjustments(size_t &warmCodeSize,
                                size_t &coldCodeSize,
                                bool needsToBeContiguous,
@@ -338,6 +384,18 @@ public:
 
 protected:
 
+   /**
+    * @brief Reserve the first unreserved code cache in the list with room for
+    *        the estimated size, ignoring the hotness of the caches unless
+    *        matchHotness is set.
+    */
+   TR::CodeCache * reserveCodeCacheFromList(bool compilationCodeAllocationsMustBeContiguous,
+                                            size_t sizeEstimate,
+                                            int32_t compThreadID,
+                                            int32_t *numReserved,
+                                            bool matchHotness,
+                                            bool isHot);
+
    TR::RawAllocator               _rawAllocator;
    TR::CodeCacheConfig            _config;
    TR::CodeCache                 *_lastCache;                         /*!< last code cache round robined through */
@@ -356,6 +414,16 @@ protected:
    TR::Monitor                   *_usageMonitor;
    size_t                         _currTotalUsedInBytes;
    size_t                         _maxUsedInBytes;
+
+   struct RetiredMethodBody
+      {
+      RetiredMethodBody     *_next;
+      void                  *_startPC;
+      TR_OpaqueMethodBlock  *_method;
+      TR::MethodMetaDataPOD *_metaData;
+      };
+
+   RetiredMethodBody             *_retiredMethodBodies;               /*!< bodies to free at the next reclaimRetiredMethodBodies */
 #if (HOST_OS == OMR_LINUX)
    public:
    /**
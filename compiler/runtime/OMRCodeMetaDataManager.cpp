@@ -44,10 +44,16 @@ TR::CodeMetaDataManager *CodeMetaDataManager::_codeMetaDataManager = NULL;
 
 
 CodeMetaDataManager::CodeMetaDataManager() :
+   _codeCacheIndex(NULL),
+   _retiredRangeIndexes(NULL),
+   _drainingRangeIndexes(NULL),
+   _readerEpoch(0),
    _cachedPC(0),
    _cachedHashTable(NULL),
    _retrievedMetaDataCache(NULL)
    {
+   _lockFreeReaders[0] = 0;
+   _lockFreeReaders[1] = 0;
    _metaDataAVL = self()->allocateMetaDataAVL();
    }
 
@@ -160,6 +166,95 @@ CodeMetaDataManager::findMetaDataForPC(uintptr_t pc)
    }
 
 
+const TR::MethodMetaDataPOD *
+CodeMetaDataManager::findMetaDataForPCLockFree(uintptr_t pc)
+   {
+   uintptr_t epoch = self()->enterLockFreeReader();
+
+   // Each index is read once into a local.  Its contents were written before
+   // the writer's barrier and the store publishing it, and the loads below
+   // depend on the loaded pointer.
+   //
+   TR::MethodMetaDataPOD *metaData = NULL;
+   TR::MetaDataHashTable *table =
+      static_cast<TR::MetaDataHashTable *>(findInRangeIndex(_codeCacheIndex, pc));
+
+   if (table)
+      metaData = static_cast<TR::MethodMetaDataPOD *>(findInRangeIndex(table->rangeIndex, pc));
+
+   self()->exitLockFreeReader(epoch);
+
+   return metaData;
+   }
+
+
+// protected
+uintptr_t
+CodeMetaDataManager::enterLockFreeReader()
+   {
+   // Announce the reader before loading any index.  A reader counted in an
+   // epoch that has since ended may have loaded the indexes the writer is
+   // about to free, so it retries in the new epoch.
+   //
+   for (;;)
+      {
+      uintptr_t epoch = _readerEpoch;
+      VM_AtomicSupport::add(&_lockFreeReaders[epoch & 1], 1);
+      VM_AtomicSupport::readWriteBarrier();
+      if (_readerEpoch == epoch)
+         return epoch;
+      VM_AtomicSupport::subtract(&_lockFreeReaders[epoch & 1], 1);
+      }
+   }
+
+
+// protected
+void
+CodeMetaDataManager::exitLockFreeReader(uintptr_t epoch)
+   {
+   VM_AtomicSupport::readWriteBarrier();
+   VM_AtomicSupport::subtract(&_lockFreeReaders[epoch & 1], 1);
+   }
+
+
+bool
+CodeMetaDataManager::reclaimRetiredRangeIndexes()
+   {
+   // The indexes were replaced before this point, so a reader entering the
+   // epoch started below can only ever load their replacements.  The readers
+   // of the previous epoch are the only ones that may still hold the
+   // draining indexes; once they are gone, the epoch can move on again.
+   //
+   VM_AtomicSupport::readWriteBarrier();
+   for (;;)
+      {
+      if (_drainingRangeIndexes)
+         {
+         if (_lockFreeReaders[(_readerEpoch - 1) & 1] != 0)
+            break;
+
+         while (_drainingRangeIndexes)
+            {
+            OMR::MetaDataRangeIndex *next = _drainingRangeIndexes->nextRetired;
+            TR_Memory::jitPersistentFree(_drainingRangeIndexes);
+            _drainingRangeIndexes = next;
+            }
+         }
+
+      if (!_retiredRangeIndexes)
+         break;
+
+      _drainingRangeIndexes = _retiredRangeIndexes;
+      _retiredRangeIndexes = NULL;
+      VM_AtomicSupport::readWriteBarrier();
+      _readerEpoch = _readerEpoch + 1;
+      VM_AtomicSupport::readWriteBarrier();
+      }
+
+   return _retiredRangeIndexes == NULL && _drainingRangeIndexes == NULL;
+   }
+
+
 // protected
 bool
 CodeMetaDataManager::insertRange(
@@ -171,7 +266,30 @@ CodeMetaDataManager::insertRange(
    self()->updateCache(metaData->startPC);
    if (_cachedHashTable)
       {
-      insertSuccess = (self()->insertMetaDataRangeInHash(_cachedHashTable, metaData, startPC, endPC) == 0);
+      // Build the new index first, so that a range is never in the hash table
+      // without also being found on the lock-free path
+      //
+      OMR::MetaDataRangeIndex *newIndex =
+         self()->copyRangeIndex(_cachedHashTable->rangeIndex, metaData, startPC, endPC, false);
+
+      if (newIndex)
+         {
+         insertSuccess = (self()->insertMetaDataRangeInHash(_cachedHashTable, metaData, startPC, endPC) == 0);
+
+         if (insertSuccess)
+            {
+            OMR::MetaDataRangeIndex *oldIndex = _cachedHashTable->rangeIndex;
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+            VM_AtomicSupport::writeBarrier();
+#endif
+            _cachedHashTable->rangeIndex = newIndex;
+            self()->retireRangeIndex(oldIndex);
+            }
+         else
+            {
+            TR_Memory::jitPersistentFree(newIndex);
+            }
+         }
       }
 
    return insertSuccess;
@@ -189,13 +307,151 @@ CodeMetaDataManager::removeRange(
    self()->updateCache(metaData->startPC);
    if (_cachedHashTable)
       {
-      removeSuccess = (self()->removeMetaDataRangeFromHash(_cachedHashTable, metaData, startPC, endPC) == 0);
+      OMR::MetaDataRangeIndex *newIndex =
+         self()->copyRangeIndex(_cachedHashTable->rangeIndex, const_cast<TR::MethodMetaDataPOD *>(metaData), startPC, endPC, true);
+
+      if (newIndex)
+         {
+         removeSuccess = (self()->removeMetaDataRangeFromHash(_cachedHashTable, metaData, startPC, endPC) == 0);
+
+         if (removeSuccess)
+            {
+            OMR::MetaDataRangeIndex *oldIndex = _cachedHashTable->rangeIndex;
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+            VM_AtomicSupport::writeBarrier();
+#endif
+            _cachedHashTable->rangeIndex = newIndex;
+            self()->retireRangeIndex(oldIndex);
+            }
+         else
+            {
+            TR_Memory::jitPersistentFree(newIndex);
+            }
+         }
       }
 
    return removeSuccess;
    }
 
 
+// protected
+OMR::MetaDataRangeIndex *
+CodeMetaDataManager::allocateRangeIndex(uintptr_t numEntries)
+   {
+   // The struct already has room for one entry
+   //
+   uintptr_t size = sizeof(OMR::MetaDataRangeIndex);
+   if (numEntries > 1)
+      size += (numEntries - 1) * sizeof(OMR::MetaDataRangeIndex::Entry);
+
+   OMR::MetaDataRangeIndex *index =
+      (OMR::MetaDataRangeIndex *) TR_Memory::jitPersistentAlloc(size, TR_Memory::CodeMetaDataAVL);
+
+   if (index)
+      {
+      index->nextRetired = NULL;
+      index->numEntries = numEntries;
+      }
+
+   return index;
+   }
+
+
+// protected
+OMR::MetaDataRangeIndex *
+CodeMetaDataManager::copyRangeIndex(
+      OMR::MetaDataRangeIndex *index,
+      void *data,
+      uintptr_t start,
+      uintptr_t end,
+      bool remove)
+   {
+   uintptr_t numEntries = index ? index->numEntries : 0;
+   OMR::MetaDataRangeIndex *newIndex;
+
+   if (remove)
+      {
+      uintptr_t found = 0;
+      while (found < numEntries &&
+             (index->entries[found].data != data || index->entries[found].start != start))
+         found++;
+
+      if (found == numEntries)
+         return NULL;
+
+      newIndex = self()->allocateRangeIndex(numEntries - 1);
+      if (newIndex)
+         {
+         memcpy(newIndex->entries, index->entries, found * sizeof(OMR::MetaDataRangeIndex::Entry));
+         memcpy(newIndex->entries + found, index->entries + found + 1, (numEntries - found - 1) * sizeof(OMR::MetaDataRangeIndex::Entry));
+         }
+      }
+   else
+      {
+      uintptr_t insertAt = 0;
+      while (insertAt < numEntries && index->entries[insertAt].start < start)
+         insertAt++;
+
+      newIndex = self()->allocateRangeIndex(numEntries + 1);
+      if (newIndex)
+         {
+         if (numEntries > 0)
+            {
+            memcpy(newIndex->entries, index->entries, insertAt * sizeof(OMR::MetaDataRangeIndex::Entry));
+            memcpy(newIndex->entries + insertAt + 1, index->entries + insertAt, (numEntries - insertAt) * sizeof(OMR::MetaDataRangeIndex::Entry));
+            }
+         newIndex->entries[insertAt].start = start;
+         newIndex->entries[insertAt].end = end;
+         newIndex->entries[insertAt].data = data;
+         }
+      }
+
+   return newIndex;
+   }
+
+
+// protected
+void
+CodeMetaDataManager::retireRangeIndex(OMR::MetaDataRangeIndex *index)
+   {
+   // Lock-free readers may still be searching the replaced index
+   //
+   if (index)
+      {
+      index->nextRetired = _retiredRangeIndexes;
+      _retiredRangeIndexes = index;
+      self()->reclaimRetiredRangeIndexes();
+      }
+   }
+
+
+// protected
+void *
+CodeMetaDataManager::findInRangeIndex(OMR::MetaDataRangeIndex *index, uintptr_t value)
+   {
+   if (!index)
+      return NULL;
+
+   // Find the last entry starting at or before the value
+   //
+   uintptr_t lo = 0;
+   uintptr_t hi = index->numEntries;
+   while (lo < hi)
+      {
+      uintptr_t mid = (lo + hi) / 2;
+      if (index->entries[mid].start <= value)
+         lo = mid + 1;
+      else
+         hi = mid;
+      }
+
+   if (lo == 0 || value >= index->entries[lo - 1].end)
+      return NULL;
+
+   return index->entries[lo - 1].data;
+   }
+
+
 // protected
 void
 CodeMetaDataManager::updateCache(uintptr_t currentPC)
@@ -590,19 +846,97 @@ CodeMetaDataManager::addCodeCache(
 
    TR_ASSERT(codeCache->segment(), "missing code cache segment");
 
-   TR::MetaDataHashTable *newTable = self()->allocateCodeMetaDataHash(
+   return self()->addCodeRange(
          (uintptr_t) (codeCache->segment()->segmentBase()),
          (uintptr_t) (codeCache->segment()->segmentTop()) );
+   }
+
+
+// protected
+TR::MetaDataHashTable *
+CodeMetaDataManager::addCodeRange(uintptr_t start, uintptr_t end)
+   {
+   TR::MetaDataHashTable *newTable = self()->allocateCodeMetaDataHash(start, end);
 
    if (newTable)
       {
+      OMR::MetaDataRangeIndex *newIndex = self()->copyRangeIndex(_codeCacheIndex, newTable, start, end, false);
+
+      if (!newIndex)
+         {
+         TR_Memory::jitPersistentFree(newTable->methodStoreStart);
+         TR_Memory::jitPersistentFree(newTable->buckets);
+         TR_Memory::jitPersistentFree(newTable);
+         return NULL;
+         }
+
       avl_insert(_metaDataAVL, (J9AVLTreeNode *) newTable);
+
+      OMR::MetaDataRangeIndex *oldIndex = _codeCacheIndex;
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+      VM_AtomicSupport::writeBarrier();
+#endif
+      _codeCacheIndex = newIndex;
+      self()->retireRangeIndex(oldIndex);
       }
 
    return newTable;
    }
 
 
+bool
+CodeMetaDataManager::removeCodeCache(TR::CodeCache *codeCache)
+   {
+   TR_ASSERT(codeCache->segment(), "missing code cache segment");
+
+   return self()->removeCodeRange(
+         (uintptr_t) (codeCache->segment()->segmentBase()),
+         (uintptr_t) (codeCache->segment()->segmentTop()) );
+   }
+
+
+// protected
+bool
+CodeMetaDataManager::removeCodeRange(uintptr_t start, uintptr_t end)
+   {
+   TR::MetaDataHashTable *table =
+      static_cast<TR::MetaDataHashTable *>(findInRangeIndex(_codeCacheIndex, start));
+
+   if (!table || table->start != start || table->end != end)
+      return false;
+
+   OMR::MetaDataRangeIndex *newIndex = self()->copyRangeIndex(_codeCacheIndex, table, start, end, true);
+   if (!newIndex)
+      return false;
+
+   avl_delete(_metaDataAVL, (J9AVLTreeNode *) table);
+
+   OMR::MetaDataRangeIndex *oldIndex = _codeCacheIndex;
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+   VM_AtomicSupport::writeBarrier();
+#endif
+   _codeCacheIndex = newIndex;
+   self()->retireRangeIndex(oldIndex);
+   self()->retireRangeIndex(table->rangeIndex);
+
+   _cachedPC = 0;
+   _cachedHashTable = NULL;
+   _retrievedMetaDataCache = NULL;
+
+   uintptr_t *store = table->methodStoreStart;
+   while (store)
+      {
+      uintptr_t *next = (uintptr_t *) *store;
+      TR_Memory::jitPersistentFree(store);
+      store = next;
+      }
+   TR_Memory::jitPersistentFree(table->buckets);
+   TR_Memory::jitPersistentFree(table);
+
+   return true;
+   }
+
+
 // protected, secondary
 TR::MetaDataHashTable *
 CodeMetaDataManager::allocateCodeMetaDataHash(uintptr_t start, uintptr_t end)
@@ -46,6 +46,7 @@ namespace TR { class CodeCache; }
 namespace TR { class CodeMetaDataManager; }
 namespace TR { class MetaDataHashTable; }
 namespace TR { struct MethodMetaDataPOD; }
+namespace OMR { struct MetaDataRangeIndex; }
 
 namespace OMR
 {
@@ -60,6 +61,19 @@ namespace OMR
  *
  * The CodeMetaDataManager only manages pointers; It takes no ownership of the
  * POD pointers provided to it.
+ *
+ * Besides the hash tables, which are only safe to query while holding the JIT
+ * metadata monitor, every registered range is published in immutable sorted
+ * range indexes: one over the code caches and one per code cache over its
+ * metadata.  Writers, which are serialized by the monitor, copy an index,
+ * change the copy and publish it with a single pointer store.  Readers on the
+ * lock-free path (findMetaDataForPCLockFree) only ever see a complete index,
+ * so stack walkers and profilers need not take the monitor.  Replaced indexes
+ * are kept on a retired list.  Lock-free readers announce themselves in the
+ * counter of the current reader epoch.  A writer moves the retired list aside
+ * and starts a new epoch: readers starting later can only load the indexes
+ * now published, so the list is freed as soon as the readers of the previous
+ * epoch have finished, however many readers of the new epoch are active.
  */
 class OMR_EXTENSIBLE CodeMetaDataManager
    {
@@ -72,7 +86,7 @@ class OMR_EXTENSIBLE CodeMetaDataManager
 
    static TR::CodeMetaDataManager *codeMetaDataManager() { return _codeMetaDataManager; }
 
-   bool initializeCodeMetaDataManager();
+   static bool initializeCodeMetaDataManager();
 
    /**
     * @brief For a given method's MethodMetaDataPOD, finds the appropriate
@@ -132,6 +146,36 @@ class OMR_EXTENSIBLE CodeMetaDataManager
     */
    const TR::MethodMetaDataPOD *findMetaDataForPC(uintptr_t pc);
 
+   /**
+    * @brief Finds the registered metadata for a PC without the JIT metadata
+    * monitor.
+    *
+    * Unlike findMetaDataForPC this does not use the cached lookup state, so any
+    * number of threads may call it concurrently with each other and with a
+    * thread inserting or removing metadata.  A query racing with an insertion
+    * or removal of the metadata covering the PC may see the metadata either
+    * registered or not.
+    *
+    * @param pc The PC for which we require the JIT metadata.
+    * @return The metadata whose range contains the PC, or NULL.
+    */
+   const TR::MethodMetaDataPOD *findMetaDataForPCLockFree(uintptr_t pc);
+
+   /**
+    * @brief Frees the retired range indexes that no thread in
+    * findMetaDataForPCLockFree can still be searching.
+    *
+    * Indexes are freed once the readers that started before they were
+    * retired have finished; readers that started later do not hold them
+    * back.  Writers call this each time they replace an index.  Code cache
+    * reclamation calls it as well, so that indexes retired while readers were
+    * active are not kept until the next change.  Must be called with the JIT
+    * metadata monitor held.
+    *
+    * @return true if no retired index is left.
+    */
+   bool reclaimRetiredRangeIndexes();
+
 
    /**
     * @brief Register code cache with metadata manager. 
@@ -141,6 +185,17 @@ class OMR_EXTENSIBLE CodeMetaDataManager
     */
    TR::MetaDataHashTable *addCodeCache(TR::CodeCache *codeCache);
 
+   /**
+    * @brief Unregisters a code cache before its memory is freed.
+    *
+    * Any metadata still registered in the code cache is dropped without
+    * being freed.  Must be called with the JIT metadata monitor held, once no
+    * thread can still look up a PC in the code cache.
+    *
+    * @return true if the code cache was registered.
+    */
+   bool removeCodeCache(TR::CodeCache *codeCache);
+
 
    protected:
 
@@ -232,12 +287,69 @@ class OMR_EXTENSIBLE CodeMetaDataManager
 
    J9AVLTree *allocateMetaDataAVL();
 
+   /**
+    * @brief Registers the memory range of a code cache.  addCodeCache calls
+    * this with the bounds of the code cache's segment.
+    */
+   TR::MetaDataHashTable *addCodeRange(uintptr_t start, uintptr_t end);
+
+   /**
+    * @brief Unregisters the memory range of a code cache.  removeCodeCache
+    * calls this with the bounds of the code cache's segment.
+    */
+   bool removeCodeRange(uintptr_t start, uintptr_t end);
+
+   OMR::MetaDataRangeIndex *allocateRangeIndex(uintptr_t numEntries);
+
+   /**
+    * @brief Copies a range index with an entry added in order of its start, or
+    * with the entry for data removed if data is already in the index.
+    *
+    * @return The new index, or NULL if it could not be allocated or the entry
+    * to remove was not found.
+    */
+   OMR::MetaDataRangeIndex *copyRangeIndex(
+      OMR::MetaDataRangeIndex *index,
+      void *data,
+      uintptr_t start,
+      uintptr_t end,
+      bool remove);
+
+   void retireRangeIndex(OMR::MetaDataRangeIndex *index);
+
+   /**
+    * @brief Announces a lock-free reader in the current reader epoch.
+    * @return The epoch to pass to exitLockFreeReader.
+    */
+   uintptr_t enterLockFreeReader();
+
+   void exitLockFreeReader(uintptr_t epoch);
+
+   static void *findInRangeIndex(OMR::MetaDataRangeIndex *index, uintptr_t value);
+
    // Singleton: Protected to allow manipulation of singleton pointer 
    // in test cases. 
    static TR::CodeMetaDataManager *_codeMetaDataManager;
 
    J9AVLTree *_metaDataAVL;
 
+   // Lock-free view of the code caches, sorted by start address
+   //
+   OMR::MetaDataRangeIndex * volatile _codeCacheIndex;
+
+   OMR::MetaDataRangeIndex *_retiredRangeIndexes;
+
+   // Indexes retired before the current reader epoch started, freed once
+   // the readers of the previous epoch have finished
+   //
+   OMR::MetaDataRangeIndex *_drainingRangeIndexes;
+
+   // Number of threads in findMetaDataForPCLockFree, by parity of the
+   // reader epoch they entered in
+   //
+   volatile uintptr_t _readerEpoch;
+   volatile uintptr_t _lockFreeReaders[2];
+
    private:
 
    mutable uintptr_t _cachedPC;
@@ -258,6 +370,28 @@ struct OMR_EXTENSIBLE MetaDataHashTable
    uintptr_t *methodStoreStart;
    uintptr_t *methodStoreEnd;
    uintptr_t *currentAllocate;
+   OMR::MetaDataRangeIndex * volatile rangeIndex;
+   };
+
+
+/**
+ * An immutable array of non-overlapping address ranges sorted by their start.
+ * The data of an entry is the MetaDataHashTable of a code cache in the index
+ * of code caches and the MethodMetaDataPOD of a method in the index of a code
+ * cache.
+ */
+struct MetaDataRangeIndex
+   {
+   struct Entry
+      {
+      uintptr_t start;
+      uintptr_t end;
+      void *data;
+      };
+
+   MetaDataRangeIndex *nextRetired;
+   uintptr_t numEntries;
+   Entry entries[1];
    };
 
 
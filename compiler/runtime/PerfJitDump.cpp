@@ -0,0 +1,373 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "runtime/PerfJitDump.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Instruction.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "env/defines.h"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+
+#if (HOST_OS == OMR_LINUX)
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+// Record layouts from tools/perf/Documentation/jitdump-specification.txt in
+// the Linux kernel sources
+//
+#define JITDUMP_MAGIC   0x4A695444
+#define JITDUMP_VERSION 1
+
+enum JitDumpRecordType
+   {
+   JIT_CODE_LOAD       = 0,
+   JIT_CODE_DEBUG_INFO = 2,
+   JIT_CODE_CLOSE      = 3
+   };
+
+struct JitDumpFileHeader
+   {
+   uint32_t magic;
+   uint32_t version;
+   uint32_t totalSize;
+   uint32_t elfMach;
+   uint32_t pad1;
+   uint32_t pid;
+   uint64_t timestamp;
+   uint64_t flags;
+   };
+
+struct JitDumpRecordHeader
+   {
+   uint32_t id;
+   uint32_t totalSize;
+   uint64_t timestamp;
+   };
+
+struct JitDumpCodeLoad
+   {
+   JitDumpRecordHeader header;
+   uint32_t pid;
+   uint32_t tid;
+   uint64_t vma;
+   uint64_t codeAddr;
+   uint64_t codeSize;
+   uint64_t codeIndex;
+   // followed by the name and the code bytes
+   };
+
+struct JitDumpDebugInfo
+   {
+   JitDumpRecordHeader header;
+   uint64_t codeAddr;
+   uint64_t numEntries;
+   // followed by the entries
+   };
+
+struct JitDumpDebugEntry
+   {
+   uint64_t codeAddr;
+   uint32_t line;
+   uint32_t discriminator;
+   // followed by the file name
+   };
+
+static int           jitDumpFile = -1;
+static void         *jitDumpMarker = NULL;
+static TR::Monitor  *jitDumpMonitor = NULL;
+static uint64_t      jitDumpCodeIndex = 0;
+
+// perf matches the records against samples using the monotonic clock, which
+// perf record must be told to use with -k mono
+//
+static uint64_t
+timestamp()
+   {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+   }
+
+static uint32_t
+elfMachine()
+   {
+   if (TR::Compiler->target.cpu.isX86())
+      return TR::Compiler->target.is64Bit() ? EM_X86_64 : EM_386;
+   else if (TR::Compiler->target.cpu.isPower())
+      return TR::Compiler->target.is64Bit() ? EM_PPC64 : EM_PPC;
+   else if (TR::Compiler->target.cpu.isZ())
+      return EM_S390;
+   else if (TR::Compiler->target.cpu.isARM64())
+      return EM_AARCH64;
+   return EM_NONE;
+   }
+
+static bool
+writeFully(const void *buffer, size_t size)
+   {
+   const uint8_t *cursor = static_cast<const uint8_t *>(buffer);
+   while (size > 0)
+      {
+      ssize_t written = write(jitDumpFile, cursor, size);
+      if (written < 0)
+         {
+         if (errno == EINTR)
+            continue;
+         return false;
+         }
+      cursor += written;
+      size -= written;
+      }
+   return true;
+   }
+
+static void
+writeRecordHeader(JitDumpRecordHeader &header, JitDumpRecordType id, size_t totalSize)
+   {
+   header.id = id;
+   header.totalSize = static_cast<uint32_t>(totalSize);
+   header.timestamp = timestamp();
+   }
+
+static void
+writeCodeLoad(const char *name, const uint8_t *code, size_t size)
+   {
+   size_t nameLength = strlen(name) + 1;
+
+   JitDumpCodeLoad record;
+   writeRecordHeader(record.header, JIT_CODE_LOAD, sizeof(record) + nameLength + size);
+   record.pid = static_cast<uint32_t>(getpid());
+   record.tid = static_cast<uint32_t>(syscall(SYS_gettid));
+   record.vma = reinterpret_cast<uintptr_t>(code);
+   record.codeAddr = reinterpret_cast<uintptr_t>(code);
+   record.codeSize = size;
+   record.codeIndex = jitDumpCodeIndex++;
+
+   writeFully(&record, sizeof(record));
+   writeFully(name, nameLength);
+   writeFully(code, size);
+   }
+
+// Source file name reported for the code of the given inlined call site
+//
+static const char *
+sourceName(TR::Compilation *comp, int16_t inlinedSiteIndex)
+   {
+   if (inlinedSiteIndex < 0)
+      return comp->signature();
+   return comp->getInlinedResolvedMethod(inlinedSiteIndex)->signature(comp->trMemory());
+   }
+
+// Write one entry for every instruction whose bytecode index or inlined call
+// site differs from that of the instruction before it.  The entries are
+// counted in a first pass, as the record header comes first.
+//
+static void
+writeDebugInfo(TR::Compilation *comp, const uint8_t *code, size_t size)
+   {
+   uint64_t numEntries = 0;
+   size_t totalSize = sizeof(JitDumpDebugInfo);
+
+   for (int32_t pass = 0; pass < 2; pass++)
+      {
+      const uint8_t *lastAddress = code;
+      uint32_t lastByteCodeIndex = 0;
+      int16_t lastSiteIndex = -2;
+
+      for (TR::Instruction *instr = comp->cg()->getFirstInstruction(); instr; instr = instr->getNext())
+         {
+         const uint8_t *address = instr->getBinaryEncoding();
+         TR::Node *node = instr->getNode();
+         if (!node || address < lastAddress || address >= code + size)
+            continue;
+
+         uint32_t byteCodeIndex = node->getByteCodeIndex();
+         int16_t siteIndex = node->getInlinedSiteIndex();
+         if (byteCodeIndex == lastByteCodeIndex && siteIndex == lastSiteIndex)
+            continue;
+
+         const char *name = sourceName(comp, siteIndex);
+         if (pass == 0)
+            {
+            numEntries++;
+            totalSize += sizeof(JitDumpDebugEntry) + strlen(name) + 1;
+            }
+         else
+            {
+            JitDumpDebugEntry entry;
+            entry.codeAddr = reinterpret_cast<uintptr_t>(address);
+            entry.line = byteCodeIndex;
+            entry.discriminator = 0;
+            writeFully(&entry, sizeof(entry));
+            writeFully(name, strlen(name) + 1);
+            }
+
+         lastAddress = address;
+         lastByteCodeIndex = byteCodeIndex;
+         lastSiteIndex = siteIndex;
+         }
+
+      if (pass == 0)
+         {
+         if (numEntries == 0)
+            return;
+
+         JitDumpDebugInfo record;
+         writeRecordHeader(record.header, JIT_CODE_DEBUG_INFO, totalSize);
+         record.codeAddr = reinterpret_cast<uintptr_t>(code);
+         record.numEntries = numEntries;
+         writeFully(&record, sizeof(record));
+         }
+      }
+   }
+
+bool
+TR::PerfJitDump::initialize()
+   {
+   if (jitDumpFile >= 0)
+      return true;
+
+   const char *directory = getenv("JITDUMPDIR");
+   if (!directory || !*directory)
+      directory = "/tmp";
+
+   char fileName[1024];
+   int length = snprintf(fileName, sizeof(fileName), "%s/jit-%d.dump", directory, (int)getpid());
+   if (length < 0 || length >= (int)sizeof(fileName))
+      return false;
+
+   jitDumpFile = open(fileName, O_CREAT | O_TRUNC | O_RDWR, 0666);
+   if (jitDumpFile < 0)
+      {
+      if (TR::Options::isAnyVerboseOptionSet(TR_VerbosePerformance, TR_VerboseCompFailure))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "cannot create jitdump file %s: %s", fileName, strerror(errno));
+      return false;
+      }
+
+   // perf record finds the dump through this executable mapping of it
+   //
+   jitDumpMarker = mmap(NULL, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, jitDumpFile, 0);
+   if (jitDumpMarker == MAP_FAILED)
+      {
+      if (TR::Options::isAnyVerboseOptionSet(TR_VerbosePerformance, TR_VerboseCompFailure))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "cannot map jitdump file %s: %s", fileName, strerror(errno));
+      jitDumpMarker = NULL;
+      close(jitDumpFile);
+      jitDumpFile = -1;
+      return false;
+      }
+
+   jitDumpMonitor = TR::Monitor::create("JIT-PerfJitDumpMonitor");
+
+   JitDumpFileHeader header;
+   header.magic = JITDUMP_MAGIC;
+   header.version = JITDUMP_VERSION;
+   header.totalSize = sizeof(header);
+   header.elfMach = elfMachine();
+   header.pad1 = 0;
+   header.pid = static_cast<uint32_t>(getpid());
+   header.timestamp = timestamp();
+   header.flags = 0;
+   writeFully(&header, sizeof(header));
+
+   jitDumpCodeIndex = 0;
+   return true;
+   }
+
+void
+TR::PerfJitDump::shutdown()
+   {
+   if (jitDumpFile < 0)
+      return;
+
+      {
+      OMR::CriticalSection closeDump(jitDumpMonitor);
+      JitDumpRecordHeader header;
+      writeRecordHeader(header, JIT_CODE_CLOSE, sizeof(header));
+      writeFully(&header, sizeof(header));
+
+      munmap(jitDumpMarker, sysconf(_SC_PAGESIZE));
+      jitDumpMarker = NULL;
+      close(jitDumpFile);
+      jitDumpFile = -1;
+      }
+
+   TR::Monitor::destroy(jitDumpMonitor);
+   jitDumpMonitor = NULL;
+   }
+
+bool
+TR::PerfJitDump::isActive()
+   {
+   return jitDumpFile >= 0;
+   }
+
+void
+TR::PerfJitDump::recordCodeLoad(const char *name, const uint8_t *code, size_t size)
+   {
+   if (jitDumpFile < 0)
+      return;
+
+   OMR::CriticalSection writeRecord(jitDumpMonitor);
+   writeCodeLoad(name, code, size);
+   }
+
+void
+TR::PerfJitDump::recordMethodLoad(TR::Compilation *comp, const uint8_t *code, size_t size)
+   {
+   if (jitDumpFile < 0)
+      return;
+
+   OMR::CriticalSection writeRecord(jitDumpMonitor);
+
+   // perf takes the debug info record to describe the next load record
+   //
+   if (comp->getOption(TR_PerfJitDumpDebugInfo))
+      writeDebugInfo(comp, code, size);
+   writeCodeLoad(comp->signature(), code, size);
+   }
+
+#else
+
+bool TR::PerfJitDump::initialize()                                                         { return false; }
+void TR::PerfJitDump::shutdown()                                                           { }
+bool TR::PerfJitDump::isActive()                                                           { return false; }
+void TR::PerfJitDump::recordCodeLoad(const char *name, const uint8_t *code, size_t size)   { }
+void TR::PerfJitDump::recordMethodLoad(TR::Compilation *comp, const uint8_t *code, size_t size) { }
+
+#endif
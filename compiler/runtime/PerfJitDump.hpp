@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TR_PERFJITDUMP_INCL
+#define TR_PERFJITDUMP_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace TR { class Compilation; }
+
+namespace TR
+{
+
+/**
+ * Writes compiled code to a jitdump file (jit-<pid>.dump) in the format read
+ * by Linux perf, enabled with -Xjit:perfJitDump.
+ *
+ * Unlike the perf map written by -Xjit:perfTool, every record carries a copy
+ * of the code bytes and is written as soon as the code is, so
+ * `perf inject --jit` can produce symbols and `perf annotate` can disassemble
+ * the JIT code of a process that is still running.  With
+ * -Xjit:perfJitDumpDebugInfo each method is preceded by a debug info record
+ * mapping its instructions to the bytecode indices of the IL they came from,
+ * reported to perf as line numbers of a file named after the method.
+ *
+ * The file is written to $JITDUMPDIR, or /tmp when that is not set.  Code
+ * that is reclaimed and whose space is reused simply gets a new load record,
+ * which perf gives precedence over the older one for samples taken after it.
+ *
+ * Only Linux hosts are supported; elsewhere all of the functions do nothing.
+ */
+class PerfJitDump
+   {
+   public:
+
+   /**
+    * Create the dump file.  Must be called once before any code is recorded,
+    * while only one thread is running.
+    */
+   static bool initialize();
+
+   /**
+    * Write a close record and close the dump file.
+    */
+   static void shutdown();
+
+   static bool isActive();
+
+   /**
+    * Record code that was just written to the code cache under the given name.
+    */
+   static void recordCodeLoad(const char *name, const uint8_t *code, size_t size);
+
+   /**
+    * Record the code of the method just compiled, along with its debug
+    * information if that was requested.
+    */
+   static void recordMethodLoad(TR::Compilation *comp, const uint8_t *code, size_t size);
+   };
+
+}
+
+#endif
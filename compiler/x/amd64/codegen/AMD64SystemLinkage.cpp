@@ -46,6 +46,8 @@
 #include "il/ResolvedMethodSymbol.hpp"
 #include "il/Symbol.hpp"
 #include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
 #include "infra/Assert.hpp"
 #include "infra/List.hpp"
 #include "ras/Debug.hpp"
@@ -512,6 +514,25 @@ TR::AMD64ABILinkage::AMD64ABILinkage(TR::CodeGenerator *cg)
    }
 
 
+// The bit standing for a register in the preserved register mask of a fast
+// helper: the general purpose registers in their encoding order (rax, rcx,
+// rdx, rbx, rsp, rbp, rsi, rdi, r8-r15) from bit 0, and xmm0-xmm15 from bit 16
+//
+uint64_t
+TR::AMD64SystemLinkage::fastHelperRegisterBit(TR::RealRegister::RegNum reg)
+   {
+   static const uint8_t gprEncoding[] = { 0 /* eax */, 3 /* ebx */, 1 /* ecx */, 2 /* edx */, 7 /* edi */, 6 /* esi */, 5 /* ebp */, 4 /* esp */ };
+
+   if (reg >= TR::RealRegister::eax && reg <= TR::RealRegister::esp)
+      return (uint64_t)1 << gprEncoding[reg - TR::RealRegister::eax];
+   if (reg >= TR::RealRegister::r8 && reg <= TR::RealRegister::r15)
+      return (uint64_t)1 << (reg - TR::RealRegister::r8 + 8);
+   if (reg >= TR::RealRegister::xmm0 && reg <= TR::RealRegister::xmm15)
+      return (uint64_t)1 << (reg - TR::RealRegister::xmm0 + 16);
+   return 0;
+   }
+
+
 TR::Register *
 TR::AMD64SystemLinkage::buildVolatileAndReturnDependencies(
       TR::Node *callNode,
@@ -566,14 +587,21 @@ TR::AMD64SystemLinkage::buildVolatileAndReturnDependencies(
          break;
       }
 
-   // Kill all non-preserved int and float regs besides the return register.
+   // Kill all non-preserved int and float regs besides the return register,
+   // and besides those a fast helper preserves.  The scratch register is
+   // always killed, as direct dispatch loads the target address into it.
    //
    int32_t i;
    TR::RealRegister::RegNum scratchIndex = getProperties().getIntegerScratchRegister(1);
+   TR::MethodSymbol *methodSymbol = callNode->getSymbol()->castToMethodSymbol();
+   uint64_t preservedRegisters = methodSymbol->isFastHelper() ? methodSymbol->getPreservedRegisters() : 0;
    for (i=0; i<getProperties().getNumVolatileRegisters(); i++)
       {
       TR::RealRegister::RegNum regIndex = getProperties()._volatileRegisters[i];
 
+      if (regIndex != scratchIndex && (preservedRegisters & fastHelperRegisterBit(regIndex)))
+         continue;
+
       if (regIndex != returnRegIndex)
          {
          TR_RegisterKinds rk = (i < getProperties()._numberOfVolatileGPRegisters) ? TR_GPR : TR_FPR;
@@ -707,6 +735,7 @@ int32_t TR::AMD64SystemLinkage::buildArgs(
          }
       else
          {
+         TR_ASSERT_FATAL(!methodSymbol->isFastHelper(), "fast helper must be passed all its arguments in registers %p\n", callNode);
          offset = layoutResult.offset;
          }
 
@@ -813,6 +842,35 @@ TR::AMD64SystemLinkage::buildIndirectDispatch(TR::Node *callNode)
    }
 
 
+// A call marked as a tail call can leave the method through a jump once the
+// epilogue has run when its result is returned right away, it passes nothing
+// on the stack, and the method being compiled uses this linkage too
+//
+static bool
+canTailJump(TR::Linkage *linkage, TR::Node *callNode, int32_t memoryArgSize, TR::CodeGenerator *cg)
+   {
+   if (!callNode->isTailCall() ||
+       memoryArgSize != 0 ||
+       !callNode->getSymbol()->castToMethodSymbol()->getMethodAddress() ||
+       cg->getLinkage() != linkage)
+      return false;
+
+   TR::TreeTop *callTree = cg->getCurrentEvaluationTreeTop();
+   TR::Node *anchor = callTree ? callTree->getNode() : NULL;
+   if (anchor && anchor->getOpCode().isReturn())
+      return anchor->getNumChildren() > 0 && anchor->getFirstChild() == callNode;
+
+   if (anchor != callNode && !(anchor && anchor->getOpCodeValue() == TR::treetop && anchor->getFirstChild() == callNode))
+      return false;
+
+   TR::TreeTop *returnTree = callTree->getNextTreeTop();
+   TR::Node *returnNode = returnTree ? returnTree->getNode() : NULL;
+   if (!returnNode || !returnNode->getOpCode().isReturn())
+      return false;
+
+   return returnNode->getNumChildren() == 0 || returnNode->getFirstChild() == callNode;
+   }
+
 TR::Register *TR::AMD64SystemLinkage::buildDirectDispatch(
       TR::Node *callNode,
       bool spillFPRegs)
@@ -867,21 +925,37 @@ TR::Register *TR::AMD64SystemLinkage::buildDirectDispatch(
          methodSymRef,
          cg());
 
-      if (comp()->getOption(TR_EmitRelocatableELFFile))
+      if (comp()->getOption(TR_EmitRelocatableELFFile) || comp()->getAOTCacheKey() != 0)
          {
          LoadRegisterInstruction->setReloKind(TR_NativeMethodAbsolute);
          }
 
-      instr = generateRegInstruction(TR::InstOpCode::CALLReg, callNode, scratchReg, preDeps, cg());
+      if (canTailJump(this, callNode, memoryArgSize, cg()))
+         {
+         // The epilogue goes in front of the jump, and the callee returns
+         // straight to this method's caller
+         //
+         instr = generateRegInstruction(TR::InstOpCode::JMPReg, callNode, scratchReg, preDeps, cg());
+         instr->setIsTailJump();
+         }
+      else
+         {
+         instr = generateRegInstruction(TR::InstOpCode::CALLReg, callNode, scratchReg, preDeps, cg());
+         }
       }
    else
       {
       instr = generateImmSymInstruction(TR::InstOpCode::CALLImm4, callNode, static_cast<int32_t>(reinterpret_cast<uintptr_t>(methodSymbol->getMethodAddress())), methodSymRef, preDeps, cg());
       }
 
-   cg()->resetIsLeafMethod();
+   // A leaf native runs on whatever stack it is given, so calling it does
+   // not require the caller to align its frame for calls
+   //
+   if (!methodSymbol->isLeafNative())
+      cg()->resetIsLeafMethod();
 
-   instr->setNeedsGCMap(getProperties().getPreservedRegisterMapForGC());
+   if (!instr->isTailJump())
+      instr->setNeedsGCMap(getProperties().getPreservedRegisterMapForGC());
 
    cg()->stopUsingRegister(scratchReg);
 
@@ -58,6 +58,8 @@ class AMD64SystemLinkage : public TR::X86SystemLinkage
 
    TR::Register *buildVolatileAndReturnDependencies(TR::Node *callNode, TR::RegisterDependencyConditions *deps);
 
+   static uint64_t fastHelperRegisterBit(TR::RealRegister::RegNum reg);
+
    virtual TR::RealRegister* getSingleWordFrameAllocationRegister() { return machine()->getRealRegister(TR::RealRegister::r11); }
 
    private:
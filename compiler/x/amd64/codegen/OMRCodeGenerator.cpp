@@ -82,6 +82,7 @@ void OMR::X86::AMD64::CodeGenerator::initialize()
 
    cg->setSupportsGlRegDepOnFirstBlock();
    cg->setConsiderAllAutosAsTacticalGlobalRegisterCandidates();
+   cg->setSupportsLinearScanRegisterAllocator();
 
    // Interpreter frame shape requires all autos to occupy an 8-byte slot on 64-bit.
    //
@@ -96,6 +96,7 @@
 #include "x/codegen/OutlinedInstructions.hpp"
 #include "x/codegen/FPTreeEvaluator.hpp"
 #include "x/codegen/X86Instruction.hpp"
+#include "x/codegen/X86LinearScanRegisterAllocator.hpp"
 #include "codegen/InstOpCode.hpp"
 
 namespace OMR { class RegisterUsage; }
@@ -520,6 +521,7 @@ OMR::X86::CodeGenerator::CodeGenerator(TR::Compilation *comp) :
    _assignmentDirection(Backward),
    _lastCatchAppendInstruction(NULL),
    _betterSpillPlacements(NULL),
+   _linearScanRegisterAllocator(NULL),
    _dataSnippetList(getTypedAllocator<TR::X86DataSnippet*>(comp->allocator())),
    _spilledIntRegisters(getTypedAllocator<TR::Register*>(comp->allocator())),
    _liveDiscardableRegisters(getTypedAllocator<TR::Register*>(comp->allocator())),
@@ -1670,8 +1672,15 @@ TR::Instruction *OMR::X86::CodeGenerator::generateInterpreterEntryInstruction(TR
          }
       }
    else
+      {
       interpreterEntryInstruction = procEntryInstruction;
 
+      // A patchable method entry needs the same 2 atomically-patchable bytes
+      //
+      if (self()->comp()->hasPatchableMethodEntry() && self()->comp()->target().isSMP())
+         generatePatchableCodeAlignmentInstruction(TR::X86PatchableCodeAlignmentInstruction::spinLoopAtomicRegions, procEntryInstruction, self());
+      }
+
    return interpreterEntryInstruction;
    }
 
@@ -1840,15 +1849,36 @@ void OMR::X86::CodeGenerator::doRegisterAssignment(TR_RegisterKinds kindsToAssig
       if (self()->enableRegisterAssociations())
          self()->machine()->setGPRWeightsFromAssociations();
 
+      // Plan the whole method once and apply the plan directly when it
+      // covers the whole stream; otherwise it guides the backward assigner,
+      // and outlined code sections assigned later reuse it
+      //
+      if (self()->useLinearScanRegisterAllocator() && !_linearScanRegisterAllocator)
+         {
+         LexicalTimer pt3("linear scan register allocation", self()->comp()->phaseTimer());
+         _linearScanRegisterAllocator = new (self()->trHeapMemory()) TR::X86LinearScanRegisterAllocator(self());
+         _linearScanRegisterAllocator->allocate(kindsToAssign);
+         if (_linearScanRegisterAllocator->assignRegisters())
+            return;
+         }
+
       self()->doBackwardsRegisterAssignment(kindsToAssign, self()->getAppendInstruction());
       }
    }
 
+TR::RealRegister::RegNum OMR::X86::CodeGenerator::getLinearScanAssignment(TR::Register *virtReg)
+   {
+   if (!_linearScanRegisterAllocator)
+      return TR::RealRegister::NoReg;
+   return _linearScanRegisterAllocator->getAssignment(virtReg);
+   }
+
 bool OMR::X86::CodeGenerator::isReturnInstruction(TR::Instruction *instr)
    {
    if (instr->getOpCodeValue() == TR::InstOpCode::RET ||
        instr->getOpCodeValue() == TR::InstOpCode::RETImm2 ||
-       instr->getOpCodeValue() == TR::InstOpCode::retn
+       instr->getOpCodeValue() == TR::InstOpCode::retn ||
+       instr->isTailJump()
       )
       return true;
    else
@@ -1925,6 +1955,12 @@ void OMR::X86::CodeGenerator::doBinaryEncoding()
    if (recompilation)
       prologueCursor = recompilation->generatePrologue(prologueCursor);
 
+   // A method entry that may be patched with a jump starts with a 5-byte nop,
+   // so no thread can be part way through the bytes the jump replaces
+   //
+   if (self()->comp()->hasPatchableMethodEntry())
+      prologueCursor = generatePaddingInstruction(prologueCursor, 5, self());
+
    // Establish the VFP ground state.
    // This instruction actually ends up immediately AFTER the prologue.
    //
@@ -69,6 +69,7 @@ namespace TR { class CodeGenerator; }
 namespace TR { class MemoryReference; }
 namespace TR { class X86ImmInstruction;         }
 namespace TR { class X86LabelInstruction;       }
+namespace TR { class X86LinearScanRegisterAllocator; }
 namespace TR { class X86MemTableInstruction;    }
 namespace TR { class X86ScratchRegisterManager; }
 namespace TR { class X86VFPSaveInstruction;     }
@@ -381,6 +382,12 @@ class OMR_EXTENSIBLE CodeGenerator : public OMR::CodeGenerator
 
    void doBackwardsRegisterAssignment(TR_RegisterKinds kindsToAssign, TR::Instruction *startInstruction, TR::Instruction *appendInstruction = NULL);
 
+   /**
+    * \brief The real register the linear scan planned for a virtual register,
+    *        or NoReg if there is no plan for it.
+    */
+   TR::RealRegister::RegNum getLinearScanAssignment(TR::Register *virtReg);
+
    bool hasComplexAddressingMode() { return true; }
    bool getSupportsBitOpCodes() { return true; }
 
@@ -558,6 +565,8 @@ class OMR_EXTENSIBLE CodeGenerator : public OMR::CodeGenerator
 
    bool supportsInliningOfIsInstance();
 
+   bool supportsPatchableMethodEntry() { return true; }
+
    bool supportsPassThroughCopyToNewVirtualRegister() { return true; }
 
    bool doRematerialization() {return true;}
@@ -753,6 +762,7 @@ protected:
 
    TR::Instruction                 *_lastCatchAppendInstruction;
    TR_BetterSpillPlacement        *_betterSpillPlacements;
+   TR::X86LinearScanRegisterAllocator *_linearScanRegisterAllocator;
 
    TR::list<TR::Register*>               _spilledIntRegisters;
    TR::list<TR::Register*>               _liveDiscardableRegisters;
@@ -233,7 +233,8 @@ void OMR::X86::Instruction::adjustVFPState(TR_VFPState *state, TR::CodeGenerator
          state->_displacement += static_cast<int32_t>(TR::Compiler->om.sizeofReferenceAddress());
       else if (self()->getOpCode().isPopOp())
          state->_displacement -= static_cast<int32_t>(TR::Compiler->om.sizeofReferenceAddress());
-      else if (self()->getOpCodeValue() == TR::InstOpCode::RET || self()->getOpCodeValue() == TR::InstOpCode::RETImm2 || self()->getOpCodeValue() == TR::InstOpCode::retn)
+      else if (self()->getOpCodeValue() == TR::InstOpCode::RET || self()->getOpCodeValue() == TR::InstOpCode::RETImm2 || self()->getOpCodeValue() == TR::InstOpCode::retn ||
+               self()->isTailJump())
          *state = cg->vfpResetInstruction()->getSavedState();
       }
    }
@@ -299,6 +299,23 @@ OMR::X86::Machine::findBestFreeGPRegister(TR::Instruction   *currentInstruction,
       last = TR::RealRegister::k7;
       }
 
+   // Take the register the linear scan planned for this virtual if it is
+   // still available here and does not interfere with the virtual
+   //
+   TR::RealRegister::RegNum plannedRegNum = self()->cg()->getLinearScanAssignment(virtReg);
+   if (plannedRegNum >= first && plannedRegNum <= last &&
+       !(virtReg->getInterference() & (1 << (plannedRegNum - first))))
+      {
+      TR::RealRegister *plannedRegister = _registerFile[plannedRegNum];
+      if (plannedRegister->getState() != TR::RealRegister::Locked &&
+          ((plannedRegister->getAssignedRegister() == NULL && plannedRegister->getState() != TR::RealRegister::Blocked) ||
+           (considerUnlatched && plannedRegister->getState() == TR::RealRegister::Unlatched)))
+         {
+         self()->cg()->setRegisterAssignmentFlag(TR_ByColouring);
+         return plannedRegister;
+         }
+      }
+
    uint32_t                        weight;
    uint32_t                        bestWeightSoFar   = IA32_REGISTER_HEAVIEST_WEIGHT ;
    TR_RegisterMask                 interference      = virtReg->getInterference();
@@ -0,0 +1,730 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "x/codegen/X86LinearScanRegisterAllocator.hpp"
+
+#include <algorithm>
+#include <string.h>
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Instruction.hpp"
+#include "codegen/Machine.hpp"
+#include "codegen/MemoryReference.hpp"
+#include "codegen/RealRegister.hpp"
+#include "codegen/Register.hpp"
+#include "codegen/RegisterDependency.hpp"
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/LabelSymbol.hpp"
+#include "infra/Array.hpp"
+#include "ras/Debug.hpp"
+#include "x/codegen/X86Instruction.hpp"
+#include "x/codegen/X86LinkageProperties.hpp"
+
+static inline uint32_t readPosition(TR::Instruction *instr)  { return 2 * instr->getIndex(); }
+static inline uint32_t writePosition(TR::Instruction *instr) { return 2 * instr->getIndex() + 1; }
+
+static bool isPlannedRegisterNumber(int32_t regNum)
+   {
+   return (regNum >= TR::RealRegister::FirstGPR && regNum <= TR::RealRegister::LastAssignableGPR) ||
+          (regNum >= TR::RealRegister::FirstXMMR && regNum <= TR::RealRegister::LastXMMR);
+   }
+
+TR::X86LinearScanRegisterAllocator::X86LinearScanRegisterAllocator(TR::CodeGenerator *cg)
+   : _cg(cg),
+     _assignment(NULL),
+     _firstReference(NULL),
+     _lastReference(NULL),
+     _numRegisters(0),
+     _directlyAssignable(false)
+   {
+   memset(_fixedUses, 0, sizeof(_fixedUses));
+   memset(_numFixedUses, 0, sizeof(_numFixedUses));
+   }
+
+TR::RealRegister::RegNum
+TR::X86LinearScanRegisterAllocator::getAssignment(TR::Register *virtReg)
+   {
+   // Registers created after the plan was made, such as those introduced
+   // during register assignment itself, have no planned register
+   //
+   uint32_t index = virtReg->getIndex();
+   if (_assignment == NULL || index >= _numRegisters || _cg->getRegisterArray()[index] != virtReg)
+      return TR::RealRegister::NoReg;
+   return (TR::RealRegister::RegNum)_assignment[index];
+   }
+
+void
+TR::X86LinearScanRegisterAllocator::allocate(TR_RegisterKinds kindsToAssign)
+   {
+   TR::Compilation *comp = _cg->comp();
+   TR_Memory *trMemory = comp->trMemory();
+
+   _numRegisters = _cg->getRegisterArray().size();
+   _assignment = (uint8_t *)trMemory->allocateHeapMemory(_numRegisters * sizeof(uint8_t));
+   memset(_assignment, TR::RealRegister::NoReg, _numRegisters * sizeof(uint8_t));
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory);
+
+   scanInstructions();
+
+   if (kindsToAssign & TR_GPR_Mask)
+      allocateKind(TR_GPR, TR::RealRegister::FirstGPR, TR::RealRegister::LastAssignableGPR);
+   if (kindsToAssign & TR_FPR_Mask)
+      allocateKind(TR_FPR, TR::RealRegister::FirstXMMR, TR::RealRegister::LastXMMR);
+
+   if (_directlyAssignable)
+      _directlyAssignable = planCoversStream();
+
+   // The fixed uses live in the stack region
+   //
+   memset(_fixedUses, 0, sizeof(_fixedUses));
+   memset(_numFixedUses, 0, sizeof(_numFixedUses));
+   }
+
+void
+TR::X86LinearScanRegisterAllocator::noteReference(TR::Register *reg, TR::Instruction *instr)
+   {
+   if (!reg)
+      return;
+
+   if (reg->getKind() != TR_GPR && reg->getKind() != TR_FPR)
+      _directlyAssignable = false;
+
+   if (reg->getRealRegister())
+      return;
+
+   // Virtuals dedicated to a real register before assignment, such as the
+   // VM thread register, keep it; others already assigned are left to the
+   // local assigner
+   //
+   TR::RealRegister *assignedRegister = reg->getAssignedRealRegister();
+   if (assignedRegister && assignedRegister->getState() != TR::RealRegister::Locked)
+      _directlyAssignable = false;
+
+   uint32_t index = reg->getIndex();
+   if (index >= _numRegisters || _cg->getRegisterArray()[index] != reg)
+      {
+      _directlyAssignable = false;
+      return;
+      }
+
+   if (!_firstReference[index] || _firstReference[index]->getIndex() > instr->getIndex())
+      _firstReference[index] = instr;
+   if (!_lastReference[index] || _lastReference[index]->getIndex() < instr->getIndex())
+      _lastReference[index] = instr;
+   }
+
+void
+TR::X86LinearScanRegisterAllocator::scanInstructions()
+   {
+   TR_Memory *trMemory = _cg->comp()->trMemory();
+
+   // The start of range recorded on each register during instruction
+   // selection is cleared when the register dies, so the references are
+   // found again here, in the same pass that collects the register
+   // dependencies and checks whether the plan can be applied directly
+   //
+   size_t numBytes = _numRegisters * sizeof(TR::Instruction *);
+   _firstReference = (TR::Instruction **)trMemory->allocateHeapMemory(numBytes);
+   _lastReference = (TR::Instruction **)trMemory->allocateHeapMemory(numBytes);
+   memset(_firstReference, 0, numBytes);
+   memset(_lastReference, 0, numBytes);
+   _directlyAssignable = _cg->getOutlinedInstructionsList().empty();
+
+   int32_t maxUses = 64, numUses = 0;
+   FixedUse *uses = (FixedUse *)trMemory->allocateStackMemory(maxUses * sizeof(FixedUse));
+   uint8_t *useRegNums = (uint8_t *)trMemory->allocateStackMemory(maxUses * sizeof(uint8_t));
+
+   TR::Instruction *prev = NULL;
+   for (TR::Instruction *instr = _cg->getFirstInstruction(); instr; prev = instr, instr = instr->getNext())
+      {
+      // Positions rely on the indices following the order of the stream
+      //
+      if (_directlyAssignable &&
+          ((prev && prev->getIndex() >= instr->getIndex()) || !isDirectlyAssignable(instr)))
+         {
+         _directlyAssignable = false;
+         if (_cg->comp()->getOption(TR_TraceRA))
+            traceMsg(_cg->comp(), "Linear scan cannot assign registers directly at instruction %p\n", instr);
+         }
+
+      noteReference(instr->getTargetRegister(), instr);
+      noteReference(instr->getSourceRegister(), instr);
+      noteReference(instr->getSource2ndRegister(), instr);
+
+      TR::MemoryReference *mr = instr->getMemoryReference();
+      if (mr)
+         {
+         noteReference(mr->getBaseRegister(), instr);
+         noteReference(mr->getIndexRegister(), instr);
+         }
+
+      TR::RegisterDependencyConditions *deps = instr->getDependencyConditions();
+      if (!deps || instr->getOpCodeValue() == TR::InstOpCode::assocreg)
+         continue;
+
+      for (int32_t post = 0; post < 2; post++)
+         {
+         TR::RegisterDependencyGroup *group = post ? deps->getPostConditions() : deps->getPreConditions();
+         uint32_t num = post ? deps->getNumPostConditions() : deps->getNumPreConditions();
+         for (uint32_t i = 0; group && i < num; i++)
+            {
+            TR::RegisterDependency *dep = group->getRegisterDependency(i);
+            noteReference(dep->getRegister(), instr);
+
+            int32_t regNum = dep->getRealRegister();
+            if (!isPlannedRegisterNumber(regNum))
+               continue;
+
+            if (numUses == maxUses)
+               {
+               FixedUse *newUses = (FixedUse *)trMemory->allocateStackMemory(2 * maxUses * sizeof(FixedUse));
+               uint8_t *newRegNums = (uint8_t *)trMemory->allocateStackMemory(2 * maxUses * sizeof(uint8_t));
+               memcpy(newUses, uses, maxUses * sizeof(FixedUse));
+               memcpy(newRegNums, useRegNums, maxUses * sizeof(uint8_t));
+               uses = newUses;
+               useRegNums = newRegNums;
+               maxUses *= 2;
+               }
+
+            uses[numUses]._position = post ? writePosition(instr) : readPosition(instr);
+            uses[numUses]._register = dep->getRegister();
+            useRegNums[numUses++] = (uint8_t)regNum;
+            _numFixedUses[regNum]++;
+            }
+         }
+      }
+
+   // Group the uses of each real register.  Instructions inserted out of line
+   // do not always get indices in list order, so they are sorted explicitly.
+   //
+   for (int32_t r = 0; r < TR::RealRegister::NumRegisters; r++)
+      {
+      if (_numFixedUses[r] > 0)
+         _fixedUses[r] = (FixedUse *)trMemory->allocateStackMemory(_numFixedUses[r] * sizeof(FixedUse));
+      _numFixedUses[r] = 0;
+      }
+
+   for (int32_t i = 0; i < numUses; i++)
+      _fixedUses[useRegNums[i]][_numFixedUses[useRegNums[i]]++] = uses[i];
+
+   for (int32_t r = 0; r < TR::RealRegister::NumRegisters; r++)
+      std::sort(_fixedUses[r], _fixedUses[r] + _numFixedUses[r], usedBefore);
+   }
+
+bool
+TR::X86LinearScanRegisterAllocator::planCoversStream()
+   {
+   TR::Compilation *comp = _cg->comp();
+   TR_Array<TR::Register *> &registers = _cg->getRegisterArray();
+
+   // Every virtual referenced needs a register
+   //
+   for (uint32_t i = 0; i < _numRegisters; i++)
+      {
+      if (_firstReference[i] && !directAssignment(registers[i]))
+         {
+         if (comp->getOption(TR_TraceRA))
+            traceMsg(comp, "Linear scan cannot assign %s directly\n", comp->getDebug()->getName(registers[i]));
+         return false;
+         }
+      }
+
+   // and the one it is coerced into wherever it has a dependency
+   //
+   for (int32_t r = 0; r < TR::RealRegister::NumRegisters; r++)
+      {
+      for (int32_t i = 0; i < _numFixedUses[r]; i++)
+         {
+         TR::Register *reg = _fixedUses[r][i]._register;
+         if (reg && directAssignment(reg)->getRegisterNumber() != r)
+            {
+            if (comp->getOption(TR_TraceRA))
+               traceMsg(comp, "Linear scan cannot assign %s directly\n", comp->getDebug()->getName(reg));
+            return false;
+            }
+         }
+      }
+
+   return true;
+   }
+
+uint32_t
+TR::X86LinearScanRegisterAllocator::blockedRegisters(Interval &interval, int32_t first, int32_t last, int32_t &preferred)
+   {
+   uint32_t blocked = 0;
+   preferred = TR::RealRegister::NoReg;
+
+   for (int32_t r = first; r <= last; r++)
+      {
+      FixedUse *uses = _fixedUses[r];
+      int32_t lo = 0, hi = _numFixedUses[r];
+
+      // First use at or after the start of the interval
+      //
+      while (lo < hi)
+         {
+         int32_t mid = (lo + hi) / 2;
+         if (uses[mid]._position < interval._start)
+            lo = mid + 1;
+         else
+            hi = mid;
+         }
+
+      for (int32_t i = lo; i < _numFixedUses[r] && uses[i]._position <= interval._end; i++)
+         {
+         if (uses[i]._register != interval._register)
+            {
+            blocked |= 1 << (r - first);
+            break;
+            }
+         if (preferred == TR::RealRegister::NoReg)
+            preferred = r;
+         }
+      }
+
+   if (preferred != TR::RealRegister::NoReg && (blocked & (1 << (preferred - first))))
+      preferred = TR::RealRegister::NoReg;
+
+   return blocked;
+   }
+
+int32_t
+TR::X86LinearScanRegisterAllocator::chooseRegister(uint32_t candidates, int32_t first, int32_t preferred)
+   {
+   if (preferred != TR::RealRegister::NoReg && (candidates & (1 << (preferred - first))))
+      return preferred;
+
+   // Volatile registers first, so preserved registers are only saved in the
+   // prologue when the method really needs them
+   //
+   const TR::X86LinkageProperties &properties = _cg->getProperties();
+   int32_t preservedChoice = TR::RealRegister::NoReg;
+   for (int32_t bit = 0; candidates >> bit; bit++)
+      {
+      if (!(candidates & (1 << bit)))
+         continue;
+      int32_t r = first + bit;
+      if (!properties.isPreservedRegister((TR::RealRegister::RegNum)r))
+         return r;
+      if (preservedChoice == TR::RealRegister::NoReg)
+         preservedChoice = r;
+      }
+   return preservedChoice;
+   }
+
+void
+TR::X86LinearScanRegisterAllocator::allocateKind(TR_RegisterKinds kind, int32_t first, int32_t last)
+   {
+   TR::Compilation *comp = _cg->comp();
+   TR_Array<TR::Register *> &registers = _cg->getRegisterArray();
+
+   // Build the live intervals.  Registers that are already assigned, are
+   // referenced from outlined code (whose ranges are not tracked) or are
+   // register pairs are left to the local assigner.
+   //
+   Interval *intervals = (Interval *)comp->trMemory()->allocateStackMemory(_numRegisters * sizeof(Interval));
+   int32_t numIntervals = 0;
+   for (uint32_t i = 0; i < _numRegisters; i++)
+      {
+      TR::Register *reg = registers[i];
+      if (!reg ||
+          reg->getKind() != kind ||
+          reg->getAssignedRegister() ||
+          reg->getRegisterPair() ||
+          reg->getOutOfLineUseCount() > 0 ||
+          reg->getTotalUseCount() == 0 ||
+          !_firstReference[i])
+         continue;
+
+      // A virtual first referenced by a read lives from the point where its
+      // instruction reads its operands, and one last referenced by a write or
+      // a post-condition lives until its instruction writes its results
+      //
+      TR::Instruction *start = _firstReference[i];
+      TR::RegisterDependencyConditions *deps = start->getDependencyConditions();
+      bool startsWithRead = start->usesRegister(reg) ||
+         (deps && deps->getPreConditions() &&
+          deps->getPreConditions()->containsVirtualRegister(reg, deps->getNumPreConditions()));
+
+      TR::Instruction *end = _lastReference[i];
+      deps = end->getDependencyConditions();
+      bool endsWithWrite = end->defsRegister(reg) ||
+         (deps && deps->getPostConditions() &&
+          deps->getPostConditions()->containsVirtualRegister(reg, deps->getNumPostConditions()));
+
+      Interval &interval = intervals[numIntervals++];
+      interval._register = reg;
+      interval._start = startsWithRead ? readPosition(start) : writePosition(start);
+      interval._end = std::max(endsWithWrite ? writePosition(end) : readPosition(end), interval._start);
+      }
+
+   std::sort(intervals, intervals + numIntervals, startsBefore);
+
+   uint32_t allocatable = 0;
+   for (int32_t r = first; r <= last; r++)
+      {
+      if (_cg->machine()->getRealRegister((TR::RealRegister::RegNum)r)->getState() == TR::RealRegister::Free)
+         allocatable |= 1 << (r - first);
+      }
+
+   Interval *active[TR::RealRegister::NumRegisters];
+   int32_t numActive = 0;
+   uint32_t freeRegisters = allocatable;
+   uint32_t freeSince[TR::RealRegister::NumRegisters];   // end of the last interval expired from each register
+   memset(freeSince, 0, sizeof(freeSince));
+   int32_t numPlanned = 0, numEvicted = 0, numMoved = 0, numUnplanned = 0;
+
+   for (int32_t i = 0; i < numIntervals; i++)
+      {
+      Interval &interval = intervals[i];
+
+      // Expire the intervals that ended before this one starts
+      //
+      for (int32_t j = 0; j < numActive; )
+         {
+         if (active[j]->_end <= interval._start)
+            {
+            int32_t r = _assignment[active[j]->_register->getIndex()];
+            freeRegisters |= 1 << (r - first);
+            freeSince[r] = std::max(freeSince[r], active[j]->_end);
+            active[j] = active[--numActive];
+            }
+         else
+            j++;
+         }
+
+      int32_t preferred;
+      uint32_t blocked = blockedRegisters(interval, first, last, preferred);
+      uint32_t candidates = freeRegisters & ~blocked;
+      int32_t choice = TR::RealRegister::NoReg;
+
+      // The register this interval is coerced into may be held by an earlier
+      // interval that only took it for being free.  Move that one to another
+      // register that has been free since it started.
+      //
+      if (preferred != TR::RealRegister::NoReg && !(candidates & (1 << (preferred - first))))
+         {
+         for (int32_t j = 0; j < numActive; j++)
+            {
+            Interval &holder = *active[j];
+            if (_assignment[holder._register->getIndex()] != preferred)
+               continue;
+
+            int32_t holderPreferred;
+            uint32_t holderCandidates = freeRegisters & ~blockedRegisters(holder, first, last, holderPreferred);
+            if (holderPreferred == preferred)
+               break;
+
+            for (int32_t r = first; r <= last; r++)
+               {
+               if ((holderCandidates & (1 << (r - first))) && freeSince[r] <= holder._start)
+                  {
+                  _assignment[holder._register->getIndex()] = (uint8_t)r;
+                  freeRegisters = (freeRegisters & ~(1 << (r - first))) | (1 << (preferred - first));
+                  candidates = freeRegisters & ~blocked;
+                  numMoved++;
+                  break;
+                  }
+               }
+            break;
+            }
+         }
+
+      if (candidates)
+         {
+         choice = chooseRegister(candidates, first, preferred);
+         }
+      else
+         {
+         // Take the register of the active interval that ends furthest away,
+         // if that is further than this one ends
+         //
+         int32_t victim = -1;
+         for (int32_t j = 0; j < numActive; j++)
+            {
+            int32_t r = _assignment[active[j]->_register->getIndex()];
+            if (!(blocked & (1 << (r - first))) &&
+                active[j]->_end > interval._end &&
+                (victim < 0 || active[j]->_end > active[victim]->_end))
+               victim = j;
+            }
+
+         if (victim < 0)
+            {
+            numUnplanned++;
+            continue;
+            }
+
+         choice = _assignment[active[victim]->_register->getIndex()];
+         _assignment[active[victim]->_register->getIndex()] = TR::RealRegister::NoReg;
+         active[victim] = active[--numActive];
+         numPlanned--;
+         numEvicted++;
+         }
+
+      _assignment[interval._register->getIndex()] = (uint8_t)choice;
+      freeRegisters &= ~(1 << (choice - first));
+      active[numActive++] = &interval;
+      numPlanned++;
+      }
+
+   if (comp->getOption(TR_TraceRA))
+      traceMsg(comp, "Linear scan %s: %d intervals, %d planned, %d evicted, %d moved, %d unplanned\n",
+         kind == TR_GPR ? "GPR" : "XMMR", numIntervals, numPlanned, numEvicted, numMoved, numUnplanned);
+   }
+
+TR::RealRegister *
+TR::X86LinearScanRegisterAllocator::directAssignment(TR::Register *reg)
+   {
+   if (reg->getRealRegister())
+      return reg->getRealRegister();
+
+   // Virtuals dedicated to a real register before assignment, such as the
+   // VM thread register, keep it
+   //
+   TR::RealRegister *assignedRegister = reg->getAssignedRealRegister();
+   if (assignedRegister)
+      return assignedRegister->getState() == TR::RealRegister::Locked ? assignedRegister : NULL;
+
+   TR::RealRegister::RegNum regNum = getAssignment(reg);
+   if (regNum == TR::RealRegister::NoReg)
+      return NULL;
+   return _cg->machine()->getRealRegister(regNum);
+   }
+
+bool
+TR::X86LinearScanRegisterAllocator::isDirectlyAssignable(TR::Instruction *instr)
+   {
+   // Only the instruction kinds whose operands are rewritten below
+   //
+   switch (instr->getKind())
+      {
+      case TR::Instruction::IsNotExtended:
+      case TR::Instruction::IsLabel:
+      case TR::Instruction::IsVirtualGuardNOP:
+      case TR::Instruction::IsFence:
+      case TR::Instruction::IsPadding:
+      case TR::Instruction::IsAlignment:
+      case TR::Instruction::IsImm:
+      case TR::Instruction::IsImmSnippet:
+      case TR::Instruction::IsImmSym:
+      case TR::Instruction::IsImm64:
+      case TR::Instruction::IsImm64Sym:
+      case TR::Instruction::IsReg:
+      case TR::Instruction::IsRegImm:
+      case TR::Instruction::IsRegImmSym:
+      case TR::Instruction::IsRegImm64:
+      case TR::Instruction::IsRegImm64Sym:
+      case TR::Instruction::IsRegReg:
+      case TR::Instruction::IsRegRegImm:
+      case TR::Instruction::IsRegRegReg:
+      case TR::Instruction::IsRegMem:
+      case TR::Instruction::IsRegMemImm:
+      case TR::Instruction::IsRegRegMem:
+      case TR::Instruction::IsMem:
+      case TR::Instruction::IsMemTable:
+      case TR::Instruction::IsCallMem:
+      case TR::Instruction::IsMemImm:
+      case TR::Instruction::IsMemImmSym:
+      case TR::Instruction::IsMemReg:
+      case TR::Instruction::IsMemRegImm:
+         break;
+      default:
+         return false;
+      }
+
+   if (instr->getMaskRegister())
+      return false;
+
+   TR::MemoryReference *mr = instr->getMemoryReference();
+   if (mr && mr->getAddressRegister())
+      return false;
+
+   TR::X86LabelInstruction *labelInstr = instr->getX86LabelInstruction();
+   if (labelInstr && labelInstr->getLabelSymbol())
+      {
+      TR::LabelSymbol *label = labelInstr->getLabelSymbol();
+      if (label->isStartOfColdInstructionStream() || label->isInternalControlFlowMerge())
+         return false;
+#ifdef J9_PROJECT_SPECIFIC
+      // Guarded devirtual snippets learn their registers from the assigner
+      //
+      if (label->getSnippet())
+         return false;
+#endif
+      }
+
+   TR::RegisterDependencyConditions *deps = instr->getDependencyConditions();
+   if (!deps || instr->getOpCodeValue() == TR::InstOpCode::assocreg)
+      return true;
+
+   for (int32_t post = 0; post < 2; post++)
+      {
+      TR::RegisterDependencyGroup *group = post ? deps->getPostConditions() : deps->getPreConditions();
+      uint32_t num = post ? deps->getNumPostConditions() : deps->getNumPreConditions();
+      for (uint32_t i = 0; group && i < num; i++)
+         {
+         TR::RegisterDependency *dep = group->getRegisterDependency(i);
+         if (dep->getRegister() && (dep->isSpilledReg() || dep->isBestFreeReg()))
+            return false;
+         }
+      }
+
+   return true;
+   }
+
+TR::Register *
+TR::X86LinearScanRegisterAllocator::assignOperand(TR::Register *reg)
+   {
+   TR::RealRegister *assignedRegister = directAssignment(reg);
+   if (assignedRegister->getState() != TR::RealRegister::Locked && !reg->isPlaceholderReg())
+      assignedRegister->setHasBeenAssignedInMethod(true);
+   return assignedRegister;
+   }
+
+void
+TR::X86LinearScanRegisterAllocator::assignDirectly(TR::Instruction *instr)
+   {
+   TR::Register *reg;
+
+   TR::X86RegInstruction *regInstr = instr->getX86RegInstruction();
+   if (regInstr && (reg = regInstr->getTargetRegister()) && !reg->getRealRegister())
+      regInstr->setTargetRegister(assignOperand(reg));
+
+   switch (instr->getKind())
+      {
+      case TR::Instruction::IsRegReg:
+      case TR::Instruction::IsRegRegImm:
+      case TR::Instruction::IsRegRegReg:
+         if ((reg = instr->getSourceRegister()) && !reg->getRealRegister())
+            static_cast<TR::X86RegRegInstruction *>(instr)->setSourceRegister(assignOperand(reg));
+         break;
+      case TR::Instruction::IsMemReg:
+      case TR::Instruction::IsMemRegImm:
+         if ((reg = instr->getSourceRegister()) && !reg->getRealRegister())
+            static_cast<TR::X86MemRegInstruction *>(instr)->setSourceRegister(assignOperand(reg));
+         break;
+      default:
+         break;
+      }
+
+   if ((reg = instr->getSource2ndRegister()) && !reg->getRealRegister())
+      {
+      if (instr->getKind() == TR::Instruction::IsRegRegMem)
+         static_cast<TR::X86RegRegMemInstruction *>(instr)->setSource2ndRegister(assignOperand(reg));
+      else
+         static_cast<TR::X86RegRegRegInstruction *>(instr)->setSource2ndRegister(assignOperand(reg));
+      }
+
+   TR::MemoryReference *mr = instr->getMemoryReference();
+   if (mr)
+      {
+      if ((reg = mr->getBaseRegister()) && !reg->getRealRegister())
+         mr->setBaseRegister(assignOperand(reg));
+      if ((reg = mr->getIndexRegister()) && !reg->getRealRegister())
+         mr->setIndexRegister(assignOperand(reg));
+      }
+
+   // Document the registers given to NoReg dependencies, as the backward
+   // assigner does, for snippets that look them up
+   //
+   TR::RegisterDependencyConditions *deps = instr->getDependencyConditions();
+   if (deps && instr->getOpCodeValue() != TR::InstOpCode::assocreg)
+      {
+      for (int32_t post = 0; post < 2; post++)
+         {
+         TR::RegisterDependencyGroup *group = post ? deps->getPostConditions() : deps->getPreConditions();
+         uint32_t num = post ? deps->getNumPostConditions() : deps->getNumPreConditions();
+         for (uint32_t i = 0; group && i < num; i++)
+            {
+            TR::RegisterDependency *dep = group->getRegisterDependency(i);
+            if (!dep->getRegister())
+               continue;
+            TR::RealRegister *assignedRegister = toRealRegister(assignOperand(dep->getRegister()));
+            if (dep->isNoReg())
+               dep->setRealRegister(assignedRegister->getRegisterNumber());
+            }
+         }
+      }
+
+   // A copy between the same registers is a no-op
+   //
+   if (instr->isRegRegMove() && instr->getSourceRegister() == instr->getTargetRegister())
+      instr->remove();
+   }
+
+bool
+TR::X86LinearScanRegisterAllocator::assignRegisters()
+   {
+   TR::Compilation *comp = _cg->comp();
+
+   if (!_assignment || !_directlyAssignable)
+      return false;
+
+   // The GC maps describe the collected references live in registers, which
+   // the machine state would hold at this point during backward assignment
+   //
+   TR_Memory *trMemory = comp->trMemory();
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory);
+   TR_Array<TR::Register *> &registers = _cg->getRegisterArray();
+   uint32_t *collected = (uint32_t *)trMemory->allocateStackMemory(_numRegisters * sizeof(uint32_t));
+   int32_t numCollected = 0;
+   for (uint32_t i = 0; i < _numRegisters; i++)
+      {
+      TR::Register *reg = registers[i];
+      if (reg && _assignment[i] != TR::RealRegister::NoReg &&
+          (reg->containsCollectedReference() || reg->containsInternalPointer()))
+         collected[numCollected++] = i;
+      }
+
+   int32_t numInstructions = 0;
+   TR::Instruction *next;
+   for (TR::Instruction *instr = _cg->getFirstInstruction(); instr; instr = next)
+      {
+      next = instr->getNext();
+      assignDirectly(instr);
+      numInstructions++;
+
+      if (!instr->needsGCMap() && !instr->getSnippetForGC())
+         continue;
+
+      uint32_t index = instr->getIndex();
+      for (int32_t i = 0; i < numCollected; i++)
+         {
+         uint32_t r = collected[i];
+         if (_firstReference[r]->getIndex() < index && _lastReference[r]->getIndex() >= index)
+            directAssignment(registers[r])->setAssignedRegister(registers[r]);
+         }
+
+      _cg->buildGCMapsForInstructionAndSnippet(instr);
+
+      for (int32_t i = 0; i < numCollected; i++)
+         directAssignment(registers[collected[i]])->setAssignedRegister(NULL);
+      }
+
+   if (comp->getOption(TR_TraceRA))
+      traceMsg(comp, "Linear scan assigned registers directly in %d instructions\n", numInstructions);
+
+   return true;
+   }
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef X86LINEARSCANREGISTERALLOCATOR_INCL
+#define X86LINEARSCANREGISTERALLOCATOR_INCL
+
+#include <stdint.h>
+#include "codegen/RealRegister.hpp"
+#include "codegen/RegisterConstants.hpp"
+#include "env/TRMemory.hpp"
+
+namespace TR { class CodeGenerator; }
+namespace TR { class Instruction; }
+namespace TR { class Register; }
+
+namespace TR
+{
+
+/**
+ * Assigns the registers of a whole method with a single linear scan over the
+ * live ranges of its virtual registers.
+ *
+ * The scan runs on the virtual register instruction stream produced by
+ * instruction selection.  Each GPR and XMM virtual gets a live interval
+ * spanning the instruction indices of its first and last reference.  Register
+ * dependencies on instructions are collected as fixed intervals of one
+ * instruction on their real registers, so a virtual is never planned into a
+ * register that a call kills or that another virtual is coerced into within
+ * its interval, and is planned into the register it is itself coerced into
+ * when that register is available.
+ *
+ * Intervals are visited in order of their start.  An interval coerced into a
+ * register held by an earlier active interval moves that one to another
+ * register free over its whole range.  An interval whose register demand
+ * cannot be met either takes the register of the active interval that ends
+ * furthest away, or is left unplanned.
+ *
+ * When every virtual in the stream was planned into a register that satisfies
+ * all of its dependencies, the plan is applied directly to the instructions
+ * and the backward local assigner does not run at all.  Otherwise the plan is
+ * consumed by OMR::X86::Machine::findBestFreeGPRegister, which takes the
+ * planned register whenever it is free at the point of assignment, and the
+ * backward assigner remains responsible for coercions and spilling.
+ *
+ * The plan is made by default for cold and noOpt compilations, where
+ * tacticalGlobalRegisterAllocator is skipped, and at any opt level with
+ * TR_EnableLinearScanRA.  TR_DisableLinearScanRA turns it off.
+ */
+class X86LinearScanRegisterAllocator
+   {
+   public:
+
+   TR_ALLOC(TR_Memory::CodeGenerator)
+
+   X86LinearScanRegisterAllocator(TR::CodeGenerator *cg);
+
+   /**
+    * Compute the plan for every register of the given kinds in the current
+    * instruction stream.
+    */
+   void allocate(TR_RegisterKinds kindsToAssign);
+
+   /**
+    * The real register planned for a virtual register, or NoReg if none was.
+    */
+   TR::RealRegister::RegNum getAssignment(TR::Register *virtReg);
+
+   /**
+    * Rewrite every virtual register reference in the instruction stream with
+    * its planned real register, in place of the backward local assigner.
+    *
+    * \return false, leaving the stream untouched, if the plan cannot be
+    *         applied directly: a referenced virtual was not planned or is
+    *         coerced into another register, or the stream contains outlined
+    *         instructions, non-linear internal control flow, or x87, vector
+    *         or mask registers, whose assignment only the backward assigner
+    *         handles.
+    */
+   bool assignRegisters();
+
+   private:
+
+   // Positions are twice the instruction index for the point where an
+   // instruction reads its operands and pre-conditions, plus one for the point
+   // where it writes its results and post-conditions
+   //
+   struct Interval
+      {
+      TR::Register *_register;
+      uint32_t      _start;
+      uint32_t      _end;
+      };
+
+   static bool startsBefore(const Interval &a, const Interval &b)
+      {
+      return a._start < b._start || (a._start == b._start && a._end < b._end);
+      }
+
+   // A register dependency of an instruction on a real register
+   //
+   struct FixedUse
+      {
+      uint32_t      _position;
+      TR::Register *_register;
+      };
+
+   static bool usedBefore(const FixedUse &a, const FixedUse &b) { return a._position < b._position; }
+
+   void noteReference(TR::Register *reg, TR::Instruction *instr);
+   void scanInstructions();
+   bool planCoversStream();
+   void allocateKind(TR_RegisterKinds kind, int32_t first, int32_t last);
+   uint32_t blockedRegisters(Interval &interval, int32_t first, int32_t last, int32_t &preferred);
+   int32_t chooseRegister(uint32_t candidates, int32_t first, int32_t preferred);
+
+   TR::RealRegister *directAssignment(TR::Register *reg);
+   bool isDirectlyAssignable(TR::Instruction *instr);
+   TR::Register *assignOperand(TR::Register *reg);
+   void assignDirectly(TR::Instruction *instr);
+
+   TR::CodeGenerator *_cg;
+   uint8_t           *_assignment;      // planned RegNum, indexed by register index
+   TR::Instruction  **_firstReference;  // indexed by register index
+   TR::Instruction  **_lastReference;   // indexed by register index
+   uint32_t           _numRegisters;
+   bool               _directlyAssignable;
+
+   FixedUse          *_fixedUses[TR::RealRegister::NumRegisters];
+   int32_t            _numFixedUses[TR::RealRegister::NumRegisters];
+   };
+
+}
+
+#endif
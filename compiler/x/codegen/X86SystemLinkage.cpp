@@ -718,13 +718,16 @@ TR::X86SystemLinkage::createEpilogue(TR::Instruction *cursor)
       {
       // No need to do anything
       }
-   else if (allocSize == singleWordSize)
+   else if (allocSize == singleWordSize && !cursor->getNext()->isTailJump())
       {
       TR::RealRegister *realReg = getSingleWordFrameAllocationRegister();
       cursor = new (trHeapMemory()) TR::X86RegInstruction(cursor, TR::InstOpCode::POPReg, realReg, cg());
       }
    else
       {
+      // A tail jump may be going through the single word allocation
+      // register, so its frame is always released with an add
+      //
       TR::InstOpCode::Mnemonic op = (allocSize <= 127) ? TR::InstOpCode::ADDRegImms() : TR::InstOpCode::ADDRegImm4();
       cursor = new (trHeapMemory()) TR::X86RegImmInstruction(cursor, op, espReal, allocSize, cg());
       }
@@ -163,6 +163,16 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return true; }
 
+	/**
+	 * Capture the stack of the thread for a sampled allocation, innermost frame first. The frames
+	 * are opaque to OMR and are handed back to the language through the allocation sampling API.
+	 *
+	 * @param[out] frames receives the frames
+	 * @param[in] maxFrames capacity of frames
+	 * @return the number of frames captured
+	 */
+	uintptr_t captureAllocationStack(void **frames, uintptr_t maxFrames) { return 0; }
+
 	/**
 	 * Acquire shared VM access. Threads must acquire VM access before accessing any OMR internal
 	 * structures such as the heap. Requests for VM access will be blocked if any other thread is
@@ -68,7 +68,8 @@ OMR_Glue_GetMethodDictionaryPropertyNames(void)
  *
  * Iterate from top to bottom. For the top-most stack frame, call omr_ras_sampleStackTraceStart()
  * with the frame's method key. For each successive stack frame, call omr_ras_sampleStackTraceContinue()
- * with the frame's method key.
+ * with the frame's method key. Finally, call omr_ras_sampleStackTraceEnd() so the sample is recorded
+ * if the sampler is running (see omr_ras_startSampler()).
  *
  * The method key must be the same as the key value that was used to insert the method in the method dictionary
  * by omr_ras_insertMethodDictionary(). The context represents a language-specific data structure which
@@ -85,6 +86,8 @@ ex_omr_sampleStack(OMR_VMThread *omrVMThread, const void *context)
 
 	For each successive stack frame:
 		omr_ras_sampleStackTraceContinue(omrVMThread, /* method key from stack frame */);
+
+	omr_ras_sampleStackTraceEnd(omrVMThread);
 #endif
 }
 
@@ -29,6 +29,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/control/OMRRecompilation.cpp  \
     $(JIT_OMR_DIRTY_DIR)/env/ExceptionTable.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/FrontEnd.cpp \
+    $(JIT_OMR_DIRTY_DIR)/infra/AdaptiveBitVector.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/Assert.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/BitVector.cpp \
     $(JIT_OMR_DIRTY_DIR)/infra/Checklist.cpp \
@@ -105,6 +106,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/CatchBlockRemover.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRCFGSimplifier.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/CompactLocals.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/CompileBudget.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/CopyPropagation.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/DataFlowAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/DeadStoreElimination.cpp \
@@ -163,6 +165,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/StructuralAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/Structure.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/SwitchAnalyzer.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/TailRecursionElimination.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/TranslateTable.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/UnionBitVectorAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/UseDefInfo.cpp \
@@ -247,6 +250,17 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/control/CompilationController.cpp \
     $(JIT_OMR_DIRTY_DIR)/control/OMRCompilationStrategy.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/FEInliner.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/BenefitInliner.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/AbsValue.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/AbsOpStack.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/AbsOpArray.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/IDT.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/IDTNode.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/ILAbsInterpreter.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/InliningMethodSummary.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/InliningMethodSummaryCache.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/OMRIDTBuilder.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/InliningProposal.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/Runtime.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/Trampoline.cpp \
     $(JIT_OMR_DIRTY_DIR)/control/CompileMethod.cpp \
@@ -256,6 +270,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/env/OMRCompilerEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/PersistentAllocator.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/IlInjector.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/InlineCache.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRBytecodeBuilder.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRIlBuilder.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRIlType.cpp \
@@ -264,7 +279,12 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderBinaryBuffer.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderBinaryFile.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderTextFile.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderReplay.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderReplayBinaryBuffer.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderReplayBinaryFile.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderReplayTextFile.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRMethodBuilder.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRMethodBuilderReplay.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRThunkBuilder.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRTypeDictionary.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRVirtualMachineOperandArray.cpp \
@@ -277,6 +297,9 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheManager.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheMemorySegment.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheConfig.cpp \
+    $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeMetaDataManager.cpp \
+    $(JIT_OMR_DIRTY_DIR)/runtime/PerfJitDump.cpp \
+    $(JIT_OMR_DIRTY_DIR)/runtime/AOTCache.cpp \
     $(JIT_PRODUCT_DIR)/compile/ResolvedMethod.cpp \
     $(JIT_PRODUCT_DIR)/control/TestJit.cpp \
     $(JIT_PRODUCT_DIR)/env/FrontEnd.cpp \
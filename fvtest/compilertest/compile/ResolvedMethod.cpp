@@ -48,6 +48,9 @@ ResolvedMethod::ResolvedMethod(TR_OpaqueMethodBlock *method)
    _returnType = resolvedMethod->returnIlType();
    _signature = resolvedMethod->getSignature();
    _entryPoint = resolvedMethod->getEntryPoint();
+   _isFastHelper = resolvedMethod->isFastHelper();
+   _isLeafHelper = resolvedMethod->isLeafHelper();
+   _preservedRegisters = resolvedMethod->getPreservedRegisters();
    strncpy(_signatureChars, resolvedMethod->signatureChars(), 62); // TODO: introduce concept of robustness
    }
 
@@ -60,7 +63,10 @@ ResolvedMethod::ResolvedMethod(TR::MethodBuilder *m)
      _returnType(m->getReturnType()),
      _entryPoint(0),
      _signature(0),
-     _ilInjector(static_cast<TR::IlInjector *>(m))
+     _ilInjector(static_cast<TR::IlInjector *>(m)),
+     _isFastHelper(false),
+     _isLeafHelper(false),
+     _preservedRegisters(0)
    {
    computeSignatureChars();
    }
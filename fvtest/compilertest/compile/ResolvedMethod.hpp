@@ -103,7 +103,10 @@ class ResolvedMethod : public ResolvedMethodBase, public Method
         _parmTypes(parmTypes),
         _returnType(returnType),
         _entryPoint(entryPoint),
-        _ilInjector(ilInjector)
+        _ilInjector(ilInjector),
+        _isFastHelper(false),
+        _isLeafHelper(false),
+        _preservedRegisters(0)
       {
       computeSignatureChars();
       }
@@ -139,8 +142,15 @@ class ResolvedMethod : public ResolvedMethodBase, public Method
    TR::DataType                 returnType();
    TR::IlType                  * returnIlType()                             { return _returnType; }
    int32_t                       getNumArgs()                               { return _numParms;}
+   TR::IlType                 ** getParmTypes()                             { return _parmTypes; }
    void                          setEntryPoint(void *ep)                    { _entryPoint = ep; }
    void                        * getEntryPoint()                            { return _entryPoint; }
+   void                          setInjector(TR::IlInjector *ilInjector)    { _ilInjector = ilInjector; }
+
+   void                          setFastHelper(uint64_t preservedRegisters, bool isLeaf) { _isFastHelper = true; _preservedRegisters = preservedRegisters; _isLeafHelper = isLeaf; }
+   bool                          isFastHelper()                             { return _isFastHelper; }
+   bool                          isLeafHelper()                             { return _isLeafHelper; }
+   uint64_t                      getPreservedRegisters()                    { return _preservedRegisters; }
 
    void                          computeSignatureCharsPrimitive();
    void                          computeSignatureChars();
@@ -163,6 +173,10 @@ class ResolvedMethod : public ResolvedMethodBase, public Method
    TR::IlType     * _returnType;
    void           * _entryPoint;
    TR::IlInjector * _ilInjector;
+
+   bool             _isFastHelper;
+   bool             _isLeafHelper;
+   uint64_t         _preservedRegisters;
    };
 
 
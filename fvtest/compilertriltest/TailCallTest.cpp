@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+#include <cstdio>
+
+/**
+ * This Verifier checks that no call is left in the method.
+ *
+ * Compilation is stopped by returning a non-zero return code.
+ */
+class NoCallIlVerifier : public TR::IlVerifier
+   {
+   public:
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         if (iter.currentNode()->getOpCode().isCall())
+            return 1;
+         }
+
+      return 0;
+      }
+   };
+
+class TailCallTest : public TRTest::JitOptTest
+   {
+   public:
+   TailCallTest()
+      {
+      addOptimization(OMR::tailRecursionElimination);
+      }
+   };
+
+/*
+ * sum(n, acc) calls itself in tail position until n reaches zero, so it only
+ * runs this deep once the call has become a loop.
+ */
+TEST_F(TailCallTest, SelfTailCallBecomesLoop) {
+    auto inputTrees = "(method return=Int64 args=[Int64, Int64]                    "
+                      " (block                                                     "
+                      "  (iflcmpne target=recurse (lload parm=0) (lconst 0)))      "
+                      " (block                                                     "
+                      "  (lreturn (lload parm=1)))                                 "
+                      " (block name=recurse                                        "
+                      "  (lreturn                                                  "
+                      "   (lcall address=self args=[Int64, Int64]                  "
+                      "    (lsub (lload parm=0) (lconst 1))                        "
+                      "    (ladd (lload parm=1) (lload parm=0))))))                ";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoCallIlVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Self tail call was not turned into a loop";
+
+    auto entry_point = compiler.getEntryPoint<int64_t (*)(int64_t, int64_t)>();
+    EXPECT_EQ(0, entry_point(0, 0));
+    EXPECT_EQ(55, entry_point(10, 0));
+    EXPECT_EQ(500000500000LL, entry_point(1000000, 0));
+}
+
+/*
+ * Parameters that are passed along unchanged, or that are swapped, must
+ * still see the values of the previous iteration.
+ */
+TEST_F(TailCallTest, SelfTailCallSwapsParameters) {
+    auto inputTrees = "(method return=Int32 args=[Int32, Int32, Int32]             "
+                      " (block                                                     "
+                      "  (ificmpne target=recurse (iload parm=0) (iconst 0)))      "
+                      " (block                                                     "
+                      "  (ireturn (isub (iload parm=1) (iload parm=2))))           "
+                      " (block name=recurse                                        "
+                      "  (ireturn                                                  "
+                      "   (icall address=self args=[Int32, Int32, Int32]           "
+                      "    (isub (iload parm=0) (iconst 1))                        "
+                      "    (iload parm=2)                                          "
+                      "    (iload parm=1)))))                                      ";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoCallIlVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Self tail call was not turned into a loop";
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t, int32_t, int32_t)>();
+    EXPECT_EQ(2, entry_point(0, 5, 3));
+    EXPECT_EQ(-2, entry_point(1, 5, 3));
+    EXPECT_EQ(2, entry_point(100, 5, 3));
+    EXPECT_EQ(-2, entry_point(101, 5, 3));
+}
+
+#if defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && defined(LINUX)
+
+/*
+ * Two compiled methods call each other in tail position.  Each call goes
+ * through a trampoline that only jumps, since neither method's address is
+ * known when the other one is compiled.
+ */
+extern "C" {
+void *tailCallTestEvenTarget = NULL;
+void *tailCallTestOddTarget = NULL;
+int64_t tailCallTestEvenTrampoline(int64_t n);
+int64_t tailCallTestOddTrampoline(int64_t n);
+}
+
+__asm__(
+   ".pushsection .text\n"
+   "tailCallTestEvenTrampoline:\n"
+   "   jmp *tailCallTestEvenTarget(%rip)\n"
+   "tailCallTestOddTrampoline:\n"
+   "   jmp *tailCallTestOddTarget(%rip)\n"
+   ".popsection\n");
+
+static uintptr_t probedFrame = 0;
+
+static int64_t
+probeStack(int64_t result)
+   {
+   probedFrame = reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+   return result;
+   }
+
+static const char *parityTrees =
+   "(method return=Int64 args=[Int64]                                   "
+   " (block                                                             "
+   "  (iflcmpne target=recurse (lload parm=0) (lconst 0)))              "
+   " (block                                                             "
+   "  (lreturn (lcall address=0x%jX args=[Int64] (lconst %d))))         "
+   " (block name=recurse                                                "
+   "  (lreturn                                                          "
+   "   (lcall address=0x%jX args=[Int64]                                "
+   "    (lsub (lload parm=0) (lconst 1))))))                            ";
+
+/*
+ * Every call in the chain is a tail jump, so the stack is no deeper when
+ * the chain ends than it was for the first call however long the chain is.
+ */
+TEST_F(TailCallTest, MutualTailCallsJump) {
+    char evenTrees[1024] = {0};
+    std::snprintf(evenTrees, sizeof(evenTrees), parityTrees,
+                  reinterpret_cast<uintmax_t>(&probeStack), 1,
+                  reinterpret_cast<uintmax_t>(&tailCallTestOddTrampoline));
+    char oddTrees[1024] = {0};
+    std::snprintf(oddTrees, sizeof(oddTrees), parityTrees,
+                  reinterpret_cast<uintmax_t>(&probeStack), 0,
+                  reinterpret_cast<uintmax_t>(&tailCallTestEvenTrampoline));
+
+    auto even = parseString(evenTrees);
+    ASSERT_NOTNULL(even) << "Trees failed to parse\n" << evenTrees;
+    auto odd = parseString(oddTrees);
+    ASSERT_NOTNULL(odd) << "Trees failed to parse\n" << oddTrees;
+
+    Tril::DefaultCompiler evenCompiler(even);
+    ASSERT_EQ(0, evenCompiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << evenTrees;
+    Tril::DefaultCompiler oddCompiler(odd);
+    ASSERT_EQ(0, oddCompiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << oddTrees;
+
+    auto isEven = evenCompiler.getEntryPoint<int64_t (*)(int64_t)>();
+    tailCallTestEvenTarget = reinterpret_cast<void *>(isEven);
+    tailCallTestOddTarget = reinterpret_cast<void *>(oddCompiler.getEntryPoint<int64_t (*)(int64_t)>());
+
+    EXPECT_EQ(1, isEven(0));
+    uintptr_t shallowFrame = probedFrame;
+
+    EXPECT_EQ(1, isEven(1000));
+    EXPECT_EQ(shallowFrame, probedFrame) << "Calls in tail position grew the stack";
+
+    EXPECT_EQ(0, isEven(999));
+    EXPECT_EQ(shallowFrame, probedFrame) << "Calls in tail position grew the stack";
+}
+
+#endif /* defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && defined(LINUX) */
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "CompilerUnitTest.hpp"
+#include "infra/AdaptiveBitVector.hpp"
+#include "infra/BitVector.hpp"
+
+#define NUM_TEST_BITS (ADAPTIVE_BV_BLOCK_BITS * 6)
+
+class AdaptiveBitVectorTest : public TRTest::CompilerUnitTest
+   {
+   protected:
+
+   AdaptiveBitVectorTest() : _seed(12345) {}
+
+   // A small deterministic generator so failures reproduce
+   //
+   int32_t nextRandom(int32_t bound)
+      {
+      _seed = _seed * 1103515245 + 12345;
+      return (int32_t)((_seed >> 8) % (uint32_t)bound);
+      }
+
+   // Fill both vectors with the same bits. Each block gets a density chosen so
+   // that both the array and the bitmap representation are exercised.
+   //
+   void fill(TR_AdaptiveBitVector &abv, TR_BitVector &bv)
+      {
+      for (int32_t block = 0; block < NUM_TEST_BITS / ADAPTIVE_BV_BLOCK_BITS; block++)
+         {
+         int32_t count = 0;
+         switch (nextRandom(4))
+            {
+            case 0: count = 0; break;
+            case 1: count = nextRandom(ADAPTIVE_BV_ARRAY_LIMIT / 2); break;
+            case 2: count = ADAPTIVE_BV_ARRAY_LIMIT / 2 + nextRandom(ADAPTIVE_BV_ARRAY_LIMIT); break;
+            case 3: count = nextRandom(ADAPTIVE_BV_BLOCK_BITS); break;
+            }
+         for (int32_t i = 0; i < count; i++)
+            {
+            int32_t bit = block * ADAPTIVE_BV_BLOCK_BITS + nextRandom(ADAPTIVE_BV_BLOCK_BITS);
+            abv.set(bit);
+            bv.set(bit);
+            }
+         }
+      }
+
+   void expectSame(TR_AdaptiveBitVector &abv, TR_BitVector &bv)
+      {
+      TR_AdaptiveBitVectorIterator abvi(abv);
+      TR_BitVectorIterator bvi(bv);
+      while (abvi.hasMoreElements() && bvi.hasMoreElements())
+         ASSERT_EQ(bvi.getNextElement(), abvi.getNextElement());
+      EXPECT_FALSE(abvi.hasMoreElements());
+      EXPECT_FALSE(bvi.hasMoreElements());
+      EXPECT_EQ(bv.elementCount(), abv.elementCount());
+      EXPECT_EQ(bv.isEmpty(), abv.isEmpty());
+      EXPECT_EQ(bv.hasMoreThanOneElement(), abv.hasMoreThanOneElement());
+      }
+
+   uint32_t _seed;
+   };
+
+TEST_F(AdaptiveBitVectorTest, SetGetReset)
+   {
+   TR_AdaptiveBitVector abv(region());
+   EXPECT_TRUE(abv.isEmpty());
+
+   // Grow one block past the array limit and back down again
+   //
+   for (int32_t i = 0; i <= ADAPTIVE_BV_ARRAY_LIMIT; i++)
+      abv.set(ADAPTIVE_BV_BLOCK_BITS + 2 * i);
+   abv.set(100 * ADAPTIVE_BV_BLOCK_BITS);
+   EXPECT_EQ(ADAPTIVE_BV_ARRAY_LIMIT + 2, abv.elementCount());
+   EXPECT_EQ(2, abv.numNonZeroChunks());
+   EXPECT_EQ(1, abv.get(ADAPTIVE_BV_BLOCK_BITS + 2 * ADAPTIVE_BV_ARRAY_LIMIT));
+   EXPECT_EQ(0, abv.get(ADAPTIVE_BV_BLOCK_BITS + 1));
+   EXPECT_EQ(0, abv.get(0));
+
+   for (int32_t i = 0; i <= ADAPTIVE_BV_ARRAY_LIMIT; i++)
+      abv.reset(ADAPTIVE_BV_BLOCK_BITS + 2 * i);
+   EXPECT_EQ(1, abv.elementCount());
+   EXPECT_EQ(1, abv.numNonZeroChunks());
+   EXPECT_FALSE(abv.hasMoreThanOneElement());
+
+   abv.reset(100 * ADAPTIVE_BV_BLOCK_BITS);
+   EXPECT_TRUE(abv.isEmpty());
+   }
+
+TEST_F(AdaptiveBitVectorTest, Ranges)
+   {
+   TR_AdaptiveBitVector abv(region());
+   TR_BitVector bv(NUM_TEST_BITS, region());
+
+   abv.setAll(10, 3 * ADAPTIVE_BV_BLOCK_BITS + 17);
+   bv.setAll(10, 3 * ADAPTIVE_BV_BLOCK_BITS + 17);
+   expectSame(abv, bv);
+
+   abv.resetAll(ADAPTIVE_BV_BLOCK_BITS - 5, 2 * ADAPTIVE_BV_BLOCK_BITS + 100);
+   bv.resetAll(ADAPTIVE_BV_BLOCK_BITS - 5, 2 * ADAPTIVE_BV_BLOCK_BITS + 100);
+   expectSame(abv, bv);
+
+   abv.setAll(70);
+   bv.setAll(70);
+   expectSame(abv, bv);
+
+   abv.resetAll(NUM_TEST_BITS);
+   EXPECT_TRUE(abv.isEmpty());
+   }
+
+TEST_F(AdaptiveBitVectorTest, MatchesBitVector)
+   {
+   for (int32_t round = 0; round < 20; round++)
+      {
+      TR_AdaptiveBitVector a(region()), b(region());
+      TR_BitVector ra(NUM_TEST_BITS, region()), rb(NUM_TEST_BITS, region());
+      fill(a, ra);
+      fill(b, rb);
+      expectSame(a, ra);
+
+      EXPECT_EQ(ra.intersects(rb), a.intersects(b));
+      EXPECT_EQ(ra == rb, a == b);
+
+      TR_AdaptiveBitVector c(region());
+      TR_BitVector rc(NUM_TEST_BITS, region());
+      switch (round % 3)
+         {
+         case 0:
+            c = a; c |= b;
+            rc = ra; rc |= rb;
+            break;
+         case 1:
+            c = a; c &= b;
+            rc = ra; rc &= rb;
+            break;
+         case 2:
+            c = a; c -= b;
+            rc = ra; rc -= rb;
+            break;
+         }
+      expectSame(c, rc);
+
+      // Reassigning reuses the storage of the previous contents
+      //
+      c = b;
+      EXPECT_TRUE(c == b);
+      expectSame(c, rb);
+
+      // Mixed operations with plain bit vectors
+      //
+      TR_AdaptiveBitVector d(region());
+      d |= rb;
+      expectSame(d, rb);
+      d -= ra;
+      TR_BitVector rd(NUM_TEST_BITS, region());
+      rd = rb;
+      rd -= ra;
+      expectSame(d, rd);
+
+      TR_BitVector re(NUM_TEST_BITS, region());
+      re = ra;
+      re &= b;
+      TR_BitVector rf(NUM_TEST_BITS, region());
+      rf = ra;
+      rf &= rb;
+      EXPECT_TRUE(re == rf);
+      }
+   }
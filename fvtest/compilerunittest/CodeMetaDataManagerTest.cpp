@@ -0,0 +1,285 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "CompilerUnitTest.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "runtime/CodeMetaDataManager.hpp"
+#include "runtime/CodeMetaDataManager_inlines.hpp"
+#include "runtime/CodeMetaDataPOD.hpp"
+
+// The code caches are never dereferenced, so any address range will do
+//
+#define NUM_CODE_CACHES 4
+#define CODE_CACHE_BASE ((uintptr_t)0x10000000)
+#define CODE_CACHE_SIZE ((uintptr_t)0x100000)
+#define METHOD_SIZE     ((uintptr_t)0x100)
+#define METHODS_PER_CACHE (CODE_CACHE_SIZE / METHOD_SIZE)
+
+class TestCodeMetaDataManager : public TR::CodeMetaDataManager
+   {
+   public:
+   using TR::CodeMetaDataManager::addCodeRange;
+   using TR::CodeMetaDataManager::removeCodeRange;
+   using TR::CodeMetaDataManager::enterLockFreeReader;
+   using TR::CodeMetaDataManager::exitLockFreeReader;
+
+   bool hasRetiredRangeIndexes() { return _retiredRangeIndexes != NULL || _drainingRangeIndexes != NULL; }
+   };
+
+class CodeMetaDataManagerTest : public TRTest::CompilerUnitTest
+   {
+   protected:
+
+   CodeMetaDataManagerTest() :
+      _methods(NUM_CODE_CACHES * METHODS_PER_CACHE)
+      {
+      for (uintptr_t i = 0; i < NUM_CODE_CACHES; i++)
+         _manager.addCodeRange(cacheStart(i), cacheStart(i) + CODE_CACHE_SIZE);
+
+      // Methods leave a gap at their end so some PCs belong to no method
+      //
+      for (size_t i = 0; i < _methods.size(); i++)
+         {
+         _methods[i].startPC = CODE_CACHE_BASE + (i / METHODS_PER_CACHE) * 2 * CODE_CACHE_SIZE + (i % METHODS_PER_CACHE) * METHOD_SIZE;
+         _methods[i].endPC = _methods[i].startPC + METHOD_SIZE - 0x10;
+         }
+      }
+
+   ~CodeMetaDataManagerTest()
+      {
+      _manager.reclaimRetiredRangeIndexes();
+      }
+
+   // Code caches are not adjacent, so PCs between them belong to no code cache
+   //
+   static uintptr_t cacheStart(uintptr_t i) { return CODE_CACHE_BASE + i * 2 * CODE_CACHE_SIZE; }
+
+   TestCodeMetaDataManager _manager;
+   std::vector<TR::MethodMetaDataPOD> _methods;
+   };
+
+TEST_F(CodeMetaDataManagerTest, LockFreeLookupMatchesHashTable)
+   {
+   for (size_t i = 0; i < _methods.size(); i += 3)
+      ASSERT_TRUE(_manager.insertMetaData(&_methods[i]));
+   for (size_t i = 0; i < _methods.size(); i += 6)
+      ASSERT_TRUE(_manager.removeMetaData(&_methods[i]));
+
+   for (uintptr_t pc = CODE_CACHE_BASE; pc < cacheStart(NUM_CODE_CACHES); pc += 0x8)
+      {
+      bool inCodeCache = ((pc - CODE_CACHE_BASE) / CODE_CACHE_SIZE) % 2 == 0;
+      const TR::MethodMetaDataPOD *expected = inCodeCache ? _manager.findMetaDataForPC(pc) : NULL;
+      ASSERT_EQ(expected, _manager.findMetaDataForPCLockFree(pc)) << "pc " << std::hex << pc;
+      }
+
+   EXPECT_EQ(&_methods[3], _manager.findMetaDataForPCLockFree(_methods[3].startPC));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPCLockFree(_methods[3].endPC));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPCLockFree(_methods[6].startPC));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPCLockFree(CODE_CACHE_BASE - 1));
+   }
+
+/**
+ * Measures lookups per second on both paths while another thread keeps
+ * inserting and removing metadata, as compilations and unloading would.
+ *
+ * The hash table path has to hold the monitor, here a mutex, against the
+ * inserting thread, while the lock-free path only serializes the writers.
+ * Every other method stays registered for the whole run and lookups of those
+ * must always find it.
+ */
+TEST_F(CodeMetaDataManagerTest, LookupThroughputWhileInserting)
+   {
+   for (size_t i = 0; i < _methods.size(); i += 2)
+      ASSERT_TRUE(_manager.insertMetaData(&_methods[i]));
+
+   std::mutex monitor;
+   const std::chrono::milliseconds duration(250);
+   double lookupsPerSecond[2];
+   double updatesPerSecond[2];
+
+   for (int lockFree = 0; lockFree < 2; lockFree++)
+      {
+      std::atomic<bool> done(false);
+      std::atomic<uint64_t> updates(0);
+
+      std::thread inserter([&]()
+         {
+         size_t next = 1;
+         while (!done.load())
+            {
+            std::lock_guard<std::mutex> lock(monitor);
+            _manager.insertMetaData(&_methods[next]);
+            _manager.removeMetaData(&_methods[next]);
+            next = (next + 2) % _methods.size();
+            updates++;
+            }
+         });
+
+      uint64_t lookups = 0;
+      uint32_t seed = 12345;
+      bool allFound = true;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      std::chrono::steady_clock::time_point now = start;
+      while (now - start < duration)
+         {
+         for (int i = 0; i < 1024; i++)
+            {
+            seed = seed * 1103515245 + 12345;
+            TR::MethodMetaDataPOD *method = &_methods[((seed >> 8) % (_methods.size() / 2)) * 2];
+            uintptr_t pc = method->startPC + (seed & 0x7f);
+            const TR::MethodMetaDataPOD *found;
+            if (lockFree)
+               {
+               found = _manager.findMetaDataForPCLockFree(pc);
+               }
+            else
+               {
+               std::lock_guard<std::mutex> lock(monitor);
+               found = _manager.findMetaDataForPC(pc);
+               }
+            allFound = allFound && found == method;
+            }
+         lookups += 1024;
+         now = std::chrono::steady_clock::now();
+         }
+
+      done = true;
+      inserter.join();
+      EXPECT_TRUE(allFound);
+
+      // With the readers done, whatever the inserter retired while they were
+      // searching can go
+      //
+      {
+      std::lock_guard<std::mutex> lock(monitor);
+      EXPECT_TRUE(_manager.reclaimRetiredRangeIndexes());
+      EXPECT_FALSE(_manager.hasRetiredRangeIndexes());
+      }
+
+      double seconds = std::chrono::duration<double>(now - start).count();
+      lookupsPerSecond[lockFree] = lookups / seconds;
+      updatesPerSecond[lockFree] = updates.load() / seconds;
+      }
+
+   RecordProperty("hashTableLookupsPerSecond", (int)lookupsPerSecond[0]);
+   RecordProperty("lockFreeLookupsPerSecond", (int)lookupsPerSecond[1]);
+   RecordProperty("hashTableUpdatesPerSecond", (int)updatesPerSecond[0]);
+   RecordProperty("lockFreeUpdatesPerSecond", (int)updatesPerSecond[1]);
+   }
+
+TEST_F(CodeMetaDataManagerTest, ReplacedIndexesAreFreedWithoutReaders)
+   {
+   for (size_t i = 0; i < _methods.size(); i += 5)
+      {
+      ASSERT_TRUE(_manager.insertMetaData(&_methods[i]));
+      EXPECT_FALSE(_manager.hasRetiredRangeIndexes());
+      }
+   for (size_t i = 0; i < _methods.size(); i += 10)
+      {
+      ASSERT_TRUE(_manager.removeMetaData(&_methods[i]));
+      EXPECT_FALSE(_manager.hasRetiredRangeIndexes());
+      }
+   EXPECT_EQ(&_methods[5], _manager.findMetaDataForPCLockFree(_methods[5].startPC));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPCLockFree(_methods[10].startPC));
+   }
+
+TEST_F(CodeMetaDataManagerTest, ReplacedIndexesAreFreedWhileNewerReadersAreActive)
+   {
+   ASSERT_TRUE(_manager.insertMetaData(&_methods[0]));
+
+   uintptr_t olderReader = _manager.enterLockFreeReader();
+   ASSERT_TRUE(_manager.insertMetaData(&_methods[1]));
+   EXPECT_TRUE(_manager.hasRetiredRangeIndexes()) << "Freed under a reader that may be searching it";
+
+   // A reader entering after the replacement can only see the new index
+   //
+   uintptr_t newerReader = _manager.enterLockFreeReader();
+   EXPECT_EQ(&_methods[1], _manager.findMetaDataForPCLockFree(_methods[1].startPC));
+
+   _manager.exitLockFreeReader(olderReader);
+   EXPECT_TRUE(_manager.reclaimRetiredRangeIndexes());
+   EXPECT_FALSE(_manager.hasRetiredRangeIndexes());
+
+   // Indexes retired now wait for the newer reader only
+   //
+   ASSERT_TRUE(_manager.insertMetaData(&_methods[2]));
+   EXPECT_TRUE(_manager.hasRetiredRangeIndexes());
+   _manager.exitLockFreeReader(newerReader);
+   EXPECT_TRUE(_manager.reclaimRetiredRangeIndexes());
+   EXPECT_FALSE(_manager.hasRetiredRangeIndexes());
+   }
+
+TEST_F(CodeMetaDataManagerTest, RemovedCodeRangeIsNotSearched)
+   {
+   ASSERT_TRUE(_manager.insertMetaData(&_methods[0]));
+   ASSERT_TRUE(_manager.insertMetaData(&_methods[METHODS_PER_CACHE]));
+
+   ASSERT_TRUE(_manager.removeCodeRange(cacheStart(0), cacheStart(0) + CODE_CACHE_SIZE));
+   EXPECT_FALSE(_manager.removeCodeRange(cacheStart(0), cacheStart(0) + CODE_CACHE_SIZE));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPCLockFree(_methods[0].startPC));
+   EXPECT_EQ(&_methods[METHODS_PER_CACHE], _manager.findMetaDataForPC(_methods[METHODS_PER_CACHE].startPC));
+
+   // A new code cache may be mapped at the same address
+   //
+   ASSERT_TRUE(_manager.addCodeRange(cacheStart(0), cacheStart(0) + CODE_CACHE_SIZE) != NULL);
+   EXPECT_EQ(NULL, _manager.findMetaDataForPC(_methods[0].startPC));
+   EXPECT_EQ(NULL, _manager.findMetaDataForPCLockFree(_methods[0].startPC));
+   }
+
+TEST_F(CodeMetaDataManagerTest, ReclaimedBodyIsUnregistered)
+   {
+   ASSERT_TRUE(TR::CodeMetaDataManager::initializeCodeMetaDataManager());
+   TR::CodeMetaDataManager *metaDataManager = TR::CodeMetaDataManager::codeMetaDataManager();
+   TR::CodeCacheManager *codeCacheManager = TR::CodeCacheManager::instance();
+
+   int32_t numReserved;
+   TR::CodeCache *codeCache = codeCacheManager->reserveCodeCache(false, METHOD_SIZE, 0, &numReserved);
+   ASSERT_TRUE(codeCache != NULL);
+   uint8_t *coldCode;
+   uint8_t *startPC = codeCacheManager->allocateCodeMemory(METHOD_SIZE, 0, &codeCache, &coldCode, false);
+   codeCacheManager->unreserveCodeCache(codeCache);
+   ASSERT_TRUE(startPC != NULL);
+
+   // The code cache is destroyed with the JIT at the end of the test
+   //
+   ASSERT_TRUE(metaDataManager->addCodeCache(codeCache) != NULL);
+
+   TR::MethodMetaDataPOD metaData;
+   metaData.startPC = (uintptr_t)startPC;
+   metaData.endPC = metaData.startPC + METHOD_SIZE;
+   EXPECT_TRUE(metaDataManager->insertMetaData(&metaData));
+   EXPECT_EQ(&metaData, metaDataManager->findMetaDataForPC(metaData.startPC));
+
+   EXPECT_TRUE(codeCacheManager->retireMethodBody(startPC, NULL, &metaData));
+   EXPECT_EQ(&metaData, metaDataManager->findMetaDataForPC(metaData.startPC)) << "Unregistered before being reclaimed";
+   EXPECT_EQ(1, codeCacheManager->reclaimRetiredMethodBodies());
+   EXPECT_EQ(NULL, metaDataManager->findMetaDataForPC(metaData.startPC));
+   EXPECT_EQ(NULL, metaDataManager->findMetaDataForPCLockFree(metaData.startPC + METHOD_SIZE / 2));
+
+   EXPECT_TRUE(metaDataManager->removeCodeCache(codeCache));
+   }
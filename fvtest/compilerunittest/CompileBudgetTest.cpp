@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdexcept>
+#include "CompilerUnitTest.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "optimizer/CompileBudget.hpp"
+#include "optimizer/OptimizationManager.hpp"
+#include "optimizer/Optimizer.hpp"
+
+class CompileBudgetTest : public TRTest::CompilerUnitTest
+   {
+   protected:
+
+   TR::OptimizationManager *manager(OMR::Optimizations optNum)
+      {
+      return _optimizer->getOptimization(optNum);
+      }
+
+   void expectDecisions(TR::CompileBudget &budget, TR::CompileBudget::Decision expensiveDecision)
+      {
+      TR::CompileBudget::Decision versionerDecision =
+         expensiveDecision == TR::CompileBudget::Run ? TR::CompileBudget::Run : TR::CompileBudget::Skip;
+      EXPECT_EQ(expensiveDecision, budget.check(manager(OMR::globalValuePropagation)));
+      EXPECT_EQ(expensiveDecision, budget.check(manager(OMR::partialRedundancyElimination)));
+      EXPECT_EQ(versionerDecision, budget.check(manager(OMR::loopVersioner)));
+      }
+   };
+
+TEST_F(CompileBudgetTest, InactiveWithoutBudget)
+   {
+   TR::CompileBudget budget(&_comp);
+   EXPECT_FALSE(budget.isActive());
+   expectDecisions(budget, TR::CompileBudget::Run);
+   }
+
+TEST_F(CompileBudgetTest, CheaperAlternatives)
+   {
+   EXPECT_EQ(OMR::localValuePropagation, TR::CompileBudget::cheaperAlternative(OMR::globalValuePropagation));
+   EXPECT_EQ(OMR::localCSE, TR::CompileBudget::cheaperAlternative(OMR::partialRedundancyElimination));
+   EXPECT_EQ(OMR::endOpts, TR::CompileBudget::cheaperAlternative(OMR::loopVersioner));
+   }
+
+TEST_F(CompileBudgetTest, SpentTimeBudgetDowngradesOrSkips)
+   {
+   _options.setCompileTimeBudget(1);
+   TR::CompileBudget budget(&_comp);
+   ASSERT_TRUE(budget.isActive());
+
+   uint64_t start = TR::Compiler->vm.getUSecClock();
+   while (TR::Compiler->vm.getUSecClock() - start < 2000)
+      ;
+   expectDecisions(budget, TR::CompileBudget::Downgrade);
+   }
+
+TEST_F(CompileBudgetTest, EstimateBeyondRemainingTimeDowngradesOrSkips)
+   {
+   TR::Node::iconst(1);
+   ASSERT_LT(0, (int32_t)_comp.getNodeCount());
+
+   _options.setCompileTimeBudget(60 * 1000);
+   TR::CompileBudget budget(&_comp);
+   expectDecisions(budget, TR::CompileBudget::Run);
+
+   // An ordinary pass that took ten seconds per node makes any of the
+   // expensive ones take longer than the minute of the budget
+   //
+   budget.endPass(OMR::localCSE, budget.startPass() - 10 * 1000 * 1000, 1);
+   expectDecisions(budget, TR::CompileBudget::Downgrade);
+   }
+
+TEST_F(CompileBudgetTest, StackRegionsCountAgainstMemoryBudget)
+   {
+   size_t allocated = region().segmentProviderBytesAllocated();
+   _options.setCompileMemoryBudget((int32_t)(allocated / 1024) + 256);
+   TR::CompileBudget budget(&_comp);
+   expectDecisions(budget, TR::CompileBudget::Run);
+
+   TR::StackMemoryRegion stackMemoryRegion(*_comp.trMemory());
+   stackMemoryRegion.allocate(1 << 20);
+   expectDecisions(budget, TR::CompileBudget::Downgrade);
+   }
+
+TEST_F(CompileBudgetTest, ActiveScopeEndsOnException)
+   {
+   TR::CompileBudget budget(&_comp);
+   TR::CompileBudget *activeBudget = NULL;
+   try
+      {
+      TR::CompileBudget::ActiveScope budgeting(activeBudget, &budget);
+      EXPECT_EQ(&budget, activeBudget);
+      throw std::runtime_error("optimizer run failed");
+      }
+   catch (const std::runtime_error &)
+      {
+      }
+   EXPECT_TRUE(NULL == activeBudget);
+   }
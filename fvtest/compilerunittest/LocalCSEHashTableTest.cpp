@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <vector>
+#include "CompilerUnitTest.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "optimizer/LocalCSE.hpp"
+
+class LocalCSEHashTableTest : public TRTest::CompilerUnitTest
+   {
+   protected:
+
+   typedef OMR::LocalCSE::HashTable HashTable;
+
+   LocalCSEHashTableTest() : _table(region())
+      {
+      for (int32_t i = 0; i < 8; i++)
+         _nodes.push_back(TR::Node::iconst(i));
+      }
+
+   std::vector<TR::Node *> contents(int32_t key)
+      {
+      std::vector<TR::Node *> nodes;
+      for (HashTable::Cursor cursor(_table, key); cursor.isValid(); cursor.advance())
+         nodes.push_back(cursor.getNode());
+      return nodes;
+      }
+
+   /**
+    * Keys whose probe sequences start at the same slot as \p key in the
+    * initial slot array of 64 slots, found with the same Fibonacci hash.
+    */
+   static std::vector<int32_t> collidingKeys(int32_t key, size_t count)
+      {
+      std::vector<int32_t> keys(1, key);
+      uint32_t slot = ((uint32_t)key * 2654435769u) >> (32 - 6);
+      for (int32_t other = key + 1; keys.size() < count; other++)
+         {
+         if ((((uint32_t)other * 2654435769u) >> (32 - 6)) == slot)
+            keys.push_back(other);
+         }
+      return keys;
+      }
+
+   HashTable _table;
+   std::vector<TR::Node *> _nodes;
+   };
+
+TEST_F(LocalCSEHashTableTest, EmptyTable)
+   {
+   EXPECT_TRUE(NULL == _table.getLast(3));
+   EXPECT_TRUE(contents(3).empty());
+   _table.removeAll(3);
+   EXPECT_TRUE(contents(3).empty());
+   }
+
+TEST_F(LocalCSEHashTableTest, NodesInInsertionOrder)
+   {
+   _table.add(7, _nodes[0]);
+   _table.add(7, _nodes[1]);
+   _table.add(7, _nodes[2]);
+
+   std::vector<TR::Node *> expected = { _nodes[0], _nodes[1], _nodes[2] };
+   EXPECT_EQ(expected, contents(7));
+   EXPECT_EQ(_nodes[2], _table.getLast(7));
+   EXPECT_TRUE(contents(8).empty());
+   }
+
+TEST_F(LocalCSEHashTableTest, CollidingKeys)
+   {
+   std::vector<int32_t> keys = collidingKeys(5, 4);
+   for (size_t i = 0; i < keys.size(); i++)
+      {
+      _table.add(keys[i], _nodes[i]);
+      _table.add(keys[i], _nodes[i + 4]);
+      }
+
+   for (size_t i = 0; i < keys.size(); i++)
+      {
+      std::vector<TR::Node *> expected = { _nodes[i], _nodes[i + 4] };
+      EXPECT_EQ(expected, contents(keys[i])) << "key " << keys[i];
+      EXPECT_EQ(_nodes[i + 4], _table.getLast(keys[i]));
+      }
+
+   // Keys probed past the emptied slot are still found
+   //
+   _table.removeAll(keys[0]);
+   EXPECT_TRUE(contents(keys[0]).empty());
+   EXPECT_TRUE(NULL == _table.getLast(keys[0]));
+   for (size_t i = 1; i < keys.size(); i++)
+      EXPECT_EQ(_nodes[i + 4], _table.getLast(keys[i])) << "key " << keys[i];
+
+   _table.add(keys[0], _nodes[3]);
+   EXPECT_EQ(std::vector<TR::Node *>(1, _nodes[3]), contents(keys[0]));
+   }
+
+TEST_F(LocalCSEHashTableTest, GrowthKeepsNodes)
+   {
+   const int32_t numKeys = 1000;
+   for (int32_t key = 0; key < numKeys; key++)
+      {
+      _table.add(key * 3, _nodes[key % 8]);
+      _table.add(key * 3, _nodes[(key + 1) % 8]);
+      }
+
+   for (int32_t key = 0; key < numKeys; key++)
+      {
+      std::vector<TR::Node *> expected = { _nodes[key % 8], _nodes[(key + 1) % 8] };
+      ASSERT_EQ(expected, contents(key * 3)) << "key " << key * 3;
+      }
+
+   // Growing again drops the slots of the emptied keys
+   //
+   for (int32_t key = 0; key < numKeys; key += 2)
+      _table.removeAll(key * 3);
+   for (int32_t key = numKeys; key < 3 * numKeys; key++)
+      _table.add(key * 3, _nodes[key % 8]);
+
+   for (int32_t key = 0; key < numKeys; key++)
+      {
+      if (key % 2 == 0)
+         ASSERT_TRUE(contents(key * 3).empty()) << "key " << key * 3;
+      else
+         ASSERT_EQ(_nodes[(key + 1) % 8], _table.getLast(key * 3)) << "key " << key * 3;
+      }
+   for (int32_t key = numKeys; key < 3 * numKeys; key++)
+      ASSERT_EQ(std::vector<TR::Node *>(1, _nodes[key % 8]), contents(key * 3)) << "key " << key * 3;
+   }
+
+TEST_F(LocalCSEHashTableTest, CursorRemove)
+   {
+   for (int32_t i = 0; i < 5; i++)
+      _table.add(11, _nodes[i]);
+
+   // Remove the first, a middle and the last node in one walk
+   //
+   for (HashTable::Cursor cursor(_table, 11); cursor.isValid();)
+      {
+      TR::Node *node = cursor.getNode();
+      if (node == _nodes[0] || node == _nodes[2] || node == _nodes[4])
+         cursor.remove();
+      else
+         cursor.advance();
+      }
+
+   std::vector<TR::Node *> expected = { _nodes[1], _nodes[3] };
+   EXPECT_EQ(expected, contents(11));
+   EXPECT_EQ(_nodes[3], _table.getLast(11));
+
+   // Nodes added afterwards follow the new last node
+   //
+   _table.add(11, _nodes[5]);
+   expected.push_back(_nodes[5]);
+   EXPECT_EQ(expected, contents(11));
+   EXPECT_EQ(_nodes[5], _table.getLast(11));
+   }
+
+TEST_F(LocalCSEHashTableTest, Clear)
+   {
+   std::vector<int32_t> keys = collidingKeys(2, 3);
+   for (size_t i = 0; i < keys.size(); i++)
+      _table.add(keys[i], _nodes[i]);
+
+   _table.clear();
+   for (size_t i = 0; i < keys.size(); i++)
+      EXPECT_TRUE(contents(keys[i]).empty()) << "key " << keys[i];
+
+   _table.add(keys[2], _nodes[6]);
+   EXPECT_EQ(std::vector<TR::Node *>(1, _nodes[6]), contents(keys[2]));
+   EXPECT_TRUE(NULL == _table.getLast(keys[0]));
+   }
@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AbsInterpreterTest.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "il/Block.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "optimizer/BenefitInliner.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/abstractinterpreter/ILAbsInterpreter.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
+
+class CallSiteCounter : public TR::AbsVisitor {
+public:
+    CallSiteCounter() : _numCallSites(0), _lastArgument(NULL) {}
+
+    virtual void visitCallSite(TR_CallSite* callSite, TR::Block* callBlock, TR::vector<TR::AbsValue*, TR::Region&>* arguments) {
+        _numCallSites++;
+        _lastArgument = arguments->size() > 0 ? arguments->at(0) : NULL;
+    }
+
+    int32_t _numCallSites;
+    TR::AbsValue* _lastArgument;
+};
+
+/**
+ * Builds methods of an Int32 and an Address parameter the way JitBuilder
+ * does, one block at a time, and interprets their trees.
+ */
+class ILAbsInterpreterTest : public TRTest::AbsInterpreterTest {
+public:
+    ILAbsInterpreterTest() : AbsInterpreterTest() {
+        TR::IlType** parmTypes = static_cast<TR::IlType**>(_comp.trMemory()->allocateHeapMemory(2 * sizeof(TR::IlType*)));
+        parmTypes[0] = _types.Int32;
+        parmTypes[1] = _types.Address;
+        TR::ResolvedMethod* method = new (region()) TR::ResolvedMethod("compunittest", "0", "callee", 2, parmTypes, _types.Int32, NULL, NULL);
+        _callee = TR::ResolvedMethodSymbol::create(_comp.trHeapMemory(), method, &_comp);
+
+        TR::CFG* cfg = new (region()) TR::CFG(&_comp, _callee, region());
+        cfg->setStartAndEnd(new (_comp.trHeapMemory()) TR::Block(_comp.trMemory()), new (_comp.trHeapMemory()) TR::Block(_comp.trMemory()));
+        _callee->setFlowGraph(cfg);
+
+        TR::IlType** leafParmTypes = static_cast<TR::IlType**>(_comp.trMemory()->allocateHeapMemory(sizeof(TR::IlType*)));
+        leafParmTypes[0] = _types.Int32;
+        _leaf = new (region()) TR::ResolvedMethod("compunittest", "0", "leaf", 1, leafParmTypes, _types.NoType, (void*)0x1000, NULL);
+    }
+
+    TR::CFG* cfg() { return _callee->getFlowGraph(); }
+
+    TR::Block* createBlocks(int32_t num) {
+        for (int32_t b = 0; b < num; b++) {
+            _blocks[b] = TR::Block::createEmptyBlock(&_comp);
+            cfg()->addNode(_blocks[b]);
+            if (b > 0)
+                _blocks[b-1]->getExit()->join(_blocks[b]->getEntry());
+        }
+        cfg()->addEdge(cfg()->getStart(), _blocks[0]);
+        _callee->setFirstTreeTop(_blocks[0]->getEntry());
+        return _blocks[0];
+    }
+
+    TR::Node* parameter(int32_t slot, TR::DataType dt) {
+        return TR::Node::createLoad(_comp.getSymRefTab()->findOrCreateAutoSymbol(_callee, slot, dt, true, false, true));
+    }
+
+    void append(int32_t b, TR::Node* node) {
+        if (!node->getOpCode().isTreeTop())
+            node = TR::Node::create(TR::treetop, 1, node);
+        _blocks[b]->append(TR::TreeTop::create(&_comp, node));
+    }
+
+    void ifjump(int32_t b, TR::ILOpCodes op, TR::Node* first, TR::Node* second, int32_t target) {
+        append(b, TR::Node::createif(op, first, second, _blocks[target]->getEntry()));
+        cfg()->addEdge(_blocks[b], _blocks[target]);
+        cfg()->addEdge(_blocks[b], _blocks[b+1]);
+    }
+
+    void fallThrough(int32_t b) {
+        cfg()->addEdge(_blocks[b], _blocks[b+1]);
+    }
+
+    void callLeaf(int32_t b, TR::Node* argument) {
+        TR::SymbolReference* symRef = _comp.getSymRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, _leaf);
+        TR::Node* callNode = TR::Node::createWithSymRef(TR::call, 1, symRef);
+        callNode->setAndIncChild(0, argument);
+        append(b, callNode);
+    }
+
+    void returnZero(int32_t b) {
+        append(b, TR::Node::create(TR::ireturn, 1, TR::Node::iconst(0)));
+        cfg()->addEdge(_blocks[b], cfg()->getEnd());
+    }
+
+    TR::vector<TR::AbsValue*, TR::Region&>* arguments(TR::AbsValue* first, TR::AbsValue* second) {
+        TR::vector<TR::AbsValue*, TR::Region&>* args = new (region()) TR::vector<TR::AbsValue*, TR::Region&>(region());
+        args->push_back(first);
+        args->push_back(second);
+        return args;
+    }
+
+    TR::AbsValue* intValue(int32_t low, int32_t high) {
+        return new (region()) TR::AbsVPValue(vp(), TR::VPIntRange::create(vp(), low, high), TR::Int32);
+    }
+
+    TR::AbsValue* nullValue() {
+        return new (region()) TR::AbsVPValue(vp(), TR::VPNullObject::create(vp()), TR::Address);
+    }
+
+    TR::InliningMethodSummary* summarize(TR::ILAbsInterpreter& interpreter) {
+        const TR::vector<TR::PotentialOptimizationRecord, TR::Region&>& records = interpreter.getPotentialOptimizations();
+        return TR::ILAbsInterpreter::createInliningMethodSummary(records.empty() ? NULL : &records[0], records.size(), vp(), region());
+    }
+
+protected:
+    TR::ResolvedMethodSymbol* _callee;
+    TR::ResolvedMethod* _leaf;
+    TR::Block* _blocks[4];
+};
+
+TEST_F(ILAbsInterpreterTest, testNoTrees) {
+    TR::ILAbsInterpreter interpreter(_callee, vp(), region(), &_comp);
+    ASSERT_FALSE(interpreter.interpret(NULL, NULL));
+}
+
+TEST_F(ILAbsInterpreterTest, testBranchOnParameters) {
+    // if (x < 10) goto 3; if (p == NULL) goto 3; return 0
+    createBlocks(3);
+    ifjump(0, TR::ificmplt, parameter(0, TR::Int32), TR::Node::iconst(10), 2);
+    ifjump(1, TR::ifacmpeq, parameter(1, TR::Address), TR::Node::aconst(0), 2);
+    returnZero(2);
+
+    TR::ILAbsInterpreter interpreter(_callee, vp(), region(), &_comp);
+    ASSERT_TRUE(interpreter.interpret(NULL, NULL));
+    ASSERT_EQ(4, interpreter.getPotentialOptimizations().size());
+
+    TR::InliningMethodSummary* summary = summarize(interpreter);
+    ASSERT_EQ(1, summary->testArgument(intValue(5, 5), 0));
+    ASSERT_EQ(1, summary->testArgument(intValue(10, 100), 0));
+    ASSERT_EQ(0, summary->testArgument(intValue(5, 15), 0));
+    ASSERT_EQ(1, summary->testArgument(nullValue(), 1));
+    ASSERT_EQ(0, summary->testArgument(new (region()) TR::AbsVPValue(vp(), NULL, TR::Address), 1));
+}
+
+TEST_F(ILAbsInterpreterTest, testBranchOnComparison) {
+    // if ((x > 3) == 0) goto 2; return 0
+    createBlocks(3);
+    TR::Node* compare = TR::Node::create(TR::icmpgt, 2, parameter(0, TR::Int32), TR::Node::iconst(3));
+    ifjump(0, TR::ificmpeq, compare, TR::Node::iconst(0), 2);
+    fallThrough(1);
+    returnZero(2);
+
+    TR::ILAbsInterpreter interpreter(_callee, vp(), region(), &_comp);
+    ASSERT_TRUE(interpreter.interpret(NULL, NULL));
+
+    TR::InliningMethodSummary* summary = summarize(interpreter);
+    ASSERT_EQ(1, summary->testArgument(intValue(4, 4), 0));
+    ASSERT_EQ(1, summary->testArgument(intValue(-5, 3), 0));
+    ASSERT_EQ(0, summary->testArgument(intValue(3, 4), 0));
+}
+
+TEST_F(ILAbsInterpreterTest, testCopiedParameter) {
+    // t = x; if (t != 7) goto 2; return 0
+    createBlocks(3);
+    TR::SymbolReference* temp = _comp.getSymRefTab()->createTemporary(_callee, TR::Int32);
+    append(0, TR::Node::createStore(temp, parameter(0, TR::Int32)));
+    ifjump(0, TR::ificmpne, TR::Node::createLoad(temp), TR::Node::iconst(7), 2);
+    fallThrough(1);
+    returnZero(2);
+
+    TR::ILAbsInterpreter interpreter(_callee, vp(), region(), &_comp);
+    ASSERT_TRUE(interpreter.interpret(NULL, NULL));
+
+    TR::InliningMethodSummary* summary = summarize(interpreter);
+    ASSERT_EQ(1, summary->testArgument(intValue(7, 7), 0));
+    ASSERT_EQ(0, summary->testArgument(intValue(8, 8), 0));
+}
+
+TEST_F(ILAbsInterpreterTest, testReassignedParameter) {
+    // x = 1; if (x < 10) goto 2; return 0
+    createBlocks(3);
+    append(0, TR::Node::createStore(_comp.getSymRefTab()->findOrCreateAutoSymbol(_callee, 0, TR::Int32, true, false, true), TR::Node::iconst(1)));
+    ifjump(0, TR::ificmplt, parameter(0, TR::Int32), TR::Node::iconst(10), 2);
+    fallThrough(1);
+    returnZero(2);
+
+    TR::ILAbsInterpreter interpreter(_callee, vp(), region(), &_comp);
+    ASSERT_TRUE(interpreter.interpret(NULL, NULL));
+    ASSERT_EQ(0, interpreter.getPotentialOptimizations().size());
+}
+
+TEST_F(ILAbsInterpreterTest, testCallSitesDependOnArguments) {
+    // if (x >= 10) goto 2; leaf(x + 1); return 0
+    createBlocks(3);
+    ifjump(0, TR::ificmpge, parameter(0, TR::Int32), TR::Node::iconst(10), 2);
+    callLeaf(1, TR::Node::create(TR::iadd, 2, parameter(0, TR::Int32), TR::Node::iconst(1)));
+    fallThrough(1);
+    returnZero(2);
+
+    TR::ILAbsInterpreter interpreter(_callee, vp(), region(), &_comp);
+
+    CallSiteCounter unknown;
+    ASSERT_TRUE(interpreter.interpret(NULL, &unknown));
+    ASSERT_EQ(1, unknown._numCallSites);
+    ASSERT_TRUE(unknown._lastArgument->isTop());
+
+    CallSiteCounter small;
+    ASSERT_TRUE(interpreter.interpret(arguments(intValue(5, 5), NULL), &small));
+    ASSERT_EQ(1, small._numCallSites);
+    TR::VPConstraint* constraint = static_cast<TR::AbsVPValue*>(small._lastArgument)->getConstraint();
+    ASSERT_TRUE(constraint != NULL && constraint->asIntConst() != NULL);
+    ASSERT_EQ(6, constraint->asIntConst()->getLowInt());
+
+    CallSiteCounter large;
+    ASSERT_TRUE(interpreter.interpret(arguments(intValue(20, 20), NULL), &large));
+    ASSERT_EQ(0, large._numCallSites);
+}
+
+TEST_F(ILAbsInterpreterTest, testLoopConverges) {
+    // i = 0; loop: i = i + 1; if (i < x) goto loop; return 0
+    createBlocks(3);
+    TR::SymbolReference* i = _comp.getSymRefTab()->createTemporary(_callee, TR::Int32);
+    append(0, TR::Node::createStore(i, TR::Node::iconst(0)));
+    fallThrough(0);
+    append(1, TR::Node::createStore(i, TR::Node::create(TR::iadd, 2, TR::Node::createLoad(i), TR::Node::iconst(1))));
+    append(1, TR::Node::createif(TR::ificmplt, TR::Node::createLoad(i), parameter(0, TR::Int32), _blocks[1]->getEntry()));
+    cfg()->addEdge(_blocks[1], _blocks[1]);
+    fallThrough(1);
+    returnZero(2);
+
+    TR::ILAbsInterpreter interpreter(_callee, vp(), region(), &_comp);
+    ASSERT_TRUE(interpreter.interpret(arguments(intValue(5, 5), NULL), NULL));
+    ASSERT_EQ(0, interpreter.getPotentialOptimizations().size());
+}
+
+TEST_F(ILAbsInterpreterTest, testSummaryCache) {
+    TR::PotentialOptimizationRecord records[] = {
+        { 0, 0, TR::PotentialOptimizationPredicate::BranchFolding, TR::PotentialOptimizationRecord::IntRange, INT_MIN, 9 },
+        { 0, 0, TR::PotentialOptimizationPredicate::BranchFolding, TR::PotentialOptimizationRecord::IntRange, 10, INT_MAX }
+    };
+    TR::InliningMethodSummaryRecord record = { 2, records };
+
+    TR::InliningMethodSummaryCache::initialize();
+    _comp.setInliningMethodSummaryRecord(&record);
+    _comp.getMethodSymbol()->setMethodAddress((void*)0x2000);
+    TR::InliningMethodSummaryCache::storeMethod(&_comp);
+    _comp.setInliningMethodSummaryRecord(NULL);
+
+    ASSERT_TRUE(TR::InliningMethodSummaryCache::hasSummary((void*)0x2000));
+    ASSERT_FALSE(TR::InliningMethodSummaryCache::hasSummary((void*)0x3000));
+    TR::InliningMethodSummary* summary = TR::InliningMethodSummaryCache::findSummary((void*)0x2000, vp(), region());
+    ASSERT_TRUE(summary != NULL);
+    ASSERT_EQ(1, summary->testArgument(intValue(5, 5), 0));
+    ASSERT_EQ(0, summary->testArgument(intValue(5, 15), 0));
+
+    TR::InliningMethodSummaryCache::shutdown();
+    ASSERT_FALSE(TR::InliningMethodSummaryCache::isActive());
+}
+
+TEST_F(ILAbsInterpreterTest, testSummaryCacheRemoveMethod) {
+    TR::InliningMethodSummaryRecord record = { 0, NULL };
+
+    TR::InliningMethodSummaryCache::initialize();
+    _comp.setInliningMethodSummaryRecord(&record);
+    _comp.getMethodSymbol()->setMethodAddress((void*)0x2000);
+    TR::InliningMethodSummaryCache::storeMethod(&_comp);
+    _comp.getMethodSymbol()->setMethodAddress((void*)0x3000);
+    TR::InliningMethodSummaryCache::storeMethod(&_comp);
+    _comp.setInliningMethodSummaryRecord(NULL);
+
+    TR::InliningMethodSummaryCache::removeMethod((void*)0x2000);
+    ASSERT_FALSE(TR::InliningMethodSummaryCache::hasSummary((void*)0x2000));
+    ASSERT_TRUE(TR::InliningMethodSummaryCache::hasSummary((void*)0x3000));
+
+    TR::InliningMethodSummaryCache::shutdown();
+}
+
+TEST_F(ILAbsInterpreterTest, testSummarizeOnlyForBenefitInliner) {
+    // localCSE only runs nested two groups deep in this strategy
+    static const OptimizationStrategy strategy[] = {
+        { OMR::lateLocalGroup },
+        { OMR::endOpts }
+    };
+    TR::Optimizer* optimizer = new (region()) TR::Optimizer(&_comp, _symbol, false, strategy);
+    _comp.setOptimizer(optimizer);
+
+    TR::OptimizationManager* localCSE = optimizer->getOptimization(OMR::localCSE);
+    ASSERT_TRUE(localCSE != NULL);
+    ASSERT_TRUE(optimizer->strategyRuns(localCSE->factory()));
+
+    // No strategy of the test compiler runs the benefit inliner
+    ASSERT_FALSE(optimizer->strategyRuns(TR::BenefitInlinerWrapper::create));
+
+    TR::InliningMethodSummaryCache::initialize();
+    TR::InliningMethodSummaryCache::summarizeMethod(&_comp);
+    ASSERT_TRUE(_comp.getInliningMethodSummaryRecord() == NULL);
+    TR::InliningMethodSummaryCache::shutdown();
+}
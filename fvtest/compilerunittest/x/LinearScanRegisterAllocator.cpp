@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "../CodeGenTest.hpp"
+#include "codegen/OMRX86Instruction.hpp"
+#include "codegen/RegisterDependency.hpp"
+#include "x/codegen/X86LinearScanRegisterAllocator.hpp"
+#include "x/codegen/X86LinkageProperties.hpp"
+
+class XLinearScanTest : public TRTest::CodeGenTest {
+public:
+    XLinearScanTest() : plan(cg()) {}
+
+    TR::Register *defineRegister(int32_t value) {
+        TR::Register *reg = cg()->allocateRegister();
+        generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, fakeNode, reg, value, cg());
+        return reg;
+    }
+
+    void useRegisters(TR::Register *a, TR::Register *b) {
+        generateRegRegInstruction(TR::InstOpCode::ADD4RegReg, fakeNode, a, b, cg());
+    }
+
+    void coerce(TR::Register *reg, TR::RealRegister::RegNum realReg) {
+        TR::RegisterDependencyConditions *deps = generateRegisterDependencyConditions((uint32_t)0, 1, cg());
+        deps->addPostCondition(reg, realReg, cg());
+        generateLabelInstruction(TR::InstOpCode::label, fakeNode, generateLabelSymbol(cg()), deps, cg());
+    }
+
+    TR::X86LinearScanRegisterAllocator plan;
+};
+
+TEST_F(XLinearScanTest, OverlappingIntervalsGetDistinctRegisters) {
+    auto a = defineRegister(1);
+    auto b = defineRegister(2);
+    useRegisters(a, b);
+    useRegisters(b, a);
+    auto c = defineRegister(3);
+    useRegisters(c, c);
+
+    plan.allocate(TR_GPR_Mask);
+
+    ASSERT_NE(TR::RealRegister::NoReg, plan.getAssignment(a));
+    ASSERT_NE(TR::RealRegister::NoReg, plan.getAssignment(b));
+    ASSERT_NE(TR::RealRegister::NoReg, plan.getAssignment(c));
+    EXPECT_NE(plan.getAssignment(a), plan.getAssignment(b));
+
+    // Nothing is live across a call, so there is no reason to use a preserved register
+    EXPECT_FALSE(cg()->getProperties().isPreservedRegister(plan.getAssignment(a)));
+    EXPECT_FALSE(cg()->getProperties().isPreservedRegister(plan.getAssignment(b)));
+    EXPECT_FALSE(cg()->getProperties().isPreservedRegister(plan.getAssignment(c)));
+}
+
+TEST_F(XLinearScanTest, CoercedRegisterIsPreferred) {
+    auto a = defineRegister(1);
+    coerce(a, TR::RealRegister::ecx);
+
+    plan.allocate(TR_GPR_Mask);
+
+    EXPECT_EQ(TR::RealRegister::ecx, plan.getAssignment(a));
+}
+
+TEST_F(XLinearScanTest, RegisterClaimedByAnotherVirtualIsAvoided) {
+    auto a = defineRegister(1);
+    auto b = defineRegister(2);
+    coerce(b, TR::RealRegister::eax);
+    useRegisters(a, a);
+
+    plan.allocate(TR_GPR_Mask);
+
+    EXPECT_EQ(TR::RealRegister::eax, plan.getAssignment(b));
+    EXPECT_NE(TR::RealRegister::NoReg, plan.getAssignment(a));
+    EXPECT_NE(TR::RealRegister::eax, plan.getAssignment(a));
+}
+
+TEST_F(XLinearScanTest, EarlierIntervalMovesOutOfACoercedRegister) {
+    auto a = defineRegister(1);
+    auto b = defineRegister(2);
+    useRegisters(a, b);
+    coerce(b, TR::RealRegister::eax);
+
+    plan.allocate(TR_GPR_Mask);
+
+    EXPECT_EQ(TR::RealRegister::eax, plan.getAssignment(b));
+    EXPECT_NE(TR::RealRegister::NoReg, plan.getAssignment(a));
+    EXPECT_NE(TR::RealRegister::eax, plan.getAssignment(a));
+}
+
+TEST_F(XLinearScanTest, RangesOfDeadRegistersArePlanned) {
+    auto a = defineRegister(1);
+    useRegisters(a, a);
+
+    // Live register tracking clears the start of range when a register dies
+    a->setStartOfRange(NULL);
+
+    plan.allocate(TR_GPR_Mask);
+
+    EXPECT_NE(TR::RealRegister::NoReg, plan.getAssignment(a));
+}
+
+TEST_F(XLinearScanTest, OverlappingIntervalsNeverSharePlannedRegisters) {
+    const int32_t numRegisters = 2 * (TR::RealRegister::LastAssignableGPR - TR::RealRegister::FirstGPR + 1);
+    TR::Register *regs[numRegisters];
+
+    // Every interval overlaps every other, so some of them cannot be planned
+    for (int32_t i = 0; i < numRegisters; i++)
+        regs[i] = defineRegister(i);
+    for (int32_t i = numRegisters - 1; i >= 0; i--)
+        useRegisters(regs[i], regs[i]);
+
+    plan.allocate(TR_GPR_Mask);
+
+    int32_t numPlanned = 0;
+    bool taken[TR::RealRegister::NumRegisters] = {};
+    for (int32_t i = 0; i < numRegisters; i++) {
+        TR::RealRegister::RegNum r = plan.getAssignment(regs[i]);
+        if (r == TR::RealRegister::NoReg)
+            continue;
+        EXPECT_FALSE(taken[r]) << "register " << r << " planned for two live virtuals";
+        taken[r] = true;
+        numPlanned++;
+    }
+
+    EXPECT_GT(numPlanned, 0);
+    EXPECT_LT(numPlanned, numRegisters);
+}
+
+TEST_F(XLinearScanTest, RegistersCreatedAfterThePlanHaveNoAssignment) {
+    auto a = defineRegister(1);
+    useRegisters(a, a);
+
+    plan.allocate(TR_GPR_Mask);
+
+    EXPECT_EQ(TR::RealRegister::NoReg, plan.getAssignment(cg()->allocateRegister()));
+}
+
+TEST_F(XLinearScanTest, PlanIsAppliedDirectly) {
+    auto a = defineRegister(1);
+    auto b = defineRegister(2);
+    auto add = generateRegRegInstruction(TR::InstOpCode::ADD4RegReg, fakeNode, a, b, cg());
+
+    plan.allocate(TR_GPR_Mask);
+    TR::RealRegister::RegNum aReg = plan.getAssignment(a);
+    TR::RealRegister::RegNum bReg = plan.getAssignment(b);
+
+    ASSERT_TRUE(plan.assignRegisters());
+
+    ASSERT_NE(nullptr, add->getTargetRegister()->getRealRegister());
+    ASSERT_NE(nullptr, add->getSourceRegister()->getRealRegister());
+    EXPECT_EQ(aReg, toRealRegister(add->getTargetRegister())->getRegisterNumber());
+    EXPECT_EQ(bReg, toRealRegister(add->getSourceRegister())->getRegisterNumber());
+    EXPECT_TRUE(cg()->machine()->getRealRegister(aReg)->getHasBeenAssignedInMethod());
+    EXPECT_TRUE(cg()->machine()->getRealRegister(bReg)->getHasBeenAssignedInMethod());
+}
+
+TEST_F(XLinearScanTest, CopyBetweenTheSameRegistersIsRemoved) {
+    auto a = defineRegister(1);
+    auto b = cg()->allocateRegister();
+    auto copy = generateRegRegInstruction(TR::InstOpCode::MOV4RegReg, fakeNode, b, a, cg());
+    useRegisters(b, b);
+
+    plan.allocate(TR_GPR_Mask);
+    ASSERT_EQ(plan.getAssignment(a), plan.getAssignment(b));
+
+    ASSERT_TRUE(plan.assignRegisters());
+
+    for (TR::Instruction *instr = cg()->getFirstInstruction(); instr; instr = instr->getNext())
+        EXPECT_NE(copy, instr);
+}
+
+TEST_F(XLinearScanTest, NoRegDependencyRecordsTheAssignedRegister) {
+    auto a = defineRegister(1);
+    TR::RegisterDependencyConditions *deps = generateRegisterDependencyConditions((uint32_t)0, 1, cg());
+    deps->addPostCondition(a, TR::RealRegister::NoReg, cg());
+    generateLabelInstruction(TR::InstOpCode::label, fakeNode, generateLabelSymbol(cg()), deps, cg());
+
+    plan.allocate(TR_GPR_Mask);
+
+    ASSERT_TRUE(plan.assignRegisters());
+
+    EXPECT_EQ(plan.getAssignment(a), deps->getPostConditions()->getRegisterDependency(0)->getRealRegister());
+}
+
+TEST_F(XLinearScanTest, ConflictingCoercionsLeaveTheStreamToTheLocalAssigner) {
+    auto a = defineRegister(1);
+    coerce(a, TR::RealRegister::ecx);
+    auto use = generateRegRegInstruction(TR::InstOpCode::ADD4RegReg, fakeNode, a, a, cg());
+    coerce(a, TR::RealRegister::edx);
+
+    plan.allocate(TR_GPR_Mask);
+
+    EXPECT_FALSE(plan.assignRegisters());
+    EXPECT_EQ(a, use->getTargetRegister());
+}
+
+TEST_F(XLinearScanTest, UnplannedVirtualsLeaveTheStreamToTheLocalAssigner) {
+    const int32_t numRegisters = 2 * (TR::RealRegister::LastAssignableGPR - TR::RealRegister::FirstGPR + 1);
+    TR::Register *regs[numRegisters];
+
+    for (int32_t i = 0; i < numRegisters; i++)
+        regs[i] = defineRegister(i);
+    for (int32_t i = numRegisters - 1; i >= 0; i--)
+        useRegisters(regs[i], regs[i]);
+
+    plan.allocate(TR_GPR_Mask);
+
+    EXPECT_FALSE(plan.assignRegisters());
+    for (TR::Instruction *instr = cg()->getFirstInstruction(); instr; instr = instr->getNext())
+        if (instr->getTargetRegister())
+            EXPECT_EQ(nullptr, instr->getTargetRegister()->getRealRegister());
+}
@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrgc.h"
+#include "omrhashtable.h"
+#include "mmomrhook.h"
+
+#include "CollectorLanguageInterface.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrExampleVM.hpp"
+#include "StartupManagerTestExample.hpp"
+
+#define SAMPLING_INTERVAL 4096
+#define OBJECT_SIZE 64
+#define OBJECT_COUNT (16 * 1024 * 1024 / OBJECT_SIZE)
+#define ROOT_FREQUENCY 64
+#define ROOT_NAME_LENGTH 16
+
+class AllocationSamplerTest : public ::testing::Test, public ::testing::WithParamInterface<const char *>
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_CollectorLanguageInterface *cli;
+	char (*rootNames)[ROOT_NAME_LENGTH];
+	uintptr_t sampleCount;
+	uintptr_t sampledBytes;
+	uintptr_t liveCount;
+	uintptr_t liveNotRooted;
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+	static void
+	sampledHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+	{
+		MM_ObjectAllocationSampledEvent *event = (MM_ObjectAllocationSampledEvent *)eventData;
+		AllocationSamplerTest *test = (AllocationSamplerTest *)userData;
+		if (NULL != event->object) {
+			test->sampleCount += 1;
+			test->sampledBytes += event->size;
+		}
+	}
+
+	static void
+	liveSampleCallback(omrobjectptr_t object, uintptr_t size, void **frames, uintptr_t frameCount, void *userData)
+	{
+		AllocationSamplerTest *test = (AllocationSamplerTest *)userData;
+		test->liveCount += 1;
+		if (!test->isRoot(object)) {
+			test->liveNotRooted += 1;
+		}
+	}
+
+	bool
+	isRoot(omrobjectptr_t object)
+	{
+		J9HashTableState state;
+		RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+		while (NULL != rootEntry) {
+			if (object == rootEntry->rootPtr) {
+				return true;
+			}
+			rootEntry = (RootEntry *)hashTableNextDo(&state);
+		}
+		return false;
+	}
+
+	omrobjectptr_t
+	allocate(uintptr_t size)
+	{
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *model = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		return OMR_GC_AllocateObject(exampleVM->_omrVMThread, model);
+	}
+
+public:
+	AllocationSamplerTest()
+		: ::testing::Test()
+		, ::testing::WithParamInterface<const char *>()
+		, exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+		, cli(NULL)
+		, rootNames(NULL)
+		, sampleCount(0)
+		, sampledBytes(0)
+		, liveCount(0)
+		, liveNotRooted(0)
+	{
+	}
+};
+
+void
+AllocationSamplerTest::SetUp()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, GetParam());
+
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+
+	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+
+	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+
+	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	cli = startupManager.createCollectorLanguageInterface(env);
+	ASSERT_TRUE(NULL != cli) << "Failed to instantiate collector interface.";
+
+	exampleVM->rootTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+	exampleVM->objectTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+
+	rootNames = (char (*)[ROOT_NAME_LENGTH])omrmem_allocate_memory((OBJECT_COUNT / ROOT_FREQUENCY) * ROOT_NAME_LENGTH, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != rootNames);
+
+	J9HookInterface **hooks = env->getExtensions()->getOmrHookInterface();
+	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED, sampledHook, OMR_GET_CALLSITE(), this);
+}
+
+void
+AllocationSamplerTest::TearDown()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	J9HookInterface **hooks = env->getExtensions()->getOmrHookInterface();
+	(*hooks)->J9HookUnregister(hooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED, sampledHook, this);
+
+	if (NULL != exampleVM->rootTable) {
+		hashTableFree(exampleVM->rootTable);
+		exampleVM->rootTable = NULL;
+	}
+	if (NULL != exampleVM->objectTable) {
+		hashTableFree(exampleVM->objectTable);
+		exampleVM->objectTable = NULL;
+	}
+	omrmem_free_memory(rootNames);
+	rootNames = NULL;
+
+	if (NULL != cli) {
+		cli->kill(env);
+	}
+
+	omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+
+	rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	exampleVM->_omrVMThread = NULL;
+}
+
+TEST_P(AllocationSamplerTest, SamplesAllocatedBytesAndTracksLiveObjects)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	EXPECT_EQ(OMR_ERROR_ILLEGAL_ARGUMENT, OMR_GC_StartAllocationSampling(exampleVM->_omrVMThread, 0, 8));
+	EXPECT_EQ(OMR_ERROR_NOT_AVAILABLE, OMR_GC_IterateLiveAllocationSamples(exampleVM->_omrVMThread, liveSampleCallback, this));
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_StartAllocationSampling(exampleVM->_omrVMThread, SAMPLING_INTERVAL, 8));
+
+	/* Allocate 16MB with collections along the way, keeping one object in ROOT_FREQUENCY alive */
+	for (uintptr_t i = 0; i < OBJECT_COUNT; i++) {
+		omrobjectptr_t object = allocate(OBJECT_SIZE);
+		ASSERT_TRUE(NULL != object) << "Allocation " << i << " failed";
+		if (0 == (i % ROOT_FREQUENCY)) {
+			RootEntry rootEntry;
+			omrstr_printf(rootNames[i / ROOT_FREQUENCY], ROOT_NAME_LENGTH, "root%zu", i / ROOT_FREQUENCY);
+			rootEntry.name = rootNames[i / ROOT_FREQUENCY];
+			rootEntry.rootPtr = object;
+			ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+		}
+	}
+
+	/* The sample count is Poisson distributed, so 20% is about 15 standard deviations */
+	uintptr_t expectedSamples = (OBJECT_COUNT * OBJECT_SIZE) / SAMPLING_INTERVAL;
+	gcTestEnv->log("%zu samples, %zu expected\n", sampleCount, expectedSamples);
+	EXPECT_LT(expectedSamples * 8 / 10, sampleCount);
+	EXPECT_GT(expectedSamples * 12 / 10, sampleCount);
+	EXPECT_EQ(sampleCount * OBJECT_SIZE, sampledBytes);
+
+	/* After a global collection only the samples of rooted objects are live */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IterateLiveAllocationSamples(exampleVM->_omrVMThread, liveSampleCallback, this));
+	gcTestEnv->log("%zu live samples\n", liveCount);
+	EXPECT_LT((uintptr_t)0, liveCount);
+	EXPECT_GT(sampleCount / 4, liveCount);
+	EXPECT_EQ((uintptr_t)0, liveNotRooted);
+
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_StopAllocationSampling(exampleVM->_omrVMThread));
+	uintptr_t samplesAtStop = sampleCount;
+	for (uintptr_t i = 0; i < 1024; i++) {
+		ASSERT_TRUE(NULL != allocate(OBJECT_SIZE));
+	}
+	EXPECT_EQ(samplesAtStop, sampleCount);
+	EXPECT_EQ(OMR_ERROR_NOT_AVAILABLE, OMR_GC_IterateLiveAllocationSamples(exampleVM->_omrVMThread, liveSampleCallback, this));
+}
+
+const char *allocationSamplerConfigs[] = {"fvtest/gctest/configuration/global_GC_config.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+                        , "fvtest/gctest/configuration/scavenger_GC_config.xml"
+#endif
+                        };
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, AllocationSamplerTest,
+        ::testing::ValuesIn(allocationSamplerConfigs));
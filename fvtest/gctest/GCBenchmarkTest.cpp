@@ -0,0 +1,367 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "mmprivatehook.h"
+
+#include "GCConfigTest.hpp"
+#include "Heap.hpp"
+
+#define MAX_RESULT_LENGTH 1024
+
+const char *benchmarkTests[] = {"fvtest/gctest/configuration/benchmark_transient_global.xml"
+                               , "fvtest/gctest/configuration/benchmark_retained_global.xml"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                               , "fvtest/gctest/configuration/benchmark_transient_optavgpause.xml"
+                               , "fvtest/gctest/configuration/benchmark_retained_optavgpause.xml"
+#endif
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                               , "fvtest/gctest/configuration/benchmark_transient_gencon.xml"
+                               , "fvtest/gctest/configuration/benchmark_retained_gencon.xml"
+#endif
+                               };
+
+/**
+ * Runs the <benchmark> sections of a GC configuration and measures the collector.
+ *
+ * The <allocation> sections of the configuration are allocated once and stay live for the whole
+ * run. The <allocation> section of a <benchmark> is then allocated "iterations" times; what it
+ * leaves live is released at the end of each iteration, so it survives about one iteration, and
+ * its garbage policy sets how much dies right away. The first "warmup" iterations are not measured.
+ *
+ * Every exclusive access taken by the collector is a pause. Pause percentiles, the share of time
+ * spent paused, the allocation rate and the footprint are recorded as test properties, appended as
+ * a JSON line to the -benchmarkResults=<file> file and, with -benchmarkBaseline=<file>, compared
+ * with the results of an earlier run: the test fails when a result is more than
+ * -benchmarkTolerance=<percent> (20 by default) worse than its baseline.
+ */
+class GCBenchmarkTest : public GCConfigTest
+{
+protected:
+	struct Results {
+		uintptr_t iterations;
+		uintptr_t pauses;
+		double pauseTotalMs;
+		double pauseP50Ms;
+		double pauseP90Ms;
+		double pauseP99Ms;
+		double pauseMaxMs;
+		double gcTimePercent;
+		double allocationMBPerSec;
+		uintptr_t allocatedBytes;
+		uintptr_t peakHeapBytes;
+		uintptr_t peakOccupancyBytes;
+	};
+
+	MM_GCExtensionsBase *extensions;
+	std::vector<uint64_t> pauseMicros;
+	uint64_t pauseStart;
+	uintptr_t peakHeapBytes;
+	uintptr_t peakOccupancyBytes;
+	std::set<std::string> retainedNames;
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+	static void
+	exclusiveAccessAcquired(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+	{
+		MM_ExclusiveAccessAcquireEvent *event = (MM_ExclusiveAccessAcquireEvent *)eventData;
+		((GCBenchmarkTest *)userData)->pauseStart = event->timestamp;
+	}
+
+	static void
+	exclusiveAccessReleased(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+	{
+		MM_ExclusiveAccessReleaseEvent *event = (MM_ExclusiveAccessReleaseEvent *)eventData;
+		GCBenchmarkTest *test = (GCBenchmarkTest *)userData;
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		test->pauseMicros.push_back(omrtime_hires_delta(test->pauseStart, event->timestamp, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+		test->sampleFootprint();
+	}
+
+	static uintptr_t
+	releaseRoot(void *entry, void *userData)
+	{
+		std::set<std::string> *retainedNames = (std::set<std::string> *)userData;
+		return (retainedNames->end() == retainedNames->find(((RootEntry *)entry)->name)) ? 1 : 0;
+	}
+
+	static uintptr_t
+	releaseObject(void *entry, void *userData)
+	{
+		GCBenchmarkTest *test = (GCBenchmarkTest *)userData;
+		ObjectEntry *objectEntry = (ObjectEntry *)entry;
+		if (test->retainedNames.end() != test->retainedNames.find(objectEntry->name)) {
+			return 0;
+		}
+		objectTableFreeFn(entry, test->exampleVM);
+		return 1;
+	}
+
+	void
+	sampleFootprint()
+	{
+		MM_Heap *heap = extensions->heap;
+		uintptr_t heapBytes = heap->getActiveMemorySize();
+		uintptr_t freeBytes = heap->getApproximateFreeMemorySize();
+		peakHeapBytes = OMR_MAX(peakHeapBytes, heapBytes);
+		if (heapBytes > freeBytes) {
+			peakOccupancyBytes = OMR_MAX(peakOccupancyBytes, heapBytes - freeBytes);
+		}
+	}
+
+	static double
+	percentileMs(const std::vector<uint64_t> &sortedMicros, double percent)
+	{
+		if (sortedMicros.empty()) {
+			return 0.0;
+		}
+		uintptr_t rank = (uintptr_t)((percent * sortedMicros.size() + 99.0) / 100.0);
+		return sortedMicros[OMR_MAX(rank, 1) - 1] / 1000.0;
+	}
+
+	void releaseIteration();
+	int32_t runBenchmark(pugi::xml_node node, Results *results);
+	void reportResults(const char *name, const Results *results);
+	void compareWithBaseline(const char *name, const Results *results);
+
+public:
+	GCBenchmarkTest()
+		: GCConfigTest()
+		, extensions(NULL)
+		, pauseStart(0)
+		, peakHeapBytes(0)
+		, peakOccupancyBytes(0)
+	{
+	}
+};
+
+void
+GCBenchmarkTest::SetUp()
+{
+	GCConfigTest::SetUp();
+	if (HasFatalFailure()) {
+		return;
+	}
+
+	extensions = MM_GCExtensionsBase::getExtensions(exampleVM->_omrVM);
+	J9HookInterface **privateHooks = extensions->getPrivateHookInterface();
+	(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, exclusiveAccessAcquired, OMR_GET_CALLSITE(), this);
+	(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, exclusiveAccessReleased, OMR_GET_CALLSITE(), this);
+}
+
+void
+GCBenchmarkTest::TearDown()
+{
+	if (NULL != extensions) {
+		J9HookInterface **privateHooks = extensions->getPrivateHookInterface();
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, exclusiveAccessAcquired, this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, exclusiveAccessReleased, this);
+	}
+	GCConfigTest::TearDown();
+}
+
+void
+GCBenchmarkTest::releaseIteration()
+{
+	/* root entries share their names with object entries, so they go first */
+	hashTableForEachDo(exampleVM->rootTable, releaseRoot, &retainedNames);
+	hashTableForEachDo(exampleVM->objectTable, releaseObject, this);
+}
+
+int32_t
+GCBenchmarkTest::runBenchmark(pugi::xml_node node, Results *results)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	uintptr_t iterations = (uintptr_t)node.attribute("iterations").as_int(10);
+	uintptr_t warmup = (uintptr_t)node.attribute("warmup").as_int(0);
+	pugi::xml_node allocationNode = node.child("allocation");
+	uint64_t startTime = 0;
+	uint64_t elapsedMicros = 0;
+
+	/* what is live now is live for the whole benchmark */
+	retainedNames.clear();
+	J9HashTableState state;
+	for (ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state); NULL != objectEntry; objectEntry = (ObjectEntry *)hashTableNextDo(&state)) {
+		retainedNames.insert(objectEntry->name);
+	}
+
+	for (uintptr_t i = 0; i < (warmup + iterations); i++) {
+		if (warmup == i) {
+			pauseMicros.clear();
+			allocatedBytes = 0;
+			peakHeapBytes = 0;
+			peakOccupancyBytes = 0;
+			startTime = omrtime_hires_clock();
+		}
+		rt = processAllocation(allocationNode);
+		if (0 != rt) {
+			return rt;
+		}
+		sampleFootprint();
+		releaseIteration();
+	}
+	elapsedMicros = OMR_MAX(omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+
+	std::sort(pauseMicros.begin(), pauseMicros.end());
+	results->iterations = iterations;
+	results->pauses = pauseMicros.size();
+	results->pauseTotalMs = 0.0;
+	for (std::vector<uint64_t>::const_iterator it = pauseMicros.begin(); it != pauseMicros.end(); ++it) {
+		results->pauseTotalMs += *it / 1000.0;
+	}
+	results->pauseP50Ms = percentileMs(pauseMicros, 50.0);
+	results->pauseP90Ms = percentileMs(pauseMicros, 90.0);
+	results->pauseP99Ms = percentileMs(pauseMicros, 99.0);
+	results->pauseMaxMs = percentileMs(pauseMicros, 100.0);
+	results->gcTimePercent = (results->pauseTotalMs * 1000.0 * 100.0) / elapsedMicros;
+	results->allocationMBPerSec = (allocatedBytes / (1024.0 * 1024.0)) / (elapsedMicros / 1000000.0);
+	results->allocatedBytes = allocatedBytes;
+	results->peakHeapBytes = peakHeapBytes;
+	results->peakOccupancyBytes = peakOccupancyBytes;
+
+	return rt;
+}
+
+void
+GCBenchmarkTest::reportResults(const char *name, const Results *results)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	char line[MAX_RESULT_LENGTH];
+
+	gcTestEnv->log("%s: %zu iterations, %zu pauses, pause ms p50 %.3f p90 %.3f p99 %.3f max %.3f, %.2f%% of time paused\n",
+		name, results->iterations, results->pauses, results->pauseP50Ms, results->pauseP90Ms, results->pauseP99Ms, results->pauseMaxMs, results->gcTimePercent);
+	gcTestEnv->log("%s: allocated %zu bytes at %.2f MB/s, peak heap %zu bytes, peak occupancy %zu bytes\n",
+		name, results->allocatedBytes, results->allocationMBPerSec, results->peakHeapBytes, results->peakOccupancyBytes);
+
+	omrstr_printf(line, sizeof(line),
+		"{\"config\":\"%s\",\"benchmark\":\"%s\",\"iterations\":%zu,\"pauses\":%zu,\"pauseTotalMs\":%.3f,"
+		"\"pauseP50Ms\":%.3f,\"pauseP90Ms\":%.3f,\"pauseP99Ms\":%.3f,\"pauseMaxMs\":%.3f,\"gcTimePercent\":%.3f,"
+		"\"allocationMBPerSec\":%.3f,\"allocatedBytes\":%zu,\"peakHeapBytes\":%zu,\"peakOccupancyBytes\":%zu}\n",
+		GetParam(), name, results->iterations, results->pauses, results->pauseTotalMs,
+		results->pauseP50Ms, results->pauseP90Ms, results->pauseP99Ms, results->pauseMaxMs, results->gcTimePercent,
+		results->allocationMBPerSec, results->allocatedBytes, results->peakHeapBytes, results->peakOccupancyBytes);
+	RecordProperty(name, line);
+
+	if (NULL != gcTestEnv->benchmarkResults) {
+		intptr_t fd = omrfile_open(gcTestEnv->benchmarkResults, EsOpenWrite | EsOpenCreate | EsOpenAppend, 0666);
+		if (-1 == fd) {
+			ADD_FAILURE() << "Failed to open benchmark results file " << gcTestEnv->benchmarkResults;
+		} else {
+			omrfile_write(fd, line, strlen(line));
+			omrfile_close(fd);
+		}
+	}
+}
+
+/**
+ * Find a number in the baseline line of the same benchmark, which has the format written by
+ * reportResults().
+ */
+static bool
+baselineValue(const std::string &baseline, const char *key, double *value)
+{
+	std::string pattern = std::string("\"") + key + "\":";
+	std::string::size_type position = baseline.find(pattern);
+	if (std::string::npos == position) {
+		return false;
+	}
+	*value = strtod(baseline.c_str() + position + pattern.length(), NULL);
+	return true;
+}
+
+void
+GCBenchmarkTest::compareWithBaseline(const char *name, const Results *results)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	intptr_t fd = omrfile_open(gcTestEnv->benchmarkBaseline, EsOpenRead, 0);
+	ASSERT_NE(-1, fd) << "Failed to open benchmark baseline file " << gcTestEnv->benchmarkBaseline;
+
+	std::string contents;
+	char buffer[4096];
+	intptr_t count = 0;
+	while ((count = omrfile_read(fd, buffer, sizeof(buffer))) > 0) {
+		contents.append(buffer, count);
+	}
+	omrfile_close(fd);
+
+	/* the last result of the same benchmark is the baseline */
+	std::string prefix = std::string("{\"config\":\"") + GetParam() + "\",\"benchmark\":\"" + name + "\",";
+	std::string::size_type start = contents.rfind(prefix);
+	if (std::string::npos == start) {
+		gcTestEnv->log("%s: no baseline in %s\n", name, gcTestEnv->benchmarkBaseline);
+		return;
+	}
+	std::string baseline = contents.substr(start, contents.find('\n', start) - start);
+
+	double tolerance = gcTestEnv->benchmarkTolerance / 100.0;
+	double expected = 0.0;
+	/* pause times under a millisecond are mostly noise */
+	if (baselineValue(baseline, "pauseP99Ms", &expected)) {
+		EXPECT_LE(results->pauseP99Ms, OMR_MAX(expected * (1.0 + tolerance), expected + 1.0)) << name << " p99 pause time regressed";
+	}
+	if (baselineValue(baseline, "gcTimePercent", &expected)) {
+		EXPECT_LE(results->gcTimePercent, OMR_MAX(expected * (1.0 + tolerance), expected + 1.0)) << name << " time paused regressed";
+	}
+	if (baselineValue(baseline, "allocationMBPerSec", &expected)) {
+		EXPECT_GE(results->allocationMBPerSec, expected * (1.0 - tolerance)) << name << " throughput regressed";
+	}
+	if (baselineValue(baseline, "peakHeapBytes", &expected)) {
+		EXPECT_LE((double)results->peakHeapBytes, expected * (1.0 + tolerance)) << name << " footprint regressed";
+	}
+}
+
+TEST_P(GCBenchmarkTest, benchmark)
+{
+	pugi::xml_node configNode = doc.select_node("/gc-config").node();
+	const char *configStyle = configNode.attribute("style").value();
+	ASSERT_EQ(0, iniXMLStr(configStyle)) << "Invalid XML input: unrecognized gc-config style \"" << configStyle << "\".";
+
+	uintptr_t benchmarks = 0;
+	for (pugi::xml_node configChild = configNode.first_child(); configChild; configChild = configChild.next_sibling()) {
+		if (0 == strcmp(configChild.name(), "allocation")) {
+			ASSERT_EQ(0, processAllocation(configChild)) << "Failed to perform allocation.";
+		} else if (0 == strcmp(configChild.name(), "benchmark")) {
+			const char *name = configChild.attribute("name").value();
+			Results results;
+			ASSERT_EQ(0, runBenchmark(configChild, &results)) << "Failed to run benchmark " << name << ".";
+			reportResults(name, &results);
+			if (NULL != gcTestEnv->benchmarkBaseline) {
+				compareWithBaseline(name, &results);
+			}
+			benchmarks += 1;
+		} else if (0 != strcmp(configChild.name(), "option")) {
+			FAIL() << "Invalid XML input: unrecognized XML node \"" << configChild.name() << "\" in benchmark configuration file.";
+		}
+	}
+	ASSERT_LT(0u, benchmarks) << "No benchmark in configuration file.";
+}
+
+INSTANTIATE_TEST_CASE_P(gcBenchmark, GCBenchmarkTest,
+        ::testing::ValuesIn(benchmarkTests));
@@ -43,6 +43,7 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/worker_stats_GC_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
 #endif
@@ -328,6 +329,7 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 			gcTestEnv->log(LEVEL_ERROR, "Consumed size for allocated object name: %s(%p[0x%llx]) != adjusted request size [0x%llx].\n", objEntry.name, objEntry.objPtr, consumedSize, adjustedSize);
 		}
 		newEntry = add(&objEntry);
+		allocatedBytes += consumedSize;
 	} else {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d No free memory after a GC. Failed to allocate object %s of size 0x%llx.\n", __FILE__, __LINE__, objName, size);
 	}
@@ -979,6 +981,26 @@ done:
 	return rt;
 }
 
+int32_t
+GCConfigTest::processAllocation(pugi::xml_node node)
+{
+	pugi::xpath_node_set objects;
+	int32_t rt = parseGarbagePolicy(node.child(xs.garbagePolicy));
+	if (0 != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to parse garbage policy.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	objects = node.select_nodes(xs.object);
+	for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
+		rt = allocationWalker(it->node());
+		OMRGCTEST_CHECK_RT(rt);
+	}
+
+done:
+	return rt;
+}
+
 int32_t
 GCConfigTest::iniXMLStr(const char *configStyle)
 {
@@ -1028,14 +1050,9 @@ TEST_P(GCConfigTest, test)
 	for (; configChild; configChild = configChild.next_sibling()) {
 		if (0 == strcmp(configChild.name(), "allocation")) {
 			gcTestEnv->log("\n+++++++++++++++++++++++++++Allocation+++++++++++++++++++++++++++\n");
-			rt = parseGarbagePolicy(configChild.child(xs.garbagePolicy));
-			ASSERT_EQ(0, rt) << "Failed to parse garbage policy.";
-			pugi::xpath_node_set objects = configChild.select_nodes(xs.object);
 			int64_t startTime = omrtime_current_time_millis();
-			for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
-				rt = allocationWalker(it->node());
-				ASSERT_EQ(0, rt) << "Failed to perform allocation.";
-			}
+			rt = processAllocation(configChild);
+			ASSERT_EQ(0, rt) << "Failed to perform allocation.";
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
 		} else if (0 == strcmp(configChild.name(), "verification")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++Verification++++++++++++++++++++++++++\n");
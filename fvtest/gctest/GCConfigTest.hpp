@@ -87,6 +87,9 @@ protected:
 	char *verboseFile;
 	uintptr_t numOfFiles;
 
+	/* bytes allocated by allocateHelper() */
+	uintptr_t allocatedBytes;
+
 	/*
 	 * Function members
 	 */
@@ -104,6 +107,7 @@ protected:
 	int32_t removeObjectFromObjectTable(const char *name);
 	int32_t removeObjectFromParentSlot(const char *name, ObjectEntry *parentEntry);
 	int32_t allocationWalker(pugi::xml_node node);
+	int32_t processAllocation(pugi::xml_node node);
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
@@ -159,6 +163,7 @@ public:
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
+		, allocatedBytes(0)
 	{
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
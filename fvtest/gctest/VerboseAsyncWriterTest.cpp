@@ -0,0 +1,356 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrgc.h"
+#include "omrhashtable.h"
+
+#include "CollectorLanguageInterface.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrExampleVM.hpp"
+#include "pugixml.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseEventDecoder.hpp"
+#include "VerboseHandlerOutput.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+#include "VerboseWriterFileLoggingSynchronous.hpp"
+
+#define MAX_NAME_LENGTH 128
+#define ASYNC_BUFFER_SIZE (1024 * 1024)
+
+class VerboseAsyncWriterTest : public ::testing::Test, public ::testing::WithParamInterface<const char *>
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_CollectorLanguageInterface *cli;
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+	/**
+	 * Encode a line as a record and format it back into text.
+	 */
+	void
+	encodeAndFormat(char *text, uintptr_t size, uintptr_t indent, const char *format, ...)
+	{
+		uint64_t record[128];
+		va_list args;
+		va_start(args, format);
+		uintptr_t recordSize = MM_VerboseEventStream::encodeOutput(record, sizeof(record), indent, format, args);
+		va_end(args);
+		ASSERT_GE(sizeof(record), recordSize);
+		uintptr_t length = MM_VerboseEventStream::formatOutput(gcTestEnv->portLib, format, (MM_VerboseEventRecord *)record, text, size);
+		ASSERT_GT(size, length);
+	}
+
+	/**
+	 * Read a whole file into memory allocated from the port library.
+	 */
+	char *
+	readFile(const char *name, uintptr_t *size)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		char *contents = NULL;
+		intptr_t fd = omrfile_open(name, EsOpenRead, 0);
+		if (-1 != fd) {
+			int64_t length = omrfile_flength(fd);
+			contents = (char *)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_MM);
+			if (NULL != contents) {
+				intptr_t read = 0;
+				while (read < length) {
+					intptr_t count = omrfile_read(fd, contents + read, (intptr_t)(length - read));
+					if (count <= 0) {
+						break;
+					}
+					read += count;
+				}
+				contents[read] = '\0';
+				*size = (uintptr_t)read;
+			}
+			omrfile_close(fd);
+		}
+		return contents;
+	}
+
+public:
+	VerboseAsyncWriterTest()
+		: ::testing::Test()
+		, ::testing::WithParamInterface<const char *>()
+		, exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+		, cli(NULL)
+	{
+	}
+};
+
+#define EXPECT_FORMATS_LIKE_BUFFER(indent, ...) \
+	do { \
+		char text[512]; \
+		buffer->reset(); \
+		buffer->formatAndOutput(env, indent, __VA_ARGS__); \
+		encodeAndFormat(text, sizeof(text), indent, __VA_ARGS__); \
+		EXPECT_STREQ(buffer->contents(), text); \
+	} while (0)
+
+void
+VerboseAsyncWriterTest::SetUp()
+{
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, GetParam());
+
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+
+	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+
+	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+
+	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	cli = startupManager.createCollectorLanguageInterface(env);
+	ASSERT_TRUE(NULL != cli) << "Failed to instantiate collector interface.";
+
+	exampleVM->rootTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+	exampleVM->objectTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+}
+
+void
+VerboseAsyncWriterTest::TearDown()
+{
+	if (NULL != exampleVM->rootTable) {
+		hashTableFree(exampleVM->rootTable);
+		exampleVM->rootTable = NULL;
+	}
+	if (NULL != exampleVM->objectTable) {
+		hashTableFree(exampleVM->objectTable);
+		exampleVM->objectTable = NULL;
+	}
+
+	if (NULL != cli) {
+		cli->kill(env);
+	}
+
+	omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+
+	rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	exampleVM->_omrVMThread = NULL;
+}
+
+TEST_P(VerboseAsyncWriterTest, RecordsFormatLikeVerboseBuffer)
+{
+	MM_VerboseBuffer *buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+	ASSERT_TRUE(NULL != buffer);
+
+	EXPECT_FORMATS_LIKE_BUFFER(1, "<gc-op id=\"%zu\" type=\"%s\" timems=\"%llu.%03.3llu\" contextid=\"%zu\" timestamp=\"%s\">",
+		(uintptr_t)42, "sweep", (unsigned long long)12, (unsigned long long)7, (uintptr_t)40, "2026-10-18T10:00:00.123");
+	EXPECT_FORMATS_LIKE_BUFFER(2, "<mem type=\"%s\" free=\"%zu\" total=\"%zu\" percent=\"%zu\" />",
+		"tenure", (uintptr_t)1234567, (uintptr_t)4194304, (uintptr_t)29);
+	EXPECT_FORMATS_LIKE_BUFFER(0, "<warning details=\"%s\" address=\"%p\" />", NULL, (void *)buffer);
+	EXPECT_FORMATS_LIKE_BUFFER(3, "%*s|%-6d|%5.2f|%c|%d%%|%lld", 4, "ab", -17, 3.14159, 'x', 99, (long long)-1);
+	EXPECT_FORMATS_LIKE_BUFFER(0, "%s %s", "", "<tag attribute=\"with a longer string value\" />");
+
+	buffer->kill(env);
+}
+
+TEST_P(VerboseAsyncWriterTest, ConvertsStanzasToJSONLines)
+{
+	const char *xml =
+		"<gc-start id=\"3\" type=\"global\">\n"
+		"  <mem-info free=\"1\" />\n"
+		"  <note>a &lt;b&gt;</note>\n"
+		"</gc-start>\n"
+		"<!-- comment -->\n"
+		"<warning details=\"a &amp; b &#x263A;\" />\n";
+	const char *expected =
+		"{\"tag\":\"gc-start\",\"attributes\":{\"id\":\"3\",\"type\":\"global\"},\"children\":["
+		"{\"tag\":\"mem-info\",\"attributes\":{\"free\":\"1\"}},"
+		"{\"tag\":\"note\",\"children\":[{\"text\":\"a <b>\"}]}]}\n"
+		"{\"tag\":\"warning\",\"attributes\":{\"details\":\"a & b \xe2\x98\xba\"}}\n";
+	char json[512];
+
+	uintptr_t length = MM_VerboseEventDecoder::convertToJSON(xml, strlen(xml), json, sizeof(json));
+	ASSERT_GT(sizeof(json), length);
+	json[length] = '\0';
+	EXPECT_STREQ(expected, json);
+
+	/* a buffer that is too small is never overrun, but the full length is reported */
+	EXPECT_EQ(length, MM_VerboseEventDecoder::convertToJSON(xml, strlen(xml), json, 16));
+}
+
+TEST_P(VerboseAsyncWriterTest, BinaryLogDecodesToSynchronousLog)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	char xmlFile[MAX_NAME_LENGTH];
+	char binaryFile[MAX_NAME_LENGTH];
+	char jsonFile[MAX_NAME_LENGTH];
+	char decodedFile[MAX_NAME_LENGTH];
+	omrstr_printf(xmlFile, MAX_NAME_LENGTH, "VerboseAsyncWriterTest_%d.xml", omrsysinfo_get_pid());
+	omrstr_printf(binaryFile, MAX_NAME_LENGTH, "VerboseAsyncWriterTest_%d.bin", omrsysinfo_get_pid());
+	omrstr_printf(jsonFile, MAX_NAME_LENGTH, "VerboseAsyncWriterTest_%d.json", omrsysinfo_get_pid());
+	omrstr_printf(decodedFile, MAX_NAME_LENGTH, "VerboseAsyncWriterTest_%d.decoded.xml", omrsysinfo_get_pid());
+
+	/* the same stanzas go to a synchronous writer and to asynchronous binary and JSON writers */
+	MM_VerboseManager *manager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
+	ASSERT_TRUE(NULL != manager);
+	ASSERT_TRUE(manager->configureVerboseGC(exampleVM->_omrVM, xmlFile, 0, 0));
+	MM_VerboseWriter *binaryWriter = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, manager, binaryFile, 0, 0, VERBOSE_OUTPUT_BINARY, ASYNC_BUFFER_SIZE);
+	ASSERT_TRUE(NULL != binaryWriter);
+	manager->getWriterChain()->addWriter(binaryWriter);
+	manager->getWriterChain()->activateWriter(binaryWriter);
+	MM_VerboseWriter *jsonWriter = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, manager, jsonFile, 0, 0, VERBOSE_OUTPUT_JSON, ASYNC_BUFFER_SIZE);
+	ASSERT_TRUE(NULL != jsonWriter);
+	manager->getWriterChain()->addWriter(jsonWriter);
+	manager->getWriterChain()->activateWriter(jsonWriter);
+	manager->enableVerboseGC();
+	manager->setInitializedTime(omrtime_hires_clock());
+
+	/* the initialized stanza is written straight into the text buffer */
+	manager->getVerboseHandlerOutput()->outputInitializedStanza(env, manager->getWriterChain()->getBuffer());
+	manager->getWriterChain()->flush(env);
+	for (uintptr_t i = 0; i < 3; i++) {
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+	}
+
+	/* the asynchronous writers have written everything once their threads are gone */
+	manager->closeStreams(env);
+	manager->disableVerboseGC();
+	manager->kill(env);
+
+	uintptr_t xmlSize = 0;
+	uintptr_t binarySize = 0;
+	uintptr_t jsonSize = 0;
+	uintptr_t decodedSize = 0;
+	char *xml = readFile(xmlFile, &xmlSize);
+	char *binary = readFile(binaryFile, &binarySize);
+	char *json = readFile(jsonFile, &jsonSize);
+	ASSERT_TRUE((NULL != xml) && (NULL != binary) && (NULL != json));
+
+	intptr_t fd = omrfile_open(decodedFile, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd);
+	MM_VerboseEventDecoder decoder(gcTestEnv->portLib, VERBOSE_OUTPUT_XML);
+	decoder.setFileDescriptor(fd);
+	EXPECT_TRUE(decoder.decodeStream((uint8_t *)binary, binarySize));
+	decoder.tearDown();
+	omrfile_close(fd);
+
+	char *decoded = readFile(decodedFile, &decodedSize);
+	ASSERT_TRUE(NULL != decoded);
+	EXPECT_EQ(xmlSize, decodedSize);
+	EXPECT_STREQ(xml, decoded);
+
+	/* one JSON line for each element of the verbosegc element */
+	pugi::xml_document document;
+	ASSERT_TRUE(document.load_buffer(xml, xmlSize));
+	uintptr_t elements = 0;
+	for (pugi::xml_node node = document.child("verbosegc").first_child(); node; node = node.next_sibling()) {
+		if (pugi::node_element == node.type()) {
+			elements += 1;
+		}
+	}
+	uintptr_t lines = 0;
+	for (char *line = json; line < (json + jsonSize); line = strchr(line, '\n') + 1) {
+		EXPECT_EQ(0, strncmp(line, "{\"tag\":\"", 8));
+		lines += 1;
+	}
+	gcTestEnv->log("%zu bytes of XML, %zu bytes binary, %zu stanzas\n", xmlSize, binarySize, elements);
+	EXPECT_LT((uintptr_t)3, elements);
+	EXPECT_EQ(elements, lines);
+
+	omrmem_free_memory(xml);
+	omrmem_free_memory(binary);
+	omrmem_free_memory(json);
+	omrmem_free_memory(decoded);
+	if (!gcTestEnv->keepLog) {
+		omrfile_unlink(xmlFile);
+		omrfile_unlink(binaryFile);
+		omrfile_unlink(jsonFile);
+		omrfile_unlink(decodedFile);
+	}
+}
+
+TEST_P(VerboseAsyncWriterTest, FormatsOnlyForActiveWriters)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	char xmlFile[MAX_NAME_LENGTH];
+	char binaryFile[MAX_NAME_LENGTH];
+	omrstr_printf(xmlFile, MAX_NAME_LENGTH, "VerboseAsyncWriterTest_%d.active.xml", omrsysinfo_get_pid());
+	omrstr_printf(binaryFile, MAX_NAME_LENGTH, "VerboseAsyncWriterTest_%d.active.bin", omrsysinfo_get_pid());
+
+	MM_VerboseManager *manager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
+	ASSERT_TRUE(NULL != manager);
+	ASSERT_TRUE(manager->configureVerboseGC(exampleVM->_omrVM, xmlFile, 0, 0));
+	MM_VerboseWriterChain *chain = manager->getWriterChain();
+	MM_VerboseWriter *xmlWriter = chain->getFirstWriter();
+	ASSERT_TRUE(xmlWriter->isActive());
+
+	chain->formatAndOutput(env, 0, "<text />");
+	EXPECT_LT((uintptr_t)0, chain->getBuffer()->currentSize());
+	chain->flush(env);
+
+	/* with no active text writer the output is not formatted */
+	chain->deactivateWriter(xmlWriter);
+	chain->formatAndOutput(env, 0, "<text />");
+	EXPECT_EQ((uintptr_t)0, chain->getBuffer()->currentSize());
+
+	MM_VerboseWriter *binaryWriter = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, manager, binaryFile, 0, 0, VERBOSE_OUTPUT_BINARY, ASYNC_BUFFER_SIZE);
+	ASSERT_TRUE(NULL != binaryWriter);
+	chain->addWriter(binaryWriter);
+	chain->activateWriter(binaryWriter);
+	chain->formatAndOutput(env, 0, "<record />");
+	EXPECT_EQ((uintptr_t)0, chain->getBuffer()->currentSize());
+	chain->flush(env);
+
+	chain->removeWriter(binaryWriter);
+	EXPECT_FALSE(binaryWriter->isActive());
+	EXPECT_TRUE(xmlWriter == chain->getFirstWriter());
+	EXPECT_TRUE(NULL == xmlWriter->getNextWriter());
+	binaryWriter->kill(env);
+
+	chain->activateWriter(xmlWriter);
+	chain->formatAndOutput(env, 0, "<text />");
+	EXPECT_LT((uintptr_t)0, chain->getBuffer()->currentSize());
+	chain->flush(env);
+
+	manager->closeStreams(env);
+	manager->kill(env);
+	if (!gcTestEnv->keepLog) {
+		omrfile_unlink(xmlFile);
+		omrfile_unlink(binaryFile);
+	}
+}
+
+const char *verboseAsyncWriterConfigs[] = {"fvtest/gctest/configuration/global_GC_config.xml"};
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, VerboseAsyncWriterTest,
+        ::testing::ValuesIn(verboseAsyncWriterConfigs));
@@ -34,6 +34,12 @@ GCTestEnvironment::initParams()
 	for (int i = 1; i < _argc; i++) {
 		if (0 == strcmp(_argv[i], "-keepVerboseLog")) {
 			keepLog = true;
+		} else if (0 == strncmp(_argv[i], "-benchmarkResults=", strlen("-benchmarkResults="))) {
+			benchmarkResults = _argv[i] + strlen("-benchmarkResults=");
+		} else if (0 == strncmp(_argv[i], "-benchmarkBaseline=", strlen("-benchmarkBaseline="))) {
+			benchmarkBaseline = _argv[i] + strlen("-benchmarkBaseline=");
+		} else if (0 == strncmp(_argv[i], "-benchmarkTolerance=", strlen("-benchmarkTolerance="))) {
+			benchmarkTolerance = (uintptr_t)atoi(_argv[i] + strlen("-benchmarkTolerance="));
 		}
 	}
 }
@@ -43,6 +43,9 @@ public:
 	OMR_VM_Example exampleVM;
 	std::vector<const char *> params;
 	bool keepLog;
+	const char *benchmarkResults; /**< file that gcBenchmark results are appended to, or NULL */
+	const char *benchmarkBaseline; /**< gcBenchmark results to compare against, or NULL */
+	uintptr_t benchmarkTolerance; /**< percentage by which a result may be worse than its baseline */
 
 	/*
 	 * Function members
@@ -60,7 +63,7 @@ public:
 
 public:
 	GCTestEnvironment(int argc, char **argv)
-	: BaseEnvironment(argc, argv), keepLog(false)
+	: BaseEnvironment(argc, argv), keepLog(false), benchmarkResults(NULL), benchmarkBaseline(NULL), benchmarkTolerance(20)
 	{
 	}
 };
@@ -0,0 +1,249 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+
+static int32_t
+triple(int32_t value)
+   {
+   return 3 * value;
+   }
+
+static int32_t
+quadruple(int32_t value)
+   {
+   return 4 * value;
+   }
+
+// The function AOTCacheCall calls; changed between runs to check that calls
+// in loaded code are relocated to the function of the new run
+//
+static void *calleeAddress = (void *)&triple;
+
+DEFINE_BUILDER(AOTCacheAddOne,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(
+      Add(
+         Load("param"),
+         ConstInt32(1)));
+   return true;
+   }
+
+DEFINE_BUILDER(AOTCacheCall,
+               Int32,
+               PARAM("param", Int32))
+   {
+   DefineFunction((char *)"aotCacheCallee",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  calleeAddress,
+                  Int32,
+                  1,
+                  Int32);
+
+   Return(
+      Add(
+         Call("aotCacheCallee", 1,
+            Load("param")),
+         ConstInt32(1)));
+   return true;
+   }
+
+static int32_t globalValue = 42;
+
+DEFINE_BUILDER(AOTCacheLoadGlobal,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(
+      Add(
+         LoadAt(PointerTo(Int32),
+            ConstAddress(&globalValue)),
+         Load("param")));
+   return true;
+   }
+
+typedef int32_t (*Int32FunctionType)(int32_t);
+
+/**
+ * Each test is a sequence of runs of the JIT, started and shut down in the
+ * test itself, sharing one cache file.
+ */
+class AOTCacheTest : public ::testing::Test
+   {
+   public:
+
+   virtual void SetUp()
+      {
+      remove(fileName("cache").c_str());
+      calleeAddress = (void *)&triple;
+      }
+
+   virtual void TearDown()
+      {
+      remove(fileName("cache").c_str());
+      remove(fileName("vlog").c_str());
+      }
+
+   static std::string fileName(const char *suffix)
+      {
+      char name[1024];
+      snprintf(name, sizeof(name), "/tmp/omr-aotcache-%d.%s", (int)getpid(), suffix);
+      return name;
+      }
+
+   static bool startJit()
+      {
+      std::string options = "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+         "verbose={compileEnd},vlog=" + fileName("vlog") + ",aotCacheFile=" + fileName("cache");
+      return initializeJitWithOptions(const_cast<char *>(options.c_str()));
+      }
+
+   static std::string readFile(const std::string &name)
+      {
+      std::string contents;
+      FILE *file = fopen(name.c_str(), "rb");
+      if (file)
+         {
+         char buffer[4096];
+         size_t n;
+         while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            contents.append(buffer, n);
+         fclose(file);
+         }
+      return contents;
+      }
+
+   static bool logged(const char *action, const char *method)
+      {
+      std::string vlog = readFile(fileName("vlog"));
+      for (size_t line = 0; line < vlog.size(); line = vlog.find('\n', line) + 1)
+         {
+         std::string text = vlog.substr(line, vlog.find('\n', line) - line);
+         if (text.find(action) != std::string::npos && text.find(method) != std::string::npos)
+            return true;
+         if (vlog.find('\n', line) == std::string::npos)
+            break;
+         }
+      return false;
+      }
+   };
+
+TEST_F(AOTCacheTest, LaterRunsLoadStoredMethods)
+   {
+   Int32FunctionType addOne;
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheAddOne, addOne);
+   EXPECT_EQ(4, addOne(3));
+   EXPECT_TRUE(logged("stored", "AOTCacheAddOne"));
+   EXPECT_FALSE(logged("loaded", "AOTCacheAddOne"));
+   shutdownJit();
+
+   size_t cacheSize = readFile(fileName("cache")).size();
+   ASSERT_GT(cacheSize, 0U);
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheAddOne, addOne);
+   EXPECT_EQ(4, addOne(3));
+   EXPECT_EQ(-6, addOne(-7));
+   EXPECT_TRUE(logged("loaded", "AOTCacheAddOne"));
+   EXPECT_FALSE(logged("stored", "AOTCacheAddOne"));
+   shutdownJit();
+
+   EXPECT_EQ(cacheSize, readFile(fileName("cache")).size()) << "A loaded method was stored again";
+   }
+
+TEST_F(AOTCacheTest, LoadedCallsAreRelocated)
+   {
+   Int32FunctionType call;
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheCall, call);
+   EXPECT_EQ(7, call(2));
+   EXPECT_TRUE(logged("stored", "AOTCacheCall"));
+   shutdownJit();
+
+   calleeAddress = (void *)&quadruple;
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheCall, call);
+   EXPECT_TRUE(logged("loaded", "AOTCacheCall"));
+   EXPECT_EQ(9, call(2));
+   shutdownJit();
+   }
+
+TEST_F(AOTCacheTest, DamagedRecordsAreIgnored)
+   {
+   Int32FunctionType addOne;
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheAddOne, addOne);
+   shutdownJit();
+
+   // Change the last byte of the record, as a writer that did not finish it
+   // might have left it
+   //
+   std::string cache = readFile(fileName("cache"));
+   ASSERT_GT(cache.size(), 0U);
+   cache[cache.size() - 1] ^= 0x5a;
+   FILE *file = fopen(fileName("cache").c_str(), "wb");
+   ASSERT_TRUE(file != NULL);
+   fwrite(cache.data(), 1, cache.size(), file);
+   fclose(file);
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheAddOne, addOne);
+   EXPECT_EQ(4, addOne(3));
+   EXPECT_FALSE(logged("loaded", "AOTCacheAddOne"));
+   EXPECT_TRUE(logged("stored", "AOTCacheAddOne"));
+   shutdownJit();
+
+   // The damaged record was cut off, so the method stored again takes its place
+   // and is found by the next run
+   //
+   EXPECT_EQ(cache.size(), readFile(fileName("cache")).size());
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheAddOne, addOne);
+   EXPECT_EQ(4, addOne(3));
+   EXPECT_TRUE(logged("loaded", "AOTCacheAddOne"));
+   EXPECT_FALSE(logged("stored", "AOTCacheAddOne"));
+   shutdownJit();
+   }
+
+TEST_F(AOTCacheTest, MethodsUsingAddressesAreNotStored)
+   {
+   Int32FunctionType loadGlobal;
+
+   ASSERT_TRUE(startJit()) << "Failed to initialize the JIT.";
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, AOTCacheLoadGlobal, loadGlobal);
+   EXPECT_EQ(42, loadGlobal(0));
+   EXPECT_FALSE(logged("stored", "AOTCacheLoadGlobal"));
+   shutdownJit();
+   }
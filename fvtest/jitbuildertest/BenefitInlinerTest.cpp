@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "JBTestUtil.hpp"
+
+// The callee is regenerated with the bias in effect at each IL generation, so
+// an inlined call returns a different bias than a call to its compiled body
+//
+static int32_t calleeBias = 0;
+static int32_t calleeILGenerations = 0;
+
+// Enough rounds for the callee to fit the inlining budget of its caller once
+// but not twice
+//
+static const int32_t mixRounds = 5;
+
+static int32_t
+mix(int32_t x, int32_t bias)
+   {
+   int32_t value = x;
+   for (int32_t i = 1; i <= mixRounds; i++)
+      value = (value * (2 * i + 1)) ^ (x + i);
+   return value + bias;
+   }
+
+// Cheap for a zero argument, and expensive otherwise
+//
+DEFINE_BUILDER( MixOrBias,
+                Int32,
+                PARAM("x", Int32) )
+   {
+   calleeILGenerations++;
+
+   OMR::JitBuilder::IlBuilder *zero = NULL;
+   OMR::JitBuilder::IlBuilder *nonZero = NULL;
+   IfThenElse(&zero, &nonZero,
+      EqualTo(
+         Load("x"),
+         ConstInt32(0)));
+
+   zero->Return(
+   zero->   ConstInt32(calleeBias));
+
+   nonZero->Store("value",
+   nonZero->   Load("x"));
+   for (int32_t i = 1; i <= mixRounds; i++)
+      {
+      nonZero->Store("value",
+      nonZero->   Xor(
+      nonZero->      Mul(
+      nonZero->         Load("value"),
+      nonZero->         ConstInt32(2 * i + 1)),
+      nonZero->      Add(
+      nonZero->         Load("x"),
+      nonZero->         ConstInt32(i))));
+      }
+   nonZero->Return(
+   nonZero->   Add(
+   nonZero->      Load("value"),
+   nonZero->      ConstInt32(calleeBias)));
+   return true;
+   }
+
+class MixTwice : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   MixTwice(OMR::JitBuilder::TypeDictionary *types, void *calleeEntry)
+      : OMR::JitBuilder::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("MixTwice");
+      DefineParameter("y", Int32);
+      DefineReturnType(Int32);
+
+      DefineFunction((char *)"mixOrBias",
+                     (char *)__FILE__,
+                     (char *)LINETOSTR(__LINE__),
+                     calleeEntry,
+                     Int32,
+                     1,
+                     Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         Add(
+            Call("mixOrBias", 1,
+               ConstInt32(0)),
+            Call("mixOrBias", 1,
+               Load("y"))));
+      return true;
+      }
+   };
+
+class BenefitInlinerTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      const char *options = "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+         "enableBenefitInliner";
+      ASSERT_TRUE(initializeJitWithOptions(const_cast<char *>(options))) << "Failed to initialize the JIT.";
+      }
+   };
+
+typedef int32_t (*MixFunctionType)(int32_t);
+
+TEST_F(BenefitInlinerTest, ConstantArgumentDecidesWhichCallIsInlined)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   MixOrBias callee(&types);
+   void *calleeEntry;
+   calleeBias = 0;
+   ASSERT_EQ(0, compileMethodBuilder(&callee, &calleeEntry));
+   MixFunctionType mixOrBias = (MixFunctionType)calleeEntry;
+   ASSERT_EQ(0, mixOrBias(0));
+   ASSERT_EQ(mix(5, 0), mixOrBias(5));
+
+   MixTwice builder(&types, calleeEntry);
+   builder.DefineFunctionIL("mixOrBias", &callee);
+
+   calleeBias = 1000;
+   calleeILGenerations = 0;
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+   MixFunctionType mixTwice = (MixFunctionType)entry;
+
+   // Only the call whose constant argument folds the callee's branch is
+   // inlined; the other one calls the body compiled without the bias
+   ASSERT_EQ(1, calleeILGenerations);
+   ASSERT_EQ(1000 + mix(5, 0), mixTwice(5));
+   ASSERT_EQ(1000 + mix(-7, 0), mixTwice(-7));
+   }
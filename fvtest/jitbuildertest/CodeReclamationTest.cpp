@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+
+DEFINE_BUILDER(TestIncrementArgument,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(
+      Add(
+         Load("param"),
+         ConstInt32(1)));
+   return true;
+   }
+
+DEFINE_BUILDER(TestDoubleArgument,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(
+      Mul(
+         Load("param"),
+         ConstInt32(2)));
+   return true;
+   }
+
+class CodeReclamationTest : public JitBuilderTest {};
+
+typedef int32_t (*Int32FunctionType)(int32_t);
+
+TEST_F(CodeReclamationTest, NothingToReclaim)
+   {
+   ASSERT_EQ(0, reclaimRetiredCode());
+   int32_t local;
+   ASSERT_FALSE(retireCompiledCode(&local)) << "Address outside the code cache was retired";
+   }
+
+TEST_F(CodeReclamationTest, ReclaimMostRecentBody)
+   {
+   Int32FunctionType first;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestIncrementArgument, first);
+   ASSERT_EQ(4, first(3));
+
+   ASSERT_TRUE(retireCompiledCode((void *)first));
+   ASSERT_EQ(1, reclaimRetiredCode());
+
+   // The body was the last one allocated, so its space is handed out again
+   //
+   Int32FunctionType second;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestIncrementArgument, second);
+   ASSERT_EQ((void *)first, (void *)second);
+   ASSERT_EQ(4, second(3));
+   }
+
+TEST_F(CodeReclamationTest, ReclaimBodyBetweenLiveBodies)
+   {
+   Int32FunctionType before, retired, after;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestIncrementArgument, before);
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestDoubleArgument, retired);
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestIncrementArgument, after);
+
+   ASSERT_TRUE(retireCompiledCode((void *)retired));
+   ASSERT_EQ(1, reclaimRetiredCode());
+
+   // The bodies around the reclaimed one are untouched
+   //
+   ASSERT_EQ(11, before(10));
+   ASSERT_EQ(11, after(10));
+
+   Int32FunctionType reused;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestDoubleArgument, reused);
+   ASSERT_EQ(20, reused(10));
+   ASSERT_EQ(11, before(10));
+   ASSERT_EQ(11, after(10));
+   }
+
+TEST_F(CodeReclamationTest, RepeatedRecompilationReusesSpace)
+   {
+   Int32FunctionType first;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestIncrementArgument, first);
+
+   Int32FunctionType current = first;
+   for (int32_t i = 0; i < 100; i++)
+      {
+      ASSERT_TRUE(retireCompiledCode((void *)current));
+      ASSERT_EQ(1, reclaimRetiredCode());
+      ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestIncrementArgument, current);
+      ASSERT_EQ(i + 1, current(i));
+      }
+   ASSERT_EQ((void *)first, (void *)current);
+   }
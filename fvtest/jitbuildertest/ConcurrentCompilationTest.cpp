@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stddef.h>
+#include <thread>
+#include <vector>
+
+#define NUM_THREADS 4
+#define COMPILES_PER_THREAD 25
+#define NUM_POINTS 16
+
+struct ConcurrentPoint
+   {
+   int32_t x;
+   int32_t y;
+   };
+
+union ConcurrentBits
+   {
+   int32_t i;
+   int32_t j;
+   };
+
+DEFINE_TYPES(ConcurrentTypes)
+   {
+   DefineStruct("ConcurrentPoint");
+   DefineField("ConcurrentPoint", "x", Int32, offsetof(ConcurrentPoint, x));
+   DefineField("ConcurrentPoint", "y", Int32, offsetof(ConcurrentPoint, y));
+   CloseStruct("ConcurrentPoint", sizeof(ConcurrentPoint));
+
+   DefineUnion("ConcurrentBits");
+   UnionField("ConcurrentBits", "i", Int32);
+   UnionField("ConcurrentBits", "j", Int32);
+   CloseUnion("ConcurrentBits");
+   }
+
+// The sum of x * y over the points, returned through the other field of the
+// union it is stored to
+//
+DEFINE_BUILDER(ConcurrentDotProduct,
+               Int32,
+               PARAM("points", PointerTo("ConcurrentPoint")),
+               PARAM("n", Int32),
+               PARAM("bits", PointerTo(LookupUnion("ConcurrentBits"))))
+   {
+   Store("sum", ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop,
+             ConstInt32(0),
+             Load("n"),
+             ConstInt32(1));
+
+   loop->Store("point",
+   loop->   IndexAt(PointerTo("ConcurrentPoint"),
+   loop->      Load("points"),
+   loop->      Load("i")));
+   loop->Store("sum",
+   loop->   Add(
+   loop->      Load("sum"),
+   loop->      Mul(
+   loop->         LoadIndirect("ConcurrentPoint", "x", loop->Load("point")),
+   loop->         LoadIndirect("ConcurrentPoint", "y", loop->Load("point")))));
+
+   StoreIndirect("ConcurrentBits", "i", Load("bits"), Load("sum"));
+   Return(
+      LoadIndirect("ConcurrentBits", "j", Load("bits")));
+   return true;
+   }
+
+typedef int32_t (*ConcurrentDotProductFunctionType)(ConcurrentPoint *, int32_t, ConcurrentBits *);
+
+class ConcurrentCompilationTest : public JitBuilderTest {};
+
+// Each thread builds and compiles its own methods with a dictionary shared by
+// all of them, calls each one and retires it, while this thread reclaims the
+// retired code
+//
+TEST_F(ConcurrentCompilationTest, SharedTypeDictionary)
+   {
+   ConcurrentTypes types;
+   std::vector<int32_t> failures(NUM_THREADS, 0);
+   std::vector<std::thread> threads;
+   std::atomic<int32_t> running(NUM_THREADS);
+
+   for (int32_t t = 0; t < NUM_THREADS; t++)
+      {
+      threads.push_back(std::thread([&types, &failures, &running, t]()
+         {
+         ConcurrentPoint points[NUM_POINTS];
+         for (int32_t c = 0; c < COMPILES_PER_THREAD; c++)
+            {
+            int32_t expected = 0;
+            for (int32_t p = 0; p < NUM_POINTS; p++)
+               {
+               points[p].x = t + p;
+               points[p].y = c - p;
+               expected += points[p].x * points[p].y;
+               }
+
+            ConcurrentDotProduct builder(&types);
+            void *entry = NULL;
+            if (compileMethodBuilder(&builder, &entry) != 0 || entry == NULL)
+               {
+               failures[t]++;
+               continue;
+               }
+
+            ConcurrentBits bits;
+            if (((ConcurrentDotProductFunctionType)entry)(points, NUM_POINTS, &bits) != expected)
+               failures[t]++;
+            retireCompiledCode(entry);
+            }
+         running--;
+         }));
+      }
+
+   while (running > 0)
+      {
+      reclaimRetiredCode();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+   for (int32_t t = 0; t < NUM_THREADS; t++)
+      threads[t].join();
+   reclaimRetiredCode();
+
+   for (int32_t t = 0; t < NUM_THREADS; t++)
+      EXPECT_EQ(0, failures[t]) << "Failed compilations or wrong results on thread " << t;
+   }
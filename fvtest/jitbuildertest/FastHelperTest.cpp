@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+// The helper only preserves rsi, rdi and r8-r10 of the registers the system
+// linkage lets it change, and deliberately changes rcx, rdx and r11
+//
+static const int64_t preservedByScramble = 0x7c0;
+
+extern "C" int32_t fastHelperScramble(int32_t value);
+
+__asm__(
+   ".pushsection .text\n"
+   "fastHelperScramble:\n"
+   "   imull $7, %edi, %eax\n"
+   "   addl $3, %eax\n"
+   "   movq $-1, %rcx\n"
+   "   movq $-1, %rdx\n"
+   "   movq $-1, %r11\n"
+   "   ret\n"
+   ".popsection\n");
+
+static int32_t
+scramble(int32_t value)
+   {
+   return value * 7 + 3;
+   }
+
+static int32_t
+addOne(int32_t value)
+   {
+   return value + 1;
+   }
+
+static int32_t tripleCalls = 0;
+
+static int32_t
+triple(int32_t value)
+   {
+   tripleCalls++;
+   return 3 * value;
+   }
+
+DECLARE_BUILDER(PreservingHelperLoop);
+
+DEFINE_BUILDER_CTOR(PreservingHelperLoop)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+   DefineName("PreservingHelperLoop");
+   DefineParameter("n", Int32);
+   DefineParameter("a", Int32);
+   DefineParameter("b", Int32);
+   DefineReturnType(Int32);
+
+   DefineFunction((char *)"scramble",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  (void *)&fastHelperScramble,
+                  Int32,
+                  1,
+                  Int32);
+   DefineFastHelper("scramble", preservedByScramble, false);
+   }
+
+// a, b and the loop's own values are live across every call
+DEFINE_BUILDIL(PreservingHelperLoop)
+   {
+   Store("sum",
+      ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop,
+             ConstInt32(0),
+             Load("n"),
+             ConstInt32(1));
+
+   loop->Store("sum",
+   loop->   Add(
+   loop->      Load("sum"),
+   loop->      Add(
+   loop->         Mul(
+   loop->            Call("scramble", 1,
+   loop->               Load("i")),
+   loop->            Load("a")),
+   loop->         Load("b"))));
+
+   Return(
+      Load("sum"));
+   return true;
+   }
+
+DECLARE_BUILDER(LeafHelperLoop);
+
+DEFINE_BUILDER_CTOR(LeafHelperLoop)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+   DefineName("LeafHelperLoop");
+   DefineParameter("n", Int32);
+   DefineReturnType(Int32);
+
+   DefineFunction((char *)"addOne",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  (void *)&addOne,
+                  Int32,
+                  1,
+                  Int32);
+   DefineFastHelper("addOne", 0, true);
+   }
+
+DEFINE_BUILDIL(LeafHelperLoop)
+   {
+   Store("value",
+      ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop,
+             ConstInt32(0),
+             Load("n"),
+             ConstInt32(1));
+
+   loop->Store("value",
+   loop->   Call("addOne", 1,
+   loop->      Load("value")));
+
+   Return(
+      Load("value"));
+   return true;
+   }
+
+DEFINE_BUILDER( TripleIL,
+                Int32,
+                PARAM("value", Int32) )
+   {
+   Return(
+      Mul(
+         Load("value"),
+         ConstInt32(3)));
+   return true;
+   }
+
+DECLARE_BUILDER(TripleTwice);
+
+DEFINE_BUILDER_CTOR(TripleTwice)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+   DefineName("TripleTwice");
+   DefineParameter("x", Int32);
+   DefineParameter("y", Int32);
+   DefineReturnType(Int32);
+
+   DefineFunction((char *)"triple",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  (void *)&triple,
+                  Int32,
+                  1,
+                  Int32);
+   }
+
+DEFINE_BUILDIL(TripleTwice)
+   {
+   Return(
+      Sub(
+         Call("triple", 1,
+            Load("x")),
+         Call("triple", 1,
+            Load("y"))));
+   return true;
+   }
+
+typedef int32_t (*HelperLoopFunctionType)(int32_t, int32_t, int32_t);
+typedef int32_t (*LeafLoopFunctionType)(int32_t);
+typedef int32_t (*TripleTwiceFunctionType)(int32_t, int32_t);
+
+class FastHelperTest : public JitBuilderTest {};
+
+TEST_F(FastHelperTest, PreservedRegistersSurviveCalls)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   PreservingHelperLoop builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+   HelperLoopFunctionType helperLoop = (HelperLoopFunctionType)entry;
+
+   for (int32_t n = 0; n < 20; n++)
+      {
+      int32_t expected = 0;
+      for (int32_t i = 0; i < n; i++)
+         expected += scramble(i) * 5 + 11;
+      ASSERT_EQ(expected, helperLoop(n, 5, 11)) << "n = " << n;
+      }
+   }
+
+TEST_F(FastHelperTest, LeafHelperIsCalled)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   LeafHelperLoop builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+   LeafLoopFunctionType leafLoop = (LeafLoopFunctionType)entry;
+
+   ASSERT_EQ(0, leafLoop(0));
+   ASSERT_EQ(1, leafLoop(1));
+   ASSERT_EQ(1000, leafLoop(1000));
+   }
+
+TEST_F(FastHelperTest, FunctionILIsInlinedOncePerCompilation)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   TripleIL tripleIL(&types);
+   TripleTwice builder(&types);
+   builder.DefineFunctionIL("triple", &tripleIL);
+
+   // the builder is inlined again when the method is compiled again
+   for (int32_t compilation = 0; compilation < 2; compilation++)
+      {
+      void *entry;
+      ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+      TripleTwiceFunctionType tripleTwice = (TripleTwiceFunctionType)entry;
+
+      tripleCalls = 0;
+      ASSERT_EQ(12, tripleTwice(7, 3));
+      ASSERT_EQ(1, tripleCalls);
+      }
+   }
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#define HOT_INVOCATION_THRESHOLD 100 // must match the option below
+
+DECLARE_BUILDER(HotMethod);
+DEFINE_BUILDER_CTOR(HotMethod)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+   DefineName("HotMethod");
+   DefineParameter("param", Int32);
+   DefineReturnType(Int32);
+   SetInvocationCount(HOT_INVOCATION_THRESHOLD);
+   }
+
+DEFINE_BUILDIL(HotMethod)
+   {
+   Return(
+      Add(
+         Load("param"),
+         ConstInt32(1)));
+   return true;
+   }
+
+DECLARE_BUILDER(ColdMethod);
+DEFINE_BUILDER_CTOR(ColdMethod)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+   DefineName("ColdMethod");
+   DefineParameter("param", Int32);
+   DefineReturnType(Int32);
+   SetInvocationCount(HOT_INVOCATION_THRESHOLD - 1);
+   }
+
+DEFINE_BUILDIL(ColdMethod)
+   {
+   Return(
+      Sub(
+         Load("param"),
+         ConstInt32(1)));
+   return true;
+   }
+
+class HotCodeCacheLayoutTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      const char *options = "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+         "enableHotCodeCacheLayout,hotCodeCacheInvocationThreshold=100";
+      ASSERT_TRUE(initializeJitWithOptions(const_cast<char *>(options))) << "Failed to initialize the JIT.";
+      }
+   };
+
+static bool isBetween(void *p, void *low, void *high)
+   {
+   return (uintptr_t)low < (uintptr_t)p && (uintptr_t)p < (uintptr_t)high;
+   }
+
+typedef int32_t (*Int32FunctionType)(int32_t);
+
+TEST_F(HotCodeCacheLayoutTest, HotMethodsArePlacedTogether)
+   {
+   Int32FunctionType cold1, hot1, cold2, hot2;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, ColdMethod, cold1);
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, HotMethod, hot1);
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, ColdMethod, cold2);
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, HotMethod, hot2);
+
+   ASSERT_EQ(2, cold1(3));
+   ASSERT_EQ(4, hot1(3));
+   ASSERT_EQ(2, cold2(3));
+   ASSERT_EQ(4, hot2(3));
+
+   // Each kind of method is allocated contiguously, without the other kind
+   // in between
+   //
+   ASSERT_LT((uintptr_t)cold1, (uintptr_t)cold2);
+   ASSERT_LT((uintptr_t)hot1, (uintptr_t)hot2);
+   ASSERT_FALSE(isBetween((void *)hot1, (void *)cold1, (void *)cold2));
+   ASSERT_FALSE(isBetween((void *)hot2, (void *)cold1, (void *)cold2));
+   ASSERT_FALSE(isBetween((void *)cold1, (void *)hot1, (void *)hot2));
+   ASSERT_FALSE(isBetween((void *)cold2, (void *)hot1, (void *)hot2));
+   }
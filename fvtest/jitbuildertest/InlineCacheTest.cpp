@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+static int32_t
+addOne(int32_t value)
+   {
+   return value + 1;
+   }
+
+static int32_t
+timesTwo(int32_t value)
+   {
+   return 2 * value;
+   }
+
+static int32_t
+negate(int32_t value)
+   {
+   return -value;
+   }
+
+static int32_t lastStored = 0;
+
+static void
+store(int32_t value)
+   {
+   lastStored = value;
+   }
+
+// The functions are defined by the constructors, since each test compiles its
+// builder more than once
+//
+DECLARE_BUILDER(InlineCacheDispatch);
+
+DEFINE_BUILDER_CTOR(InlineCacheDispatch)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+   DefineName("InlineCacheDispatch");
+   DefineParameter("target", Address);
+   DefineParameter("value", Int32);
+   DefineReturnType(Int32);
+
+   DefineFunction((char *)"dispatchTarget",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  NULL,
+                  Int32,
+                  1,
+                  Int32);
+   }
+
+DEFINE_BUILDIL(InlineCacheDispatch)
+   {
+   Return(
+      InlineCacheCall((char *)"dispatchTarget", 2, 2,
+         Load("target"),
+         Load("value")));
+   return true;
+   }
+
+DECLARE_BUILDER(InlineCacheDispatchTwice);
+
+DEFINE_BUILDER_CTOR(InlineCacheDispatchTwice)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+   DefineName("InlineCacheDispatchTwice");
+   DefineParameter("first", Address);
+   DefineParameter("second", Address);
+   DefineParameter("value", Int32);
+   DefineReturnType(NoType);
+
+   DefineFunction((char *)"storeTarget",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  NULL,
+                  NoType,
+                  1,
+                  Int32);
+   }
+
+DEFINE_BUILDIL(InlineCacheDispatchTwice)
+   {
+   InlineCacheCall((char *)"storeTarget", 1, 2,
+      Load("first"),
+      Load("value"));
+   InlineCacheCall((char *)"storeTarget", 1, 2,
+      Load("second"),
+      Add(
+         Load("value"),
+         ConstInt32(1)));
+   Return();
+   return true;
+   }
+
+typedef int32_t (*DispatchFunctionType)(void *, int32_t);
+typedef void (*DispatchTwiceFunctionType)(void *, void *, int32_t);
+
+class InlineCacheTest : public JitBuilderTest {};
+
+TEST_F(InlineCacheTest, MissesAreRecordedAndGuardedOnRecompilation)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   InlineCacheDispatch builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+   DispatchFunctionType dispatch = (DispatchFunctionType)entry;
+
+   ASSERT_EQ(1, builder.GetNumInlineCaches());
+   ASSERT_EQ(0, builder.GetInlineCacheNumTargets(0));
+
+   // nothing is cached yet, so every call misses
+   ASSERT_EQ(4, dispatch((void *)&addOne, 3));
+   ASSERT_EQ(6, dispatch((void *)&timesTwo, 3));
+   ASSERT_EQ(8, dispatch((void *)&addOne, 7));
+   ASSERT_EQ(3, builder.GetInlineCacheMisses(0));
+   ASSERT_EQ(2, builder.GetInlineCacheNumTargets(0));
+   ASSERT_EQ((void *)&addOne, builder.GetInlineCacheTarget(0, 0));
+   ASSERT_EQ((void *)&timesTwo, builder.GetInlineCacheTarget(0, 1));
+   ASSERT_EQ(0, builder.GetInlineCacheHits(0, 0));
+
+   // the cache is full, so a third target is called but not recorded
+   ASSERT_EQ(-5, dispatch((void *)&negate, 5));
+   ASSERT_EQ(4, builder.GetInlineCacheMisses(0));
+   ASSERT_EQ(2, builder.GetInlineCacheNumTargets(0));
+
+   // code compiled now calls the cached targets directly
+   ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+   dispatch = (DispatchFunctionType)entry;
+   ASSERT_EQ(1, builder.GetNumInlineCaches());
+
+   for (int32_t i = 0; i < 10; i++)
+      {
+      ASSERT_EQ(i + 1, dispatch((void *)&addOne, i));
+      ASSERT_EQ(2 * i, dispatch((void *)&timesTwo, i));
+      }
+   ASSERT_EQ(-1, dispatch((void *)&negate, 1));
+
+   EXPECT_EQ(10, builder.GetInlineCacheHits(0, 0));
+   EXPECT_EQ(10, builder.GetInlineCacheHits(0, 1));
+   EXPECT_EQ(5, builder.GetInlineCacheMisses(0));
+   EXPECT_EQ(2, builder.GetInlineCacheNumTargets(0));
+   }
+
+TEST_F(InlineCacheTest, EachCallSiteHasItsOwnCache)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   InlineCacheDispatchTwice builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+   DispatchTwiceFunctionType dispatchTwice = (DispatchTwiceFunctionType)entry;
+
+   ASSERT_EQ(2, builder.GetNumInlineCaches());
+
+   // negate's result is ignored by the first call site
+   dispatchTwice((void *)&negate, (void *)&store, 10);
+   ASSERT_EQ(11, lastStored);
+
+   ASSERT_EQ(0, compileMethodBuilder(&builder, &entry));
+   dispatchTwice = (DispatchTwiceFunctionType)entry;
+   ASSERT_EQ(2, builder.GetNumInlineCaches());
+
+   dispatchTwice((void *)&store, (void *)&store, 20);
+   ASSERT_EQ(21, lastStored);
+
+   ASSERT_EQ((void *)&negate, builder.GetInlineCacheTarget(0, 0));
+   ASSERT_EQ((void *)&store, builder.GetInlineCacheTarget(1, 0));
+   EXPECT_EQ(2, builder.GetInlineCacheMisses(0));
+   EXPECT_EQ(0, builder.GetInlineCacheHits(0, 0));
+   EXPECT_EQ(1, builder.GetInlineCacheMisses(1));
+   EXPECT_EQ(1, builder.GetInlineCacheHits(1, 0));
+   }
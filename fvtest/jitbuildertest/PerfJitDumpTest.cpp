@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+DEFINE_BUILDER(TestAddOne,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(
+      Add(
+         Load("param"),
+         ConstInt32(1)));
+   return true;
+   }
+
+class PerfJitDumpTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      const char *options = "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+         "perfJitDump,perfJitDumpDebugInfo";
+      ASSERT_TRUE(initializeJitWithOptions(const_cast<char *>(options))) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      shutdownJit();
+      remove(dumpFileName().c_str());
+      }
+
+   static std::string dumpFileName()
+      {
+      const char *directory = getenv("JITDUMPDIR");
+      char name[1024];
+      snprintf(name, sizeof(name), "%s/jit-%d.dump", directory && *directory ? directory : "/tmp", (int)getpid());
+      return name;
+      }
+
+   static std::vector<uint8_t> readDump()
+      {
+      std::vector<uint8_t> contents;
+      FILE *file = fopen(dumpFileName().c_str(), "rb");
+      if (file)
+         {
+         uint8_t buffer[4096];
+         size_t n;
+         while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            contents.insert(contents.end(), buffer, buffer + n);
+         fclose(file);
+         }
+      return contents;
+      }
+
+   template <typename T>
+   static T read(const std::vector<uint8_t> &dump, size_t offset)
+      {
+      T value;
+      memcpy(&value, &dump[offset], sizeof(T));
+      return value;
+      }
+   };
+
+typedef int32_t (*Int32FunctionType)(int32_t);
+
+TEST_F(PerfJitDumpTest, CodeLoadRecordsCompiledCode)
+   {
+   Int32FunctionType addOne;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestAddOne, addOne);
+   ASSERT_EQ(4, addOne(3));
+
+   std::vector<uint8_t> dump = readDump();
+   ASSERT_GE(dump.size(), 40U) << "No file header in " << dumpFileName();
+   ASSERT_EQ(0x4A695444U, read<uint32_t>(dump, 0)) << "Wrong magic";
+   ASSERT_EQ(1U, read<uint32_t>(dump, 4)) << "Wrong version";
+   ASSERT_EQ((uint32_t)getpid(), read<uint32_t>(dump, 20));
+
+   // Walk the records to the load record of the method, which must be
+   // preceded by its debug info
+   //
+   bool foundLoad = false;
+   bool foundDebugInfo = false;
+   for (size_t offset = read<uint32_t>(dump, 8); offset + 16 <= dump.size(); )
+      {
+      uint32_t id = read<uint32_t>(dump, offset);
+      uint32_t size = read<uint32_t>(dump, offset + 4);
+      ASSERT_GE(size, 16U);
+      ASSERT_LE(offset + size, dump.size()) << "Truncated record";
+
+      if (id == 2 && read<uint64_t>(dump, offset + 16) == (uintptr_t)addOne)
+         {
+         foundDebugInfo = true;
+         EXPECT_GT(read<uint64_t>(dump, offset + 24), 0U) << "Debug info without entries";
+         }
+      else if (id == 0 && read<uint64_t>(dump, offset + 32) == (uintptr_t)addOne)
+         {
+         foundLoad = true;
+         EXPECT_TRUE(foundDebugInfo) << "Debug info must precede the code load";
+
+         uint64_t codeSize = read<uint64_t>(dump, offset + 40);
+         const char *name = (const char *)&dump[offset + 56];
+         EXPECT_NE((const char *)NULL, strstr(name, "TestAddOne")) << name;
+
+         const uint8_t *code = &dump[offset + 56 + strlen(name) + 1];
+         ASSERT_EQ(offset + size, (size_t)(code - &dump[0]) + codeSize);
+         EXPECT_EQ(0, memcmp(code, (const void *)addOne, codeSize)) << "Recorded code differs from the compiled code";
+         }
+
+      offset += size;
+      }
+
+   EXPECT_TRUE(foundLoad) << "No code load record for the compiled method";
+   }
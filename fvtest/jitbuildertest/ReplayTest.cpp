@@ -0,0 +1,278 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static int32_t
+replayCallee(int32_t value)
+   {
+   return 3 * value + 1;
+   }
+
+DEFINE_BUILDER(ReplayLoopAndBranch,
+               Int64,
+               PARAM("n", Int32))
+   {
+   Store("sum", ConstInt64(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop,
+             ConstInt32(0),
+             Load("n"),
+             ConstInt32(1));
+
+   // odd values count three times over
+   OMR::JitBuilder::IlBuilder *odd = NULL;
+   OMR::JitBuilder::IlBuilder *even = NULL;
+   loop->IfThenElse(&odd, &even,
+   loop->   And(
+   loop->      Load("i"),
+   loop->      ConstInt32(1)));
+
+   odd->Store("sum",
+   odd->   Add(
+   odd->      Load("sum"),
+   odd->      ConvertTo(Int64,
+   odd->         Mul(
+   odd->            Load("i"),
+   odd->            ConstInt32(3)))));
+
+   even->Store("sum",
+   even->   Add(
+   even->      Load("sum"),
+   even->      ConvertTo(Int64,
+   even->         Load("i"))));
+
+   Return(
+      Load("sum"));
+   return true;
+   }
+
+DEFINE_BUILDER(ReplayDoubleAndCall,
+               Double,
+               PARAM("x", Double),
+               PARAM("y", Int32))
+   {
+   DefineFunction((char *)"replayCallee",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  (void *)&replayCallee,
+                  Int32,
+                  1,
+                  Int32);
+
+   // a constant with no short decimal form checks that doubles replay exactly
+   Return(
+      Add(
+         Mul(
+            Load("x"),
+            ConstDouble(0.1)),
+         ConvertTo(Double,
+            Call("replayCallee", 1,
+               Load("y")))));
+   return true;
+   }
+
+typedef struct ReplayPoint
+   {
+   int32_t x;
+   int32_t y;
+   } ReplayPoint;
+
+DEFINE_TYPES(ReplayPointTypeDictionary)
+   {
+   DEFINE_STRUCT(ReplayPoint);
+   DEFINE_FIELD(ReplayPoint, x, Int32);
+   DEFINE_FIELD(ReplayPoint, y, Int32);
+   CLOSE_STRUCT(ReplayPoint);
+   }
+
+DEFINE_BUILDER(ReplayStructField,
+               Int32,
+               PARAM("point", PointerTo("ReplayPoint")))
+   {
+   Return(
+      LoadIndirect("ReplayPoint", "y",
+         Load("point")));
+   return true;
+   }
+
+typedef int64_t (*LoopAndBranchFunctionType)(int32_t);
+typedef double (*DoubleAndCallFunctionType)(double, int32_t);
+typedef int32_t (*StructFieldFunctionType)(ReplayPoint *);
+
+/**
+ * Each test records a compilation to a file and compiles the method again
+ * from the recording alone, in text and in binary format.
+ */
+class ReplayTest : public JitBuilderTest, public ::testing::WithParamInterface<bool>
+   {
+   public:
+
+   virtual void TearDown()
+      {
+      remove(recordingFile().c_str());
+      }
+
+   // parameterized test names contain a '/', which cannot be in a file name
+   static std::string recordingFile()
+      {
+      const ::testing::TestInfo *test = ::testing::UnitTest::GetInstance()->current_test_info();
+      std::string name = std::string("replaytest-") + test->name() + ".jbil";
+      for (size_t i = 0; i < name.size(); i++)
+         if (name[i] == '/')
+            name[i] = '-';
+      return name;
+      }
+
+   // make a text recording look as if another process had made it, by
+   // changing the process ID that follows the version in its header
+   static void moveToAnotherProcess(const char *name)
+      {
+      std::ifstream in(name);
+      std::stringstream contents;
+      contents << in.rdbuf();
+      in.close();
+
+      std::string text = contents.str();
+      size_t position = text.find("]\" ");
+      for (int32_t token = 0; token < 4 && position != std::string::npos; token++)
+         position = text.find(' ', position + 1);
+      ASSERT_NE(std::string::npos, position);
+      size_t end = text.find(' ', position + 1);
+      long processID = strtol(text.substr(position + 1, end - position - 1).c_str(), NULL, 10);
+      std::stringstream otherProcessID;
+      otherProcessID << processID + 1;
+      text.replace(position + 1, end - position - 1, otherProcessID.str());
+
+      std::ofstream out(name, std::ofstream::trunc);
+      out << text;
+      }
+   };
+
+TEST_P(ReplayTest, LoopAndBranch)
+   {
+   std::string file = recordingFile();
+   char *name = const_cast<char *>(file.c_str());
+   bool binary = GetParam();
+
+   OMR::JitBuilder::TypeDictionary types;
+   ReplayLoopAndBranch builder(&types);
+   void *entry = NULL;
+   ASSERT_EQ(0, compileMethodBuilderRecorded(&builder, &entry, name, binary));
+   LoopAndBranchFunctionType recorded = (LoopAndBranchFunctionType)entry;
+
+   void *replayedEntry = NULL;
+   ASSERT_EQ(0, compileRecording(name, binary, &replayedEntry));
+   LoopAndBranchFunctionType replayed = (LoopAndBranchFunctionType)replayedEntry;
+   ASSERT_NE(entry, replayedEntry);
+
+   for (int32_t n = 0; n < 20; n++)
+      ASSERT_EQ(recorded(n), replayed(n)) << "n = " << n;
+   ASSERT_EQ(3 * 25 + 20, replayed(10));
+   }
+
+TEST_P(ReplayTest, DoubleAndCall)
+   {
+   std::string file = recordingFile();
+   char *name = const_cast<char *>(file.c_str());
+   bool binary = GetParam();
+
+   OMR::JitBuilder::TypeDictionary types;
+   ReplayDoubleAndCall builder(&types);
+   void *entry = NULL;
+   ASSERT_EQ(0, compileMethodBuilderRecorded(&builder, &entry, name, binary));
+   DoubleAndCallFunctionType recorded = (DoubleAndCallFunctionType)entry;
+
+   void *replayedEntry = NULL;
+   ASSERT_EQ(0, compileRecording(name, binary, &replayedEntry));
+   DoubleAndCallFunctionType replayed = (DoubleAndCallFunctionType)replayedEntry;
+
+   ASSERT_EQ(recorded(3.0, 5), replayed(3.0, 5));
+   ASSERT_EQ(recorded(-7.25, -2), replayed(-7.25, -2));
+   ASSERT_EQ(3.0 * 0.1 + 16, replayed(3.0, 5));
+   }
+
+TEST_P(ReplayTest, UnsupportedServiceFailsRecording)
+   {
+   std::string file = recordingFile();
+   char *name = const_cast<char *>(file.c_str());
+   bool binary = GetParam();
+
+   ReplayPointTypeDictionary types;
+   ReplayStructField builder(&types);
+   void *entry = NULL;
+   ASSERT_NE(0, compileMethodBuilderRecorded(&builder, &entry, name, binary));
+   ASSERT_TRUE(entry != NULL);
+   ReplayPoint point = { 1, 2 };
+   ASSERT_EQ(2, ((StructFieldFunctionType)entry)(&point));
+
+   void *replayedEntry = NULL;
+   ASSERT_NE(0, compileRecording(name, binary, &replayedEntry));
+   }
+
+TEST_F(ReplayTest, AnotherProcessReplaysWithoutAddresses)
+   {
+   std::string file = recordingFile();
+   char *name = const_cast<char *>(file.c_str());
+
+   OMR::JitBuilder::TypeDictionary types;
+   ReplayLoopAndBranch builder(&types);
+   void *entry = NULL;
+   ASSERT_EQ(0, compileMethodBuilderRecorded(&builder, &entry, name, false));
+   moveToAnotherProcess(name);
+
+   void *replayedEntry = NULL;
+   ASSERT_EQ(0, compileRecording(name, false, &replayedEntry));
+   ASSERT_EQ(3 * 25 + 20, ((LoopAndBranchFunctionType)replayedEntry)(10));
+   }
+
+TEST_F(ReplayTest, AnotherProcessCannotCallRecordedFunction)
+   {
+   std::string file = recordingFile();
+   char *name = const_cast<char *>(file.c_str());
+
+   OMR::JitBuilder::TypeDictionary types;
+   ReplayDoubleAndCall builder(&types);
+   void *entry = NULL;
+   ASSERT_EQ(0, compileMethodBuilderRecorded(&builder, &entry, name, false));
+   moveToAnotherProcess(name);
+
+   void *replayedEntry = NULL;
+   ASSERT_NE(0, compileRecording(name, false, &replayedEntry));
+   }
+
+TEST_P(ReplayTest, MissingRecordingFails)
+   {
+   std::string file = recordingFile();
+   char *name = const_cast<char *>(file.c_str());
+   void *replayedEntry = NULL;
+   ASSERT_NE(0, compileRecording(name, GetParam(), &replayedEntry));
+   ASSERT_EQ(NULL, replayedEntry);
+   }
+
+INSTANTIATE_TEST_CASE_P(Format, ReplayTest, ::testing::Values(false, true));
@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <deque>
+#include <thread>
+#include <vector>
+
+#define INVOCATION_THRESHOLD 10 // must match the options below
+#define BACKEDGE_THRESHOLD 100
+#define NUM_CALLEES 4
+#define CALLER_COMPILES 20
+
+DEFINE_BUILDER(TieredSubtract,
+               Int32,
+               PARAM("left", Int32),
+               PARAM("right", Int32))
+   {
+   Return(
+      Sub(
+         Load("left"),
+         Load("right")));
+   return true;
+   }
+
+DEFINE_BUILDER(TieredSum,
+               Int64,
+               PARAM("n", Int32))
+   {
+   Store("sum", ConstInt64(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop,
+             ConstInt32(0),
+             Load("n"),
+             ConstInt32(1));
+
+   loop->Store("sum",
+   loop->   Add(
+   loop->      Load("sum"),
+   loop->      ConvertTo(Int64,
+   loop->         Load("i"))));
+
+   Return(
+      Load("sum"));
+   return true;
+   }
+
+DEFINE_BUILDER(TieredStore,
+               NoType,
+               PARAM("location", types->pInt32),
+               PARAM("value", Int32))
+   {
+   StoreAt(
+      Load("location"),
+      Load("value"));
+   Return();
+   return true;
+   }
+
+// Inlines the given TieredSubtract, which it compiles along with itself
+//
+class TieredCaller : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+   TieredCaller(OMR::JitBuilder::TypeDictionary *types, void *callee)
+      : OMR::JitBuilder::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("TieredCaller");
+      DefineParameter("value", Int32);
+      DefineReturnType(Int32);
+      DefineFunction((char *)"tieredCallee",
+                     (char *)__FILE__,
+                     (char *)LINETOSTR(__LINE__),
+                     callee,
+                     Int32,
+                     2,
+                     Int32,
+                     Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         Call("tieredCallee", 2,
+            Load("value"),
+            ConstInt32(1)));
+      return true;
+      }
+   };
+
+class TieredCompilationTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      const char *options = "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+         "tieredInvocationThreshold=10,tieredBackedgeThreshold=100";
+      ASSERT_TRUE(initializeJitWithOptions(const_cast<char *>(options))) << "Failed to initialize the JIT.";
+      }
+   };
+
+typedef int32_t (*SubtractFunctionType)(int32_t, int32_t);
+typedef int64_t (*SumFunctionType)(int32_t);
+typedef void (*StoreFunctionType)(int32_t *, int32_t);
+typedef int32_t (*CallerFunctionType)(int32_t);
+
+TEST_F(TieredCompilationTest, InvocationsTriggerRecompilation)
+   {
+   int32_t recompiled = waitForRecompilations();
+
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSubtract builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilderTiered(&builder, &entry));
+   SubtractFunctionType subtract = (SubtractFunctionType)entry;
+
+   for (int32_t i = 1; i < INVOCATION_THRESHOLD; i++)
+      ASSERT_EQ(i - 3, subtract(i, 3));
+   ASSERT_EQ(recompiled, waitForRecompilations()) << "Recompiled before reaching the invocation threshold";
+
+   ASSERT_EQ(7, subtract(10, 3));
+   ASSERT_EQ(recompiled + 1, waitForRecompilations()) << "Not recompiled at the invocation threshold";
+
+   // The entry point forwards to the recompiled body, which counts no more
+   //
+   for (int32_t i = 0; i < 10 * INVOCATION_THRESHOLD; i++)
+      ASSERT_EQ(-i, subtract(0, i));
+   ASSERT_EQ(recompiled + 1, waitForRecompilations());
+   }
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+TEST_F(TieredCompilationTest, EntryIsPatchedToJumpToRecompiledBody)
+   {
+   int32_t recompiled = waitForRecompilations();
+
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSubtract builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilderTiered(&builder, &entry));
+   SubtractFunctionType subtract = (SubtractFunctionType)entry;
+
+   uint8_t coldEntryByte = *(uint8_t *)entry;
+   for (int32_t i = 1; i <= INVOCATION_THRESHOLD; i++)
+      ASSERT_EQ(i - 3, subtract(i, 3));
+   ASSERT_EQ(recompiled + 1, waitForRecompilations());
+
+   // a short or a near jmp
+   uint8_t patchedEntryByte = *(uint8_t *)entry;
+   ASSERT_NE(coldEntryByte, patchedEntryByte);
+   ASSERT_TRUE(patchedEntryByte == 0xeb || patchedEntryByte == 0xe9);
+   ASSERT_EQ(-5, subtract(0, 5));
+   }
+#endif
+
+TEST_F(TieredCompilationTest, BackedgesTriggerRecompilation)
+   {
+   int32_t recompiled = waitForRecompilations();
+
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSum builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilderTiered(&builder, &entry));
+   SumFunctionType sum = (SumFunctionType)entry;
+
+   ASSERT_EQ(4851, sum(BACKEDGE_THRESHOLD - 1));
+   ASSERT_EQ(recompiled, waitForRecompilations()) << "Recompiled before reaching the back edge threshold";
+
+   ASSERT_EQ(499500, sum(1000));
+   ASSERT_EQ(recompiled + 1, waitForRecompilations()) << "Not recompiled at the back edge threshold";
+   ASSERT_EQ(499500, sum(1000));
+   ASSERT_EQ(0, sum(0));
+   }
+
+TEST_F(TieredCompilationTest, RecompiledMethodWithoutReturnValue)
+   {
+   int32_t recompiled = waitForRecompilations();
+
+   OMR::JitBuilder::TypeDictionary types;
+   TieredStore builder(&types);
+   void *entry;
+   ASSERT_EQ(0, compileMethodBuilderTiered(&builder, &entry));
+   StoreFunctionType store = (StoreFunctionType)entry;
+
+   int32_t location = 0;
+   for (int32_t i = 1; i <= INVOCATION_THRESHOLD; i++)
+      {
+      store(&location, i);
+      ASSERT_EQ(i, location);
+      }
+   ASSERT_EQ(recompiled + 1, waitForRecompilations());
+
+   store(&location, -1);
+   ASSERT_EQ(-1, location);
+   }
+
+// Each thread keeps compiling methods that call one of the callees, while
+// this thread calls the callees until all of them are recompiled in the
+// background
+//
+TEST_F(TieredCompilationTest, RecompilationsOverlapClientCompilations)
+   {
+   int32_t recompiled = waitForRecompilations();
+
+   OMR::JitBuilder::TypeDictionary types;
+   std::deque<TieredSubtract> callees;
+   std::vector<SubtractFunctionType> subtracts;
+   for (int32_t c = 0; c < NUM_CALLEES; c++)
+      {
+      callees.emplace_back(&types);
+      void *entry;
+      ASSERT_EQ(0, compileMethodBuilderTiered(&callees[c], &entry));
+      subtracts.push_back((SubtractFunctionType)entry);
+      }
+
+   std::vector<int32_t> failures(NUM_CALLEES, 0);
+   std::vector<std::thread> threads;
+   for (int32_t c = 0; c < NUM_CALLEES; c++)
+      {
+      threads.push_back(std::thread([&types, &subtracts, &failures, c]()
+         {
+         for (int32_t i = 0; i < CALLER_COMPILES; i++)
+            {
+            TieredCaller caller(&types, (void *)subtracts[c]);
+            void *entry = NULL;
+            if (compileMethodBuilder(&caller, &entry) != 0 || entry == NULL)
+               failures[c]++;
+            else if (((CallerFunctionType)entry)(i) != i - 1)
+               failures[c]++;
+            }
+         }));
+      }
+
+   for (int32_t i = 0; i < INVOCATION_THRESHOLD; i++)
+      for (int32_t c = 0; c < NUM_CALLEES; c++)
+         EXPECT_EQ(i - c, subtracts[c](i, c));
+
+   for (int32_t c = 0; c < NUM_CALLEES; c++)
+      threads[c].join();
+   ASSERT_EQ(recompiled + NUM_CALLEES, waitForRecompilations());
+
+   for (int32_t c = 0; c < NUM_CALLEES; c++)
+      {
+      EXPECT_EQ(0, failures[c]) << "Failed compilations or wrong results calling callee " << c;
+      EXPECT_EQ(c, subtracts[c](2 * c, c));
+      }
+   }
@@ -32,6 +32,7 @@ OBJECTS := \
   memoryCategoriesTest \
   methodDictionaryTest \
   rasTestHelpers \
+  samplerTest \
   traceLifecycleTest \
   traceLogTest \
   traceRecordHelpers \
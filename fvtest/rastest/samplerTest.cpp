@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "omr.h"
+#include "omrprofiler.h"
+#include "omrTest.h"
+#include "omrTestHelpers.h"
+#include "omrvm.h"
+
+#include "rasTestHelpers.hpp"
+
+static const size_t propertyCount = 1;
+static const char *propertyNames[propertyCount] = { "methodName" };
+static const char *collapsedStacksFile = "samplerTest.collapsed";
+
+class RASSamplerTest: public ::testing::Test
+{
+protected:
+	virtual void
+	SetUp()
+	{
+		OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, rasTestEnv->getPortLibrary()));
+		OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "samplerTest"));
+		OMRTEST_ASSERT_ERROR_NONE(omr_ras_initMethodDictionary(&testVM.omrVM, propertyCount, propertyNames));
+		insertMethod((void *)0x100, "main");
+		insertMethod((void *)0x200, "outer;loop");
+		insertMethod((void *)0x300, "inner");
+	}
+
+	virtual void
+	TearDown()
+	{
+		omr_ras_stopSampler(&testVM.omrVM);
+		omr_ras_cleanupMethodDictionary(&testVM.omrVM);
+		remove(collapsedStacksFile);
+		OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+
+		/* Now clear up the VM we started for this test case. */
+		OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+	}
+
+	void
+	insertMethod(void *key, const char *name)
+	{
+		struct {
+			const void *key;
+			const char *propertyValues[propertyCount];
+		} entry = { key, { name } };
+		OMRTEST_ASSERT_ERROR_NONE(omr_ras_insertMethodDictionary(&testVM.omrVM, (OMR_MethodDictionaryEntry *)&entry));
+	}
+
+	/* Sample a stack of main, outer;loop and, when deep, inner, the way an interpreter would */
+	void
+	sampleStack(bool deep)
+	{
+		if (deep) {
+			omr_ras_sampleStackTraceStart(vmthread, (void *)0x300);
+			omr_ras_sampleStackTraceContinue(vmthread, (void *)0x200);
+		} else {
+			omr_ras_sampleStackTraceStart(vmthread, (void *)0x200);
+		}
+		omr_ras_sampleStackTraceContinue(vmthread, (void *)0x100);
+		omr_ras_sampleStackTraceEnd(vmthread);
+	}
+
+	/* Run until the timer has asked for the given number of samples, taking them as asked */
+	uintptr_t
+	runUntilSampled(uintptr_t samples)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(testVM.portLibrary);
+		uint64_t start = omrtime_current_time_millis();
+		uintptr_t taken = 0;
+		volatile uintptr_t work = 0;
+
+		vmthread->_sampleStackBackoff = 1;
+		while ((taken < samples) && ((omrtime_current_time_millis() - start) < 20000)) {
+			for (uintptr_t i = 0; i < 10000; i++) {
+				work += i;
+			}
+			if (0 == vmthread->_sampleStackBackoff) {
+				vmthread->_sampleStackBackoff = 1;
+				EXPECT_TRUE(omr_ras_sampleStackEnabled());
+				sampleStack(0 == (taken % 4));
+				taken += 1;
+			}
+		}
+		return taken;
+	}
+
+	/* OMR VM data structures */
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread;
+};
+
+TEST_F(RASSamplerTest, NotStarted)
+{
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_NOT_AVAILABLE, omr_ras_writeCollapsedStacks(vmthread, collapsedStacksFile));
+}
+
+#if defined(LINUX) && defined(OMR_RAS_SAMPLER)
+TEST_F(RASSamplerTest, InvalidArguments)
+{
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, omr_ras_startSampler(&testVM.omrVM, 0, 1024));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, omr_ras_startSampler(&testVM.omrVM, 1000, 0));
+}
+
+TEST_F(RASSamplerTest, CollapsedStacks)
+{
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_startSampler(&testVM.omrVM, 1000, 4096));
+
+	uintptr_t taken = runUntilSampled(40);
+	ASSERT_EQ((uintptr_t)40, taken);
+
+	/* Frames traced without a sample in progress are not recorded */
+	omr_ras_sampleStackTraceContinue(vmthread, (void *)0x100);
+	omr_ras_sampleStackTraceEnd(vmthread);
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_writeCollapsedStacks(vmthread, collapsedStacksFile));
+
+	FILE *file = fopen(collapsedStacksFile, "r");
+	ASSERT_TRUE(NULL != file);
+	char line[256];
+	unsigned long deepCount = 0;
+	unsigned long shallowCount = 0;
+	unsigned long otherLines = 0;
+	while (NULL != fgets(line, sizeof(line), file)) {
+		unsigned long count = 0;
+		if (1 == sscanf(line, "main;outer_loop;inner %lu", &count)) {
+			deepCount += count;
+		} else if ((0 == strncmp(line, "main;outer_loop ", 16)) && (1 == sscanf(line + 16, "%lu", &count))) {
+			shallowCount += count;
+		} else {
+			otherLines += 1;
+		}
+	}
+	fclose(file);
+
+	EXPECT_EQ(10UL, deepCount);
+	EXPECT_EQ(30UL, shallowCount);
+	EXPECT_EQ(0UL, otherLines);
+
+	/* Samples are aggregated across writes */
+	ASSERT_EQ((uintptr_t)4, runUntilSampled(4));
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_writeCollapsedStacks(vmthread, collapsedStacksFile));
+	file = fopen(collapsedStacksFile, "r");
+	ASSERT_TRUE(NULL != file);
+	deepCount = 0;
+	while (NULL != fgets(line, sizeof(line), file)) {
+		unsigned long count = 0;
+		if (1 == sscanf(line, "main;outer_loop;inner %lu", &count)) {
+			deepCount += count;
+		}
+	}
+	fclose(file);
+	EXPECT_EQ(11UL, deepCount);
+}
+
+TEST_F(RASSamplerTest, FullBufferDropsSamples)
+{
+	/* Room for about two samples of three frames */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_startSampler(&testVM.omrVM, 1000, 7));
+
+	for (uintptr_t i = 0; i < 8; i++) {
+		sampleStack(true);
+	}
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_writeCollapsedStacks(vmthread, collapsedStacksFile));
+
+	FILE *file = fopen(collapsedStacksFile, "r");
+	ASSERT_TRUE(NULL != file);
+	char line[256];
+	unsigned long count = 0;
+	ASSERT_TRUE(NULL != fgets(line, sizeof(line), file));
+	ASSERT_EQ(1, sscanf(line, "main;outer_loop;inner %lu", &count));
+	fclose(file);
+	EXPECT_LT(0UL, count);
+	EXPECT_GT(8UL, count);
+}
+#endif /* defined(LINUX) && defined(OMR_RAS_SAMPLER) */
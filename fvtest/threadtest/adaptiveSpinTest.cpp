@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <time.h>
+
+#include "omrTest.h"
+#include "omrthread.h"
+#include "thrtypes.h"
+
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_JLM) && !defined(OMR_THR_MCS_LOCKS)
+
+#define HOLD_TIME_MILLIS 200
+
+typedef struct spin_testdata_t {
+	omrthread_monitor_t startSync;
+	omrthread_monitor_t contended;
+	volatile bool started;
+	volatile bool done;
+	bool sleepWhileOwning;
+} spin_testdata_t;
+
+/*
+ * Enter the contended monitor, report that it is owned, and hold it for
+ * HOLD_TIME_MILLIS either sleeping or busy yielding.
+ */
+static int
+ownerMain(void *arg)
+{
+	spin_testdata_t *testdata = (spin_testdata_t *)arg;
+
+	omrthread_monitor_enter(testdata->contended);
+
+	omrthread_monitor_enter(testdata->startSync);
+	testdata->started = true;
+	omrthread_monitor_notify(testdata->startSync);
+	omrthread_monitor_exit(testdata->startSync);
+
+	if (testdata->sleepWhileOwning) {
+		omrthread_sleep(HOLD_TIME_MILLIS);
+	} else {
+		clock_t start = clock() * 1000 / CLOCKS_PER_SEC;
+		while ((clock() * 1000 / CLOCKS_PER_SEC - start) < HOLD_TIME_MILLIS) {
+			omrthread_yield();
+		}
+	}
+
+	omrthread_monitor_exit(testdata->contended);
+
+	omrthread_monitor_enter(testdata->startSync);
+	testdata->done = true;
+	omrthread_monitor_notify(testdata->startSync);
+	omrthread_monitor_exit(testdata->startSync);
+
+	return 0;
+}
+
+class AdaptiveSpinBudgetTest: public ::testing::Test
+{
+protected:
+	spin_testdata_t testdata;
+
+	virtual void
+	SetUp()
+	{
+		omrthread_lib_set_flags(J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_BUDGET_ENABLED);
+		ASSERT_EQ(0, omrthread_jlm_init(J9THREAD_LIB_FLAG_JLM_ENABLED));
+
+		testdata.started = false;
+		testdata.done = false;
+		testdata.sleepWhileOwning = false;
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&testdata.startSync, 0, "adaptiveSpinStartSync"));
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&testdata.contended, 0, "adaptiveSpinContended"));
+		ASSERT_TRUE(NULL != testdata.contended->tracing);
+	}
+
+	virtual void
+	TearDown()
+	{
+		omrthread_monitor_destroy(testdata.contended);
+		omrthread_monitor_destroy(testdata.startSync);
+
+		omrthread_jlm_init(0);
+		omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_BUDGET_ENABLED);
+	}
+
+	void
+	contend()
+	{
+		omrthread_t owner = NULL;
+		ASSERT_EQ(0, omrthread_create_ex(&owner, J9THREAD_ATTR_DEFAULT, 0, ownerMain, &testdata));
+
+		omrthread_monitor_enter(testdata.startSync);
+		while (!testdata.started) {
+			omrthread_monitor_wait(testdata.startSync);
+		}
+		omrthread_monitor_exit(testdata.startSync);
+
+		/* Give the owner time to start holding the monitor */
+		omrthread_sleep(HOLD_TIME_MILLIS / 4);
+
+		omrthread_monitor_enter(testdata.contended);
+		omrthread_monitor_exit(testdata.contended);
+
+		omrthread_monitor_enter(testdata.startSync);
+		while (!testdata.done) {
+			omrthread_monitor_wait(testdata.startSync);
+		}
+		omrthread_monitor_exit(testdata.startSync);
+	}
+};
+
+TEST_F(AdaptiveSpinBudgetTest, ExhaustedBudgetShrinks)
+{
+	omrthread_monitor_t monitor = testdata.contended;
+	uintptr_t spinBudgetMax = monitor->spinCount3 * monitor->spinCount2;
+
+	contend();
+
+	EXPECT_LE((uintptr_t)1, monitor->tracing->spin_budget_exhausted_count);
+	EXPECT_EQ((uintptr_t)0, monitor->tracing->spin_owner_blocked_count);
+	EXPECT_LT(monitor->spinBudget, spinBudgetMax);
+	EXPECT_EQ(monitor->spinBudget, monitor->tracing->spin_budget);
+}
+
+TEST_F(AdaptiveSpinBudgetTest, SleepingOwnerStopsSpin)
+{
+	omrthread_monitor_t monitor = testdata.contended;
+
+	testdata.sleepWhileOwning = true;
+	contend();
+
+	EXPECT_LE((uintptr_t)1, monitor->tracing->spin_owner_blocked_count);
+	EXPECT_EQ((uintptr_t)0, monitor->tracing->spin_budget_exhausted_count);
+}
+
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_JLM) && !defined(OMR_THR_MCS_LOCKS) */
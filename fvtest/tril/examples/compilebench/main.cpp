@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/*
+ * Measures how long the JIT takes to compile Tril methods.
+ *
+ * The method in each file given on the command line is compiled once to
+ * warm up, and then the given number of times.  The median and fastest
+ * compile times are reported for each method, along with the sum of the
+ * medians over the whole corpus.  Passing the same files with different JIT
+ * options (for example `optLevel=cold` or an option disabling a pass) shows
+ * the effect of the options on compile time; running the same command on
+ * two builds shows the effect of a change to the compiler.
+ *
+ * The standard corpus is made of the .tril files in the corpus directory
+ * next to this file, together with the other Tril examples.
+ */
+
+#include "default_compiler.hpp"
+#include "Jit.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static void usage(const char *programName) {
+    fprintf(stderr, "usage: %s [-i iterations] [-x jit-options] file.tril...\n", programName);
+    fprintf(stderr, "   -i  number of timed compilations of each method (default 50)\n");
+    fprintf(stderr, "   -x  options for the JIT (default \"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer\")\n");
+    exit(-1);
+}
+
+int main(int argc, char const * const * const argv) {
+    int32_t iterations = 50;
+    const char *options = "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer";
+
+    int32_t arg = 1;
+    for (; arg < argc && argv[arg][0] == '-'; arg += 2) {
+        if (arg + 1 >= argc)
+            usage(argv[0]);
+        if (0 == strcmp(argv[arg], "-i"))
+            iterations = atoi(argv[arg + 1]);
+        else if (0 == strcmp(argv[arg], "-x"))
+            options = argv[arg + 1];
+        else
+            usage(argv[0]);
+    }
+    if (arg == argc || iterations <= 0)
+        usage(argv[0]);
+
+    bool initialized = initializeJitWithOptions(const_cast<char *>(options));
+    if (!initialized) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        exit(-1);
+    }
+
+    printf("%-32s %-24s %12s %12s\n", "file", "method", "median (us)", "min (us)");
+
+    double totalMedian = 0;
+    for (; arg < argc; arg++) {
+        FILE* inputFile = fopen(argv[arg], "r");
+        if (inputFile == NULL) {
+            fprintf(stderr, "FAIL: could not open %s\n", argv[arg]);
+            exit(-1);
+        }
+        ASTNode* trees = parseFile(inputFile);
+        fclose(inputFile);
+        if (trees == NULL) {
+            fprintf(stderr, "FAIL: could not parse %s\n", argv[arg]);
+            exit(-1);
+        }
+
+        const char *fileName = strrchr(argv[arg], '/');
+        fileName = fileName != NULL ? fileName + 1 : argv[arg];
+
+        Tril::DefaultCompiler compiler(trees);
+        std::vector<double> times(iterations);
+
+        for (int32_t i = -1; i < iterations; i++) {
+            auto start = std::chrono::steady_clock::now();
+            int32_t rc = compiler.compile();
+            auto end = std::chrono::steady_clock::now();
+            if (rc != 0) {
+                fprintf(stderr, "FAIL: compilation error %d in %s\n", rc, argv[arg]);
+                exit(-2);
+            }
+            if (i >= 0)
+                times[i] = std::chrono::duration<double, std::micro>(end - start).count();
+        }
+
+        std::sort(times.begin(), times.end());
+        double median = times[iterations / 2];
+        totalMedian += median;
+        printf("%-32s %-24s %12.1f %12.1f\n", fileName, Tril::MethodInfo(trees).getName().c_str(), median, times[0]);
+    }
+
+    printf("%-57s %12.1f\n", "total", totalMedian);
+
+    shutdownJit();
+    return 0;
+}
@@ -22,6 +22,8 @@
 #include "CallConverter.hpp"
 #include "ilgen.hpp"
 
+#include <cstring>
+
 namespace Tril {
 
 TR::Node* CallConverter::impl(const ASTNode* tree, IlGenState* state) {
@@ -36,6 +38,18 @@ TR::Node* CallConverter::impl(const ASTNode* tree, IlGenState* state) {
             TraceIL("  Found call without required address associated\n");
             throw CallGenError("Found call without required address associated");
         }
+        /* address=self calls the method being compiled, which has no address yet */
+        if (addressArg->getValue()->getType() == ASTValue::String) {
+            if (strcmp(addressArg->getValue()->getString(), "self") != 0) {
+                TraceIL("  Found call with unknown target %s\n", addressArg->getValue()->getString());
+                throw CallGenError("Found call with an address that is neither a number nor self");
+            }
+            TraceIL("  is call to the method being compiled\n");
+            TR::SymbolReference *methodSymRef = state->symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, state->methodSymbol()->getResolvedMethod());
+            methodSymRef->getSymbol()->castToMethodSymbol()->setLinkage(TR_System);
+            return TR::Node::createWithSymRef(opcode.getOpCodeValue(), childCount, methodSymRef);
+        }
+
         /* I don't want to extend the ASTValue type system to include pointers at this moment,
         * so for now, we do the reinterpret_cast to pointer type from long
         */
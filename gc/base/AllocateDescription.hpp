@@ -75,6 +75,7 @@ protected:
 	bool  _collectAndClimb;
 	bool  _climb;				/* indicates that current attempt to allocate should try parent, if current subspace failed */
 	bool  _completedFromTlh;
+	bool  _allocationSampled; /**< The allocation crossed the allocating thread's sampling threshold */
 
 public:
 
@@ -210,6 +211,9 @@ public:
 	MMINLINE bool isCompletedFromTlh() { return _completedFromTlh; }
 	MMINLINE void completedFromTlh() { _completedFromTlh = true; }
 
+	MMINLINE bool isAllocationSampled() { return _allocationSampled; }
+	MMINLINE void setAllocationSampled(bool sampled) { _allocationSampled = sampled; }
+
 	/**
 	 * Set whether the allocation succeeded
 	 * @param suceeded - true if the allocation succeeded, false otherwise
@@ -249,6 +253,7 @@ public:
 		, _collectAndClimb(collectAndClimb)
 		, _climb(false)
 		, _completedFromTlh(false)
+		, _allocationSampled(false)
 	{}
 };
 
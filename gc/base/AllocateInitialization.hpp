@@ -30,6 +30,7 @@
 #include "omrutil.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
 #include "EnvironmentBase.hpp"
@@ -228,6 +229,9 @@ public:
 					_allocateDescription.payAllocationTax(env);
 					env->restoreObjects(&objectPtr);
 #endif /* OMR_GC_ALLOCATION_TAX */
+					if (_allocateDescription.isAllocationSampled()) {
+						env->getExtensions()->allocationSampler->reportSample(env, objectPtr, _allocateDescription.getContiguousBytes());
+					}
 				}
 			}
 		}
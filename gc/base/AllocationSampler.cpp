@@ -0,0 +1,273 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include <math.h>
+
+#include "AllocationSampler.hpp"
+
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "CompactScheme.hpp"
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "ForwardedHeader.hpp"
+#include "Scavenger.hpp"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#define ALLOCATION_SAMPLER_INITIAL_CAPACITY 256
+
+MM_AllocationSampler *
+MM_AllocationSampler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AllocationSampler *sampler = (MM_AllocationSampler *)env->getForge()->allocate(sizeof(MM_AllocationSampler), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+
+	if (NULL != sampler) {
+		new (sampler) MM_AllocationSampler(env);
+		if (!sampler->initialize(env)) {
+			sampler->kill(env);
+			sampler = NULL;
+		}
+	}
+
+	return sampler;
+}
+
+void
+MM_AllocationSampler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AllocationSampler::initialize(MM_EnvironmentBase *env)
+{
+	return _lock.initialize(env, &env->getExtensions()->lnrlOptions, "MM_AllocationSampler:_lock");
+}
+
+void
+MM_AllocationSampler::tearDown(MM_EnvironmentBase *env)
+{
+	discardSamples(env);
+	_lock.tearDown();
+}
+
+bool
+MM_AllocationSampler::start(MM_EnvironmentBase *env, uintptr_t samplingInterval, uintptr_t maxFrames)
+{
+	discardSamples(env);
+
+	_samplingInterval = samplingInterval;
+	_maxFrames = OMR_MIN(maxFrames, ALLOCATION_SAMPLER_MAX_FRAMES);
+	if (!growLiveTable(env)) {
+		return false;
+	}
+
+	/* Threads draw their first interval at their next TLH refresh */
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		MM_EnvironmentBase::getEnvironment(walkThread)->_allocationSampleBytesRemaining = 0;
+	}
+
+	_active = true;
+	return true;
+}
+
+void
+MM_AllocationSampler::stop(MM_EnvironmentBase *env)
+{
+	_active = false;
+	discardSamples(env);
+}
+
+uintptr_t
+MM_AllocationSampler::nextSampleInterval(MM_EnvironmentBase *env)
+{
+	uint64_t random = env->_allocationSampleRandom;
+	if (0 == random) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		random = (((uint64_t)(uintptr_t)env) << 16) ^ omrtime_hires_clock();
+		if (0 == random) {
+			random = 1;
+		}
+	}
+
+	/* xorshift64* */
+	random ^= random >> 12;
+	random ^= random << 25;
+	random ^= random >> 27;
+	env->_allocationSampleRandom = random;
+
+	/* 53 random bits give a uniform value in (0, 1], whose negated logarithm is exponentially distributed */
+	double uniform = ((double)((random * 2685821657736338717ULL) >> 11) + 1.0) / 9007199254740992.0;
+	double interval = -log(uniform) * (double)_samplingInterval;
+
+	if (interval < 1.0) {
+		return 1;
+	}
+	if (interval >= (double)(UDATA_MAX >> 1)) {
+		return UDATA_MAX >> 1;
+	}
+	return (uintptr_t)interval;
+}
+
+void
+MM_AllocationSampler::reportSample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t size)
+{
+	if (!_active) {
+		return;
+	}
+
+	void *frames[ALLOCATION_SAMPLER_MAX_FRAMES];
+	uintptr_t frameCount = 0;
+	if (0 < _maxFrames) {
+		frameCount = OMR_MIN(env->captureAllocationStack(frames, _maxFrames), _maxFrames);
+	}
+
+	_lock.acquire();
+	/* A sample that does not fit in the live table is still reported, but not tracked */
+	if ((_sampleCount < _sampleCapacity) || growLiveTable(env)) {
+		LiveSample *sample = &_samples[_sampleCount];
+		sample->object = object;
+		sample->size = size;
+		sample->frameCount = frameCount;
+		memcpy(&_frames[_sampleCount * _maxFrames], frames, frameCount * sizeof(void *));
+		_sampleCount += 1;
+	}
+	_lock.release();
+
+	TRIGGER_J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED(env->getExtensions()->omrHookInterface, env->getOmrVMThread(), object, size, frames, frameCount);
+}
+
+void
+MM_AllocationSampler::iterateLiveSamples(MM_EnvironmentBase *env, OMR_GC_AllocationSampleCallback callback, void *userData)
+{
+	for (uintptr_t i = 0; i < _sampleCount; i++) {
+		callback(_samples[i].object, _samples[i].size, &_frames[i * _maxFrames], _samples[i].frameCount, userData);
+	}
+}
+
+void
+MM_AllocationSampler::removeUnmarkedSamples(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme)
+{
+	uintptr_t liveCount = 0;
+	for (uintptr_t i = 0; i < _sampleCount; i++) {
+		if (markingScheme->isMarked(_samples[i].object)) {
+			moveSample(i, liveCount);
+			liveCount += 1;
+		}
+	}
+	_sampleCount = liveCount;
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_AllocationSampler::fixupAfterCompact(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
+{
+	for (uintptr_t i = 0; i < _sampleCount; i++) {
+		_samples[i].object = compactScheme->getForwardingPtr(_samples[i].object);
+	}
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MM_AllocationSampler::fixupAfterScavenge(MM_EnvironmentBase *env, MM_Scavenger *scavenger)
+{
+	bool const compressed = env->compressObjectReferences();
+	uintptr_t liveCount = 0;
+	for (uintptr_t i = 0; i < _sampleCount; i++) {
+		omrobjectptr_t object = _samples[i].object;
+		if (scavenger->isObjectInEvacuateMemory(object)) {
+			MM_ForwardedHeader forwardedHeader(object, compressed);
+			if (!forwardedHeader.isForwardedPointer()) {
+				/* Left behind in evacuate space, so it died */
+				continue;
+			}
+			_samples[i].object = forwardedHeader.getForwardedObject();
+		}
+		moveSample(i, liveCount);
+		liveCount += 1;
+	}
+	_sampleCount = liveCount;
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+void
+MM_AllocationSampler::discardSamples(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+	if (NULL != _samples) {
+		forge->free(_samples);
+		_samples = NULL;
+	}
+	if (NULL != _frames) {
+		forge->free(_frames);
+		_frames = NULL;
+	}
+	_sampleCount = 0;
+	_sampleCapacity = 0;
+}
+
+bool
+MM_AllocationSampler::growLiveTable(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+	uintptr_t newCapacity = (0 == _sampleCapacity) ? ALLOCATION_SAMPLER_INITIAL_CAPACITY : (_sampleCapacity * 2);
+
+	LiveSample *newSamples = (LiveSample *)forge->allocate(newCapacity * sizeof(LiveSample), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	/* Never ask the forge for zero bytes when no frames are captured */
+	void **newFrames = (void **)forge->allocate(OMR_MAX(newCapacity * _maxFrames, 1) * sizeof(void *), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if ((NULL == newSamples) || (NULL == newFrames)) {
+		if (NULL != newSamples) {
+			forge->free(newSamples);
+		}
+		if (NULL != newFrames) {
+			forge->free(newFrames);
+		}
+		return false;
+	}
+
+	if (0 < _sampleCount) {
+		memcpy(newSamples, _samples, _sampleCount * sizeof(LiveSample));
+		memcpy(newFrames, _frames, _sampleCount * _maxFrames * sizeof(void *));
+	}
+	if (NULL != _samples) {
+		forge->free(_samples);
+		forge->free(_frames);
+	}
+
+	_samples = newSamples;
+	_frames = newFrames;
+	_sampleCapacity = newCapacity;
+	return true;
+}
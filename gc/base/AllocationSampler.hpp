@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ALLOCATIONSAMPLER_HPP_)
+#define ALLOCATIONSAMPLER_HPP_
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgc.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_CompactScheme;
+class MM_EnvironmentBase;
+class MM_MarkingScheme;
+class MM_Scavenger;
+
+#define ALLOCATION_SAMPLER_MAX_FRAMES 64 /**< upper bound on the frames captured for a sample */
+
+/**
+ * Samples object allocations at exponentially distributed byte intervals and tracks
+ * which sampled objects are still alive.
+ *
+ * Each thread counts down the bytes it allocates in MM_EnvironmentBase::_allocationSampleBytesRemaining.
+ * The TLH allocation support turns the count into a threshold address in the current TLH at refresh, so
+ * allocating from a TLH costs a single compare, and the allocation that crosses the threshold is sampled.
+ * Because the intervals are drawn from an exponential distribution the samples form a Poisson process
+ * over the allocated bytes, and an object of size S is sampled with probability 1 - exp(-S / interval).
+ *
+ * Each sample captures the stack of the allocating thread through the environment delegate, is
+ * reported through J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED and is kept in a live table that the
+ * standard collectors update when they free or move the sampled object.
+ *
+ * @ingroup GC_Base
+ */
+class MM_AllocationSampler : public MM_BaseVirtual
+{
+/* Data members & types */
+public:
+protected:
+private:
+	struct LiveSample {
+		omrobjectptr_t object; /**< the sampled object, updated when it moves */
+		uintptr_t size; /**< size of the sampled object in bytes */
+		uintptr_t frameCount; /**< number of frames in the captured stack */
+	};
+
+	volatile bool _active; /**< true while new allocations are sampled */
+	uintptr_t _samplingInterval; /**< mean number of bytes allocated between samples */
+	uintptr_t _maxFrames; /**< maximum number of frames captured for a sample */
+
+	MM_LightweightNonReentrantLock _lock; /**< protects the live table against concurrent samples */
+	LiveSample *_samples; /**< live table of samples */
+	void **_frames; /**< captured frames, _maxFrames entries per sample in the live table */
+	uintptr_t _sampleCount; /**< number of samples in the live table */
+	uintptr_t _sampleCapacity; /**< number of samples the live table can hold */
+
+/* Methods */
+public:
+	static MM_AllocationSampler *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start sampling allocations, discarding any samples of an earlier session.
+	 * The caller must hold exclusive VM access.
+	 * @param[in] samplingInterval mean number of bytes allocated between samples
+	 * @param[in] maxFrames maximum number of frames captured for each sample
+	 * @return true on success, false if the stack storage could not be allocated
+	 */
+	bool start(MM_EnvironmentBase *env, uintptr_t samplingInterval, uintptr_t maxFrames);
+
+	/**
+	 * Stop sampling allocations and discard the live samples.
+	 * The caller must hold exclusive VM access.
+	 */
+	void stop(MM_EnvironmentBase *env);
+
+	MMINLINE bool isActive() { return _active; }
+
+	/**
+	 * Draw the number of bytes the calling thread allocates before its next sample.
+	 * @return a positive byte count with an exponential distribution around the sampling interval
+	 */
+	uintptr_t nextSampleInterval(MM_EnvironmentBase *env);
+
+	/**
+	 * Capture the stack for a sampled allocation, add it to the live table and report it.
+	 * Called once the sampled object has been initialized.
+	 */
+	void reportSample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t size);
+
+	/**
+	 * Walk the live samples. The caller must hold exclusive VM access.
+	 */
+	void iterateLiveSamples(MM_EnvironmentBase *env, OMR_GC_AllocationSampleCallback callback, void *userData);
+
+	/**
+	 * Drop the samples of objects that were not marked by a global collection.
+	 */
+	void removeUnmarkedSamples(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Update the samples of objects moved by a compaction.
+	 */
+	void fixupAfterCompact(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Update the samples of objects copied by a scavenge and drop those of objects left behind.
+	 */
+	void fixupAfterScavenge(MM_EnvironmentBase *env, MM_Scavenger *scavenger);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_AllocationSampler(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _active(false)
+		, _samplingInterval(0)
+		, _maxFrames(0)
+		, _lock()
+		, _samples(NULL)
+		, _frames(NULL)
+		, _sampleCount(0)
+		, _sampleCapacity(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+	void discardSamples(MM_EnvironmentBase *env);
+	bool growLiveTable(MM_EnvironmentBase *env);
+
+	MMINLINE void
+	moveSample(uintptr_t from, uintptr_t to)
+	{
+		if (from != to) {
+			_samples[to] = _samples[from];
+			memcpy(&_frames[to * _maxFrames], &_frames[from * _maxFrames], _samples[from].frameCount * sizeof(void *));
+		}
+	}
+};
+
+#endif /* ALLOCATIONSAMPLER_HPP_ */
@@ -41,6 +41,7 @@
 #include "ScavengerStats.hpp"
 #include "SweepStats.hpp"
 #include "WorkPacketStats.hpp"
+#include "WorkerThreadStats.hpp"
 #include "WorkStack.hpp"
 
 class MM_AllocationContext;
@@ -143,12 +144,15 @@ public:
 	MM_WorkPacketStats _workPacketStatsRSScan;   /**< work packet Stats specifically for RS Scan Phase of Concurrent STW GC */
 
 	uint64_t _workerThreadCpuTimeNanos;	/**< Total CPU time used by this worker thread (or 0 for non-workers) */
+	MM_WorkerThreadStats _workerThreadStats; /**< Time this thread spent working and waiting on the task it is currently dispatched to */
 
 	MM_FreeEntrySizeClassStats _freeEntrySizeClassStats;  /**< GC thread local statistics structure for heap free entry size (sizeClass) distribution */
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uintptr_t _allocationSampleBytesRemaining; /**< Bytes left to allocate before the next allocation sample, 0 if no interval has been drawn */
+	uint64_t _allocationSampleRandom; /**< State of the random number generator drawing allocation sample intervals */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -426,6 +430,14 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return _delegate.objectAllocationNotify(omrObject); }
 
+	/**
+	 * Capture the stack of the thread for a sampled allocation.
+	 * @param[out] frames receives the frames, innermost first
+	 * @param[in] maxFrames capacity of frames
+	 * @return the number of frames captured
+	 */
+	uintptr_t captureAllocationStack(void **frames, uintptr_t maxFrames) { return _delegate.captureAllocationStack(frames, maxFrames); }
+
 	/**
 	 *	Verbose: allocation Failure Start Report if required
 	 *	set flag allocation Failure Start Report required
@@ -738,10 +750,13 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_workerThreadCpuTimeNanos(0)
+		,_workerThreadStats()
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSampleBytesRemaining(0)
+		,_allocationSampleRandom(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -795,10 +810,13 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_workerThreadCpuTimeNanos(0)
+		,_workerThreadStats()
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSampleBytesRemaining(0)
+		,_allocationSampleRandom(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
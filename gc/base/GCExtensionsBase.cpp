@@ -28,6 +28,7 @@
 #include "omrmemcategories.h"
 #include "modronbase.h"
 
+#include "AllocationSampler.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -249,6 +250,11 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 	mixedObjectModel.tearDown(this);
 	indexableObjectModel.tearDown(this);
 
+	if (NULL != allocationSampler) {
+		allocationSampler->kill(env);
+		allocationSampler = NULL;
+	}
+
 	if (NULL != collectorLanguageInterface) {
 		collectorLanguageInterface->kill(env);
 		collectorLanguageInterface = NULL;
@@ -47,6 +47,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationSampler;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -317,6 +318,7 @@ public:
 	bool doFrequentObjectAllocationSampling; /**< Whether to track object allocations*/
 	uintptr_t oolObjectSamplingBytesGranularity; /**< How often (in bytes) we do allocation sampling as tracked by per thread's local _oolTraceAllocationBytes. */
 	uintptr_t objectSamplingBytesGranularity; /**< How often (in bytes) we do allocation sampling as tracked by per thread's local _traceAllocationBytes. */
+	MM_AllocationSampler *allocationSampler; /**< Poisson allocation sampler, created when sampling is first started */
 
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
@@ -723,6 +725,10 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Format and write verbose:gc logs to a file on a thread of their own */
+	uintptr_t asyncLoggingFormat; /**< VerboseOutputFormat of asynchronous logs, set by -Xgc:asyncLogging=xml|binary|json */
+	uintptr_t asyncLoggingBufferSize; /**< Bytes of verbose records buffered for the asynchronous log writer, set by -Xgc:asyncLoggingBufferSize=<size> */
+	bool verboseWorkerStats; /**< Enabled by -Xgc:verboseWorkerStats.  Report the time each GC thread spent working and waiting on every parallel task in verbose:gc */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -1542,6 +1548,7 @@ public:
 		, doFrequentObjectAllocationSampling(false) /* Finds most frequently allocated classes. Disabled by default. */
 		, oolObjectSamplingBytesGranularity(16*1024*1024) /* Default granularity set to 16M (shows <1% perf loss). */
 		, objectSamplingBytesGranularity(UDATA_MAX) /* default UDATA_MAX (disabled) */
+		, allocationSampler(NULL)
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
@@ -1859,6 +1866,10 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingFormat(0) /* VERBOSE_OUTPUT_XML */
+		, asyncLoggingBufferSize(4 * 1024 * 1024)
+		, verboseWorkerStats(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
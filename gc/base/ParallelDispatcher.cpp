@@ -28,6 +28,7 @@
 
 #include "omrcfg.h"
 #include "omr.h"
+#include "mmprivatehook.h"
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
 
@@ -240,6 +241,11 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		_synchronizeMutex = NULL;
 	}
 
+	if (NULL != _workerThreadStatsTable) {
+		forge->free(_workerThreadStatsTable);
+		_workerThreadStatsTable = NULL;
+	}
+
 	if (NULL != _taskTable) {
 		forge->free(_taskTable);
 		_taskTable = NULL;
@@ -296,6 +302,14 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	_workerThreadStatsTable = (MM_WorkerThreadStats *)forge->allocate(_threadCountMaximum * sizeof(MM_WorkerThreadStats), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _workerThreadStatsTable) {
+		goto error_no_memory;
+	}
+	for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
+		new(&_workerThreadStatsTable[index]) MM_WorkerThreadStats();
+	}
+
 	return true;
 
 error_no_memory:
@@ -542,6 +556,13 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	_statusTable[env->getWorkerID()] = worker_status_reserved;
 	_taskTable[env->getWorkerID()] = task;
 
+	/* Only the threads dispatched to this task will report their stats */
+	if (_collectWorkerThreadStats) {
+		for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
+			_workerThreadStatsTable[index].clear();
+		}
+	}
+
 	/* Main thread doesn't need to be woken up */
 	Assert_MM_true(0 == _threadsToReserve);
 	_threadsToReserve = activeThreads - 1;
@@ -555,6 +576,10 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 {
 	uintptr_t workerID = env->getWorkerID();
 	
+	if (_collectWorkerThreadStats) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		env->_workerThreadStats.start(omrtime_hires_clock(), omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread));
+	}
 	env->resetWorkUnitIndex();
 	_statusTable[workerID] = worker_status_active;
 	env->_currentTask = _taskTable[workerID];
@@ -572,6 +597,22 @@ MM_ParallelDispatcher::completeTask(MM_EnvironmentBase *env)
 	env->_currentTask = NULL;
 	_taskTable[workerID] = NULL;
 
+	/* Update this worker thread's CPU time, which also ends its stats for the task */
+	int64_t cpuTime = -1;
+	if (!env->isMainThread() || _collectWorkerThreadStats) {
+		cpuTime = omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread);
+		if (!env->isMainThread()) {
+			env->_workerThreadCpuTimeNanos = cpuTime;
+		}
+	}
+
+	if (_collectWorkerThreadStats) {
+		/* Published before completing, the main thread reads the table once all threads have completed */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		env->_workerThreadStats.end(omrtime_hires_clock(), cpuTime);
+		_workerThreadStatsTable[workerID] = env->_workerThreadStats;
+	}
+
 	currentTask->complete(env);
 }
 
@@ -594,10 +635,34 @@ MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 void
 MM_ParallelDispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount)
 {
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = 0;
+
+	/* Threads read the flag once they are dispatched, it does not change until all of them have completed the task */
+	_collectWorkerThreadStats = _extensions->verboseWorkerStats
+		|| J9_EVENT_IS_HOOKED(_extensions->privateHookInterface, J9HOOK_MM_PRIVATE_TASK_COMPLETED);
+	if (_collectWorkerThreadStats) {
+		startTime = omrtime_hires_clock();
+	}
+
 	prepareThreadsForTask(env, task, newThreadCount);
 	acceptTask(env);
 	task->run(env);
 	completeTask(env);
+
+	if (_collectWorkerThreadStats) {
+		TRIGGER_J9HOOK_MM_PRIVATE_TASK_COMPLETED(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			omrtime_hires_clock(),
+			J9HOOK_MM_PRIVATE_TASK_COMPLETED,
+			task->getBaseVirtualTypeId(),
+			task->getThreadCount(),
+			startTime,
+			_workerThreadStatsTable,
+			_threadCountMaximum);
+	}
+
 	cleanupAfterTask(env);
 	task->mainCleanup(env);
 }
@@ -766,7 +831,7 @@ MM_ParallelDispatcher::reinitializeThreadPool(MM_EnvironmentBase *env, uintptr_t
 		  /* Dispatcher reinitialization is only supported for standard collectors. */
 		 Assert_MM_true(newPoolSize <= _poolMaxCapacity);
 	 } else if (newPoolSize > _poolMaxCapacity) {
-		/* Re-size/allocate the dispatcher tables: _threadTable, _statusTable & _taskTable. */
+		/* Re-size/allocate the dispatcher tables: _threadTable, _statusTable, _taskTable & _workerThreadStatsTable. */
 		 OMR::GC::Forge *forge = env->getForge();
 
 		 omrthread_t *threadTableTemp = (omrthread_t *)forge->allocate(
@@ -796,6 +861,17 @@ MM_ParallelDispatcher::reinitializeThreadPool(MM_EnvironmentBase *env, uintptr_t
 		 }
 		 memset(taskTableTemp, 0, newPoolSize * sizeof(MM_Task *));
 
+		 MM_WorkerThreadStats *workerThreadStatsTableTemp = (MM_WorkerThreadStats *)forge->allocate(
+				 newPoolSize * sizeof(MM_WorkerThreadStats),
+				 OMR::GC::AllocationCategory::FIXED,
+				 OMR_GET_CALLSITE());
+		 if (NULL == workerThreadStatsTableTemp) {
+			 goto error_no_memory;
+		 }
+		 for (uintptr_t index = 0; index < newPoolSize; index++) {
+			 new(&workerThreadStatsTableTemp[index]) MM_WorkerThreadStats();
+		 }
+
 		 for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
 			 threadTableTemp[index] =_threadTable[index];
 			 statusTableTemp[index] = _statusTable[index];
@@ -805,6 +881,9 @@ MM_ParallelDispatcher::reinitializeThreadPool(MM_EnvironmentBase *env, uintptr_t
 		 forge->free(_taskTable);
 		 _taskTable = taskTableTemp;
 
+		 forge->free(_workerThreadStatsTable);
+		 _workerThreadStatsTable = workerThreadStatsTableTemp;
+
 		 forge->free(_statusTable);
 		_statusTable = statusTableTemp;
 
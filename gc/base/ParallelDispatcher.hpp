@@ -62,6 +62,8 @@ protected:
 	omrthread_t *_threadTable;
 	uintptr_t *_statusTable;
 	MM_Task **_taskTable;
+	MM_WorkerThreadStats *_workerThreadStatsTable; /**< Time each thread spent on the last dispatched task, indexed by worker ID */
+	bool _collectWorkerThreadStats; /**< True if the threads record their stats for the current task, which is when -Xgc:verboseWorkerStats is set or J9HOOK_MM_PRIVATE_TASK_COMPLETED is hooked */
 	
 	omrthread_monitor_t _workerThreadMutex;
 	omrthread_monitor_t _dispatcherMonitor; /**< Provides signalling between threads for startup and shutting down as well as the thread that initiated the shutdown */
@@ -84,7 +86,7 @@ protected:
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
-	uintptr_t _poolMaxCapacity;  /**< Size of the dispatcher tables: _taskTable, _statusTable & _threadTable. */
+	uintptr_t _poolMaxCapacity;  /**< Size of the dispatcher tables: _taskTable, _statusTable, _workerThreadStatsTable & _threadTable. */
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
 public:
@@ -212,6 +214,7 @@ public:
 	MMINLINE uintptr_t threadCountMaximum() { return _threadCountMaximum; }
 	MMINLINE omrthread_t *getThreadTable() { return _threadTable; }
 	MMINLINE uintptr_t activeThreadCount() { return _activeThreadCount; }
+	MMINLINE bool isCollectingWorkerThreadStats() { return _collectWorkerThreadStats; }
 
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
 	MMINLINE void *getSignalHandlerArg() {return _handler_arg;}
@@ -229,6 +232,8 @@ public:
 		,_threadTable(NULL)
 		,_statusTable(NULL)
 		,_taskTable(NULL)
+		,_workerThreadStatsTable(NULL)
+		,_collectWorkerThreadStats(false)
 		,_workerThreadMutex(NULL)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
@@ -76,6 +76,10 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	env->_lastSyncPointReached = id;
 	
 	if(1 < _totalThreadCount) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		bool collectStats = _dispatcher->isCollectingWorkerThreadStats();
+		uint64_t startTime = collectStats ? omrtime_hires_clock() : 0;
+
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -104,6 +108,9 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 
+		if (collectStats) {
+			env->_workerThreadStats.addToBarrierStallTime(startTime, omrtime_hires_clock());
+		}
 	}
 
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
@@ -113,6 +120,9 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id)
 {
 	bool isMainThread = false;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	bool collectStats = (1 < _totalThreadCount) && _dispatcher->isCollectingWorkerThreadStats();
+	uint64_t startTime = collectStats ? omrtime_hires_clock() : 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
@@ -160,6 +170,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 	}
 
 done:
+	if (collectStats) {
+		env->_workerThreadStats.addToBarrierStallTime(startTime, omrtime_hires_clock());
+	}
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Exit(env->getLanguageVMThread());
 	return isMainThread;	
 }
@@ -168,6 +181,9 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id)
 {
 	bool isReleasedThread = false;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	bool collectStats = (1 < _totalThreadCount) && _dispatcher->isCollectingWorkerThreadStats();
+	uint64_t startTime = collectStats ? omrtime_hires_clock() : 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
@@ -207,6 +223,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	}
 
 done:
+	if (collectStats) {
+		env->_workerThreadStats.addToBarrierStallTime(startTime, omrtime_hires_clock());
+	}
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Exit(env->getLanguageVMThread());
 	return isReleasedThread;
 }
@@ -246,11 +265,6 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 {
 	const char *id = UNIQUE_ID;
 
-	/* Update this worker thread's CPU time */
-	if(!env->isMainThread()) {
-		env->_workerThreadCpuTimeNanos = omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread);
-	}
-
 	if(1 == _totalThreadCount) {
 		_threadCount -= 1;
 		MM_Task::complete(env);
@@ -27,6 +27,7 @@
 #if defined(OMR_GC)
 #include "GCExtensionsBase.hpp"
 #include "ConfigurationFlat.hpp"
+#include "VerboseEventStream.hpp"
 #endif /* OMR_GC */
 
 #define OMR_GC_BUFFER_SIZE 256
@@ -48,6 +49,12 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCVERBOSE_WORKER_STATS "-Xgc:verboseWorkerStats"
+#define OMR_XGCVERBOSE_WORKER_STATS_LENGTH 23
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -276,6 +283,30 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSE_WORKER_STATS, OMR_XGCVERBOSE_WORKER_STATS_LENGTH)) {
+		extensions->verboseWorkerStats = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->asyncLoggingBufferSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		char *format = option + OMR_XGCASYNC_LOGGING_LENGTH;
+		extensions->asyncLogging = true;
+		if ((0 == strcmp(format, "")) || (0 == strcmp(format, "=xml"))) {
+			extensions->asyncLoggingFormat = VERBOSE_OUTPUT_XML;
+		} else if (0 == strcmp(format, "=binary")) {
+			extensions->asyncLoggingFormat = VERBOSE_OUTPUT_BINARY;
+		} else if (0 == strcmp(format, "=json")) {
+			extensions->asyncLoggingFormat = VERBOSE_OUTPUT_JSON;
+		} else {
+			result = false;
+		}
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
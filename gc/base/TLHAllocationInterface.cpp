@@ -36,6 +36,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#include "AllocationSampler.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -201,6 +202,9 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 #endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
 		_stats._allocationBytes += allocDescription->getContiguousBytes();
 		_stats._allocationCount += 1;
+		if (NULL != extensions->allocationSampler) {
+			sampleAllocationOutsideTLH(env, allocDescription);
+		}
 	}
 
 	uintptr_t sizeInBytesAllocated = (_stats.bytesAllocated(false) - _bytesAllocatedBase);
@@ -209,6 +213,36 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	return result;
 }
 
+void
+MM_TLHAllocationInterface::sampleAllocationOutsideTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	MM_AllocationSampler *sampler = env->getExtensions()->allocationSampler;
+
+	if (sampler->isActive()) {
+		/* Bring the interval up to date with the TLH allocations made so far */
+		_tlhAllocationSupport.chargeSampledBytes();
+#if defined(OMR_GC_NON_ZERO_TLH)
+		_tlhAllocationSupportNonZero.chargeSampledBytes();
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+		uintptr_t size = allocDescription->getContiguousBytes();
+		if (0 == _owningEnv->_allocationSampleBytesRemaining) {
+			_owningEnv->_allocationSampleBytesRemaining = sampler->nextSampleInterval(_owningEnv);
+		}
+		if (size >= _owningEnv->_allocationSampleBytesRemaining) {
+			allocDescription->setAllocationSampled(true);
+			_owningEnv->_allocationSampleBytesRemaining = 0;
+		} else {
+			_owningEnv->_allocationSampleBytesRemaining -= size;
+		}
+
+		_tlhAllocationSupport.updateSampleThreshold(env);
+#if defined(OMR_GC_NON_ZERO_TLH)
+		_tlhAllocationSupportNonZero.updateSampleThreshold(env);
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+	}
+}
+
 void *
 MM_TLHAllocationInterface::allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
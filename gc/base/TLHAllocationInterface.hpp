@@ -93,6 +93,12 @@ private:
 	void reconnect(MM_EnvironmentBase *env);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
+	/**
+	 * Charge an allocation that did not come from a TLH to the allocation sampler, and move the
+	 * sampling thresholds of the TLHs to account for it.
+	 */
+	void sampleAllocationOutsideTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -37,6 +37,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#include "AllocationSampler.hpp"
 #include "AllocationStats.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
@@ -143,6 +144,8 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		extensions->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
+	chargeSampledBytes();
+
 	stats->_tlhDiscardedBytes += getRemainingSize();
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
@@ -250,6 +253,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		 * Do not change stats here if TLH is flushed already
 		 */
 		if (0 < getSize()) {
+			updateSampleThreshold(env);
 			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
@@ -284,6 +288,12 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 		Assert_MM_true(_reservedBytesForGC == extensions->getGlobalCollector()->reservedForGCAllocCacheSize());
 		memPtr = (void *)getAlloc();
 		setAlloc((void *)((uintptr_t)getAlloc() + sizeInBytesRequired));
+		if ((uintptr_t)getAlloc() > _sampleThreshold) {
+			/* This allocation covers the sample point */
+			allocDescription->setAllocationSampled(true);
+			env->_allocationSampleBytesRemaining = 0;
+			updateSampleThreshold(env);
+		}
 #if defined(OMR_GC_TLH_PREFETCH_FTA)
 		if (*_pointerToTlhPrefetchFTA < (intptr_t)sizeInBytesRequired) {
 			*_pointerToTlhPrefetchFTA = 0;
@@ -324,6 +334,8 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 		env->getExtensions()->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
+	chargeSampledBytes();
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
@@ -352,6 +364,49 @@ MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void
 #if defined(OMR_GC_TLH_PREFETCH_FTA)
 	*_pointerToTlhPrefetchFTA = 0;
 #endif /* OMR_GC_TLH_PREFETCH_FTA */
+
+	/* The sampling threshold is placed once the refresh completes */
+	_sampleBase = (uintptr_t)addrBase;
+	_sampleThreshold = UDATA_MAX;
+}
+
+void
+MM_TLHAllocationSupport::chargeSampledBytes()
+{
+	if (UDATA_MAX != _sampleThreshold) {
+		MM_EnvironmentBase *owningEnv = _objectAllocationInterface->getOwningEnv();
+		uintptr_t allocated = (uintptr_t)getAlloc() - _sampleBase;
+
+		/* The allocation reaching the threshold is sampled, so this only saturates when the zero and
+		 * non-zero TLHs of a thread have both been charging the same interval; a new one is then drawn.
+		 */
+		if (allocated < owningEnv->_allocationSampleBytesRemaining) {
+			owningEnv->_allocationSampleBytesRemaining -= allocated;
+		} else {
+			owningEnv->_allocationSampleBytesRemaining = 0;
+		}
+		_sampleBase = (uintptr_t)getAlloc();
+	}
+}
+
+void
+MM_TLHAllocationSupport::updateSampleThreshold(MM_EnvironmentBase *env)
+{
+	MM_AllocationSampler *sampler = env->getExtensions()->allocationSampler;
+
+	_sampleBase = (uintptr_t)getAlloc();
+	_sampleThreshold = UDATA_MAX;
+
+	if ((NULL != sampler) && sampler->isActive() && (NULL != getBase())) {
+		MM_EnvironmentBase *owningEnv = _objectAllocationInterface->getOwningEnv();
+		if (0 == owningEnv->_allocationSampleBytesRemaining) {
+			owningEnv->_allocationSampleBytesRemaining = sampler->nextSampleInterval(owningEnv);
+		}
+
+		/* The sample point is the last byte of the interval; a point beyond the address space is never reached */
+		uintptr_t offset = owningEnv->_allocationSampleBytesRemaining - 1;
+		_sampleThreshold = (offset < (UDATA_MAX - 1 - _sampleBase)) ? (_sampleBase + offset) : (UDATA_MAX - 1);
+	}
 }
 
 void
@@ -84,6 +84,9 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uintptr_t _sampleBase; /**< Allocation pointer up to which TLH allocations have been charged to the owning thread's sampling interval */
+	uintptr_t _sampleThreshold; /**< An allocation that moves the allocation pointer beyond this address is sampled, UDATA_MAX if not sampling */
 public:
 protected:
 private:
@@ -195,6 +198,18 @@ private:
 	 */
 	void *restoreTLHTopForGC(MM_EnvironmentBase *env);
 
+	/**
+	 * Charge the bytes allocated from the TLH since the last sample point to the owning thread's
+	 * sampling interval.
+	 */
+	void chargeSampledBytes();
+
+	/**
+	 * Place the sampling threshold of the TLH at the owning thread's next sample point, drawing
+	 * a new interval if the previous one has been used up.
+	 */
+	void updateSampleThreshold(MM_EnvironmentBase *env);
+
 	/**
 	 * Refresh the TLH.
 	 */
@@ -251,7 +266,9 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_sampleBase(0),
+		_sampleThreshold(UDATA_MAX)
 	{};
 
 	/*
@@ -483,24 +483,37 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 				omrthread_monitor_notify_all(_inputListMonitor);
 			} else {
 				while (mustSyncThreadsAndExit || (!inputPacketAvailable(env) && (_inputListDoneIndex == doneIndex))) {
-#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
-					uint64_t waitStartTime, waitEndTime;
 					OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
-					waitStartTime = omrtime_hires_clock();
+					bool collectWorkerThreadStats = _extensions->dispatcher->isCollectingWorkerThreadStats();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+					bool timeWait = true;
+#else /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					bool timeWait = collectWorkerThreadStats;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					uint64_t waitStartTime = timeWait ? omrtime_hires_clock() : 0;
 					
 					/* This is where all the GC threads end up synchronizing when waiting for work */
 					omrthread_monitor_wait(_inputListMonitor);
 
-#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
-					waitEndTime = omrtime_hires_clock();
+					if (timeWait) {
+						uint64_t waitEndTime = omrtime_hires_clock();
+						bool completeStall = (_inputListDoneIndex != doneIndex);
 
-					if (_inputListDoneIndex != doneIndex) {
-						env->_workPacketStats.addToCompleteStallTime(waitStartTime, waitEndTime);
-					} else {
-						env->_workPacketStats.addToWorkStallTime(waitStartTime, waitEndTime);
-					}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+						if (completeStall) {
+							env->_workPacketStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+						} else {
+							env->_workPacketStats.addToWorkStallTime(waitStartTime, waitEndTime);
+						}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+						if (collectWorkerThreadStats) {
+							if (completeStall) {
+								env->_workerThreadStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+							} else {
+								env->_workerThreadStats.addToWorkStallTime(waitStartTime, waitEndTime);
+							}
+						}
+					}
 
 #if defined(OMR_GC_VLHGC)
 					if ((NULL != env->_currentTask) && env->_currentTask->shouldYieldFromTask(env)) {
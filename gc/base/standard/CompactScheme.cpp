@@ -29,6 +29,7 @@
 #include "ModronAssertions.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "Bits.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -613,6 +614,10 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	MM_AtomicOperations::sync();
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		if (NULL != _extensions->allocationSampler) {
+			_extensions->allocationSampler->fixupAfterCompact(env, this);
+		}
+
 		rebuildFreelist(env);
 
 		MM_MemoryPool *memoryPool;
@@ -30,6 +30,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationFailureStats.hpp"
+#include "AllocationSampler.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -499,6 +500,10 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	markAll(env, initMarkMap);
 
 	_delegate.postMarkProcessing(env);
+
+	if (NULL != _extensions->allocationSampler) {
+		_extensions->allocationSampler->removeUnmarkedSamples(env, _markingScheme);
+	}
 	
 	sweep(env, allocDescription, rebuildMarkBits);
 	const MM_GCCode gcCode = env->_cycleState->_gcCode;
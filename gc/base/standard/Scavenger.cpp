@@ -46,6 +46,7 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 #include "AllocateDescription.hpp"
+#include "AllocationSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -2384,19 +2385,32 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 			} else {
 				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
 					flushBuffersForGetNextScanCache(env);
+					bool collectWorkerThreadStats = _dispatcher->isCollectingWorkerThreadStats();
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
-					uint64_t waitEndTime, waitStartTime;
-					waitStartTime = omrtime_hires_clock();
+					bool timeWait = true;
+#else /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					bool timeWait = collectWorkerThreadStats;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					uint64_t waitStartTime = timeWait ? omrtime_hires_clock() : 0;
 					omrthread_monitor_wait(_scanCacheMonitor);
+					if (timeWait) {
+						uint64_t waitEndTime = omrtime_hires_clock();
+						bool completeStall = (doneIndex != _doneIndex);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
-					waitEndTime = omrtime_hires_clock();
-					if (doneIndex != _doneIndex) {
-						env->_scavengerStats.addToCompleteStallTime(waitStartTime, waitEndTime);
-					} else {
-						env->_scavengerStats.addToWorkStallTime(waitStartTime, waitEndTime);
-					}
+						if (completeStall) {
+							env->_scavengerStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+						} else {
+							env->_scavengerStats.addToWorkStallTime(waitStartTime, waitEndTime);
+						}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+						if (collectWorkerThreadStats) {
+							if (completeStall) {
+								env->_workerThreadStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+							} else {
+								env->_workerThreadStats.addToWorkStallTime(waitStartTime, waitEndTime);
+							}
+						}
+					}
 				}
 			}
 		}
@@ -2587,6 +2601,17 @@ MM_Scavenger::completeScan(MM_EnvironmentStandard *env)
 	return !backOutRaisedThisScanCycle;
 }
 
+void
+MM_Scavenger::fixupAllocationSamples(MM_EnvironmentStandard *env)
+{
+	if (NULL != _extensions->allocationSampler) {
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+			_extensions->allocationSampler->fixupAfterScavenge(env, this);
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
 void
 MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 {
@@ -2614,6 +2639,7 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 			flushRememberedSet(env);
 		}
 		rootScanner.scanClearable(env);
+		fixupAllocationSamples(env);
 	}
 	rootScanner.flush(env);
 
@@ -5677,6 +5703,7 @@ MM_Scavenger::workThreadComplete(MM_EnvironmentStandard *env)
 	if (!isBackOutFlagRaised()) {
 		/* If aborted, the clearable work will be done by mandatory percolate global GC */
 		rootScanner.scanClearable(env);
+		fixupAllocationSamples(env);
 	}
 	rootScanner.flush(env);
 
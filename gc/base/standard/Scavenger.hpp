@@ -441,6 +441,12 @@ public:
 	 * Called at the end of a task to return empty caches to the global free pool
 	 */
 	void finalReturnCopyCachesToFreeList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Update the live allocation samples for the objects copied or left behind by this scavenge.
+	 * Called by all GC threads once clearable roots have been processed.
+	 */
+	void fixupAllocationSamples(MM_EnvironmentStandard *env);
 	/* 
 	 * Used by CS to return empty caches during intermediate blocks, to aid with more precise counting of free/empty cache in the pool
 	 */
@@ -42,6 +42,49 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/**
+ * Called for each live allocation sample by OMR_GC_IterateLiveAllocationSamples().
+ *
+ * @param[in] object the sampled object
+ * @param[in] size the size of the sampled object in bytes
+ * @param[in] frames the stack captured when the object was allocated, innermost frame first
+ * @param[in] frameCount the number of entries in frames
+ * @param[in] userData the userData passed to OMR_GC_IterateLiveAllocationSamples()
+ */
+typedef void (*OMR_GC_AllocationSampleCallback)(omrobjectptr_t object, uintptr_t size, void **frames, uintptr_t frameCount, void *userData);
+
+/**
+ * Start sampling object allocations. On average one allocation is sampled every samplingInterval
+ * bytes allocated by a thread, and each sample is reported through J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED.
+ * Samples are tracked until their object is collected. Restarting discards the samples of the
+ * previous session.
+ *
+ * @param[in] omrVMThread the calling thread; exclusive VM access is acquired for the call
+ * @param[in] samplingInterval mean number of bytes allocated between samples, must not be 0
+ * @param[in] maxFrames maximum number of frames captured for each sample, capped at 64
+ * @return OMR_ERROR_NONE on success, OMR_ERROR_ILLEGAL_ARGUMENT or OMR_ERROR_OUT_OF_NATIVE_MEMORY otherwise
+ */
+omr_error_t OMR_GC_StartAllocationSampling(OMR_VMThread *omrVMThread, uintptr_t samplingInterval, uintptr_t maxFrames);
+
+/**
+ * Stop sampling object allocations and discard the live samples.
+ *
+ * @param[in] omrVMThread the calling thread; exclusive VM access is acquired for the call
+ * @return OMR_ERROR_NONE
+ */
+omr_error_t OMR_GC_StopAllocationSampling(OMR_VMThread *omrVMThread);
+
+/**
+ * Walk the samples whose objects have survived every collection since they were sampled, which
+ * is the sampled retained heap. Objects that died since the last collection are still included.
+ *
+ * @param[in] omrVMThread the calling thread; exclusive VM access is acquired for the call
+ * @param[in] callback function called for each live sample, which must not allocate
+ * @param[in] userData passed to callback
+ * @return OMR_ERROR_NONE, or OMR_ERROR_NOT_AVAILABLE if sampling has not been started
+ */
+omr_error_t OMR_GC_IterateLiveAllocationSamples(OMR_VMThread *omrVMThread, OMR_GC_AllocationSampleCallback callback, void *userData);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
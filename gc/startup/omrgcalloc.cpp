@@ -25,6 +25,7 @@
 #include "objectdescription.h"
 
 #include "AllocateInitialization.hpp"
+#include "AllocationSampler.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
@@ -60,3 +61,59 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_StartAllocationSampling(OMR_VMThread *omrVMThread, uintptr_t samplingInterval, uintptr_t maxFrames)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (0 == samplingInterval) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	env->acquireExclusiveVMAccess();
+	if (NULL == extensions->allocationSampler) {
+		extensions->allocationSampler = MM_AllocationSampler::newInstance(env);
+	}
+	if ((NULL == extensions->allocationSampler) || !extensions->allocationSampler->start(env, samplingInterval, maxFrames)) {
+		result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	env->releaseExclusiveVMAccess();
+
+	return result;
+}
+
+omr_error_t
+OMR_GC_StopAllocationSampling(OMR_VMThread *omrVMThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	env->acquireExclusiveVMAccess();
+	if (NULL != extensions->allocationSampler) {
+		extensions->allocationSampler->stop(env);
+	}
+	env->releaseExclusiveVMAccess();
+
+	return OMR_ERROR_NONE;
+}
+
+omr_error_t
+OMR_GC_IterateLiveAllocationSamples(OMR_VMThread *omrVMThread, OMR_GC_AllocationSampleCallback callback, void *userData)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	env->acquireExclusiveVMAccess();
+	if ((NULL != extensions->allocationSampler) && extensions->allocationSampler->isActive()) {
+		extensions->allocationSampler->iterateLiveSamples(env, callback, userData);
+	} else {
+		result = OMR_ERROR_NOT_AVAILABLE;
+	}
+	env->releaseExclusiveVMAccess();
+
+	return result;
+}
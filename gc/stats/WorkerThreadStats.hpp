@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(WORKERTHREADSTATS_HPP_)
+#define WORKERTHREADSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/**
+ * Storage for the time a single GC thread spent on its share of one dispatched task.
+ * Every thread records into its own environment while the task runs, and the dispatcher
+ * copies the result into a table indexed by worker ID when the thread completes the task.
+ * Wall clock times are in hi-res ticks, CPU time is in nanoseconds.
+ * @ingroup GC_Stats
+ */
+class MM_WorkerThreadStats
+{
+public:
+	uint64_t _startTime; /**< The time, in hi-res ticks, the thread accepted the task */
+	uint64_t _endTime; /**< The time, in hi-res ticks, the thread completed its share of the task (0 if it did not take part) */
+	int64_t _cpuStartTime; /**< CPU time of the thread, in nanoseconds, when it accepted the task (negative if unavailable) */
+	uint64_t _cpuTime; /**< CPU time, in nanoseconds, the thread consumed while working on the task */
+	uintptr_t _barrierStallCount; /**< The number of times the thread waited at a synchronization point */
+	uint64_t _barrierStallTime; /**< The time, in hi-res ticks, the thread spent waiting at synchronization points */
+	uintptr_t _workStallCount; /**< The number of times the thread ran out of work and waited for other threads to share theirs */
+	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent waiting for work from other threads */
+	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent waiting for all other threads to run out of work */
+
+public:
+	void clear()
+	{
+		_startTime = 0;
+		_endTime = 0;
+		_cpuStartTime = -1;
+		_cpuTime = 0;
+		_barrierStallCount = 0;
+		_barrierStallTime = 0;
+		_workStallCount = 0;
+		_workStallTime = 0;
+		_completeStallTime = 0;
+	}
+
+	/**
+	 * Start accounting for a new task.
+	 * @param startTime hi-res time the task was accepted
+	 * @param cpuTime CPU time of the thread in nanoseconds, or negative if unavailable
+	 */
+	MMINLINE void
+	start(uint64_t startTime, int64_t cpuTime)
+	{
+		clear();
+		_startTime = startTime;
+		_cpuStartTime = cpuTime;
+	}
+
+	/**
+	 * Finish accounting for the current task.
+	 * @param endTime hi-res time the thread completed the task
+	 * @param cpuTime CPU time of the thread in nanoseconds, or negative if unavailable
+	 */
+	MMINLINE void
+	end(uint64_t endTime, int64_t cpuTime)
+	{
+		_endTime = endTime;
+		if ((0 <= _cpuStartTime) && (_cpuStartTime <= cpuTime)) {
+			_cpuTime = (uint64_t)(cpuTime - _cpuStartTime);
+		}
+	}
+
+	/**
+	 * Time is stored in raw format, converted to resolution at time of output.
+	 * Don't need to worry about wrap (endTime < startTime as unsigned math
+	 * takes care of wrap)
+	 */
+	MMINLINE void
+	addToBarrierStallTime(uint64_t startTime, uint64_t endTime)
+	{
+		_barrierStallCount += 1;
+		_barrierStallTime += (endTime - startTime);
+	}
+
+	MMINLINE void
+	addToWorkStallTime(uint64_t startTime, uint64_t endTime)
+	{
+		_workStallCount += 1;
+		_workStallTime += (endTime - startTime);
+	}
+
+	MMINLINE void
+	addToCompleteStallTime(uint64_t startTime, uint64_t endTime)
+	{
+		_completeStallTime += (endTime - startTime);
+	}
+
+	/**
+	 * Get the time the thread spent waiting for work, whether or not more work arrived
+	 * @return the time in hi-res ticks
+	 */
+	MMINLINE uint64_t
+	getStealTime()
+	{
+		return _workStallTime + _completeStallTime;
+	}
+
+	MM_WorkerThreadStats()
+	{
+		clear();
+	}
+};
+
+#endif /* WORKERTHREADSTATS_HPP_ */
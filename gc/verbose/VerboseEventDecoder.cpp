@@ -0,0 +1,555 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "VerboseEventDecoder.hpp"
+
+#include <string.h>
+
+#define MINIMUM_TEXT_SIZE 4096
+#define MAXIMUM_ELEMENT_DEPTH 64
+
+/**
+ * Output which is only written while it fits the buffer.
+ */
+typedef struct JSONOutput {
+	char *buffer;
+	uintptr_t size;
+	uintptr_t length;
+} JSONOutput;
+
+static void
+put(JSONOutput *output, const char *text, uintptr_t length)
+{
+	if ((output->length + length) <= output->size) {
+		memcpy(output->buffer + output->length, text, length);
+	}
+	output->length += length;
+}
+
+static void
+put(JSONOutput *output, const char *text)
+{
+	put(output, text, strlen(text));
+}
+
+static void
+putEscapedCharacter(JSONOutput *output, char c)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+
+	switch (c) {
+	case '"':
+		put(output, "\\\"", 2);
+		break;
+	case '\\':
+		put(output, "\\\\", 2);
+		break;
+	case '\n':
+		put(output, "\\n", 2);
+		break;
+	case '\r':
+		put(output, "\\r", 2);
+		break;
+	case '\t':
+		put(output, "\\t", 2);
+		break;
+	default:
+		if ((unsigned char)c < 0x20) {
+			char escape[] = { '\\', 'u', '0', '0', hexDigits[((unsigned char)c) >> 4], hexDigits[c & 0xf] };
+			put(output, escape, sizeof(escape));
+		} else {
+			put(output, &c, 1);
+		}
+		break;
+	}
+}
+
+/**
+ * Decode a character reference or one of the predefined entities.
+ * @return the length of the reference, or 0 if text does not start with one
+ */
+static uintptr_t
+decodeEntity(const char *text, const char *end, uint32_t *codePoint)
+{
+	static const struct { const char *name; char value; } entities[] = {
+		{ "&lt;", '<' }, { "&gt;", '>' }, { "&amp;", '&' }, { "&quot;", '"' }, { "&apos;", '\'' }
+	};
+
+	for (uintptr_t i = 0; i < sizeof(entities) / sizeof(entities[0]); i++) {
+		uintptr_t length = strlen(entities[i].name);
+		if (((uintptr_t)(end - text) >= length) && (0 == strncmp(text, entities[i].name, length))) {
+			*codePoint = (uint32_t)entities[i].value;
+			return length;
+		}
+	}
+
+	if (((end - text) > 3) && ('#' == text[1])) {
+		bool hex = ('x' == text[2]) || ('X' == text[2]);
+		const char *cursor = text + (hex ? 3 : 2);
+		uint32_t value = 0;
+		uintptr_t digits = 0;
+		for (; (cursor < end) && (';' != *cursor) && (digits < 8); cursor++, digits++) {
+			char c = *cursor;
+			if (('0' <= c) && ('9' >= c)) {
+				value = (value * (hex ? 16 : 10)) + (c - '0');
+			} else if (hex && ('a' <= (c | 0x20)) && ('f' >= (c | 0x20))) {
+				value = (value * 16) + ((c | 0x20) - 'a' + 10);
+			} else {
+				return 0;
+			}
+		}
+		if ((cursor < end) && (';' == *cursor) && (0 < digits) && (0x10ffff >= value)) {
+			*codePoint = value;
+			return cursor + 1 - text;
+		}
+	}
+
+	return 0;
+}
+
+static void
+putEscaped(JSONOutput *output, const char *text, const char *end)
+{
+	while (text < end) {
+		uint32_t codePoint = 0;
+		uintptr_t length = ('&' == *text) ? decodeEntity(text, end, &codePoint) : 0;
+		if (0 == length) {
+			putEscapedCharacter(output, *text);
+			text += 1;
+		} else {
+			if (0x80 > codePoint) {
+				putEscapedCharacter(output, (char)codePoint);
+			} else {
+				/* encode as UTF-8 */
+				char bytes[4];
+				uintptr_t count = 0;
+				if (0x800 > codePoint) {
+					bytes[count++] = (char)(0xc0 | (codePoint >> 6));
+				} else if (0x10000 > codePoint) {
+					bytes[count++] = (char)(0xe0 | (codePoint >> 12));
+					bytes[count++] = (char)(0x80 | ((codePoint >> 6) & 0x3f));
+				} else {
+					bytes[count++] = (char)(0xf0 | (codePoint >> 18));
+					bytes[count++] = (char)(0x80 | ((codePoint >> 12) & 0x3f));
+					bytes[count++] = (char)(0x80 | ((codePoint >> 6) & 0x3f));
+				}
+				bytes[count++] = (char)(0x80 | (codePoint & 0x3f));
+				put(output, bytes, count);
+			}
+			text += length;
+		}
+	}
+}
+
+static bool
+isWhitespace(char c)
+{
+	return (' ' == c) || ('\n' == c) || ('\r' == c) || ('\t' == c);
+}
+
+static void
+skipWhitespace(const char **cursor, const char *end)
+{
+	while ((*cursor < end) && isWhitespace(**cursor)) {
+		*cursor += 1;
+	}
+}
+
+static bool
+startsWith(const char *cursor, const char *end, const char *prefix)
+{
+	uintptr_t length = strlen(prefix);
+	return ((uintptr_t)(end - cursor) >= length) && (0 == strncmp(cursor, prefix, length));
+}
+
+static void
+skipPast(const char **cursor, const char *end, const char *terminator)
+{
+	while ((*cursor < end) && !startsWith(*cursor, end, terminator)) {
+		*cursor += 1;
+	}
+	if (*cursor < end) {
+		*cursor += strlen(terminator);
+	}
+}
+
+/**
+ * Skip a comment or processing instruction.
+ * @return true if one was skipped
+ */
+static bool
+skipMarkup(const char **cursor, const char *end)
+{
+	if (startsWith(*cursor, end, "<!--")) {
+		skipPast(cursor, end, "-->");
+		return true;
+	}
+	if (startsWith(*cursor, end, "<?") || startsWith(*cursor, end, "<!")) {
+		skipPast(cursor, end, ">");
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Convert the element starting at cursor, which is on its '<'.
+ */
+static void
+convertElement(const char **cursor, const char *end, JSONOutput *output, uintptr_t depth)
+{
+	const char *name = *cursor + 1;
+	const char *nameEnd = name;
+	while ((nameEnd < end) && !isWhitespace(*nameEnd) && ('/' != *nameEnd) && ('>' != *nameEnd)) {
+		nameEnd += 1;
+	}
+	*cursor = nameEnd;
+
+	put(output, "{\"tag\":\"");
+	putEscaped(output, name, nameEnd);
+	put(output, "\"");
+
+	/* attributes */
+	bool hasAttributes = false;
+	bool hasContent = false;
+	while (*cursor < end) {
+		skipWhitespace(cursor, end);
+		if (*cursor >= end) {
+			break;
+		}
+		if ('/' == **cursor) {
+			skipPast(cursor, end, ">");
+			break;
+		}
+		if ('>' == **cursor) {
+			*cursor += 1;
+			hasContent = true;
+			break;
+		}
+
+		const char *attribute = *cursor;
+		while ((*cursor < end) && !isWhitespace(**cursor) && ('=' != **cursor) && ('>' != **cursor) && ('/' != **cursor)) {
+			*cursor += 1;
+		}
+		const char *attributeEnd = *cursor;
+		if (attribute == attributeEnd) {
+			*cursor += 1;
+			continue;
+		}
+
+		const char *value = attributeEnd;
+		const char *valueEnd = attributeEnd;
+		skipWhitespace(cursor, end);
+		if ((*cursor < end) && ('=' == **cursor)) {
+			*cursor += 1;
+			skipWhitespace(cursor, end);
+			if ((*cursor < end) && (('"' == **cursor) || ('\'' == **cursor))) {
+				char quote = **cursor;
+				value = *cursor + 1;
+				valueEnd = value;
+				while ((valueEnd < end) && (quote != *valueEnd)) {
+					valueEnd += 1;
+				}
+				*cursor = (valueEnd < end) ? (valueEnd + 1) : valueEnd;
+			} else {
+				value = *cursor;
+				while ((*cursor < end) && !isWhitespace(**cursor) && ('>' != **cursor)) {
+					*cursor += 1;
+				}
+				valueEnd = *cursor;
+			}
+		}
+
+		put(output, hasAttributes ? ",\"" : ",\"attributes\":{\"");
+		hasAttributes = true;
+		putEscaped(output, attribute, attributeEnd);
+		put(output, "\":\"");
+		putEscaped(output, value, valueEnd);
+		put(output, "\"");
+	}
+	if (hasAttributes) {
+		put(output, "}");
+	}
+
+	/* children and text, in order */
+	bool hasChildren = false;
+	while (hasContent && (*cursor < end)) {
+		if (startsWith(*cursor, end, "</")) {
+			skipPast(cursor, end, ">");
+			break;
+		}
+		if (skipMarkup(cursor, end)) {
+			continue;
+		}
+		if ('<' == **cursor) {
+			if (MAXIMUM_ELEMENT_DEPTH <= depth) {
+				skipPast(cursor, end, ">");
+				continue;
+			}
+			put(output, hasChildren ? "," : ",\"children\":[");
+			hasChildren = true;
+			convertElement(cursor, end, output, depth + 1);
+			continue;
+		}
+
+		const char *text = *cursor;
+		while ((*cursor < end) && ('<' != **cursor)) {
+			*cursor += 1;
+		}
+		const char *textEnd = *cursor;
+		while ((text < textEnd) && isWhitespace(*text)) {
+			text += 1;
+		}
+		while ((text < textEnd) && isWhitespace(textEnd[-1])) {
+			textEnd -= 1;
+		}
+		if (text < textEnd) {
+			put(output, hasChildren ? ",{\"text\":\"" : ",\"children\":[{\"text\":\"");
+			hasChildren = true;
+			putEscaped(output, text, textEnd);
+			put(output, "\"}");
+		}
+	}
+	if (hasChildren) {
+		put(output, "]");
+	}
+
+	put(output, "}");
+}
+
+uintptr_t
+MM_VerboseEventDecoder::convertToJSON(const char *xml, uintptr_t length, char *buffer, uintptr_t bufferSize)
+{
+	JSONOutput output = { buffer, bufferSize, 0 };
+	const char *cursor = xml;
+	const char *end = xml + length;
+
+	while (cursor < end) {
+		skipWhitespace(&cursor, end);
+		if (cursor >= end) {
+			break;
+		}
+		if (skipMarkup(&cursor, end)) {
+			continue;
+		}
+		if (startsWith(cursor, end, "</")) {
+			/* closes an element of an earlier stanza */
+			skipPast(&cursor, end, ">");
+			continue;
+		}
+		if ('<' == *cursor) {
+			convertElement(&cursor, end, &output, 0);
+			put(&output, "\n", 1);
+		} else {
+			/* text outside of any element */
+			while ((cursor < end) && ('<' != *cursor)) {
+				cursor += 1;
+			}
+		}
+	}
+
+	return output.length;
+}
+
+bool
+MM_VerboseEventDecoder::ensureText(uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	uintptr_t sizeNeeded = _textLength + length + 1;
+
+	if (sizeNeeded > _textSize) {
+		uintptr_t newSize = OMR_MAX(OMR_MAX(sizeNeeded, 2 * _textSize), MINIMUM_TEXT_SIZE);
+		char *newText = (char *)omrmem_allocate_memory(newSize, OMRMEM_CATEGORY_MM);
+		if (NULL == newText) {
+			return false;
+		}
+		if (NULL != _text) {
+			memcpy(newText, _text, _textLength);
+			omrmem_free_memory(_text);
+		}
+		_text = newText;
+		_textSize = newSize;
+	}
+
+	return true;
+}
+
+bool
+MM_VerboseEventDecoder::appendText(const char *text, uintptr_t length)
+{
+	if (!ensureText(length)) {
+		return false;
+	}
+	memcpy(_text + _textLength, text, length);
+	_textLength += length;
+	return true;
+}
+
+bool
+MM_VerboseEventDecoder::decodeRecord(const MM_VerboseEventRecord *record, const char *format)
+{
+	bool result = true;
+
+	switch (record->_type) {
+	case VERBOSE_EVENT_RECORD_OUTPUT: {
+		uintptr_t room = _textSize - _textLength;
+		uintptr_t length = MM_VerboseEventStream::formatOutput(_portLibrary, format, record, _text + _textLength, room);
+		if (length >= room) {
+			result = ensureText(length);
+			if (result) {
+				MM_VerboseEventStream::formatOutput(_portLibrary, format, record, _text + _textLength, _textSize - _textLength);
+			}
+		}
+		if (result) {
+			_textLength += length;
+		}
+		break;
+	}
+	case VERBOSE_EVENT_RECORD_TEXT:
+		if ((VERBOSE_OUTPUT_XML == _outputFormat) || (0 == (record->_indent & VERBOSE_EVENT_TEXT_MARKUP))) {
+			const char *text = MM_VerboseEventStream::getString(record);
+			result = appendText(text, strlen(text));
+		}
+		break;
+	case VERBOSE_EVENT_RECORD_FLUSH:
+		flush();
+		break;
+	default:
+		break;
+	}
+
+	return result;
+}
+
+bool
+MM_VerboseEventDecoder::decodeStream(const uint8_t *stream, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	bool result = true;
+	const char **formats = NULL; /**< format strings, indexed by id */
+	uintptr_t formatsSize = 0;
+	uintptr_t offset = 0;
+
+	while (result && (offset < size)) {
+		uintptr_t remaining = size - offset;
+		if ((remaining >= sizeof(MM_VerboseEventStreamHeader)) && (0 == memcmp(stream + offset, VERBOSE_EVENT_STREAM_MAGIC, sizeof(VERBOSE_EVENT_STREAM_MAGIC)))) {
+			/* format ids start over with every stream */
+			const MM_VerboseEventStreamHeader *header = (const MM_VerboseEventStreamHeader *)(stream + offset);
+			if ((VERBOSE_EVENT_STREAM_VERSION != header->_version) || (sizeof(void *) != header->_pointerSize)) {
+				result = false;
+			} else if (NULL != formats) {
+				memset((void *)formats, 0, formatsSize * sizeof(const char *));
+			}
+			offset += sizeof(MM_VerboseEventStreamHeader);
+			continue;
+		}
+
+		const MM_VerboseEventRecord *record = (const MM_VerboseEventRecord *)(stream + offset);
+		if ((remaining < sizeof(MM_VerboseEventRecord))
+			|| (record->_size < sizeof(MM_VerboseEventRecord))
+			|| (record->_size > remaining)
+			|| (0 != (record->_size % VERBOSE_EVENT_RECORD_ALIGNMENT))
+		) {
+			result = false;
+			break;
+		}
+
+		uintptr_t payloadSize = record->_size - sizeof(MM_VerboseEventRecord);
+		bool hasString = (VERBOSE_EVENT_RECORD_FORMAT == record->_type) || (VERBOSE_EVENT_RECORD_TEXT == record->_type);
+		if (hasString && (NULL == memchr(MM_VerboseEventStream::getString(record), '\0', payloadSize))) {
+			result = false;
+		} else if (VERBOSE_EVENT_RECORD_FORMAT == record->_type) {
+			if (record->_format >= formatsSize) {
+				uintptr_t newSize = OMR_MAX((uintptr_t)record->_format + 1, 2 * formatsSize);
+				const char **newFormats = (const char **)omrmem_allocate_memory(newSize * sizeof(const char *), OMRMEM_CATEGORY_MM);
+				if (NULL == newFormats) {
+					result = false;
+					break;
+				}
+				memset((void *)newFormats, 0, newSize * sizeof(const char *));
+				if (NULL != formats) {
+					memcpy((void *)newFormats, (void *)formats, formatsSize * sizeof(const char *));
+					omrmem_free_memory((void *)formats);
+				}
+				formats = newFormats;
+				formatsSize = newSize;
+			}
+			formats[record->_format] = MM_VerboseEventStream::getString(record);
+		} else if (VERBOSE_EVENT_RECORD_OUTPUT == record->_type) {
+			const char *format = (record->_format < formatsSize) ? formats[record->_format] : NULL;
+			result = (NULL != format) && decodeRecord(record, format);
+		} else {
+			result = decodeRecord(record, NULL);
+		}
+		offset += record->_size;
+	}
+
+	flush();
+	omrmem_free_memory((void *)formats);
+
+	return result;
+}
+
+void
+MM_VerboseEventDecoder::flush()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (0 == _textLength) {
+		return;
+	}
+
+	if (VERBOSE_OUTPUT_JSON == _outputFormat) {
+		uintptr_t length = convertToJSON(_text, _textLength, _json, _jsonSize);
+		if (length > _jsonSize) {
+			uintptr_t newSize = OMR_MAX(length, 2 * _jsonSize);
+			char *newJSON = (char *)omrmem_allocate_memory(newSize, OMRMEM_CATEGORY_MM);
+			if (NULL != newJSON) {
+				omrmem_free_memory(_json);
+				_json = newJSON;
+				_jsonSize = newSize;
+				length = convertToJSON(_text, _textLength, _json, _jsonSize);
+			} else {
+				length = 0;
+			}
+		}
+		if ((-1 != _fileDescriptor) && (0 != length)) {
+			omrfile_write_text(_fileDescriptor, _json, length);
+		}
+	} else if (-1 != _fileDescriptor) {
+		omrfile_write_text(_fileDescriptor, _text, _textLength);
+	}
+
+	_textLength = 0;
+}
+
+void
+MM_VerboseEventDecoder::tearDown()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	omrmem_free_memory(_text);
+	_text = NULL;
+	_textSize = 0;
+	_textLength = 0;
+	omrmem_free_memory(_json);
+	_json = NULL;
+	_jsonSize = 0;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTDECODER_HPP_)
+#define VERBOSEEVENTDECODER_HPP_
+
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include "VerboseEventStream.hpp"
+
+/**
+ * Turns binary verbose records back into the verbose GC XML, or into JSON lines.
+ *
+ * Records are decoded one at a time and the text is written to a file descriptor at the end of
+ * each stanza. In JSON lines output every top level element of a stanza becomes one object,
+ * {"tag":...,"attributes":{...},"children":[...]}, where text content appears as {"text":...}
+ * among the children. Attribute values are kept as strings. The file header and footer are
+ * omitted, and an element left open at the end of a stanza is closed there.
+ *
+ * Like MM_VerboseEventStream this depends only on the port library.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseEventDecoder
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	OMRPortLibrary *_portLibrary;
+	VerboseOutputFormat _outputFormat; /**< VERBOSE_OUTPUT_XML or VERBOSE_OUTPUT_JSON */
+	intptr_t _fileDescriptor; /**< where text is written, or -1 */
+	char *_text; /**< text of the current stanza */
+	uintptr_t _textLength;
+	uintptr_t _textSize;
+	char *_json; /**< JSON lines of the current stanza */
+	uintptr_t _jsonSize;
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Decode one record. Format records and records that are never part of a stream are ignored.
+	 * @param[in] record the record to decode
+	 * @param[in] format the format string of an output record, ignored for other records
+	 * @return false if the text could not be buffered, true otherwise
+	 */
+	bool decodeRecord(const MM_VerboseEventRecord *record, const char *format);
+
+	/**
+	 * Decode a binary stream, which may be several streams one after the other, and write out
+	 * all of its text.
+	 * @param[in] stream the stream, aligned to VERBOSE_EVENT_RECORD_ALIGNMENT
+	 * @param[in] size the size of the stream in bytes
+	 * @return false if the stream is malformed or written on a platform with another pointer size,
+	 * or the text could not be buffered; true otherwise
+	 */
+	bool decodeStream(const uint8_t *stream, uintptr_t size);
+
+	/**
+	 * Write out the text of the current stanza, even if it is not complete.
+	 */
+	void flush();
+
+	/**
+	 * Set the file descriptor the text is written to.
+	 */
+	void setFileDescriptor(intptr_t fileDescriptor) { _fileDescriptor = fileDescriptor; }
+
+	/**
+	 * Convert XML text to JSON lines, one for each top level element.
+	 * @param[in] xml the text, which does not have to be NUL terminated
+	 * @param[in] length the length of the text
+	 * @param[out] buffer where the lines are written
+	 * @param[in] bufferSize bytes available at buffer
+	 * @return the length of the lines, which were only written completely if it is not more than bufferSize
+	 */
+	static uintptr_t convertToJSON(const char *xml, uintptr_t length, char *buffer, uintptr_t bufferSize);
+
+	/**
+	 * Release the buffers of the decoder.
+	 */
+	void tearDown();
+
+	MM_VerboseEventDecoder(OMRPortLibrary *portLibrary, VerboseOutputFormat outputFormat)
+		: _portLibrary(portLibrary)
+		, _outputFormat(outputFormat)
+		, _fileDescriptor(-1)
+		, _text(NULL)
+		, _textLength(0)
+		, _textSize(0)
+		, _json(NULL)
+		, _jsonSize(0)
+	{}
+
+protected:
+private:
+	bool ensureText(uintptr_t length);
+	bool appendText(const char *text, uintptr_t length);
+	void endOfStanza();
+};
+
+#endif /* VERBOSEEVENTDECODER_HPP_ */
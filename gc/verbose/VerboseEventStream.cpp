@@ -0,0 +1,447 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "VerboseEventStream.hpp"
+
+#include <string.h>
+
+#define INDENT_SPACER "  "
+#define NULL_STRING_LENGTH ((uint64_t)-1)
+#define MAX_SPEC_LENGTH 48
+
+typedef enum {
+	LENGTH_DEFAULT = 0,
+	LENGTH_SHORT,
+	LENGTH_LONG,
+	LENGTH_LONG_LONG,
+	LENGTH_SIZE,
+	LENGTH_LONG_DOUBLE
+} ArgumentLength;
+
+typedef enum {
+	KIND_NONE = 0,
+	KIND_INTEGER,
+	KIND_SIGNED_INTEGER,
+	KIND_POINTER,
+	KIND_DOUBLE,
+	KIND_STRING
+} ArgumentKind;
+
+/**
+ * A conversion specification of a format string, from its '%' up to and including the
+ * conversion character.
+ */
+typedef struct FormatSpec {
+	const char *start;
+	const char *end;
+	bool widthFromArgument;
+	bool precisionFromArgument;
+	ArgumentLength length;
+	ArgumentKind kind;
+} FormatSpec;
+
+/**
+ * Output text which is only written while it fits the buffer, leaving room for a NUL terminator.
+ */
+typedef struct TextOutput {
+	char *buffer;
+	uintptr_t size;
+	uintptr_t length;
+} TextOutput;
+
+static void
+parseSpec(const char *cursor, FormatSpec *spec)
+{
+	spec->start = cursor;
+	spec->widthFromArgument = false;
+	spec->precisionFromArgument = false;
+	spec->length = LENGTH_DEFAULT;
+	spec->kind = KIND_NONE;
+
+	cursor += 1;
+	while (('\0' != *cursor) && (NULL != strchr("-+ #0", *cursor))) {
+		cursor += 1;
+	}
+	if ('*' == *cursor) {
+		spec->widthFromArgument = true;
+		cursor += 1;
+	}
+	while (('0' <= *cursor) && ('9' >= *cursor)) {
+		cursor += 1;
+	}
+	if ('.' == *cursor) {
+		cursor += 1;
+		if ('*' == *cursor) {
+			spec->precisionFromArgument = true;
+			cursor += 1;
+		}
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+	}
+
+	switch (*cursor) {
+	case 'h':
+		spec->length = LENGTH_SHORT;
+		cursor += ('h' == cursor[1]) ? 2 : 1;
+		break;
+	case 'l':
+		if ('l' == cursor[1]) {
+			spec->length = LENGTH_LONG_LONG;
+			cursor += 2;
+		} else {
+			spec->length = LENGTH_LONG;
+			cursor += 1;
+		}
+		break;
+	case 'q':
+	case 'j':
+		spec->length = LENGTH_LONG_LONG;
+		cursor += 1;
+		break;
+	case 'z':
+	case 't':
+		spec->length = LENGTH_SIZE;
+		cursor += 1;
+		break;
+	case 'L':
+		spec->length = LENGTH_LONG_DOUBLE;
+		cursor += 1;
+		break;
+	default:
+		break;
+	}
+
+	switch (*cursor) {
+	case 'd':
+	case 'i':
+		spec->kind = KIND_SIGNED_INTEGER;
+		break;
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X':
+	case 'c':
+		spec->kind = KIND_INTEGER;
+		break;
+	case 'p':
+		spec->kind = KIND_POINTER;
+		break;
+	case 'e':
+	case 'E':
+	case 'f':
+	case 'F':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		spec->kind = KIND_DOUBLE;
+		break;
+	case 's':
+		spec->kind = KIND_STRING;
+		break;
+	default:
+		/* %% and unsupported conversions take no argument */
+		break;
+	}
+
+	spec->end = ('\0' == *cursor) ? cursor : (cursor + 1);
+}
+
+static void
+putBytes(uint8_t *buffer, uintptr_t bufferSize, uintptr_t *offset, const void *bytes, uintptr_t length)
+{
+	if ((*offset + length) <= bufferSize) {
+		if (NULL == bytes) {
+			memset(buffer + *offset, 0, length);
+		} else {
+			memcpy(buffer + *offset, bytes, length);
+		}
+	}
+	*offset += length;
+}
+
+static void
+putValue(uint8_t *buffer, uintptr_t bufferSize, uintptr_t *offset, uint64_t value)
+{
+	putBytes(buffer, bufferSize, offset, &value, sizeof(value));
+}
+
+static bool
+getValue(const uint8_t **cursor, const uint8_t *end, uint64_t *value)
+{
+	if ((uintptr_t)(end - *cursor) < sizeof(uint64_t)) {
+		return false;
+	}
+	memcpy(value, *cursor, sizeof(uint64_t));
+	*cursor += sizeof(uint64_t);
+	return true;
+}
+
+static void
+appendText(TextOutput *output, const char *text, uintptr_t length)
+{
+	if ((output->length + length) < output->size) {
+		memcpy(output->buffer + output->length, text, length);
+	}
+	output->length += length;
+}
+
+static void
+appendFormatted(OMRPortLibrary *portLibrary, TextOutput *output, const char *spec, ...)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	va_list args;
+	va_list argsCopy;
+
+	va_start(args, spec);
+	COPY_VA_LIST(argsCopy, args);
+	/* the size needed includes the NUL terminator */
+	uintptr_t length = omrstr_vprintf(NULL, 0, spec, argsCopy) - 1;
+	if ((output->length + length) < output->size) {
+		COPY_VA_LIST(argsCopy, args);
+		omrstr_vprintf(output->buffer + output->length, output->size - output->length, spec, argsCopy);
+	}
+	output->length += length;
+	va_end(args);
+}
+
+uintptr_t
+MM_VerboseEventStream::encodeOutput(void *buffer, uintptr_t bufferSize, uintptr_t indent, const char *format, va_list args)
+{
+	uint8_t *base = (uint8_t *)buffer;
+	uintptr_t offset = sizeof(MM_VerboseEventRecord);
+	const char *cursor = format;
+
+	while ('\0' != *cursor) {
+		if ('%' != *cursor) {
+			cursor += 1;
+			continue;
+		}
+
+		FormatSpec spec;
+		parseSpec(cursor, &spec);
+		cursor = spec.end;
+
+		if (spec.widthFromArgument) {
+			putValue(base, bufferSize, &offset, (uint64_t)(int64_t)va_arg(args, int));
+		}
+		if (spec.precisionFromArgument) {
+			putValue(base, bufferSize, &offset, (uint64_t)(int64_t)va_arg(args, int));
+		}
+
+		switch (spec.kind) {
+		case KIND_INTEGER:
+		case KIND_SIGNED_INTEGER:
+			/* signed values are decoded by truncation, so only their width matters */
+			switch (spec.length) {
+			case LENGTH_LONG:
+				putValue(base, bufferSize, &offset, (uint64_t)va_arg(args, unsigned long));
+				break;
+			case LENGTH_LONG_LONG:
+				putValue(base, bufferSize, &offset, (uint64_t)va_arg(args, unsigned long long));
+				break;
+			case LENGTH_SIZE:
+				putValue(base, bufferSize, &offset, (uint64_t)va_arg(args, uintptr_t));
+				break;
+			default:
+				putValue(base, bufferSize, &offset, (uint64_t)va_arg(args, unsigned int));
+				break;
+			}
+			break;
+		case KIND_POINTER:
+			putValue(base, bufferSize, &offset, (uint64_t)(uintptr_t)va_arg(args, void *));
+			break;
+		case KIND_DOUBLE: {
+			double value = (LENGTH_LONG_DOUBLE == spec.length) ? (double)va_arg(args, long double) : va_arg(args, double);
+			putBytes(base, bufferSize, &offset, &value, sizeof(value));
+			break;
+		}
+		case KIND_STRING: {
+			const char *string = va_arg(args, const char *);
+			if (NULL == string) {
+				putValue(base, bufferSize, &offset, NULL_STRING_LENGTH);
+			} else {
+				uintptr_t length = strlen(string);
+				putValue(base, bufferSize, &offset, (uint64_t)length);
+				putBytes(base, bufferSize, &offset, string, length + 1);
+				putBytes(base, bufferSize, &offset, NULL, align(offset) - offset);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	if (offset <= bufferSize) {
+		MM_VerboseEventRecord *record = (MM_VerboseEventRecord *)buffer;
+		record->_size = (uint32_t)offset;
+		record->_type = VERBOSE_EVENT_RECORD_OUTPUT;
+		record->_indent = (uint16_t)indent;
+		record->_format = (uint64_t)(uintptr_t)format;
+	}
+
+	return offset;
+}
+
+uintptr_t
+MM_VerboseEventStream::encodeString(void *buffer, uintptr_t bufferSize, VerboseEventRecordType type, uint16_t flags, uint64_t format, const char *string, uintptr_t length)
+{
+	uintptr_t size = align(sizeof(MM_VerboseEventRecord) + length + 1);
+
+	if (size <= bufferSize) {
+		MM_VerboseEventRecord *record = (MM_VerboseEventRecord *)buffer;
+		char *payload = (char *)(record + 1);
+		record->_size = (uint32_t)size;
+		record->_type = (uint16_t)type;
+		record->_indent = flags;
+		record->_format = format;
+		memcpy(payload, string, length);
+		memset(payload + length, 0, size - sizeof(MM_VerboseEventRecord) - length);
+	}
+
+	return size;
+}
+
+uintptr_t
+MM_VerboseEventStream::encodeControl(void *buffer, uintptr_t bufferSize, VerboseEventRecordType type)
+{
+	uintptr_t size = sizeof(MM_VerboseEventRecord);
+
+	if (size <= bufferSize) {
+		MM_VerboseEventRecord *record = (MM_VerboseEventRecord *)buffer;
+		record->_size = (uint32_t)size;
+		record->_type = (uint16_t)type;
+		record->_indent = 0;
+		record->_format = 0;
+	}
+
+	return size;
+}
+
+uintptr_t
+MM_VerboseEventStream::formatOutput(OMRPortLibrary *portLibrary, const char *format, const MM_VerboseEventRecord *record, char *buffer, uintptr_t bufferSize)
+{
+	TextOutput output = { buffer, bufferSize, 0 };
+	const uint8_t *cursor = (const uint8_t *)(record + 1);
+	const uint8_t *end = (const uint8_t *)record + record->_size;
+	const char *literal = format;
+	bool valid = true;
+
+	for (uintptr_t i = 0; i < record->_indent; i++) {
+		appendText(&output, INDENT_SPACER, sizeof(INDENT_SPACER) - 1);
+	}
+
+	while (valid && ('\0' != *literal)) {
+		const char *percent = strchr(literal, '%');
+		if (NULL == percent) {
+			appendText(&output, literal, strlen(literal));
+			break;
+		}
+		appendText(&output, literal, percent - literal);
+
+		FormatSpec spec;
+		parseSpec(percent, &spec);
+		literal = spec.end;
+
+		/* Rebuild the specification with the width and precision arguments in place */
+		char specText[MAX_SPEC_LENGTH + 2 * 24];
+		uintptr_t specLength = 0;
+		uint64_t value = 0;
+		for (const char *c = spec.start; c < spec.end; c++) {
+			if ('*' == *c) {
+				if (!getValue(&cursor, end, &value)) {
+					valid = false;
+					break;
+				}
+				OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+				specLength += omrstr_printf(specText + specLength, sizeof(specText) - specLength, "%d", (int32_t)(int64_t)value);
+			} else if (specLength < MAX_SPEC_LENGTH) {
+				specText[specLength++] = *c;
+			}
+		}
+		specText[specLength] = '\0';
+
+		if (valid && (KIND_NONE != spec.kind)) {
+			if (KIND_STRING == spec.kind) {
+				const char *string = NULL;
+				valid = getValue(&cursor, end, &value);
+				if (valid && (NULL_STRING_LENGTH != value)) {
+					string = (const char *)cursor;
+					valid = (value < (uint64_t)(end - cursor)) && ('\0' == string[value]);
+					cursor += align((uintptr_t)value + 1);
+				}
+				if (valid) {
+					appendFormatted(portLibrary, &output, specText, string);
+				}
+			} else if (getValue(&cursor, end, &value)) {
+				switch (spec.kind) {
+				case KIND_POINTER:
+					appendFormatted(portLibrary, &output, specText, (void *)(uintptr_t)value);
+					break;
+				case KIND_DOUBLE: {
+					double doubleValue = 0;
+					memcpy(&doubleValue, &value, sizeof(doubleValue));
+					if (LENGTH_LONG_DOUBLE == spec.length) {
+						appendFormatted(portLibrary, &output, specText, (long double)doubleValue);
+					} else {
+						appendFormatted(portLibrary, &output, specText, doubleValue);
+					}
+					break;
+				}
+				default:
+					switch (spec.length) {
+					case LENGTH_LONG:
+						appendFormatted(portLibrary, &output, specText, (unsigned long)value);
+						break;
+					case LENGTH_LONG_LONG:
+						appendFormatted(portLibrary, &output, specText, (unsigned long long)value);
+						break;
+					case LENGTH_SIZE:
+						appendFormatted(portLibrary, &output, specText, (uintptr_t)value);
+						break;
+					default:
+						appendFormatted(portLibrary, &output, specText, (unsigned int)value);
+						break;
+					}
+					break;
+				}
+			} else {
+				valid = false;
+			}
+		} else if (valid) {
+			if ('%' == spec.end[-1]) {
+				appendFormatted(portLibrary, &output, specText);
+			} else {
+				/* unsupported conversions were not encoded, keep them as they are */
+				appendText(&output, specText, specLength);
+			}
+		}
+	}
+
+	appendText(&output, "\n", 1);
+	if (output.length < output.size) {
+		output.buffer[output.length] = '\0';
+	}
+
+	return output.length;
+}
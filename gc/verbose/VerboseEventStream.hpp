@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTSTREAM_HPP_)
+#define VERBOSEEVENTSTREAM_HPP_
+
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrstdarg.h"
+
+/**
+ * @file
+ * Binary verbose GC records.
+ *
+ * A record holds the format string and raw arguments of one formatAndOutput() call, so the
+ * reporting thread only copies values and the text is produced later, possibly in another
+ * process. The same records make up the binary verbose stream written to file, which starts
+ * with an MM_VerboseEventStreamHeader. In memory the format of an output record is the address
+ * of the format string; in a stream it is the id of an earlier format record.
+ *
+ * The encoding and formatting code depends only on the port library, so that it can be built
+ * into tools that decode streams.
+ * @ingroup GC_verbose_output_agents
+ */
+
+#define VERBOSE_EVENT_STREAM_MAGIC "OMRVGCB"
+#define VERBOSE_EVENT_STREAM_VERSION 1
+
+/**
+ * Output formats of the asynchronous verbose writer and of the stream decoder.
+ */
+typedef enum {
+	VERBOSE_OUTPUT_XML = 0, /**< the verbose GC XML, identical to the synchronous writers */
+	VERBOSE_OUTPUT_BINARY = 1, /**< the binary record stream */
+	VERBOSE_OUTPUT_JSON = 2 /**< one JSON object per line for each top level XML element */
+} VerboseOutputFormat;
+
+typedef enum {
+	VERBOSE_EVENT_RECORD_PAD = 0, /**< fills the end of a ring buffer, never in a stream */
+	VERBOSE_EVENT_RECORD_FORMAT = 1, /**< defines the format string with the id in _format */
+	VERBOSE_EVENT_RECORD_OUTPUT = 2, /**< one formatted line: format, indent and arguments */
+	VERBOSE_EVENT_RECORD_TEXT = 3, /**< preformatted text, with flags in _indent */
+	VERBOSE_EVENT_RECORD_FLUSH = 4, /**< ends a stanza */
+	VERBOSE_EVENT_RECORD_OPEN = 5, /**< starts a new file, with the descriptor in _format and the file header as text; never in a stream */
+	VERBOSE_EVENT_RECORD_CLOSE = 6 /**< ends the current file, with the file footer as text; never in a stream */
+} VerboseEventRecordType;
+
+/**
+ * Text record flag for the file header and footer, which are not part of any event.
+ */
+#define VERBOSE_EVENT_TEXT_MARKUP 0x1
+
+typedef struct MM_VerboseEventStreamHeader {
+	char _magic[8]; /**< VERBOSE_EVENT_STREAM_MAGIC */
+	uint32_t _version; /**< VERBOSE_EVENT_STREAM_VERSION, also identifies the byte order */
+	uint32_t _pointerSize; /**< size of the pointers printed by %p */
+} MM_VerboseEventStreamHeader;
+
+typedef struct MM_VerboseEventRecord {
+	uint32_t _size; /**< bytes in the record including this header, a multiple of VERBOSE_EVENT_RECORD_ALIGNMENT */
+	uint16_t _type; /**< a VerboseEventRecordType */
+	uint16_t _indent; /**< indent of an output record, flags of a text record */
+	uint64_t _format; /**< address or id of the format string, see above */
+} MM_VerboseEventRecord;
+
+#define VERBOSE_EVENT_RECORD_ALIGNMENT 8
+
+class MM_VerboseEventStream
+{
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Encode an output record. Integer and pointer arguments take 8 bytes each, as do floating point
+	 * ones, and strings are copied. When the record does not fit the contents of the buffer are
+	 * undefined.
+	 * @param[out] buffer where the record is written
+	 * @param[in] bufferSize bytes available at buffer
+	 * @param[in] indent indent level of the line
+	 * @param[in] format printf style format, which must outlive the record
+	 * @param[in] args arguments of format
+	 * @return the size of the record
+	 */
+	static uintptr_t encodeOutput(void *buffer, uintptr_t bufferSize, uintptr_t indent, const char *format, va_list args);
+
+	/**
+	 * Encode a record whose payload is a NUL terminated string: text, format, open and close records.
+	 * The record is only written when it fits.
+	 * @return the size of the record
+	 */
+	static uintptr_t encodeString(void *buffer, uintptr_t bufferSize, VerboseEventRecordType type, uint16_t flags, uint64_t format, const char *string, uintptr_t length);
+
+	/**
+	 * Encode a record without payload. The record is only written when it fits.
+	 * @return the size of the record
+	 */
+	static uintptr_t encodeControl(void *buffer, uintptr_t bufferSize, VerboseEventRecordType type);
+
+	/**
+	 * The payload of a record encoded by encodeString().
+	 */
+	static const char *getString(const MM_VerboseEventRecord *record) { return (const char *)(record + 1); }
+
+	/**
+	 * Produce the text of an output record, as MM_VerboseBuffer::formatAndOutput() would have from the
+	 * original arguments: the indent, the formatted line and a newline. When the text and its NUL
+	 * terminator do not fit the contents of the buffer are undefined.
+	 * @param[in] portLibrary used for formatting
+	 * @param[in] format the format string of the record
+	 * @param[in] record the output record
+	 * @param[out] buffer where the text is written
+	 * @param[in] bufferSize bytes available at buffer
+	 * @return the length of the text, not including the NUL terminator
+	 */
+	static uintptr_t formatOutput(OMRPortLibrary *portLibrary, const char *format, const MM_VerboseEventRecord *record, char *buffer, uintptr_t bufferSize);
+
+	/**
+	 * Round a payload size up to a multiple of VERBOSE_EVENT_RECORD_ALIGNMENT.
+	 */
+	static uintptr_t align(uintptr_t size) { return (size + VERBOSE_EVENT_RECORD_ALIGNMENT - 1) & ~(uintptr_t)(VERBOSE_EVENT_RECORD_ALIGNMENT - 1); }
+};
+
+#endif /* VERBOSEEVENTSTREAM_HPP_ */
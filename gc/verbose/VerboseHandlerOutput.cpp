@@ -43,6 +43,7 @@ static void verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum
 static void verboseHandlerReinitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 static void verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerTaskCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -110,6 +111,10 @@ MM_VerboseHandlerOutput::enableVerbose()
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, OMR_GET_CALLSITE(), (void *)this);
 
+	if (_extensions->verboseWorkerStats) {
+		(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_TASK_COMPLETED, verboseHandlerTaskCompleted, OMR_GET_CALLSITE(), (void *)this);
+	}
+
 	return ;
 }
 
@@ -122,6 +127,7 @@ MM_VerboseHandlerOutput::disableVerbose()
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_REINITIALIZED, verboseHandlerReinitialized, NULL);
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_TASK_COMPLETED, verboseHandlerTaskCompleted, NULL);
 
 	return ;
 }
@@ -1083,6 +1089,84 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutput::handleTaskCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_TaskCompletedEvent *event = (MM_TaskCompletedEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain *writer = _manager->getWriterChain();
+	uintptr_t indent = _manager->getIndentLevel();
+	uint64_t taskTime = 0;
+	uint64_t totalBusyTime = 0;
+	uint64_t maxBusyTime = 0;
+	uint64_t totalIdleTime = 0;
+	uintptr_t workerCount = 0;
+	char tagTemplate[200];
+
+	getTimeDeltaInMicroSeconds(&taskTime, event->taskStartTime, event->timestamp);
+
+	/* Busy is the time a thread was neither waiting at a barrier nor for work to steal, idle is the time the task
+	 * ran without it, from being dispatched until it started and from completing its share until the last thread did.
+	 */
+	for (uintptr_t workerID = 0; workerID < event->workerStatsCount; workerID++) {
+		MM_WorkerThreadStats *stats = &event->workerStats[workerID];
+		if (0 != stats->_endTime) {
+			uint64_t workerTime = 0;
+			getTimeDeltaInMicroSeconds(&workerTime, stats->_startTime, stats->_endTime);
+			uint64_t waitTime = omrtime_hires_delta(0, stats->_barrierStallTime + stats->getStealTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t busyTime = (workerTime > waitTime) ? (workerTime - waitTime) : 0;
+			totalBusyTime += busyTime;
+			maxBusyTime = OMR_MAX(maxBusyTime, busyTime);
+			totalIdleTime += (taskTime > workerTime) ? (taskTime - workerTime) : 0;
+			workerCount += 1;
+		}
+	}
+
+	if (0 == workerCount) {
+		return;
+	}
+
+	/* Hundredths of the busiest thread over the average, 1.00 when the work was spread evenly */
+	uint64_t imbalance = (0 == totalBusyTime) ? 100 : ((maxBusyTime * workerCount * 100) / totalBusyTime);
+	uint64_t meanBusyTime = totalBusyTime / workerCount;
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, indent, "<gc-task name=\"%s\" threads=\"%zu\" timems=\"%llu.%03llu\" maxbusyms=\"%llu.%03llu\" meanbusyms=\"%llu.%03llu\" idlems=\"%llu.%03llu\" imbalance=\"%llu.%02llu\" %s>",
+		(NULL != event->taskName) ? event->taskName : "unknown", workerCount,
+		taskTime / 1000, taskTime % 1000,
+		maxBusyTime / 1000, maxBusyTime % 1000,
+		meanBusyTime / 1000, meanBusyTime % 1000,
+		totalIdleTime / 1000, totalIdleTime % 1000,
+		imbalance / 100, imbalance % 100,
+		tagTemplate);
+
+	for (uintptr_t workerID = 0; workerID < event->workerStatsCount; workerID++) {
+		MM_WorkerThreadStats *stats = &event->workerStats[workerID];
+		if (0 != stats->_endTime) {
+			uint64_t workerTime = 0;
+			getTimeDeltaInMicroSeconds(&workerTime, stats->_startTime, stats->_endTime);
+			uint64_t barrierTime = omrtime_hires_delta(0, stats->_barrierStallTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t stealTime = omrtime_hires_delta(0, stats->getStealTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t busyTime = (workerTime > (barrierTime + stealTime)) ? (workerTime - barrierTime - stealTime) : 0;
+			uint64_t idleTime = (taskTime > workerTime) ? (taskTime - workerTime) : 0;
+			uint64_t cpuTime = stats->_cpuTime / 1000;
+			writer->formatAndOutput(env, indent + 1, "<worker id=\"%zu\" busyms=\"%llu.%03llu\" cpums=\"%llu.%03llu\" stealms=\"%llu.%03llu\" steals=\"%zu\" barrierms=\"%llu.%03llu\" barriers=\"%zu\" idlems=\"%llu.%03llu\" />",
+				workerID,
+				busyTime / 1000, busyTime % 1000,
+				cpuTime / 1000, cpuTime % 1000,
+				stealTime / 1000, stealTime % 1000, stats->_workStallCount,
+				barrierTime / 1000, barrierTime % 1000, stats->_barrierStallCount,
+				idleTime / 1000, idleTime % 1000);
+		}
+	}
+
+	writer->formatAndOutput(env, indent, "</gc-task>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 void
 MM_VerboseHandlerOutput::outputCollectorHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t indent, HeapResizeType resizeType, uintptr_t resizeAmount, uintptr_t resizeCount, uintptr_t subSpaceType, uintptr_t reason, uint64_t timeInMicroSeconds)
 {
@@ -1186,6 +1270,12 @@ verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* event
 	((MM_VerboseHandlerOutput*)userData)->handleHeapResize(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerTaskCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleTaskCompleted(hook, eventNum, eventData);
+}
+
 void
 MM_VerboseHandlerOutput::handleGCOPOuterStanzaStart(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess)
 {
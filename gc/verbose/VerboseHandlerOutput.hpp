@@ -528,6 +528,15 @@ public:
 
 	void handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the verbose stanza for the time each GC thread spent working and waiting on a completed task.
+	 * Only reported when enabled by -Xgc:verboseWorkerStats.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleTaskCompleted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
 	/**
 	 * Write the verbose stanza for the excessive gc raised event.
 	 * @param hook Hook interface used by the JVM.
@@ -34,6 +34,7 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -222,7 +223,7 @@ MM_VerboseManager::disableWriters()
 	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
 
 	while(NULL != writer) {
-		writer->isActive(false);
+		_writerChain->deactivateWriter(writer);
 		writer = writer->getNextWriter();
 	}
 }
@@ -250,6 +251,10 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->asyncLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -287,10 +292,13 @@ MM_VerboseManager::configureVerboseGC(OMR_VM *omrVM, char *filename, uintptr_t f
 			return false;
 		}
 
-		_writerChain->addWriter(writer);
+		/* A writer already in the chain that createWriter fell back to is active */
+		if (!writer->isActive()) {
+			_writerChain->addWriter(writer);
+		}
 	}
 
-	writer->isActive(true);
+	_writerChain->activateWriter(writer);
 
 	return true;
 }
@@ -311,7 +319,7 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 		if (NULL == writer) {
 			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
 			if (NULL != writer) {
-				writer->isActive(true);
+				_writerChain->activateWriter(writer);
 				return writer;
 			}
 			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
@@ -323,13 +331,29 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 		if (NULL == writer) {
 			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
 			if (NULL != writer) {
-				writer->isActive(true);
+				_writerChain->activateWriter(writer);
 				return writer;
 			}
 			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS:
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		writer = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, this, filename, fileCount, iterations,
+			(VerboseOutputFormat)extensions->asyncLoggingFormat, extensions->asyncLoggingBufferSize);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				_writerChain->activateWriter(writer);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
+	}
 
 	default:
 		return NULL;
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "VerboseRecordBuffer.hpp"
+
+#include "GCExtensionsBase.hpp"
+
+MM_VerboseRecordBuffer *
+MM_VerboseRecordBuffer::newInstance(MM_EnvironmentBase *env, uintptr_t size)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseRecordBuffer *recordBuffer = (MM_VerboseRecordBuffer *) extensions->getForge()->allocate(sizeof(MM_VerboseRecordBuffer), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != recordBuffer) {
+		new(recordBuffer) MM_VerboseRecordBuffer(env);
+		if (!recordBuffer->initialize(env, size)) {
+			recordBuffer->kill(env);
+			recordBuffer = NULL;
+		}
+	}
+	return recordBuffer;
+}
+
+bool
+MM_VerboseRecordBuffer::initialize(MM_EnvironmentBase *env, uintptr_t size)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (0 == size) {
+		return false;
+	}
+
+	if (NULL == (_buffer = (uint8_t *) extensions->getForge()->allocate(size, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE()))) {
+		return false;
+	}
+
+	_capacity = size;
+	reset();
+
+	return true;
+}
+
+void
+MM_VerboseRecordBuffer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	extensions->getForge()->free(this);
+}
+
+void
+MM_VerboseRecordBuffer::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+		extensions->getForge()->free(_buffer);
+		_buffer = NULL;
+	}
+}
+
+bool
+MM_VerboseRecordBuffer::ensureCapacity(MM_EnvironmentBase *env, uintptr_t spaceNeeded)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	bool result = true;
+
+	if ((_capacity - _size) < spaceNeeded) {
+		/* Not enough space in the current buffer - try to alloc a larger one and use that */
+		uintptr_t newSize = _size + spaceNeeded;
+		newSize += newSize / 2;
+		uint8_t *newBuffer = (uint8_t *) extensions->getForge()->allocate(newSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == newBuffer) {
+			result = false;
+		} else {
+			memcpy(newBuffer, _buffer, _size);
+			extensions->getForge()->free(_buffer);
+			_buffer = newBuffer;
+			_capacity = newSize;
+		}
+	}
+	return result;
+}
+
+bool
+MM_VerboseRecordBuffer::addOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	bool result = true;
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t spaceNeeded = MM_VerboseEventStream::encodeOutput(_buffer + _size, _capacity - _size, indent, format, argsCopy);
+	if (spaceNeeded > (_capacity - _size)) {
+		/* grow the buffer and try again */
+		if (ensureCapacity(env, spaceNeeded)) {
+			COPY_VA_LIST(argsCopy, args);
+			MM_VerboseEventStream::encodeOutput(_buffer + _size, _capacity - _size, indent, format, argsCopy);
+		} else {
+			result = false;
+		}
+	}
+	if (result) {
+		_size += spaceNeeded;
+	}
+
+	return result;
+}
+
+bool
+MM_VerboseRecordBuffer::addString(MM_EnvironmentBase *env, VerboseEventRecordType type, uint16_t flags, uint64_t format, const char *string, uintptr_t length)
+{
+	bool result = true;
+	uintptr_t spaceNeeded = MM_VerboseEventStream::encodeString(NULL, 0, type, flags, format, string, length);
+
+	if (ensureCapacity(env, spaceNeeded)) {
+		MM_VerboseEventStream::encodeString(_buffer + _size, _capacity - _size, type, flags, format, string, length);
+		_size += spaceNeeded;
+	} else {
+		result = false;
+	}
+
+	return result;
+}
+
+bool
+MM_VerboseRecordBuffer::addControl(MM_EnvironmentBase *env, VerboseEventRecordType type)
+{
+	bool result = true;
+	uintptr_t spaceNeeded = MM_VerboseEventStream::encodeControl(NULL, 0, type);
+
+	if (ensureCapacity(env, spaceNeeded)) {
+		MM_VerboseEventStream::encodeControl(_buffer + _size, _capacity - _size, type);
+		_size += spaceNeeded;
+	} else {
+		result = false;
+	}
+
+	return result;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSERECORDBUFFER_HPP_)
+#define VERBOSERECORDBUFFER_HPP_
+
+#include "omrcfg.h"
+#include "omrstdarg.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+#include "VerboseEventStream.hpp"
+
+#define INITIAL_RECORD_BUFFER_SIZE 4096
+
+/**
+ * Verbose record buffer
+ *
+ * Holds the binary records of the stanza being reported, for writers that format
+ * output on their own thread. See MM_VerboseEventStream.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseRecordBuffer : public MM_Base
+{
+/*
+ * Member data
+ */
+private:
+	uint8_t *_buffer; /**< Pointer to the base of the buffer */
+	uintptr_t _size; /**< Bytes used by records */
+	uintptr_t _capacity; /**< Bytes available at _buffer */
+protected:
+public:
+
+/*
+ * Member functions
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t size);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Ensure that there are at least spaceNeeded bytes left in the buffer.
+	 * @param env[in] the current thread
+	 * @param spaceNeeded[in] the minimum number of free bytes needed
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool ensureCapacity(MM_EnvironmentBase *env, uintptr_t spaceNeeded);
+
+protected:
+
+public:
+	static MM_VerboseRecordBuffer *newInstance(MM_EnvironmentBase *env, uintptr_t size);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Append an output record for one line of formatted output.
+	 * @param env[in] the current thread
+	 * @param indent[in] the indent level of the line
+	 * @param format[in] a format string with static storage duration; see omrstr_printf
+	 * @param args[in] a va_list describing the arguments to format
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool addOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	/**
+	 * Append a record whose payload is a string, such as a text record.
+	 * @param env[in] the current thread
+	 * @param type[in] the type of the record
+	 * @param flags[in] the flags of a text record
+	 * @param format[in] the format field of the record
+	 * @param string[in] the string, which does not have to be NUL terminated
+	 * @param length[in] the length of the string
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool addString(MM_EnvironmentBase *env, VerboseEventRecordType type, uint16_t flags, uint64_t format, const char *string, uintptr_t length);
+
+	/**
+	 * Append a text record.
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	MMINLINE bool addText(MM_EnvironmentBase *env, const char *text, uintptr_t length)
+	{
+		return addString(env, VERBOSE_EVENT_RECORD_TEXT, 0, 0, text, length);
+	}
+
+	/**
+	 * Append a record without payload, such as the end of a stanza.
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool addControl(MM_EnvironmentBase *env, VerboseEventRecordType type);
+
+	MMINLINE void reset() { _size = 0; }
+	MMINLINE uint8_t *contents() { return _buffer; }
+	MMINLINE uintptr_t currentSize() { return _size; }
+
+	MM_VerboseRecordBuffer(MM_EnvironmentBase *env) :
+		MM_Base(),
+		_buffer(NULL),
+		_size(0),
+		_capacity(0)
+	{}
+};
+
+#endif /* VERBOSERECORDBUFFER_HPP_ */
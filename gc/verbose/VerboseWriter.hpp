@@ -35,7 +35,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -69,6 +70,21 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Writers that format output on their own are given the binary records of each stanza
+	 * instead of its text. See MM_VerboseEventStream.
+	 * @return true if the writer takes records through outputRecords()
+	 */
+	virtual bool outputsRecords() { return false; }
+
+	/**
+	 * Output the records of a stanza, which ends with a flush record.
+	 * @param[in] env the current environment.
+	 * @param[in] records the records
+	 * @param[in] size the size of the records in bytes
+	 */
+	virtual void outputRecords(MM_EnvironmentBase *env, const uint8_t *records, uintptr_t size) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
@@ -23,6 +23,7 @@
 #include "VerboseWriterChain.hpp"
 
 #include "VerboseBuffer.hpp"
+#include "VerboseRecordBuffer.hpp"
 #include "VerboseWriter.hpp"
 
 #include "GCExtensionsBase.hpp"
@@ -35,7 +36,11 @@
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
+	,_records(NULL)
 	,_writers(NULL)
+	,_textWriterCount(0)
+	,_recordWriterCount(0)
+	,_textRecorded(0)
 {}
 
 MM_VerboseWriterChain *
@@ -60,19 +65,51 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 	va_list args;
 
 	va_start(args, format);
-	_buffer->formatAndOutputV(env, indent, format, args);
+	if (0 != _recordWriterCount) {
+		va_list argsCopy;
+		COPY_VA_LIST(argsCopy, args);
+		recordDirectText(env);
+		_records->addOutputV(env, indent, format, argsCopy);
+	}
+	if (0 != _textWriterCount) {
+		_buffer->formatAndOutputV(env, indent, format, args);
+		_textRecorded = _buffer->currentSize();
+	}
 	va_end(args);
 }
 
+void
+MM_VerboseWriterChain::recordDirectText(MM_EnvironmentBase *env)
+{
+	uintptr_t textSize = _buffer->currentSize();
+	if (textSize > _textRecorded) {
+		_records->addText(env, _buffer->contents() + _textRecorded, textSize - _textRecorded);
+		_textRecorded = textSize;
+	}
+}
+
 void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
+	if (0 != _recordWriterCount) {
+		recordDirectText(env);
+		_records->addControl(env, VERBOSE_EVENT_RECORD_FLUSH);
+	}
+
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (!writer->isActive()) {
+			/* Output was only formatted or recorded for the active writers */
+		} else if (writer->outputsRecords()) {
+			writer->outputRecords(env, _records->contents(), _records->currentSize());
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	_textRecorded = 0;
+	_records->reset();
 }
 
 void
@@ -82,6 +119,10 @@ MM_VerboseWriterChain::tearDown(MM_EnvironmentBase* env)
 		_buffer->kill(env);
 		_buffer = NULL;
 	}
+	if (NULL != _records) {
+		_records->kill(env);
+		_records = NULL;
+	}
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
 		MM_VerboseWriter* nextWriter = writer->getNextWriter();
@@ -106,6 +147,11 @@ MM_VerboseWriterChain::initialize(MM_EnvironmentBase* env)
 	if(NULL == _buffer) {
 		result = false;
 	}
+
+	_records = MM_VerboseRecordBuffer::newInstance(env, INITIAL_RECORD_BUFFER_SIZE);
+	if(NULL == _records) {
+		result = false;
+	}
 	
 	return result;
 }
@@ -115,6 +161,56 @@ MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 {
 	writer->setNextWriter(_writers);
 	_writers = writer;
+	if (writer->isActive()) {
+		updateWriterCount(writer, 1);
+	}
+}
+
+void
+MM_VerboseWriterChain::removeWriter(MM_VerboseWriter* writer)
+{
+	deactivateWriter(writer);
+
+	if (_writers == writer) {
+		_writers = writer->getNextWriter();
+	} else {
+		MM_VerboseWriter* previous = _writers;
+		while ((NULL != previous) && (previous->getNextWriter() != writer)) {
+			previous = previous->getNextWriter();
+		}
+		if (NULL != previous) {
+			previous->setNextWriter(writer->getNextWriter());
+		}
+	}
+	writer->setNextWriter(NULL);
+}
+
+void
+MM_VerboseWriterChain::activateWriter(MM_VerboseWriter* writer)
+{
+	if (!writer->isActive()) {
+		writer->isActive(true);
+		updateWriterCount(writer, 1);
+	}
+}
+
+void
+MM_VerboseWriterChain::deactivateWriter(MM_VerboseWriter* writer)
+{
+	if (writer->isActive()) {
+		writer->isActive(false);
+		updateWriterCount(writer, -1);
+	}
+}
+
+void
+MM_VerboseWriterChain::updateWriterCount(MM_VerboseWriter* writer, intptr_t delta)
+{
+	if (writer->outputsRecords()) {
+		_recordWriterCount += delta;
+	} else {
+		_textWriterCount += delta;
+	}
 }
 
 void
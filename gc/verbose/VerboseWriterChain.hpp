@@ -32,11 +32,15 @@
 #include "EnvironmentBase.hpp"
 
 class MM_VerboseBuffer;
+class MM_VerboseRecordBuffer;
 class MM_VerboseWriter;
 
 /**
  * This class manages a list of writers. It formats and buffers output, flushing it
  * to the writers when asked.
+ *
+ * Writers that format output on their own thread get binary records instead, so output is
+ * only formatted on the reporting thread when some other writer needs the text.
  */
 class MM_VerboseWriterChain : public MM_Base
 {
@@ -44,21 +48,46 @@ public:
 protected:
 private:
 	MM_VerboseBuffer *_buffer;
+	MM_VerboseRecordBuffer *_records; /**< records for the writers that take them */
 	MM_VerboseWriter *_writers;
+	uintptr_t _textWriterCount; /**< active writers that take text */
+	uintptr_t _recordWriterCount; /**< active writers that take records */
+	uintptr_t _textRecorded; /**< bytes of _buffer that are also in _records */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
 
 	void kill(MM_EnvironmentBase *env);
 
+	/**
+	 * Format one line of output.
+	 * @param env[in] the current thread
+	 * @param indent[in] the indent level of the line
+	 * @param format[in] the format, which writers that take records may only use after the stanza
+	 * is flushed, so it must be a string literal; text built at runtime is passed as a "%s" argument
+	 */
 	void formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, const char *format, ...);
 	void flush(MM_EnvironmentBase *env);
 
 	/**
-	 * Add a new verbose writer to the list of active output writers.
+	 * Add a new verbose writer to the list of output writers. It gets output once it is active.
 	 * @param writer[in] New writer to add to list.
 	 */
 	void addWriter(MM_VerboseWriter* writer);
+
+	/**
+	 * Deactivate a writer and unlink it from the list. The caller then owns the writer.
+	 * @param writer[in] Writer to remove from the list.
+	 */
+	void removeWriter(MM_VerboseWriter* writer);
+
+	/**
+	 * Start or stop passing output to a writer in the list. Output is only formatted as
+	 * text, or encoded as records, while an active writer takes it.
+	 * @param writer[in] Writer in the list.
+	 */
+	void activateWriter(MM_VerboseWriter* writer);
+	void deactivateWriter(MM_VerboseWriter* writer);
 	
 	/**
 	 * Fetch the first writer in the linked chain of writers.
@@ -66,6 +95,11 @@ public:
 	 */
 	MM_VerboseWriter *getFirstWriter() { return _writers; }
 	
+	/**
+	 * Fetch the text buffer, for output that is added to it directly. The text is passed
+	 * to the writers that take records when the chain is next formatted to or flushed.
+	 * @return the text buffer
+	 */
 	MM_VerboseBuffer *getBuffer() { return _buffer; }
 
 	/**
@@ -79,6 +113,18 @@ protected:
 	void tearDown(MM_EnvironmentBase *env);
 	bool initialize(MM_EnvironmentBase* env);
 private:
+	/**
+	 * Add any text that was added directly to the text buffer to the records.
+	 * @param env[in] the current thread
+	 */
+	void recordDirectText(MM_EnvironmentBase *env);
+
+	/**
+	 * Count a writer in, or out of, the active writers of its kind.
+	 * @param writer[in] the writer being activated or deactivated
+	 * @param delta[in] 1 when it is activated, -1 when it is deactivated
+	 */
+	void updateWriterCount(MM_VerboseWriter* writer, intptr_t delta);
 };
 
 #endif /* VERBOSEWRITERCHAIN_HPP_ */
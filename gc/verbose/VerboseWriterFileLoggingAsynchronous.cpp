@@ -0,0 +1,674 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "omrutil.h"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+#include "VerboseRecordBuffer.hpp"
+
+#define MINIMUM_RING_SIZE ((uintptr_t)64 * 1024)
+#define STAGING_BUFFER_SIZE ((uintptr_t)64 * 1024)
+#define INITIAL_FORMATS_SIZE 256
+#define WRITER_THREAD_WAIT_MILLIS 100
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager, VerboseOutputFormat outputFormat, uintptr_t bufferSize)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_outputFormat(outputFormat)
+	,_logFileDescriptor(-1)
+	,_ring(NULL)
+	,_ringSize(MINIMUM_RING_SIZE)
+	,_ringHead(0)
+	,_ringTail(0)
+	,_droppedStanzas(0)
+	,_monitor(NULL)
+	,_threadState(STATE_ERROR)
+	,_outputFileDescriptor(-1)
+	,_reportedDroppedStanzas(0)
+	,_decoder(env->getPortLibrary(), (VERBOSE_OUTPUT_JSON == outputFormat) ? VERBOSE_OUTPUT_JSON : VERBOSE_OUTPUT_XML)
+	,_staging(NULL)
+	,_stagingLength(0)
+	,_stagingSize(0)
+	,_formats(NULL)
+	,_formatIds(NULL)
+	,_formatsSize(0)
+	,_formatCount(0)
+{
+	while (_ringSize < bufferSize) {
+		_ringSize <<= 1;
+	}
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles, VerboseOutputFormat outputFormat, uintptr_t bufferSize)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager, outputFormat, bufferSize);
+		if (!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * The writer thread is started before the first file is opened.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _ring) {
+		return false;
+	}
+	_ringHead = 0;
+	_ringTail = 0;
+
+	if (!startWriterThread(env)) {
+		return false;
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Closes the current file and waits for the writer thread to write out everything queued.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	closeFile(env);
+	stopWriterThread(env);
+
+	_decoder.tearDown();
+	if (NULL != _ring) {
+		extensions->getForge()->free(_ring);
+		_ring = NULL;
+	}
+	if (NULL != _staging) {
+		extensions->getForge()->free(_staging);
+		_staging = NULL;
+		_stagingSize = 0;
+	}
+	if (NULL != _formats) {
+		extensions->getForge()->free(_formats);
+		extensions->getForge()->free(_formatIds);
+		_formats = NULL;
+		_formatIds = NULL;
+		_formatsSize = 0;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startWriterThread(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+
+	/* hold the monitor over start-up of the thread so that it cannot notify us before we wait */
+	omrthread_monitor_enter(_monitor);
+	_threadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		writerThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} else {
+		_threadState = STATE_ERROR;
+	}
+	bool result = (STATE_RUNNING == _threadState);
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopWriterThread(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_enter(_monitor);
+		if (STATE_RUNNING == _threadState) {
+			_threadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_monitor);
+			while (STATE_TERMINATED != _threadState) {
+				omrthread_monitor_wait(_monitor);
+			}
+		}
+		omrthread_monitor_exit(_monitor);
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+		_threadState = STATE_ERROR;
+	}
+}
+
+/**
+ * Opens the file to log output to and queues the header. The descriptor is handed over to
+ * the writer thread, which writes and closes the file from then on.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	int32_t openFlags =  EsOpenRead | EsOpenWrite | EsOpenCreate | _manager->fileOpenMode(env);
+
+	intptr_t fileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+	if (-1 == fileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		fileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+		if (-1 == fileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	bool result = false;
+	MM_VerboseRecordBuffer *records = MM_VerboseRecordBuffer::newInstance(env, INITIAL_RECORD_BUFFER_SIZE);
+	if (NULL != records) {
+		const char *header = getHeader(env);
+		result = records->addString(env, VERBOSE_EVENT_RECORD_OPEN, 0, (uint64_t)fileDescriptor, header, strlen(header));
+		/* Print an Initialized Stanza in new file */
+		if (result && printInitializedHeader) {
+			MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+			if (NULL != buffer) {
+				_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+				records->addText(env, buffer->contents(), buffer->currentSize());
+				records->addControl(env, VERBOSE_EVENT_RECORD_FLUSH);
+				buffer->kill(env);
+			}
+		}
+		/* the file has to be opened before anything else is written, so wait for space */
+		result = result && enqueue(env, records->contents(), records->currentSize(), true);
+		records->kill(env);
+	}
+
+	if (result) {
+		_logFileDescriptor = fileDescriptor;
+	} else {
+		omrfile_close(fileDescriptor);
+	}
+
+	return result;
+}
+
+/**
+ * Queues the footer, after which the writer thread closes the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (-1 != _logFileDescriptor) {
+		char footer[64];
+		uint64_t records[(sizeof(footer) + sizeof(MM_VerboseEventRecord)) / sizeof(uint64_t)];
+		uintptr_t length = omrstr_printf(footer, sizeof(footer), "%s\n", getFooter(env));
+		uintptr_t size = MM_VerboseEventStream::encodeString(records, sizeof(records), VERBOSE_EVENT_RECORD_CLOSE, 0, 0, footer, length);
+		if ((size > sizeof(records)) || !enqueue(env, (uint8_t *)records, size, true)) {
+			omrfile_close(_logFileDescriptor);
+		}
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	if (-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	if (-1 != _logFileDescriptor) {
+		if (!enqueueText(env, string, strlen(string), false)) {
+			MM_AtomicOperations::add(&_droppedStanzas, 1);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputRecords(MM_EnvironmentBase *env, const uint8_t *records, uintptr_t size)
+{
+	if (-1 == _logFileDescriptor) {
+		/* see outputString() */
+		openFile(env);
+	}
+
+	if (-1 != _logFileDescriptor) {
+		if (!enqueue(env, records, size, false)) {
+			MM_AtomicOperations::add(&_droppedStanzas, 1);
+		}
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enqueueText(MM_EnvironmentBase *env, const char *text, uintptr_t length, bool wait)
+{
+	bool result = false;
+	MM_VerboseRecordBuffer *records = MM_VerboseRecordBuffer::newInstance(env, length + INITIAL_RECORD_BUFFER_SIZE);
+	if (NULL != records) {
+		if (records->addText(env, text, length) && records->addControl(env, VERBOSE_EVENT_RECORD_FLUSH)) {
+			result = enqueue(env, records->contents(), records->currentSize(), wait);
+		}
+		records->kill(env);
+	}
+	return result;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enqueue(MM_EnvironmentBase *env, const uint8_t *records, uintptr_t size, bool wait)
+{
+	if ((size > _ringSize) || (STATE_RUNNING != _threadState)) {
+		return false;
+	}
+
+	/* Records of one call are kept contiguous, so the end of the ring is padded when they do not fit there */
+	uintptr_t tail = _ringTail;
+	while (true) {
+		uintptr_t head = _ringHead;
+		/* the writer thread must be done reading the space before it is reused */
+		MM_AtomicOperations::loadSync();
+		uintptr_t space = _ringSize - (tail - head);
+		uintptr_t offset = tail & (_ringSize - 1);
+		uintptr_t contiguous = _ringSize - offset;
+
+		if (size <= contiguous) {
+			if (size <= space) {
+				memcpy(_ring + offset, records, size);
+				MM_AtomicOperations::storeSync();
+				_ringTail = tail + size;
+				notifyWriterThread();
+				return true;
+			}
+		} else if (contiguous <= space) {
+			/* the writer thread skips an end of the ring that is too small for a record */
+			if (contiguous >= sizeof(MM_VerboseEventRecord)) {
+				MM_VerboseEventRecord *pad = (MM_VerboseEventRecord *)(_ring + offset);
+				pad->_size = (uint32_t)contiguous;
+				pad->_type = VERBOSE_EVENT_RECORD_PAD;
+				pad->_indent = 0;
+				pad->_format = 0;
+			}
+			tail += contiguous;
+			MM_AtomicOperations::storeSync();
+			_ringTail = tail;
+			continue;
+		}
+
+		if (!wait) {
+			return false;
+		}
+		notifyWriterThread();
+		omrthread_sleep(1);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::notifyWriterThread()
+{
+	/* never block the reporting thread; a writer thread that is busy will find the records anyway */
+	if (0 == omrthread_monitor_try_enter(_monitor)) {
+		omrthread_monitor_notify(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	MM_EnvironmentBase env(writer->_omrVM);
+
+	/* this method will NOT return */
+	writer->writerThreadEntryPoint(&env);
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadEntryPoint(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	_threadState = STATE_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (true) {
+		if (_ringHead != _ringTail) {
+			omrthread_monitor_exit(_monitor);
+			drain(env);
+			omrthread_monitor_enter(_monitor);
+		} else if (STATE_TERMINATION_REQUESTED == _threadState) {
+			break;
+		} else {
+			/* the reporting thread only notifies when the monitor is free, so do not wait indefinitely */
+			omrthread_monitor_wait_timed(_monitor, WRITER_THREAD_WAIT_MILLIS, 0);
+		}
+	}
+
+	_threadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env)
+{
+	uintptr_t head = _ringHead;
+	uintptr_t tail = _ringTail;
+	MM_AtomicOperations::loadSync();
+
+	while (head != tail) {
+		uintptr_t offset = head & (_ringSize - 1);
+		uintptr_t contiguous = _ringSize - offset;
+		if (contiguous < sizeof(MM_VerboseEventRecord)) {
+			head += contiguous;
+		} else {
+			MM_VerboseEventRecord *record = (MM_VerboseEventRecord *)(_ring + offset);
+			if (VERBOSE_EVENT_RECORD_PAD != record->_type) {
+				writeRecord(env, record);
+			}
+			head += record->_size;
+		}
+		/* release the space only once the record has been read */
+		MM_AtomicOperations::storeSync();
+		_ringHead = head;
+
+		if (head == tail) {
+			tail = _ringTail;
+			MM_AtomicOperations::loadSync();
+		}
+	}
+
+	writeStaged(env);
+	reportDroppedStanzas(env);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeRecord(MM_EnvironmentBase *env, const MM_VerboseEventRecord *record)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if ((-1 == _outputFileDescriptor) && (VERBOSE_EVENT_RECORD_OPEN != record->_type)) {
+		return;
+	}
+
+	switch (record->_type) {
+	case VERBOSE_EVENT_RECORD_OPEN:
+	{
+		const char *header = MM_VerboseEventStream::getString(record);
+		_outputFileDescriptor = (intptr_t)record->_format;
+		_decoder.setFileDescriptor(_outputFileDescriptor);
+		if (VERBOSE_OUTPUT_BINARY == _outputFormat) {
+			MM_VerboseEventStreamHeader streamHeader;
+			memset(&streamHeader, 0, sizeof(streamHeader));
+			memcpy(streamHeader._magic, VERBOSE_EVENT_STREAM_MAGIC, sizeof(VERBOSE_EVENT_STREAM_MAGIC));
+			streamHeader._version = VERBOSE_EVENT_STREAM_VERSION;
+			streamHeader._pointerSize = sizeof(void *);
+			resetFormats();
+			stage(env, &streamHeader, sizeof(streamHeader));
+			stageString(env, VERBOSE_EVENT_RECORD_TEXT, VERBOSE_EVENT_TEXT_MARKUP, 0, header, strlen(header));
+		} else if (VERBOSE_OUTPUT_XML == _outputFormat) {
+			omrfile_write_text(_outputFileDescriptor, header, strlen(header));
+		}
+		break;
+	}
+	case VERBOSE_EVENT_RECORD_CLOSE:
+	{
+		const char *footer = MM_VerboseEventStream::getString(record);
+		reportDroppedStanzas(env);
+		if (VERBOSE_OUTPUT_BINARY == _outputFormat) {
+			stageString(env, VERBOSE_EVENT_RECORD_TEXT, VERBOSE_EVENT_TEXT_MARKUP, 0, footer, strlen(footer));
+			writeStaged(env);
+		} else {
+			_decoder.flush();
+			if (VERBOSE_OUTPUT_XML == _outputFormat) {
+				omrfile_write_text(_outputFileDescriptor, footer, strlen(footer));
+			}
+		}
+		omrfile_close(_outputFileDescriptor);
+		_outputFileDescriptor = -1;
+		_decoder.setFileDescriptor(-1);
+		break;
+	}
+	case VERBOSE_EVENT_RECORD_OUTPUT:
+		if (VERBOSE_OUTPUT_BINARY == _outputFormat) {
+			uint64_t id = formatId(env, record->_format);
+			uint8_t *destination = (0 != id) ? reserve(env, record->_size) : NULL;
+			if (NULL != destination) {
+				memcpy(destination, record, record->_size);
+				((MM_VerboseEventRecord *)destination)->_format = id;
+			}
+		} else {
+			_decoder.decodeRecord(record, (const char *)(uintptr_t)record->_format);
+		}
+		break;
+	default:
+		if (VERBOSE_OUTPUT_BINARY == _outputFormat) {
+			stage(env, record, record->_size);
+		} else {
+			_decoder.decodeRecord(record, NULL);
+		}
+		break;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::reportDroppedStanzas(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t droppedStanzas = _droppedStanzas;
+
+	if ((droppedStanzas != _reportedDroppedStanzas) && (-1 != _outputFileDescriptor)) {
+		char text[256];
+		uint64_t records[(sizeof(text) + (2 * sizeof(MM_VerboseEventRecord))) / sizeof(uint64_t)];
+		uintptr_t length = omrstr_printf(text, sizeof(text), "<warning details=\"%zu stanzas were dropped because the asynchronous verbose buffer was full\" />\n", droppedStanzas - _reportedDroppedStanzas);
+		uintptr_t size = MM_VerboseEventStream::encodeString(records, sizeof(records), VERBOSE_EVENT_RECORD_TEXT, 0, 0, text, length);
+		MM_VerboseEventStream::encodeControl((uint8_t *)records + size, sizeof(records) - size, VERBOSE_EVENT_RECORD_FLUSH);
+		_reportedDroppedStanzas = droppedStanzas;
+
+		writeRecord(env, (MM_VerboseEventRecord *)records);
+		writeRecord(env, (MM_VerboseEventRecord *)((uint8_t *)records + size));
+		writeStaged(env);
+	}
+}
+
+uint8_t *
+MM_VerboseWriterFileLoggingAsynchronous::reserve(MM_EnvironmentBase *env, uintptr_t size)
+{
+	if ((_stagingLength + size) > _stagingSize) {
+		writeStaged(env);
+		if (size > _stagingSize) {
+			MM_GCExtensionsBase *extensions = env->getExtensions();
+			uintptr_t newSize = (size > STAGING_BUFFER_SIZE) ? size : STAGING_BUFFER_SIZE;
+			uint8_t *newStaging = (uint8_t *)extensions->getForge()->allocate(newSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+			if (NULL == newStaging) {
+				return NULL;
+			}
+			if (NULL != _staging) {
+				extensions->getForge()->free(_staging);
+			}
+			_staging = newStaging;
+			_stagingSize = newSize;
+		}
+	}
+
+	uint8_t *result = _staging + _stagingLength;
+	_stagingLength += size;
+	return result;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::stage(MM_EnvironmentBase *env, const void *data, uintptr_t size)
+{
+	uint8_t *destination = reserve(env, size);
+	if (NULL != destination) {
+		memcpy(destination, data, size);
+	}
+	return NULL != destination;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::stageString(MM_EnvironmentBase *env, VerboseEventRecordType type, uint16_t flags, uint64_t format, const char *string, uintptr_t length)
+{
+	uintptr_t size = MM_VerboseEventStream::encodeString(NULL, 0, type, flags, format, string, length);
+	uint8_t *destination = reserve(env, size);
+	if (NULL != destination) {
+		MM_VerboseEventStream::encodeString(destination, size, type, flags, format, string, length);
+	}
+	return NULL != destination;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeStaged(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if ((0 != _stagingLength) && (-1 != _outputFileDescriptor)) {
+		omrfile_write(_outputFileDescriptor, _staging, _stagingLength);
+	}
+	_stagingLength = 0;
+}
+
+uint64_t
+MM_VerboseWriterFileLoggingAsynchronous::formatId(MM_EnvironmentBase *env, uint64_t format)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if ((2 * (_formatCount + 1)) > _formatsSize) {
+		uintptr_t newSize = (0 == _formatsSize) ? INITIAL_FORMATS_SIZE : (2 * _formatsSize);
+		uint64_t *newFormats = (uint64_t *)extensions->getForge()->allocate(newSize * sizeof(uint64_t), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		uint64_t *newFormatIds = (uint64_t *)extensions->getForge()->allocate(newSize * sizeof(uint64_t), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if ((NULL == newFormats) || (NULL == newFormatIds)) {
+			if (NULL != newFormats) {
+				extensions->getForge()->free(newFormats);
+			}
+			if (NULL != newFormatIds) {
+				extensions->getForge()->free(newFormatIds);
+			}
+			return 0;
+		}
+		memset(newFormats, 0, newSize * sizeof(uint64_t));
+		for (uintptr_t i = 0; i < _formatsSize; i++) {
+			if (0 != _formats[i]) {
+				uintptr_t slot = (uintptr_t)((_formats[i] >> 3) * 0x9E3779B97F4A7C15ULL) & (newSize - 1);
+				while (0 != newFormats[slot]) {
+					slot = (slot + 1) & (newSize - 1);
+				}
+				newFormats[slot] = _formats[i];
+				newFormatIds[slot] = _formatIds[i];
+			}
+		}
+		if (NULL != _formats) {
+			extensions->getForge()->free(_formats);
+			extensions->getForge()->free(_formatIds);
+		}
+		_formats = newFormats;
+		_formatIds = newFormatIds;
+		_formatsSize = newSize;
+	}
+
+	uintptr_t slot = (uintptr_t)((format >> 3) * 0x9E3779B97F4A7C15ULL) & (_formatsSize - 1);
+	while (0 != _formats[slot]) {
+		if (format == _formats[slot]) {
+			return _formatIds[slot];
+		}
+		slot = (slot + 1) & (_formatsSize - 1);
+	}
+
+	/* the format record has to precede the first record that uses it */
+	const char *string = (const char *)(uintptr_t)format;
+	uint64_t id = _formatCount + 1;
+	if (!stageString(env, VERBOSE_EVENT_RECORD_FORMAT, 0, id, string, strlen(string))) {
+		return 0;
+	}
+	_formats[slot] = format;
+	_formatIds[slot] = id;
+	_formatCount += 1;
+	return id;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::resetFormats()
+{
+	if (NULL != _formats) {
+		memset(_formats, 0, _formatsSize * sizeof(uint64_t));
+	}
+	_formatCount = 0;
+}
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseEventDecoder.hpp"
+#include "VerboseEventStream.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a thread of its own.
+ *
+ * The reporting thread only copies the records of each stanza into a single producer, single
+ * consumer ring buffer. The writer thread formats them as XML or JSON lines, or writes them
+ * out as a binary stream that omrvgcdecode turns back into XML. A stanza which does not fit
+ * in the ring is dropped, and the number of dropped stanzas is reported in the log.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	};
+
+	OMR_VM *_omrVM;
+	VerboseOutputFormat _outputFormat; /**< the format of the file */
+	intptr_t _logFileDescriptor; /**< the file being written to, as seen by the reporting thread */
+
+	uint8_t *_ring; /**< the records waiting for the writer thread */
+	uintptr_t _ringSize; /**< bytes at _ring, a power of two */
+	volatile uintptr_t _ringHead; /**< total bytes consumed, only advanced by the writer thread */
+	volatile uintptr_t _ringTail; /**< total bytes produced, only advanced by the reporting thread */
+	volatile uintptr_t _droppedStanzas; /**< stanzas which did not fit in the ring */
+
+	omrthread_monitor_t _monitor; /**< the writer thread waits on this for records */
+	volatile uintptr_t _threadState;
+
+	/* state of the writer thread */
+	intptr_t _outputFileDescriptor; /**< the file being written to, as seen by the writer thread */
+	uintptr_t _reportedDroppedStanzas; /**< dropped stanzas already reported */
+	MM_VerboseEventDecoder _decoder; /**< formats records in XML and JSON output */
+	uint8_t *_staging; /**< binary output waiting to be written */
+	uintptr_t _stagingLength;
+	uintptr_t _stagingSize;
+	uint64_t *_formats; /**< open addressed table of the format strings already in the binary file */
+	uint64_t *_formatIds; /**< ids of the entries in _formats */
+	uintptr_t _formatsSize;
+	uintptr_t _formatCount;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t fileCount, uintptr_t iterations, VerboseOutputFormat outputFormat, uintptr_t bufferSize);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char *string);
+
+	virtual bool outputsRecords() { return true; }
+	virtual void outputRecords(MM_EnvironmentBase *env, const uint8_t *records, uintptr_t size);
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager, VerboseOutputFormat outputFormat, uintptr_t bufferSize);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startWriterThread(MM_EnvironmentBase *env);
+	void stopWriterThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Copy records into the ring and wake the writer thread.
+	 * @param env[in] the reporting thread
+	 * @param records[in] the records
+	 * @param size[in] the size of the records in bytes
+	 * @param wait[in] true to wait for space in the ring, false to drop records which do not fit
+	 * @return true if the records were queued
+	 */
+	bool enqueue(MM_EnvironmentBase *env, const uint8_t *records, uintptr_t size, bool wait);
+	bool enqueueText(MM_EnvironmentBase *env, const char *text, uintptr_t length, bool wait);
+	void notifyWriterThread();
+
+	static int J9THREAD_PROC writerThreadProc(void *info);
+	void writerThreadEntryPoint(MM_EnvironmentBase *env);
+	void drain(MM_EnvironmentBase *env);
+	void writeRecord(MM_EnvironmentBase *env, const MM_VerboseEventRecord *record);
+	void reportDroppedStanzas(MM_EnvironmentBase *env);
+
+	/**
+	 * Reserve space in the binary output, writing out what is staged when it is full.
+	 * @return the space, or NULL if the staging buffer could not be expanded
+	 */
+	uint8_t *reserve(MM_EnvironmentBase *env, uintptr_t size);
+	bool stage(MM_EnvironmentBase *env, const void *data, uintptr_t size);
+	bool stageString(MM_EnvironmentBase *env, VerboseEventRecordType type, uint16_t flags, uint64_t format, const char *string, uintptr_t length);
+	void writeStaged(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the id of a format string in the current binary file, adding a format record if it is new.
+	 * @return the id, or 0 if the format could not be added
+	 */
+	uint64_t formatId(MM_EnvironmentBase *env, uint64_t format);
+	void resetFormats();
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * Turns a binary verbose GC log, as written with -Xgc:asyncLogging=binary, back into the
+ * verbose GC XML, or into JSON lines.
+ *
+ * Usage: omrvgcdecode [--json] <binary log> [<output file>]
+ */
+
+#include <string.h>
+
+#include "omrport.h"
+#include "thread_api.h"
+
+#include "VerboseEventDecoder.hpp"
+
+static int
+decode(OMRPortLibrary *portLibrary, const char *inputName, const char *outputName, VerboseOutputFormat outputFormat)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	int rc = -1;
+	intptr_t inputFile = -1;
+	intptr_t outputFile = OMRPORT_TTY_OUT;
+	uint8_t *stream = NULL;
+	int64_t size = 0;
+
+	inputFile = omrfile_open(inputName, EsOpenRead, 0);
+	if (-1 == inputFile) {
+		omrfile_printf(OMRPORT_TTY_ERR, "Cannot open %s\n", inputName);
+		goto done;
+	}
+
+	size = omrfile_flength(inputFile);
+	if (size >= 0) {
+		/* the decoder reads records in place, so the stream is kept in memory aligned for them */
+		stream = (uint8_t *)omrmem_allocate_memory((uintptr_t)size + 1, OMRMEM_CATEGORY_MM);
+	}
+	if (NULL == stream) {
+		omrfile_printf(OMRPORT_TTY_ERR, "Cannot read %s\n", inputName);
+		goto done;
+	}
+	for (int64_t read = 0; read < size;) {
+		intptr_t count = omrfile_read(inputFile, stream + read, (intptr_t)(size - read));
+		if (count <= 0) {
+			omrfile_printf(OMRPORT_TTY_ERR, "Cannot read %s\n", inputName);
+			goto done;
+		}
+		read += count;
+	}
+
+	if ((size < (int64_t)sizeof(MM_VerboseEventStreamHeader)) || (0 != memcmp(stream, VERBOSE_EVENT_STREAM_MAGIC, sizeof(VERBOSE_EVENT_STREAM_MAGIC)))) {
+		omrfile_printf(OMRPORT_TTY_ERR, "%s is not a binary verbose GC log\n", inputName);
+		goto done;
+	}
+
+	if (NULL != outputName) {
+		outputFile = omrfile_open(outputName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == outputFile) {
+			omrfile_printf(OMRPORT_TTY_ERR, "Cannot open %s\n", outputName);
+			goto done;
+		}
+	}
+
+	{
+		MM_VerboseEventDecoder decoder(portLibrary, outputFormat);
+		decoder.setFileDescriptor(outputFile);
+		if (decoder.decodeStream(stream, (uintptr_t)size)) {
+			rc = 0;
+		} else {
+			omrfile_printf(OMRPORT_TTY_ERR, "%s is truncated, corrupt or from a platform with another pointer size\n", inputName);
+		}
+		decoder.tearDown();
+	}
+
+done:
+	if ((NULL != outputName) && (-1 != outputFile)) {
+		omrfile_close(outputFile);
+	}
+	if (-1 != inputFile) {
+		omrfile_close(inputFile);
+	}
+	omrmem_free_memory(stream);
+	return rc;
+}
+
+int
+main(int argc, char *argv[])
+{
+	omrthread_attach(NULL);
+
+	OMRPortLibrary portLibrary;
+
+	if (0 != omrport_init_library(&portLibrary, sizeof(portLibrary))) {
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	VerboseOutputFormat outputFormat = VERBOSE_OUTPUT_XML;
+	int argument = 1;
+	int rc = -1;
+
+	if ((argument < argc) && (0 == strcmp(argv[argument], "--json"))) {
+		outputFormat = VERBOSE_OUTPUT_JSON;
+		argument += 1;
+	}
+
+	if ((argument == argc) || ((argument + 2) < argc)) {
+		omrfile_printf(OMRPORT_TTY_ERR, "Usage: %s [--json] <binary log> [<output file>]\n", argv[0]);
+	} else {
+		rc = decode(&portLibrary, argv[argument], ((argument + 1) < argc) ? argv[argument + 1] : NULL, outputFormat);
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+
+	return rc;
+}
@@ -145,6 +145,9 @@ typedef struct OMR_VM {
 	omrthread_monitor_t _omrTIAccessMutex;
 	struct OMRTraceEngine *_trcEngine;
 	void *_methodDictionary;
+#if defined(OMR_RAS_SAMPLER)
+	void *_sampler;
+#endif /* OMR_RAS_SAMPLER */
 #endif /* OMR_RAS_TDF_TRACE */
 #if defined(OMR_GC_REALTIME)
 	omrthread_monitor_t _gcCycleOnMonitor;
@@ -177,6 +180,9 @@ typedef struct OMR_VMThread {
 		struct UtThreadData *uteThread; /* used by JVM */
 		struct OMR_TraceThread *omrTraceThread; /* used by OMR */
 	} _trace;
+#if defined(OMR_RAS_SAMPLER)
+	void *_sampleBuffer;
+#endif /* OMR_RAS_SAMPLER */
 #endif /* OMR_RAS_TDF_TRACE */
 
 	/* todo: dagar these are temporarily duplicated and should be removed from J9VMThread */
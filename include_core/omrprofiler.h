@@ -113,6 +113,19 @@ void omr_ras_sampleStackTraceStart(OMR_VMThread *omrVMThread, const void *method
  */
 void omr_ras_sampleStackTraceContinue(OMR_VMThread *omrVMThread, const void *methodKey);
 
+/**
+ * @brief Complete the sample of the current thread's stack.
+ *
+ * The frames traced since the last call to omr_ras_sampleStackTraceStart() are
+ * published to the sampler, if it is running. Without this call, they are discarded
+ * by the next sample.
+ *
+ * @pre The current thread must be attached to the OMR VM.
+ *
+ * @param[in] omrVMThread The current OMR VM thread. Must not be NULL.
+ */
+void omr_ras_sampleStackTraceEnd(OMR_VMThread *omrVMThread);
+
 /**
  * @brief Test whether stack sampling is enabled.
  *
@@ -121,12 +134,95 @@ void omr_ras_sampleStackTraceContinue(OMR_VMThread *omrVMThread, const void *met
  * header files.
  *
  * Stack stampling is enabled if either of the sampling tracepoints is enabled,
- * regardless of whether the method dictionary is enabled.
+ * or the sampler is running, regardless of whether the method dictionary is enabled.
  *
  * @return TRUE if stack sampling is enabled. FALSE if stack sampling is disabled.
  */
 BOOLEAN omr_ras_sampleStackEnabled(void);
 
+/* ---------------- OMR_Sampler.cpp ---------------- */
+
+/**
+ * @brief Start sampling the stacks of the VM's threads.
+ *
+ * Every thread attached to the VM, now or later, gets a timer on the CPU time it
+ * consumes. When the timer expires, a SIGPROF handler sets the thread's
+ * _sampleStackBackoff to 0, so the runtime samples the thread's stack at its next
+ * check of the counter, where the stack can safely be walked. The frames traced with
+ * omr_ras_sampleStackTraceStart() and omr_ras_sampleStackTraceContinue(), and
+ * completed by omr_ras_sampleStackTraceEnd(), are recorded in a lock-free buffer of
+ * the thread and aggregated by omr_ras_writeCollapsedStacks().
+ *
+ * Does nothing if the VM's sampler is already started.
+ *
+ * @param[in] vm The OMR VM.
+ * @param[in] intervalMicros Microseconds of CPU time between two samples of a thread.
+ * @param[in] framesPerThread Number of frames each thread can buffer between two
+ *                            calls to omr_ras_writeCollapsedStacks().
+ *                            Samples that do not fit are dropped.
+ * @return An OMR error code.
+ * @retval OMR_ERROR_NONE Success.
+ * @retval OMR_ERROR_ILLEGAL_ARGUMENT intervalMicros or framesPerThread is 0.
+ * @retval OMR_ERROR_NOT_AVAILABLE Sampling is not supported on this platform or
+ * was not built in (see OMR_RAS_SAMPLER), or another VM is already being sampled.
+ * @retval OMR_ERROR_OUT_OF_NATIVE_MEMORY Unable to allocate native memory for the sampler.
+ * @retval OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR Unable to allocate the sampler's lock.
+ * @retval OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD Unable to attach to the omrthread library.
+ */
+omr_error_t omr_ras_startSampler(OMR_VM *vm, uint32_t intervalMicros, size_t framesPerThread);
+
+/**
+ * @brief Stop sampling and deallocate the VM's sampler.
+ *
+ * Samples that were not written by omr_ras_writeCollapsedStacks() are discarded.
+ * The timers are deleted before the buffers are freed, which waits for any SIGPROF
+ * handler still using them.
+ *
+ * @pre No other thread is sampling its stack.
+ *
+ * @param[in] vm The OMR VM.
+ */
+void omr_ras_stopSampler(OMR_VM *vm);
+
+/**
+ * @brief Write the stacks sampled so far in the collapsed stack format.
+ *
+ * Each line lists the frames of a distinct stack from the outermost frame to the
+ * top-most frame, separated by ';', followed by a space and the number of times the
+ * stack was sampled. Frames are named by the first property of their method in the
+ * method dictionary, or by their method key if it has none. The output can be given
+ * to flame graph tools directly.
+ *
+ * @param[in] vmThread The current OMR VM thread.
+ * @param[in] fileName The file to write. It is replaced if it exists.
+ * @return An OMR error code.
+ * @retval OMR_ERROR_NONE Success.
+ * @retval OMR_ERROR_NOT_AVAILABLE The sampler is not started.
+ * @retval OMR_ERROR_ILLEGAL_ARGUMENT The file could not be opened.
+ * @retval OMR_ERROR_INTERNAL The file could not be written.
+ */
+omr_error_t omr_ras_writeCollapsedStacks(OMR_VMThread *vmThread, const char *fileName);
+
+/**
+ * @brief Give a thread attaching to the VM a sample buffer and a timer, if the sampler is started.
+ *
+ * Called by the OMR VM with the VM's thread list locked.
+ *
+ * @param[in] vmThread The attaching OMR VM thread.
+ * @return An OMR error code.
+ */
+omr_error_t omr_ras_samplerAttachThread(OMR_VMThread *vmThread);
+
+/**
+ * @brief Stop sampling a thread detaching from the VM.
+ *
+ * Called by the OMR VM with the VM's thread list locked. The samples of the thread are
+ * kept.
+ *
+ * @param[in] vmThread The detaching OMR VM thread.
+ */
+void omr_ras_samplerDetachThread(OMR_VMThread *vmThread);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -90,6 +90,7 @@ or omrthread priority value.
 #define J9THREAD_LIB_FLAG_SECONDARY_SPIN_OBJECT_MONITORS_ENABLED  0x20
 #define J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_KEEP_SAMPLING  0x40
 #define J9THREAD_LIB_FLAG_REALTIME_SCHEDULING_ENABLED  0x80
+#define J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_BUDGET_ENABLED  0x100
 #define J9THREAD_LIB_FLAG_CUSTOM_ADAPTIVE_SPIN_ENABLED  0x2000
 #define J9THREAD_LIB_FLAG_JLM_ENABLED  0x4000
 #define J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED  0x8000
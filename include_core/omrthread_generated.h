@@ -200,6 +200,12 @@ typedef struct J9ThreadMonitorTracing {
 	uintptr_t volatile holdtime_count;
 	uintptr_t enter_pause_count;
 #endif /* OMR_THR_JLM_HOLD_TIMES */
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	uintptr_t spin_budget;
+	uintptr_t spin_acquire_count;
+	uintptr_t spin_budget_exhausted_count;
+	uintptr_t spin_owner_blocked_count;
+#endif /* OMR_THR_ADAPTIVE_SPIN */
 } J9ThreadMonitorTracing;
 
 #define J9_ABSTRACT_MONITOR_FIELDS_1 \
@@ -233,7 +239,8 @@ typedef struct J9ThreadMonitorTracing {
 
 #if defined(OMR_THR_ADAPTIVE_SPIN)
 #define J9_ABSTRACT_MONITOR_FIELDS_5 \
-    uintptr_t sampleCounter;
+    uintptr_t sampleCounter; \
+    uintptr_t spinBudget;
 #else /* OMR_THR_ADAPTIVE_SPIN */
 #define J9_ABSTRACT_MONITOR_FIELDS_5
 #endif /* OMR_THR_ADAPTIVE_SPIN */
@@ -44,6 +44,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/x/codegen/X86BinaryEncoding.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/X86Debug.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/X86FPConversionSnippet.cpp \
+    $(JIT_OMR_DIRTY_DIR)/x/codegen/X86LinearScanRegisterAllocator.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/OMRInstruction.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/OMRInstructionDelegate.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/OMRX86Instruction.cpp \
@@ -57,6 +58,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/x/codegen/OMRCodeGenerator.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/env/OMRDebugEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/env/OMRCPU.cpp \
+    $(JIT_OMR_DIRTY_DIR)/x/runtime/VirtualGuardRuntime.cpp \
     $(JIT_PRODUCT_DIR)/x/codegen/Evaluator.cpp
 
 include $(JIT_MAKE_DIR)/files/target/$(TARGET_SUBARCH).mk
@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <algorithm>
 #include "compile/Compilation.hpp"
 #include "compile/ResolvedMethod.hpp"
 #include "il/ParameterSymbol.hpp"
@@ -46,6 +47,9 @@ JitBuilder::ResolvedMethod::ResolvedMethod(TR_OpaqueMethodBlock *method)
    _signature = resolvedMethod->getSignature();
    _externalName = 0;
    _entryPoint = resolvedMethod->getEntryPoint();
+   _isFastHelper = resolvedMethod->isFastHelper();
+   _isLeafHelper = resolvedMethod->isLeafHelper();
+   _preservedRegisters = resolvedMethod->getPreservedRegisters();
    strncpy(_signatureChars, resolvedMethod->signatureChars(), MAX_SIGNATURE_LENGTH); // TODO: introduce concept of robustness
    }
 
@@ -59,7 +63,10 @@ JitBuilder::ResolvedMethod::ResolvedMethod(TR::MethodBuilder *m)
      _entryPoint(0),
      _signature(0),
      _externalName(0),
-     _ilInjector(static_cast<TR::IlInjector *>(m))
+     _ilInjector(static_cast<TR::IlInjector *>(m)),
+     _isFastHelper(false),
+     _isLeafHelper(false),
+     _preservedRegisters(0)
    {
    computeSignatureChars();
    }
@@ -139,6 +146,25 @@ JitBuilder::ResolvedMethod::computeSignatureChars()
    }
 
 
+intptr_t
+JitBuilder::ResolvedMethod::getInvocationCount()
+   {
+   // Only method builders are told their invocation count by the client
+   if (_ilInjector != NULL && _ilInjector->isMethodBuilder())
+      return (intptr_t)_ilInjector->asMethodBuilder()->getInvocationCount();
+   return 0;
+   }
+
+uint32_t
+JitBuilder::ResolvedMethod::maxBytecodeIndex()
+   {
+   // Method builders have no bytecodes: they are as big as the IL their last
+   // compilation ended with, and as small as a method can be until then
+   if (_ilInjector != NULL && _ilInjector->isMethodBuilder())
+      return std::max(_ilInjector->asMethodBuilder()->getCompiledNodeCount(), 1);
+   return 0;
+   }
+
 char *
 JitBuilder::ResolvedMethod::localName(uint32_t slot,
                           uint32_t bcIndex,
@@ -171,6 +197,9 @@ JitBuilder::ResolvedMethod::getInjector (TR::IlGeneratorMethodDetails * details,
    TR::FrontEnd *fe,
    TR::SymbolReferenceTable *symRefTab)
    {
+   // the inliner may generate IL for a method builder again, in any compilation
+   if (_ilInjector->isMethodBuilder())
+      _ilInjector->asMethodBuilder()->forgetCompilation();
    _ilInjector->initialize(details, methodSymbol, fe, symRefTab);
    return _ilInjector;
    }
@@ -68,6 +68,7 @@ class ResolvedMethodBase : public TR_ResolvedMethod
    virtual bool                  isPublic()                                     { return true; }
    virtual bool                  isFinal()                                      { return false; }
    virtual bool                  isSubjectToPhaseChange(TR::Compilation *comp)  { return false; }
+   virtual TR_OpaqueClassBlock * containingClass()                              { return NULL; }
 
    virtual bool                  hasBackwardBranches()                          { return false; }
 
@@ -107,7 +108,10 @@ class ResolvedMethod : public ResolvedMethodBase, public Method
         _parmTypes(parmTypes),
         _returnType(returnType),
         _entryPoint(entryPoint),
-        _ilInjector(ilInjector)
+        _ilInjector(ilInjector),
+        _isFastHelper(false),
+        _isLeafHelper(false),
+        _preservedRegisters(0)
       {
       computeSignatureChars();
       }
@@ -134,18 +138,27 @@ class ResolvedMethod : public ResolvedMethodBase, public Method
    virtual void                * startAddressForJittedMethod()              { return (getEntryPoint()); }
    virtual void                * startAddressForInterpreterOfJittedMethod() { return 0; }
 
-   virtual uint32_t              maxBytecodeIndex()                         { return 0; }
+   virtual uint32_t              maxBytecodeIndex();
    virtual uint8_t             * code()                                     { return NULL; }
    virtual TR_OpaqueMethodBlock* getPersistentIdentifier()                  { return (TR_OpaqueMethodBlock *) _ilInjector; }
    virtual bool                  isInterpreted()                            { return startAddressForJittedMethod() == 0; }
+   virtual bool                  isInlineable(TR::Compilation *)            { return _ilInjector != NULL; }
+   virtual intptr_t              getInvocationCount();
 
    const char                  * getLineNumber()                            { return _lineNumber;}
    char                        * getSignature()                             { return _signature;}
    TR::DataType                 returnType();
    TR::IlType                  * returnIlType()                             { return _returnType; }
    int32_t                       getNumArgs()                               { return _numParms;}
+   TR::IlType                 ** getParmTypes()                             { return _parmTypes; }
    void                          setEntryPoint(void *ep)                    { _entryPoint = ep; }
    void                        * getEntryPoint()                            { return _entryPoint; }
+   void                          setInjector(TR::IlInjector *ilInjector)    { _ilInjector = ilInjector; }
+
+   void                          setFastHelper(uint64_t preservedRegisters, bool isLeaf) { _isFastHelper = true; _preservedRegisters = preservedRegisters; _isLeafHelper = isLeaf; }
+   bool                          isFastHelper()                             { return _isFastHelper; }
+   bool                          isLeafHelper()                             { return _isLeafHelper; }
+   uint64_t                      getPreservedRegisters()                    { return _preservedRegisters; }
 
    void                          computeSignatureCharsPrimitive();
    void                          computeSignatureChars();
@@ -169,6 +182,10 @@ class ResolvedMethod : public ResolvedMethodBase, public Method
    TR::IlType     * _returnType;
    void           * _entryPoint;
    TR::IlInjector * _ilInjector;
+
+   bool             _isFastHelper;
+   bool             _isLeafHelper;
+   uint64_t         _preservedRegisters;
    };
 
 
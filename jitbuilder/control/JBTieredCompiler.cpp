@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "control/JBTieredCompiler.hpp"
+
+#include "compile/CompilationTypes.hpp"
+#include "control/Options.hpp"
+#include "ilgen/MethodBuilder.hpp"
+
+std::mutex JitBuilder::TieredCompiler::_scopeLock;
+std::condition_variable JitBuilder::TieredCompiler::_scopeChanged;
+int32_t JitBuilder::TieredCompiler::_compilations = 0;
+bool JitBuilder::TieredCompiler::_exclusive = false;
+
+JitBuilder::TieredCompiler::CompilingScope::CompilingScope()
+   {
+   std::unique_lock<std::mutex> lock(_scopeLock);
+   while (_exclusive)
+      _scopeChanged.wait(lock);
+   _compilations++;
+   }
+
+JitBuilder::TieredCompiler::CompilingScope::~CompilingScope()
+   {
+   std::lock_guard<std::mutex> lock(_scopeLock);
+   if (--_compilations == 0)
+      _scopeChanged.notify_all();
+   }
+
+JitBuilder::TieredCompiler::ExclusiveScope::ExclusiveScope()
+   {
+   std::unique_lock<std::mutex> lock(_scopeLock);
+   while (_exclusive)
+      _scopeChanged.wait(lock);
+
+   // from here on new compilations wait, so a steady stream of them cannot
+   // keep the exclusive scope waiting
+   _exclusive = true;
+   while (_compilations > 0)
+      _scopeChanged.wait(lock);
+   }
+
+JitBuilder::TieredCompiler::ExclusiveScope::~ExclusiveScope()
+   {
+   std::lock_guard<std::mutex> lock(_scopeLock);
+   _exclusive = false;
+   _scopeChanged.notify_all();
+   }
+
+JitBuilder::TieredCompiler::TieredCompiler()
+   : _recompiling(false),
+   _shuttingDown(false),
+   _recompiledCount(0)
+   {
+   }
+
+// Never destroyed: a background thread that was not stopped by shutdownJit
+// must not be destroyed while joinable
+//
+JitBuilder::TieredCompiler &
+JitBuilder::TieredCompiler::instance()
+   {
+   static TieredCompiler *tieredCompiler = new TieredCompiler();
+   return *tieredCompiler;
+   }
+
+int32_t
+JitBuilder::TieredCompiler::compile(TR::MethodBuilder *methodBuilder, void **entry)
+   {
+   TR::Options *options = TR::Options::getCmdLineOptions();
+
+   CompilingScope compiling;
+   methodBuilder->enableRecompilationCounting((void *)&requestRecompilation,
+                                              options->getTieredInvocationThreshold(),
+                                              options->getTieredBackedgeThreshold());
+   int32_t rc = methodBuilder->Compile(entry, cold);
+   methodBuilder->disableRecompilationCounting();
+   return rc;
+   }
+
+void
+JitBuilder::TieredCompiler::requestRecompilation(TR::MethodBuilder *methodBuilder)
+   {
+   TieredCompiler &tieredCompiler = instance();
+   std::lock_guard<std::mutex> lock(tieredCompiler._queueLock);
+
+   // both counters of a method can reach their threshold
+   if (tieredCompiler._shuttingDown || !tieredCompiler._requested.insert(methodBuilder).second)
+      return;
+
+   tieredCompiler._queue.push_back(methodBuilder);
+   if (!tieredCompiler._thread.joinable())
+      tieredCompiler._thread = std::thread(&TieredCompiler::recompileQueuedMethods, &tieredCompiler);
+   tieredCompiler._queueChanged.notify_all();
+   }
+
+void
+JitBuilder::TieredCompiler::recompileQueuedMethods()
+   {
+   std::unique_lock<std::mutex> lock(_queueLock);
+   while (true)
+      {
+      while (_queue.empty() && !_shuttingDown)
+         _queueChanged.wait(lock);
+      if (_shuttingDown)
+         break;
+
+      TR::MethodBuilder *methodBuilder = _queue.front();
+      _queue.pop_front();
+      _recompiling = true;
+      lock.unlock();
+
+      void *entry = NULL;
+      int32_t rc;
+      {
+      // the client's threads may be compiling this MethodBuilder, or one that
+      // calls and inlines it, so the recompilation cannot overlap with them
+      ExclusiveScope recompiling;
+      rc = methodBuilder->Compile(&entry, hot);
+      }
+
+      // on failure the method simply keeps running its first tier
+      if (rc == 0 && entry != NULL)
+         methodBuilder->setRecompiledEntry(entry);
+
+      lock.lock();
+      if (rc == 0 && entry != NULL)
+         _recompiledCount++;
+      _recompiling = false;
+      _queueChanged.notify_all();
+      }
+   }
+
+int32_t
+JitBuilder::TieredCompiler::waitForRecompilations()
+   {
+   std::unique_lock<std::mutex> lock(_queueLock);
+   while (!_queue.empty() || _recompiling)
+      _queueChanged.wait(lock);
+   return _recompiledCount;
+   }
+
+void
+JitBuilder::TieredCompiler::shutdown()
+   {
+   {
+   std::lock_guard<std::mutex> lock(_queueLock);
+   _shuttingDown = true;
+   _queue.clear();
+   _queueChanged.notify_all();
+   }
+
+   if (_thread.joinable())
+      _thread.join();
+
+   // the JIT may be initialized again
+   std::lock_guard<std::mutex> lock(_queueLock);
+   _requested.clear();
+   _recompiledCount = 0;
+   _shuttingDown = false;
+   }
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef JITBUILDER_TIEREDCOMPILER_HPP
+#define JITBUILDER_TIEREDCOMPILER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <stdint.h>
+#include <thread>
+
+namespace TR { class MethodBuilder; }
+
+namespace JitBuilder
+{
+
+/**
+ * Compiles MethodBuilders cold with counters inserted, and recompiles them hot
+ * on a background thread once their counters reach tieredInvocationThreshold=
+ * or tieredBackedgeThreshold=.
+ *
+ * The cold body stays the entry point handed to the client: once the hot body
+ * is published the entry of the cold body is patched with a jump to it where
+ * the code generator supports that, and the cold body forwards calls to it
+ * otherwise, so nothing holding the entry point needs to be updated.  Calls
+ * already running in the cold body, such as a long loop, finish there.
+ *
+ * Compilations on the client's threads run in a CompilingScope, so
+ * compilations of distinct methods run concurrently.  A recompilation runs in
+ * an ExclusiveScope instead: the client may be compiling the same
+ * MethodBuilder, or one that inlines it, at any time, so it waits for every
+ * client compilation to end and holds off new ones until it is done.  The
+ * background thread is only started by the first recompilation request.
+ */
+class TieredCompiler
+   {
+   public:
+
+   static TieredCompiler &instance();
+
+   /**
+    * Held for the duration of a compilation, or of anything else that may
+    * look up or allocate code, by any number of threads at once.
+    */
+   class CompilingScope
+      {
+      public:
+      CompilingScope();
+      ~CompilingScope();
+      };
+
+   /**
+    * Held by a recompilation or while retired code is freed: waits for every
+    * CompilingScope to end and keeps new ones from starting until it ends
+    * itself.
+    */
+   class ExclusiveScope
+      {
+      public:
+      ExclusiveScope();
+      ~ExclusiveScope();
+      };
+
+   /**
+    * Compile the first tier of a MethodBuilder.  The MethodBuilder must not be
+    * destroyed while its compiled code can run or a recompilation of it is
+    * pending; waitForRecompilations() or shutdown() rule out the latter.
+    */
+   int32_t compile(TR::MethodBuilder *methodBuilder, void **entry);
+
+   /**
+    * Wait until every requested recompilation has completed.
+    *
+    * @return the number of methods recompiled since the JIT was initialized
+    */
+   int32_t waitForRecompilations();
+
+   /**
+    * Drop pending requests, wait for any recompilation in progress and stop
+    * the background thread.
+    */
+   void shutdown();
+
+   private:
+
+   TieredCompiler();
+
+   // Called by compiled code, see TR::MethodBuilder::enableRecompilationCounting
+   static void requestRecompilation(TR::MethodBuilder *methodBuilder);
+
+   void recompileQueuedMethods();
+
+   static std::mutex _scopeLock;
+   static std::condition_variable _scopeChanged;
+   static int32_t _compilations;
+   static bool _exclusive;
+
+   std::mutex _queueLock;
+   std::condition_variable _queueChanged;
+   std::thread _thread;
+   std::deque<TR::MethodBuilder *> _queue;
+   std::set<TR::MethodBuilder *> _requested; // queued or already recompiled
+   bool _recompiling;
+   bool _shuttingDown;
+   int32_t _recompiledCount;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_TIEREDCOMPILER_HPP)
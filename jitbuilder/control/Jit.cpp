@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include <stdio.h>
+#include <vector>
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
@@ -30,12 +31,19 @@
 #include "env/IO.hpp"
 #include "env/RawAllocator.hpp"
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
+#include "ilgen/JitBuilderRecorderBinaryFile.hpp"
+#include "ilgen/JitBuilderRecorderTextFile.hpp"
+#include "ilgen/JitBuilderReplayBinaryFile.hpp"
+#include "ilgen/JitBuilderReplayTextFile.hpp"
 #include "ilgen/MethodBuilder.hpp"
+#include "ilgen/MethodBuilderReplay.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "runtime/CodeCache.hpp"
+#include "runtime/CodeMetaDataManager.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/JBJitConfig.hpp"
 #include "control/CompilationController.hpp"
+#include "control/JBTieredCompiler.hpp"
 
 #if defined(AIXPPC)
 #include "p/codegen/PPCTableOfConstants.hpp"
@@ -144,6 +152,9 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
    if (commonJitInit(fe, options) < 0)
       return false;
 
+   if (!TR::CodeMetaDataManager::initializeCodeMetaDataManager())
+      return false;
+
    initializeCodeCache(fe.codeCacheManager());
 
    return true;
@@ -185,11 +196,9 @@ internal_initializeJit()
    return initializeJitBuilder(0, 0, 0, (char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator");
    }
 
-int32_t
-internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+static void
+createFunctionDescriptor(void **entry)
    {
-   auto rc = m->Compile(entry);
-
 #if defined(AIXPPC)
    struct FunctionDescriptor
       {
@@ -207,14 +216,138 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
 
    *entry = (uint8_t*) fd;
 #endif
+   }
 
+// Distinct MethodBuilders can be compiled on any number of threads at once,
+// sharing a TypeDictionary or not.  A MethodBuilder, and any MethodBuilder it
+// calls and may inline, must only be compiled on one of the client's threads
+// at a time; background recompilations never overlap with client compilations
+//
+int32_t
+internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+   {
+   int32_t rc;
+   {
+   JitBuilder::TieredCompiler::CompilingScope compiling;
+   rc = m->Compile(entry);
+   }
+
+   createFunctionDescriptor(entry);
    return rc;
    }
 
+// The method is compiled cold with invocation and loop back edge counters,
+// and recompiled hot on a background thread once either count reaches its
+// threshold (-Xjit:tieredInvocationThreshold=,tieredBackedgeThreshold=).
+// The returned entry point stays valid across the recompilation, and the
+// MethodBuilder must live as long as it may be called
+//
+int32_t
+internal_compileMethodBuilderTiered(TR::MethodBuilder *m, void **entry)
+   {
+   int32_t rc = JitBuilder::TieredCompiler::instance().compile(m, entry);
+
+   createFunctionDescriptor(entry);
+   return rc;
+   }
+
+int32_t
+internal_waitForRecompilations()
+   {
+   return JitBuilder::TieredCompiler::instance().waitForRecompilations();
+   }
+
+// The MethodBuilder is compiled as usual while every JitBuilder service it
+// is asked for, from its definitions to its IL, is written to recordingFile
+// in the text or the binary recording format. The recording can be compiled
+// again by compileRecording. Recording stops at the first service that cannot
+// be replayed, such as a struct or union type, a BytecodeBuilder or a call to
+// another MethodBuilder, and COMPILATION_IL_GEN_FAILURE is then returned even
+// though the method was compiled and its entry point is valid
+//
+int32_t
+internal_compileMethodBuilderRecorded(TR::MethodBuilder *m, void **entry, char *recordingFile, bool binary)
+   {
+   TR::JitBuilderRecorder *recorder;
+   if (binary)
+      recorder = new TR::JitBuilderRecorderBinaryFile(m, recordingFile);
+   else
+      recorder = new TR::JitBuilderRecorderTextFile(m, recordingFile);
+   m->setRecorder(recorder);
+
+   int32_t rc = internal_compileMethodBuilder(m, entry);
+   if (rc == COMPILATION_SUCCEEDED && recorder->hasFailed())
+      rc = COMPILATION_IL_GEN_FAILURE;
+
+   delete recorder;
+   return rc;
+   }
+
+// Recordings that have been compiled, kept until shutdown since their
+// compiled code may refer to strings they own
+//
+static std::vector<TR::JitBuilderReplay *> compiledRecordings;
+static std::mutex compiledRecordingsLock;
+
+int32_t
+internal_compileRecording(char *recordingFile, bool binary, void **entry)
+   {
+   TR::JitBuilderReplay *replay;
+   if (binary)
+      replay = new TR::JitBuilderReplayBinaryFile(recordingFile);
+   else
+      replay = new TR::JitBuilderReplayTextFile(recordingFile);
+
+   int32_t rc = COMPILATION_IL_GEN_FAILURE;
+   *entry = NULL;
+   if (!replay->failed())
+      {
+      TR::TypeDictionary types;
+      TR::MethodBuilderReplay mb(&types, replay);
+      if (!replay->failed())
+         rc = internal_compileMethodBuilder(&mb, entry);
+      }
+
+   std::lock_guard<std::mutex> lock(compiledRecordingsLock);
+   compiledRecordings.push_back(replay);
+   return rc;
+   }
+
+// Entry points passed to retireCompiledCode are queued and only freed by
+// reclaimRetiredCode, which the caller must only call once no thread can still
+// be running, or be about to call, any of the retired code
+//
+bool
+internal_retireCompiledCode(void *entry)
+   {
+#if defined(AIXPPC)
+   entry = *(void **)entry; // function descriptor created by compileMethodBuilder
+#endif
+
+   JitBuilder::TieredCompiler::CompilingScope retiring;
+   auto fe = JitBuilder::FrontEnd::instance();
+   return fe->retireMethodBody(entry);
+   }
+
+int32_t
+internal_reclaimRetiredCode()
+   {
+   JitBuilder::TieredCompiler::ExclusiveScope reclaiming;
+   auto fe = JitBuilder::FrontEnd::instance();
+   return fe->reclaimRetiredMethodBodies();
+   }
+
 void
 internal_shutdownJit()
    {
+   JitBuilder::TieredCompiler::instance().shutdown();
+
+   for (size_t i = 0; i < compiledRecordings.size(); i++)
+      delete compiledRecordings[i];
+   compiledRecordings.clear();
+
    auto fe = JitBuilder::FrontEnd::instance();
+   fe->unregisterCodeCaches();
 
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
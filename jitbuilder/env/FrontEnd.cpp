@@ -22,6 +22,7 @@
 
 #include "env/FrontEnd.hpp"
 
+#include <algorithm>
 #include <limits.h>
 #include <math.h>
 #include <stdio.h>
@@ -36,6 +37,9 @@
 #include "env/jittypes.h"
 #include "il/DataTypes.hpp"
 #include "il/ILOps.hpp"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "runtime/CodeMetaDataManager.hpp"
 #include "runtime/CodeMetaDataPOD.hpp"
 #include "runtime/StackAtlasPOD.hpp"
 
@@ -77,6 +81,107 @@ FrontEnd::methodTrampolineLookup(TR::Compilation *comp, TR::SymbolReference *sym
    return 0;
    }
 
+TR::MethodMetaDataPOD *
+FrontEnd::createMethodMetaData(TR::Compilation *comp)
+   {
+   TR::CodeMetaDataManager *metaDataManager = TR::CodeMetaDataManager::codeMetaDataManager();
+   if (!metaDataManager)
+      return NULL;
+
+   void *startPC = comp->getMethodSymbol()->getMethodAddress();
+   TR::CodeCache *codeCache = codeCacheManager().findCodeCacheFromPC(startPC);
+   if (!codeCache)
+      return NULL;
+
+   TR::MethodMetaDataPOD *metaData = new (PERSISTENT_NEW) TR::MethodMetaDataPOD();
+   if (!metaData)
+      return NULL;
+
+   metaData->startPC = (uintptr_t)startPC;
+   metaData->endPC = (uintptr_t)comp->cg()->getCodeEnd();
+
+   std::lock_guard<std::mutex> lock(_metaDataMonitor);
+
+   // Code caches are registered when the first body is placed in them
+   //
+   if (std::find(_metaDataCodeCaches.begin(), _metaDataCodeCaches.end(), codeCache) == _metaDataCodeCaches.end())
+      {
+      if (!metaDataManager->addCodeCache(codeCache))
+         {
+         TR_Memory::jitPersistentFree(metaData);
+         return NULL;
+         }
+      _metaDataCodeCaches.push_back(codeCache);
+      }
+
+   if (!metaDataManager->insertMetaData(metaData))
+      {
+      TR_Memory::jitPersistentFree(metaData);
+      return NULL;
+      }
+
+   CompiledBody body = { comp->getCurrentMethod()->getPersistentIdentifier(), metaData };
+   _compiledBodies[startPC] = body;
+   return metaData;
+   }
+
+bool
+FrontEnd::retireMethodBody(void *startPC)
+   {
+   TR_OpaqueMethodBlock *method = NULL;
+   TR::MethodMetaDataPOD *metaData = NULL;
+
+   std::lock_guard<std::mutex> lock(_metaDataMonitor);
+   auto body = _compiledBodies.find(startPC);
+   if (body != _compiledBodies.end())
+      {
+      method = body->second._method;
+      metaData = body->second._metaData;
+      }
+
+   if (!codeCacheManager().retireMethodBody(startPC, method, metaData))
+      return false;
+
+   if (body != _compiledBodies.end())
+      {
+      _compiledBodies.erase(body);
+      _retiredMetaData.push_back(metaData);
+      }
+   return true;
+   }
+
+int32_t
+FrontEnd::reclaimRetiredMethodBodies()
+   {
+   std::lock_guard<std::mutex> lock(_metaDataMonitor);
+   int32_t numFreed = codeCacheManager().reclaimRetiredMethodBodies();
+
+   for (size_t i = 0; i < _retiredMetaData.size(); i++)
+      TR_Memory::jitPersistentFree(_retiredMetaData[i]);
+   _retiredMetaData.clear();
+
+   return numFreed;
+   }
+
+void
+FrontEnd::unregisterCodeCaches()
+   {
+   TR::CodeMetaDataManager *metaDataManager = TR::CodeMetaDataManager::codeMetaDataManager();
+
+   std::lock_guard<std::mutex> lock(_metaDataMonitor);
+   for (size_t i = 0; i < _metaDataCodeCaches.size(); i++)
+      metaDataManager->removeCodeCache(_metaDataCodeCaches[i]);
+   _metaDataCodeCaches.clear();
+
+   for (auto body = _compiledBodies.begin(); body != _compiledBodies.end(); ++body)
+      TR_Memory::jitPersistentFree(body->second._metaData);
+   _compiledBodies.clear();
+
+   for (size_t i = 0; i < _retiredMetaData.size(); i++)
+      TR_Memory::jitPersistentFree(_retiredMetaData[i]);
+   _retiredMetaData.clear();
+   }
+
 // -----------------------------------------------------------------------------
 
 
@@ -23,14 +23,17 @@
 #ifndef TESTFE_INCL
 #define TESTFE_INCL
 
+#include <map>
+#include <mutex>
 #include <vector>
 #include "compiler/env/FrontEnd.hpp"
 #include "env/FEBase.hpp"
 #include "env/jittypes.h"
 #include "runtime/JBJitConfig.hpp"
 
+namespace TR { class CodeCache; }
 namespace TR { class GCStackAtlas; }
-namespace OMR { struct MethodMetaDataPOD; }
+namespace TR { struct MethodMetaDataPOD; }
 class TR_ResolvedMethod;
 
 namespace TR
@@ -67,8 +70,42 @@ class FrontEnd : public TR::FEBase<FrontEnd>
   TR_ResolvedMethod * createResolvedMethod(TR_Memory * trMemory, TR_OpaqueMethodBlock * aMethod,
                                             TR_ResolvedMethod * owningMethod, TR_OpaqueClassBlock *classForNewInstance);
 
+   /**
+    * @brief Registers the body just compiled with the CodeMetaDataManager and
+    *        records it along with the method it was compiled for.
+    */
+   virtual TR::MethodMetaDataPOD *createMethodMetaData(TR::Compilation *comp);
+
+   /**
+    * @brief Retires the body at startPC, passing the method and metadata
+    *        recorded when it was compiled so that reclamation unregisters them.
+    */
+   bool retireMethodBody(void *startPC);
+
+   /**
+    * @brief Reclaims the retired bodies and frees their metadata.  No thread
+    *        may be compiling or retiring a body at the same time.
+    */
+   int32_t reclaimRetiredMethodBodies();
+
+   /**
+    * @brief Unregisters every code cache from the CodeMetaDataManager before
+    *        the code caches are destroyed.
+    */
+   void unregisterCodeCaches();
 
+   private:
+
+   struct CompiledBody
+      {
+      TR_OpaqueMethodBlock *_method;
+      TR::MethodMetaDataPOD *_metaData;
+      };
 
+   std::mutex _metaDataMonitor;
+   std::map<void *, CompiledBody> _compiledBodies;
+   std::vector<TR::MethodMetaDataPOD *> _retiredMetaData;
+   std::vector<TR::CodeCache *> _metaDataCodeCaches;
    };
 
 } // namespace JitBuilder
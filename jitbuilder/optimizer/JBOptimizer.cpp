@@ -65,7 +65,9 @@
 #include "optimizer/GlobalValuePropagation.hpp"
 #include "optimizer/LocalValuePropagation.hpp"
 #include "optimizer/Inliner.hpp"
+#include "optimizer/BenefitInliner.hpp"
 #include "optimizer/SwitchAnalyzer.hpp"
+#include "optimizer/TailRecursionElimination.hpp"
 
 
 static const OptimizationStrategy tacticalGlobalRegisterAllocatorOpts[] =
@@ -107,6 +109,7 @@ static const OptimizationStrategy JBwarmStrategyOpts[] =
    {
    { OMR::deadTreesElimination                                                     },
    { OMR::inlining                                                                 },
+   { OMR::tailRecursionElimination                                                 }, // after inlining so inlined returns are seen
    { OMR::treeSimplification                                                       },
    { OMR::localCSE                                                                 },
    { OMR::basicBlockOrdering                                                       }, // straighten goto's
@@ -195,10 +198,16 @@ Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymb
       new (comp->allocator()) TR::OptimizationManager(self(), TR_GlobalRegisterAllocator::create, OMR::tacticalGlobalRegisterAllocator);
    _opts[OMR::regDepCopyRemoval] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR::RegDepCopyRemoval::create, OMR::regDepCopyRemoval);
-   _opts[OMR::inlining] =
-      new (comp->allocator()) TR::OptimizationManager(self(), TR_TrivialInliner::create, OMR::inlining);
+   if (comp->getOption(TR_EnableBenefitInliner))
+      _opts[OMR::inlining] =
+         new (comp->allocator()) TR::OptimizationManager(self(), TR::BenefitInlinerWrapper::create, OMR::inlining);
+   else
+      _opts[OMR::inlining] =
+         new (comp->allocator()) TR::OptimizationManager(self(), TR_TrivialInliner::create, OMR::inlining);
    _opts[OMR::switchAnalyzer] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
+   _opts[OMR::tailRecursionElimination] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR::TailRecursionElimination::create, OMR::tailRecursionElimination);
 
    // Initialize optimization groups
    _opts[OMR::cheapTacticalGlobalRegisterAllocatorGroup] =
@@ -0,0 +1,402 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Compiles and runs the kernels of several samples repeatedly and writes one
+ * JSON object per kernel to stdout, reporting:
+ *   - the time each compilation phase took (median and maximum, in usec)
+ *   - the size of the generated code
+ *   - percentiles of the time one call of the compiled kernel and of the
+ *     equivalent C function take (in nsec)
+ *
+ * It then compiles every kernel the given number of times on one thread and
+ * on several threads sharing a TypeDictionary, and writes the elapsed time of
+ * both (in usec) and the resulting speedup.
+ *
+ * The kernels are the method builders of those samples, which are linked in
+ * with SAMPLE_WITHOUT_MAIN defined.
+ *
+ * usage: benchmark [compilations [runs [threads]]]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+#include "DotProduct.hpp"
+#include "IterativeFib.hpp"
+#include "MatMult.hpp"
+#include "Pow2.hpp"
+
+using std::cerr;
+
+
+// C baselines, called through these pointers so that the C compiler can
+// neither inline them nor hoist them out of the timing loop
+
+static int32_t
+iterativeFib(int32_t n)
+   {
+   if (n < 2)
+      return n;
+   int32_t lastSum = 0, sum = 1;
+   for (int32_t i = 1; i < n; i++)
+      {
+      int32_t tempSum = sum + lastSum;
+      lastSum = sum;
+      sum = tempSum;
+      }
+   return sum;
+   }
+
+static int64_t
+pow2(int64_t n)
+   {
+   int64_t a = 1, b = 1;
+   for (int64_t i = n; i > -1; i--)
+      {
+      a = b;
+      b = a + b;
+      }
+   return a;
+   }
+
+static void
+dotProduct(double *result, double *vector1, double *vector2, int32_t length)
+   {
+   for (int32_t i = 0; i < length; i++)
+      result[i] = vector1[i] * vector2[i];
+   }
+
+static void
+matMult(double *C, double *A, double *B, int32_t N)
+   {
+   for (int32_t i = 0; i < N; i++)
+      for (int32_t j = 0; j < N; j++)
+         {
+         double sum = 0.0;
+         for (int32_t k = 0; k < N; k++)
+            sum += A[i*N+k] * B[k*N+j];
+         C[i*N+j] = sum;
+         }
+   }
+
+static IterativeFibFunctionType * volatile iterativeFibBaseline = &iterativeFib;
+static Pow2FunctionType * volatile pow2Baseline = &pow2;
+static DotProductFunctionType * volatile dotProductBaseline = &dotProduct;
+static MatMultFunctionType * volatile matMultBaseline = &matMult;
+
+
+static const int32_t FIB_N = 40;
+static const int64_t POW2_N = 60;
+static const int32_t DOT_LENGTH = 1024;
+static const int32_t MAT_N = 32;
+
+static volatile int64_t sink;
+static double vector1[DOT_LENGTH], vector2[DOT_LENGTH], dotResult[DOT_LENGTH], dotExpected[DOT_LENGTH];
+static double matA[MAT_N*MAT_N], matB[MAT_N*MAT_N], matC[MAT_N*MAT_N], matExpected[MAT_N*MAT_N];
+
+static void
+initData()
+   {
+   for (int32_t i = 0; i < DOT_LENGTH; i++)
+      {
+      vector1[i] = i + 0.5;
+      vector2[i] = DOT_LENGTH - i;
+      }
+   for (int32_t i = 0; i < MAT_N*MAT_N; i++)
+      {
+      matA[i] = (i % 7) + 1.0;
+      matB[i] = 1.0 / ((i % 5) + 1);
+      }
+   }
+
+static bool
+sameArray(double *actual, double *expected, int32_t length)
+   {
+   for (int32_t i = 0; i < length; i++)
+      if (fabs(actual[i] - expected[i]) > 1e-9 * fabs(expected[i]))
+         return false;
+   return true;
+   }
+
+static OMR::JitBuilder::MethodBuilder *createIterativeFib(OMR::JitBuilder::TypeDictionary *t) { return new IterativeFibonnaciMethod(t); }
+static void runIterativeFib(void *entry)  { sink = ((IterativeFibFunctionType *)entry)(FIB_N); }
+static void runIterativeFibBaseline()     { sink = iterativeFibBaseline(FIB_N); }
+static bool checkIterativeFib(void *entry) { return ((IterativeFibFunctionType *)entry)(FIB_N) == iterativeFibBaseline(FIB_N); }
+
+static OMR::JitBuilder::MethodBuilder *createPow2(OMR::JitBuilder::TypeDictionary *t) { return new Pow2Method(t); }
+static void runPow2(void *entry)          { sink = ((Pow2FunctionType *)entry)(POW2_N); }
+static void runPow2Baseline()             { sink = pow2Baseline(POW2_N); }
+static bool checkPow2(void *entry)        { return ((Pow2FunctionType *)entry)(POW2_N) == pow2Baseline(POW2_N); }
+
+static OMR::JitBuilder::MethodBuilder *createDotProduct(OMR::JitBuilder::TypeDictionary *t) { return new DotProduct(t, false); }
+static void runDotProduct(void *entry)    { ((DotProductFunctionType *)entry)(dotResult, vector1, vector2, DOT_LENGTH); }
+static void runDotProductBaseline()       { dotProductBaseline(dotResult, vector1, vector2, DOT_LENGTH); }
+static bool
+checkDotProduct(void *entry)
+   {
+   dotProductBaseline(dotExpected, vector1, vector2, DOT_LENGTH);
+   runDotProduct(entry);
+   return sameArray(dotResult, dotExpected, DOT_LENGTH);
+   }
+
+static OMR::JitBuilder::MethodBuilder *createMatMult(OMR::JitBuilder::TypeDictionary *t) { return new MatMult(t); }
+static void runMatMult(void *entry)       { ((MatMultFunctionType *)entry)(matC, matA, matB, MAT_N); }
+static void runMatMultBaseline()          { matMultBaseline(matC, matA, matB, MAT_N); }
+static bool
+checkMatMult(void *entry)
+   {
+   matMultBaseline(matExpected, matA, matB, MAT_N);
+   runMatMult(entry);
+   return sameArray(matC, matExpected, MAT_N*MAT_N);
+   }
+
+struct Benchmark
+   {
+   const char *name;
+   OMR::JitBuilder::MethodBuilder *(*create)(OMR::JitBuilder::TypeDictionary *);
+   void (*run)(void *entry);
+   void (*runBaseline)();
+   bool (*check)(void *entry);
+   int32_t callsPerRun;   // short kernels are timed over several calls
+   };
+
+static Benchmark benchmarks[] =
+   {
+   { "iterfib",    createIterativeFib, runIterativeFib, runIterativeFibBaseline, checkIterativeFib, 1000 },
+   { "pow2",       createPow2,         runPow2,         runPow2Baseline,         checkPow2,         1000 },
+   { "dotproduct", createDotProduct,   runDotProduct,   runDotProductBaseline,   checkDotProduct,   10 },
+   { "matmult",    createMatMult,      runMatMult,      runMatMultBaseline,      checkMatMult,      1 },
+   };
+
+
+static int64_t
+nanoTime()
+   {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (int64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+   }
+
+// value below which the given fraction of the sorted samples lie
+static int64_t
+percentile(std::vector<int64_t> &sorted, double fraction)
+   {
+   size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5);
+   return sorted[index];
+   }
+
+static void
+printTimes(const char *name, std::vector<int64_t> &times, bool last)
+   {
+   std::sort(times.begin(), times.end());
+   printf("\"%s\":{\"min\":%lld,\"p50\":%lld,\"p90\":%lld,\"p99\":%lld,\"max\":%lld}%s",
+          name,
+          (long long)times.front(),
+          (long long)percentile(times, 0.50),
+          (long long)percentile(times, 0.90),
+          (long long)percentile(times, 0.99),
+          (long long)times.back(),
+          last ? "" : ",");
+   }
+
+static void
+printPhase(const char *name, std::vector<int64_t> &times, bool last)
+   {
+   std::sort(times.begin(), times.end());
+   printf("\"%s\":{\"p50\":%lld,\"max\":%lld}%s",
+          name,
+          (long long)percentile(times, 0.50),
+          (long long)times.back(),
+          last ? "" : ",");
+   }
+
+static bool
+runBenchmark(Benchmark &b, int32_t numCompiles, int32_t numRuns)
+   {
+   std::vector<int64_t> ilGen, optimization, codeGen, total;
+   int32_t codeSize = 0;
+   void *entry = NULL;
+
+   // every compilation builds the method anew, as a client compiling many
+   // methods would; only the code of the last one is kept
+   for (int32_t c = 0; c < numCompiles; c++)
+      {
+      OMR::JitBuilder::TypeDictionary types;
+      OMR::JitBuilder::MethodBuilder *method = b.create(&types);
+      if (entry != NULL)
+         retireCompiledCode(entry);
+
+      int32_t rc = compileMethodBuilder(method, &entry);
+      if (rc != 0)
+         {
+         cerr << "FAIL: compilation error " << rc << " in " << b.name << "\n";
+         delete method;
+         return false;
+         }
+
+      ilGen.push_back(method->GetIlGenTime());
+      optimization.push_back(method->GetOptimizationTime());
+      codeGen.push_back(method->GetCodeGenTime());
+      total.push_back(method->GetCompileTime());
+      codeSize = method->GetCompiledCodeSize();
+      delete method;
+      }
+   reclaimRetiredCode();
+
+   bool correct = b.check(entry);
+
+   std::vector<int64_t> compiled, baseline;
+   for (int32_t r = 0; r < numRuns; r++)
+      {
+      int64_t start = nanoTime();
+      for (int32_t i = 0; i < b.callsPerRun; i++)
+         b.run(entry);
+      compiled.push_back((nanoTime() - start) / b.callsPerRun);
+
+      start = nanoTime();
+      for (int32_t i = 0; i < b.callsPerRun; i++)
+         b.runBaseline();
+      baseline.push_back((nanoTime() - start) / b.callsPerRun);
+      }
+
+   printf("{\"benchmark\":\"%s\",\"correct\":%s,\"compilations\":%d,\"compile_usec\":{",
+          b.name, correct ? "true" : "false", numCompiles);
+   printPhase("ilgen", ilGen, false);
+   printPhase("optimization", optimization, false);
+   printPhase("codegen", codeGen, false);
+   printPhase("total", total, true);
+   printf("},\"code_size\":%d,\"runs\":%d,\"run_nsec\":{", codeSize, numRuns);
+   printTimes("jit", compiled, false);
+   printTimes("c", baseline, true);
+   printf("}}\n");
+   fflush(stdout);
+
+   if (!correct)
+      cerr << "FAIL: compiled " << b.name << " differs from its C baseline\n";
+   return correct;
+   }
+
+// each thread compiles every kernel numCompiles times, keeping no code
+static bool
+compileKernels(OMR::JitBuilder::TypeDictionary *types, int32_t numCompiles)
+   {
+   bool compiled = true;
+   for (int32_t c = 0; c < numCompiles; c++)
+      for (size_t b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++)
+         {
+         OMR::JitBuilder::MethodBuilder *method = benchmarks[b].create(types);
+         void *entry = NULL;
+         if (compileMethodBuilder(method, &entry) == 0)
+            retireCompiledCode(entry);
+         else
+            compiled = false;
+         delete method;
+         }
+   return compiled;
+   }
+
+static int64_t
+timeCompileKernels(int32_t numThreads, int32_t numCompiles, bool &compiled)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   std::vector<std::thread> threads;
+   std::vector<char> threadCompiled(numThreads, true);
+
+   int64_t start = nanoTime();
+   for (int32_t t = 0; t < numThreads; t++)
+      threads.push_back(std::thread([&types, &threadCompiled, numCompiles, t]()
+         {
+         threadCompiled[t] = compileKernels(&types, numCompiles);
+         }));
+   for (int32_t t = 0; t < numThreads; t++)
+      threads[t].join();
+   int64_t elapsed = nanoTime() - start;
+
+   reclaimRetiredCode();
+   for (int32_t t = 0; t < numThreads; t++)
+      compiled = compiled && threadCompiled[t];
+   return elapsed / 1000;
+   }
+
+static bool
+runParallelCompiles(int32_t numThreads, int32_t numCompiles)
+   {
+   bool compiled = true;
+   int64_t oneThread = timeCompileKernels(1, numThreads * numCompiles, compiled);
+   int64_t allThreads = timeCompileKernels(numThreads, numCompiles, compiled);
+
+   printf("{\"parallel_compile\":{\"methods\":%d,\"threads\":%d,\"usec_one_thread\":%lld,\"usec\":%lld,\"speedup\":%.2f}}\n",
+          (int32_t)(numThreads * numCompiles * (sizeof(benchmarks) / sizeof(benchmarks[0]))),
+          numThreads,
+          (long long)oneThread,
+          (long long)allThreads,
+          allThreads > 0 ? (double)oneThread / allThreads : 0.0);
+   fflush(stdout);
+
+   if (!compiled)
+      cerr << "FAIL: compilation error while compiling in parallel\n";
+   return compiled;
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   int32_t numCompiles = 5;
+   int32_t numRuns = 101;
+   int32_t numThreads = std::max(2, (int32_t)std::thread::hardware_concurrency());
+   if (argc > 1)
+      numCompiles = atoi(argv[1]);
+   if (argc > 2)
+      numRuns = atoi(argv[2]);
+   if (argc > 3)
+      numThreads = atoi(argv[3]);
+   if (numCompiles < 1 || numRuns < 1 || numThreads < 1)
+      {
+      cerr << "usage: " << argv[0] << " [compilations [runs [threads]]]\n";
+      exit(-1);
+      }
+
+   bool initialized = initializeJit();
+   if (!initialized)
+      {
+      cerr << "FAIL: could not initialize JIT\n";
+      exit(-1);
+      }
+
+   initData();
+
+   bool allCorrect = true;
+   for (size_t b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++)
+      allCorrect = runBenchmark(benchmarks[b], numCompiles, numRuns) && allCorrect;
+   allCorrect = runParallelCompiles(numThreads, numCompiles) && allCorrect;
+
+   shutdownJit();
+
+   return allCorrect ? 0 : -1;
+   }
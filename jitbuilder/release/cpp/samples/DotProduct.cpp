@@ -52,8 +52,9 @@ static void printPointer(int64_t val)
    printf("%llx", val);
    }
 
-DotProduct::DotProduct(OMR::JitBuilder::TypeDictionary *types)
-   : OMR::JitBuilder::MethodBuilder(types)
+DotProduct::DotProduct(OMR::JitBuilder::TypeDictionary *types, bool printParameters)
+   : OMR::JitBuilder::MethodBuilder(types),
+   _printParameters(printParameters)
 
    {
    DefineLine(LINETOSTR(__LINE__));
@@ -110,22 +111,25 @@ DotProduct::PrintString(IlBuilder *bldr, const char *s)
 bool
 DotProduct::buildIL()
    {
-   PrintString(this, "dotproduct parameters:\n");
-
-   PrintString(this, "   result is ");
-   Call("printPointer", 1,
-      Load("result"));
-   PrintString(this, "\n");
-
-   PrintString(this, "   vector1 is ");
-   Call("printPointer", 1,
-      Load("vector1"));
-   PrintString(this, "\n");
-
-   PrintString(this, "   vector2 is ");
-   Call("printPointer", 1,
-      Load("vector2"));
-   PrintString(this, "\n");
+   if (_printParameters)
+      {
+      PrintString(this, "dotproduct parameters:\n");
+
+      PrintString(this, "   result is ");
+      Call("printPointer", 1,
+         Load("result"));
+      PrintString(this, "\n");
+
+      PrintString(this, "   vector1 is ");
+      Call("printPointer", 1,
+         Load("vector1"));
+      PrintString(this, "\n");
+
+      PrintString(this, "   vector2 is ");
+      Call("printPointer", 1,
+         Load("vector2"));
+      PrintString(this, "\n");
+      }
 
    IlBuilder *loop = NULL;
    ForLoopUp("i", &loop,
@@ -153,6 +157,8 @@ DotProduct::buildIL()
    }
 
 
+#if !defined(SAMPLE_WITHOUT_MAIN)
+
 int
 main(int argc, char *argv[])
    {
@@ -196,3 +202,5 @@ main(int argc, char *argv[])
 
    printf("PASS\n");
    }
+
+#endif // !defined(SAMPLE_WITHOUT_MAIN)
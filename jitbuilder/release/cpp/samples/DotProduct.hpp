@@ -34,9 +34,10 @@ class DotProduct : public OMR::JitBuilder::MethodBuilder
 
    void PrintString (IlBuilder *bldr, const char *s);
    OMR::JitBuilder::IlType *pDouble;
+   bool _printParameters;
 
    public:
-   DotProduct(OMR::JitBuilder::TypeDictionary *);
+   DotProduct(OMR::JitBuilder::TypeDictionary *, bool printParameters = true);
    virtual bool buildIL();
    };
 
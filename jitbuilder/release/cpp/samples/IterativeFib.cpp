@@ -79,6 +79,8 @@ IterativeFibonnaciMethod::buildIL()
    }
 
 
+#if !defined(SAMPLE_WITHOUT_MAIN)
+
 int
 main(int argc, char *argv[])
    {
@@ -113,3 +115,5 @@ main(int argc, char *argv[])
 
    printf("PASS\n");
    }
+
+#endif // !defined(SAMPLE_WITHOUT_MAIN)
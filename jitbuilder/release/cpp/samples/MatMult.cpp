@@ -270,6 +270,8 @@ VectorMatMult::buildIL()
    }
 
 
+#if !defined(SAMPLE_WITHOUT_MAIN)
+
 void
 printMatrix(double *M, int32_t N, const char *name)
    {
@@ -353,3 +355,5 @@ main(int argc, char *argv[])
 
    printf("PASS\n");
    }
+
+#endif // !defined(SAMPLE_WITHOUT_MAIN)
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <iostream>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "OperandStackCommits.hpp"
+
+using std::cout;
+using std::cerr;
+
+#define TOSTR(x)     #x
+#define LINETOSTR(x) TOSTR(x)
+
+int64_t *OperandStackCommitsMethod::_realStack = NULL;
+int64_t *OperandStackCommitsMethod::_realStackTop = NULL;
+
+// the helpers read the operand stack the way an interpreter would: from memory, through the stack pointer
+int64_t
+OperandStackCommitsMethod::top()
+   {
+   return *_realStackTop;
+   }
+
+int64_t
+OperandStackCommitsMethod::sumStack()
+   {
+   int64_t sum = 0;
+   for (int64_t *p = _realStackTop; p > _realStackTop - DEPTH; p--)
+      sum += *p;
+   return sum;
+   }
+
+static const char *
+methodName(OperandStackCommitsMethod::CommitMode mode)
+   {
+   switch (mode)
+      {
+      case OperandStackCommitsMethod::CommitElided: return "stackCommitsElided";
+      case OperandStackCommitsMethod::CommitLive:   return "stackCommitsLive";
+      default:                                      return "stackCommits";
+      }
+   }
+
+OperandStackCommitsMethod::OperandStackCommitsMethod(OMR::JitBuilder::TypeDictionary *d, CommitMode mode)
+   : OMR::JitBuilder::MethodBuilder(d),
+   _mode(mode)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName(methodName(mode));
+   DefineParameter("n", Int32);
+   DefineReturnType(Int64);
+
+   DefineFunction((char *)"top",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  (void *)&OperandStackCommitsMethod::top,
+                  Int64,
+                  0);
+
+   DefineFunction((char *)"sumStack",
+                  (char *)__FILE__,
+                  (char *)LINETOSTR(__LINE__),
+                  (void *)&OperandStackCommitsMethod::sumStack,
+                  Int64,
+                  0);
+   }
+
+bool
+OperandStackCommitsMethod::buildIL()
+   {
+   OMR::JitBuilder::IlType *pInt64 = typeDictionary()->PointerTo(Int64);
+   OMR::JitBuilder::VirtualMachineRegister *stackTop = new OMR::JitBuilder::VirtualMachineRegister(this, "SP", typeDictionary()->PointerTo(pInt64), sizeof(int64_t), ConstAddress(&_realStackTop));
+   OMR::JitBuilder::VirtualMachineOperandStack *stack = new OMR::JitBuilder::VirtualMachineOperandStack(this, DEPTH + 1, Int64, stackTop);
+   stack->SetCommitElision(_mode != CommitAll);
+
+   for (int32_t d = 0; d < DEPTH; d++)
+      stack->Push(this, ConstInt64(d + 1));
+
+   Store("sum", ConstInt64(0));
+
+   // each iteration models a run of call bytecodes: every call pushes its argument,
+   // commits the operand stack for the helper to read, and pops its argument again;
+   // the helper only reads its argument, so that is the only value live across the call
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+             ConstInt32(0),
+             Load("n"),
+             ConstInt32(1));
+      {
+      OMR::JitBuilder::IlValue *base = loop->Mul(
+                                       loop->   ConvertTo(Int64, loop->Load("i")),
+                                       loop->   ConstInt64(CALLS));
+      for (int32_t c = 0; c < CALLS; c++)
+         {
+         stack->Push(loop, loop->Add(base, loop->ConstInt64(c)));
+         if (_mode == CommitLive)
+            stack->CommitTop(loop, 1);
+         else
+            stack->Commit(loop);
+         stackTop->Commit(loop);
+         loop->Store("sum",
+         loop->   Add(
+                     loop->Load("sum"),
+                     loop->Call("top", 0)));
+         stack->Drop(loop, 1);
+         }
+      }
+
+   // leaving compiled code, the whole operand stack is materialized
+   stack->Commit(this);
+   stackTop->Commit(this);
+   Return(
+      Add(
+         Load("sum"),
+         Call("sumStack", 0)));
+
+   return true;
+   }
+
+static double
+timeMethod(OperandStackCommitsFunctionType *f, int32_t n, int32_t reps, int64_t expected, bool *correct)
+   {
+   double best = -1;
+   for (int32_t r = 0; r < reps; r++)
+      {
+      OperandStackCommitsMethod::_realStackTop = OperandStackCommitsMethod::_realStack - 1;
+
+      struct timespec start, end;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      int64_t result = f(n);
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      if (result != expected)
+         *correct = false;
+
+      double ms = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+      if (best < 0 || ms < best)
+         best = ms;
+      }
+   return best;
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   int32_t n = 1000000;
+   if (argc == 2)
+      n = atoi(argv[1]);
+
+   cout << "Step 1: initialize JIT\n";
+   bool initialized = initializeJit();
+   if (!initialized)
+      {
+      cerr << "FAIL: could not initialize JIT\n";
+      exit(-1);
+      }
+
+   cout << "Step 2: compile method that commits the whole operand stack\n";
+   OMR::JitBuilder::TypeDictionary types;
+   OperandStackCommitsMethod fullMethod(&types, OperandStackCommitsMethod::CommitAll);
+   void *fullEntry = 0;
+   int32_t rc = compileMethodBuilder(&fullMethod, &fullEntry);
+   if (rc != 0)
+      {
+      cerr << "FAIL: compilation error " << rc << "\n";
+      exit(-2);
+      }
+
+   cout << "Step 3: compile method that elides commits of values already on the stack\n";
+   OperandStackCommitsMethod elidedMethod(&types, OperandStackCommitsMethod::CommitElided);
+   void *elidedEntry = 0;
+   rc = compileMethodBuilder(&elidedMethod, &elidedEntry);
+   if (rc != 0)
+      {
+      cerr << "FAIL: compilation error " << rc << "\n";
+      exit(-2);
+      }
+
+   cout << "Step 4: compile method that commits only the values live across each call\n";
+   OperandStackCommitsMethod liveMethod(&types, OperandStackCommitsMethod::CommitLive);
+   void *liveEntry = 0;
+   rc = compileMethodBuilder(&liveMethod, &liveEntry);
+   if (rc != 0)
+      {
+      cerr << "FAIL: compilation error " << rc << "\n";
+      exit(-2);
+      }
+
+   cout << "Step 5: invoke compiled code and compare\n";
+   const int32_t DEPTH = OperandStackCommitsMethod::DEPTH;
+   const int32_t CALLS = OperandStackCommitsMethod::CALLS;
+   int64_t expected = DEPTH * (DEPTH + 1) / 2;
+   for (int64_t i = 0; i < n; i++)
+      for (int64_t c = 0; c < CALLS; c++)
+         expected += i * CALLS + c;
+
+   int64_t stack[DEPTH + 1];
+   OperandStackCommitsMethod::_realStack = stack;
+
+   bool correct = true;
+   double fullTime = timeMethod((OperandStackCommitsFunctionType *)fullEntry, n, 5, expected, &correct);
+   double elidedTime = timeMethod((OperandStackCommitsFunctionType *)elidedEntry, n, 5, expected, &correct);
+   double liveTime = timeMethod((OperandStackCommitsFunctionType *)liveEntry, n, 5, expected, &correct);
+
+   cout << "stores per iteration without elision: " << CALLS * (DEPTH + 1) << "\n";
+   cout << "stores per iteration with elision:    " << DEPTH + CALLS << "\n";
+   cout << "stores per iteration live only:       " << CALLS << "\n";
+   cout << "best time without elision: " << fullTime << " ms\n";
+   cout << "best time with elision:    " << elidedTime << " ms\n";
+   cout << "best time live only:       " << liveTime << " ms\n";
+
+   cout << "Step 6: shutdown JIT\n";
+   shutdownJit();
+
+   if (!correct)
+      {
+      cout << "FAIL: result differs from " << expected << "\n";
+      return -1;
+      }
+
+   cout << "PASS\n";
+   return 0;
+   }
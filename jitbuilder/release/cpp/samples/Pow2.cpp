@@ -85,6 +85,8 @@ Pow2Method::buildIL()
    }
 
 
+#if !defined(SAMPLE_WITHOUT_MAIN)
+
 int
 main(int argc, char *argv[])
    {
@@ -123,3 +125,5 @@ main(int argc, char *argv[])
 
    printf("PASS\n");
    }
+
+#endif // !defined(SAMPLE_WITHOUT_MAIN)
@@ -188,6 +188,31 @@ OMR_MethodDictionary::insert(OMR_MethodDictionaryEntry *entry)
 	return rc;
 }
 
+/**
+ * Copy the first property of a method, its name, without removing the method's entry as
+ * getEntries() does.
+ *
+ * @return true if the method is in the dictionary and has a name, false otherwise.
+ */
+bool
+OMR_MethodDictionary::getMethodName(const void *key, char *buffer, size_t bufferSize)
+{
+	bool found = false;
+
+	if ((0 < _numProperties) && (0 == omrthread_monitor_enter(_lock))) {
+		OMR_MethodDictionaryEntry searchEntryHdr;
+		searchEntryHdr.key = key;
+		OMR_MethodDictionaryEntry *entry = (OMR_MethodDictionaryEntry *)hashTableFind(_hashTable, &searchEntryHdr);
+		if ((NULL != entry) && (NULL != entry->propertyValues[0])) {
+			strncpy(buffer, entry->propertyValues[0], bufferSize - 1);
+			buffer[bufferSize - 1] = '\0';
+			found = true;
+		}
+		omrthread_monitor_exit(_lock);
+	}
+	return found;
+}
+
 omr_error_t
 OMR_MethodDictionary::getEntries(OMR_VMThread *vmThread, void **methodArray, size_t methodArrayCount,
 	OMR_SampledMethodDescription *methodDescriptions, char *nameBuffer, size_t nameBytes,
@@ -57,6 +57,7 @@ public:
 		OMR_SampledMethodDescription *methodDescriptions, char *nameBuffer, size_t nameBytes,
 		size_t *firstRetryMethod, size_t *nameBytesRemaining);
 	void getProperties(size_t *numProperties, const char *const **propertyNames, size_t *sizeofSampledMethodDesc) const;
+	bool getMethodName(const void *key, char *buffer, size_t bufferSize);
 	void print();
 
 protected:
@@ -21,22 +21,43 @@
  *******************************************************************************/
 
 #include "omrprofiler.h"
+#if defined(OMR_RAS_SAMPLER)
+#include "OMR_Sampler.hpp"
+#endif /* OMR_RAS_SAMPLER */
 #include "ut_omrti.h"
 
 void
 omr_ras_sampleStackTraceStart(OMR_VMThread *omrVMThread, const void *methodKey)
 {
 	Trc_OMRPROF_MethodSampleStart(omrVMThread, methodKey);
+#if defined(OMR_RAS_SAMPLER)
+	OMR_Sampler::recordFrame(omrVMThread, methodKey, true);
+#endif /* OMR_RAS_SAMPLER */
 }
 
 void
 omr_ras_sampleStackTraceContinue(OMR_VMThread *omrVMThread, const void *methodKey)
 {
 	Trc_OMRPROF_MethodSampleContinue(omrVMThread, methodKey);
+#if defined(OMR_RAS_SAMPLER)
+	OMR_Sampler::recordFrame(omrVMThread, methodKey, false);
+#endif /* OMR_RAS_SAMPLER */
+}
+
+void
+omr_ras_sampleStackTraceEnd(OMR_VMThread *omrVMThread)
+{
+#if defined(OMR_RAS_SAMPLER)
+	OMR_Sampler::endSample(omrVMThread);
+#endif /* OMR_RAS_SAMPLER */
 }
 
 BOOLEAN
 omr_ras_sampleStackEnabled(void)
 {
+#if defined(OMR_RAS_SAMPLER)
+	return (TrcEnabled_Trc_OMRPROF_MethodSampleStart || TrcEnabled_Trc_OMRPROF_MethodSampleContinue || OMR_Sampler::isActive());
+#else /* OMR_RAS_SAMPLER */
 	return (TrcEnabled_Trc_OMRPROF_MethodSampleStart || TrcEnabled_Trc_OMRPROF_MethodSampleContinue);
+#endif /* OMR_RAS_SAMPLER */
 }
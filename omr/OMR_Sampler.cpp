@@ -0,0 +1,689 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include "OMR_Sampler.hpp"
+
+#include <errno.h>
+#include <string.h>
+#if defined(LINUX)
+#include <pthread.h>
+#include <signal.h>
+#endif /* defined(LINUX) */
+
+#include "AtomicSupport.hpp"
+#include "OMR_MethodDictionary.hpp"
+#include "omrformatconsts.h"
+#include "ut_omrti.h"
+
+#if defined(OMR_RAS_SAMPLER)
+
+#if defined(LINUX) && !defined(sigev_notify_thread_id)
+#define sigev_notify_thread_id _sigev_un._tid
+#endif /* defined(LINUX) && !defined(sigev_notify_thread_id) */
+
+#define OMR_SAMPLER_MAX_NAME_LENGTH 256
+
+typedef struct OMR_SampledStack {
+	uintptr_t hash;
+	uintptr_t depth;
+	uintptr_t count;
+	uintptr_t *frames; /* method keys, top-most frame first */
+} OMR_SampledStack;
+
+typedef struct OMR_CollapsedStackWriter {
+	OMR_VM *vm;
+	OMR_VMThread *vmThread;
+	intptr_t fd;
+	omr_error_t rc;
+} OMR_CollapsedStackWriter;
+
+/* Read by the signal handler and by every sampled frame, so kept outside the sampler */
+static OMR_Sampler * volatile activeSampler = NULL;
+
+#if defined(LINUX)
+static void *previousSignalHandler = NULL;
+
+/* Signal handlers between their check of activeSampler and their last access to it */
+static volatile uintptr_t signalsInFlight = 0;
+
+static void
+samplerSignalHandler(int signal, siginfo_t *sigInfo, void *context)
+{
+	if (SI_TIMER == sigInfo->si_code) {
+		/* Counted before activeSampler is read, so OMR_Sampler::cleanup() can wait for this
+		 * handler before freeing the buffers.
+		 */
+		VM_AtomicSupport::add(&signalsInFlight, 1);
+		VM_AtomicSupport::readWriteBarrier();
+		OMR_Sampler *sampler = activeSampler;
+		if (NULL != sampler) {
+			sampler->requestSample((OMR_SampleBuffer *)sigInfo->si_value.sival_ptr);
+		}
+		VM_AtomicSupport::subtract(&signalsInFlight, 1);
+	} else if ((NULL != previousSignalHandler)
+		&& ((void *)SIG_DFL != previousSignalHandler)
+		&& ((void *)SIG_IGN != previousSignalHandler)
+	) {
+		((void (*)(int, siginfo_t *, void *))previousSignalHandler)(signal, sigInfo, context);
+	}
+}
+#endif /* defined(LINUX) */
+
+omr_error_t
+omr_ras_startSampler(OMR_VM *vm, uint32_t intervalMicros, size_t framesPerThread)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+#if defined(LINUX)
+	if ((0 == intervalMicros) || (0 == framesPerThread)) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if (NULL != vm->_sampler) {
+		/* Already started */
+	} else if (NULL != activeSampler) {
+		/* SIGPROF is shared by the whole process, so only one VM can be sampled at a time */
+		rc = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+		OMRPORT_ACCESS_FROM_OMRVM(vm);
+		OMR_Sampler *sampler = (OMR_Sampler *)omrmem_allocate_memory(sizeof(*sampler), OMRMEM_CATEGORY_OMRTI);
+		if (NULL != sampler) {
+			rc = sampler->init(vm, intervalMicros, framesPerThread);
+			if (OMR_ERROR_NONE != rc) {
+				omrmem_free_memory(sampler);
+			}
+		} else {
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+	}
+#else /* defined(LINUX) */
+	rc = OMR_ERROR_NOT_AVAILABLE;
+#endif /* defined(LINUX) */
+	return rc;
+}
+
+void
+omr_ras_stopSampler(OMR_VM *vm)
+{
+	if (NULL != vm->_sampler) {
+		OMRPORT_ACCESS_FROM_OMRVM(vm);
+		OMR_Sampler *sampler = (OMR_Sampler *)vm->_sampler;
+		sampler->cleanup();
+		omrmem_free_memory(sampler);
+	}
+}
+
+omr_error_t
+omr_ras_writeCollapsedStacks(OMR_VMThread *vmThread, const char *fileName)
+{
+	omr_error_t rc = OMR_ERROR_NOT_AVAILABLE;
+	OMR_VM *vm = vmThread->_vm;
+	if (NULL != vm->_sampler) {
+		rc = ((OMR_Sampler *)vm->_sampler)->writeCollapsedStacks(vmThread, fileName);
+	}
+	return rc;
+}
+
+omr_error_t
+omr_ras_samplerAttachThread(OMR_VMThread *vmThread)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	OMR_VM *vm = vmThread->_vm;
+	if (NULL != vm->_sampler) {
+		rc = ((OMR_Sampler *)vm->_sampler)->attachThread(vmThread);
+	}
+	return rc;
+}
+
+void
+omr_ras_samplerDetachThread(OMR_VMThread *vmThread)
+{
+	OMR_VM *vm = vmThread->_vm;
+	if (NULL != vm->_sampler) {
+		((OMR_Sampler *)vm->_sampler)->detachThread(vmThread);
+	}
+}
+
+omr_error_t
+OMR_Sampler::init(OMR_VM *vm, uint32_t intervalMicros, size_t framesPerThread)
+{
+	_vm = vm;
+	_lock = NULL;
+	_stacks = NULL;
+	_buffers = NULL;
+	_intervalMicros = intervalMicros;
+	_samplesAggregated = 0;
+	_samplesDropped = 0;
+	_scratch = NULL;
+	_oldSignalHandler = NULL;
+	_signalHandlerInstalled = false;
+
+	/* Room for the depth word of every sample too, rounded up so positions wrap with a mask */
+	_capacity = 1;
+	while (_capacity < framesPerThread + (framesPerThread / 8) + 1) {
+		_capacity <<= 1;
+	}
+
+	omr_error_t rc = OMR_ERROR_NONE;
+	omrthread_t self = NULL;
+	if (0 == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT)) {
+		OMRPORT_ACCESS_FROM_OMRVM(vm);
+		_stacks = hashTableNew(
+			OMRPORTLIB, OMR_GET_CALLSITE(), 0, sizeof(OMR_SampledStack), 0, 0, OMRMEM_CATEGORY_OMRTI,
+			stackHash, stackEquals, NULL, NULL);
+		_scratch = (uintptr_t *)omrmem_allocate_memory(_capacity * sizeof(uintptr_t), OMRMEM_CATEGORY_OMRTI);
+		if ((NULL == _stacks) || (NULL == _scratch)) {
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		} else if (0 != omrthread_monitor_init_with_name(&_lock, 0, "omrVM->_sampler")) {
+			rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
+		}
+
+#if defined(LINUX)
+		if (OMR_ERROR_NONE == rc) {
+			if (0 == omrsig_register_os_handler(OMRPORT_SIG_FLAG_SIGPROF, (void *)samplerSignalHandler, &_oldSignalHandler)) {
+				previousSignalHandler = _oldSignalHandler;
+				_signalHandlerInstalled = true;
+			} else {
+				rc = OMR_ERROR_NOT_AVAILABLE;
+			}
+		}
+#endif /* defined(LINUX) */
+
+		if (OMR_ERROR_NONE == rc) {
+			/* Threads attaching from now on add their own buffers, see OMR_VM.cpp */
+			omrthread_monitor_enter(vm->_vmThreadListMutex);
+			vm->_sampler = this;
+			OMR_VMThread *walkThread = vm->_vmThreadList;
+			if (NULL != walkThread) {
+				do {
+					rc = attachThread(walkThread);
+					walkThread = walkThread->_linkNext;
+				} while ((OMR_ERROR_NONE == rc) && (walkThread != vm->_vmThreadList));
+			}
+			if (OMR_ERROR_NONE != rc) {
+				vm->_sampler = NULL;
+			}
+			omrthread_monitor_exit(vm->_vmThreadListMutex);
+		}
+
+		if (OMR_ERROR_NONE == rc) {
+			VM_AtomicSupport::writeBarrier();
+			activeSampler = this;
+			Trc_OMRPROF_samplerStarted(intervalMicros, (uint32_t)framesPerThread);
+		} else {
+			cleanup();
+		}
+		omrthread_detach(self);
+	} else {
+		rc = OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD;
+	}
+	return rc;
+}
+
+void
+OMR_Sampler::cleanup()
+{
+	if (NULL != _vm) {
+		omrthread_t self = NULL;
+		if (0 == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT)) {
+			OMRPORT_ACCESS_FROM_OMRVM(_vm);
+
+			omrthread_monitor_enter(_vm->_vmThreadListMutex);
+			if (this == _vm->_sampler) {
+				_vm->_sampler = NULL;
+			}
+			omrthread_monitor_exit(_vm->_vmThreadListMutex);
+
+			/* No timer signal requests a sample from here on.  One already delivered may still
+			 * be using a buffer, and one generated before its timer was deleted may still be
+			 * pending, so the buffers are only freed once no handler has seen the sampler.
+			 */
+			if (this == activeSampler) {
+				activeSampler = NULL;
+			}
+			VM_AtomicSupport::readWriteBarrier();
+			OMR_SampleBuffer *buffer = _buffers;
+			for (; NULL != buffer; buffer = buffer->next) {
+				stopTimer(buffer);
+			}
+#if defined(LINUX)
+			while (0 != signalsInFlight) {
+				omrthread_yield();
+			}
+			VM_AtomicSupport::readBarrier();
+#endif /* defined(LINUX) */
+
+			buffer = _buffers;
+			while (NULL != buffer) {
+				OMR_SampleBuffer *next = buffer->next;
+				OMR_VMThread *vmThread = buffer->vmThread;
+				if (NULL != vmThread) {
+					_samplesDropped += buffer->droppedSamples;
+					vmThread->_sampleBuffer = NULL;
+				}
+				omrmem_free_memory(buffer);
+				buffer = next;
+			}
+			_buffers = NULL;
+
+#if defined(LINUX)
+			if (_signalHandlerInstalled) {
+				omrsig_register_os_handler(OMRPORT_SIG_FLAG_SIGPROF, _oldSignalHandler, NULL);
+				previousSignalHandler = NULL;
+				_signalHandlerInstalled = false;
+			}
+#endif /* defined(LINUX) */
+
+			Trc_OMRPROF_samplerStopped((uint32_t)_samplesAggregated, (uint32_t)_samplesDropped);
+
+			if (NULL != _stacks) {
+				hashTableForEachDo(_stacks, OMR_Sampler::freeStack, this);
+				hashTableFree(_stacks);
+				_stacks = NULL;
+			}
+			if (NULL != _scratch) {
+				omrmem_free_memory(_scratch);
+				_scratch = NULL;
+			}
+			if (NULL != _lock) {
+				omrthread_monitor_destroy(_lock);
+				_lock = NULL;
+			}
+			_vm = NULL;
+			omrthread_detach(self);
+		}
+	}
+}
+
+OMR_SampleBuffer *
+OMR_Sampler::allocateBuffer()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_vm);
+	OMR_SampleBuffer *buffer = NULL;
+
+	/* Reuse the buffer of a thread that has detached once all of its samples are aggregated */
+	for (OMR_SampleBuffer *walk = _buffers; NULL != walk; walk = walk->next) {
+		if ((NULL == walk->vmThread) && (walk->head == walk->tail)) {
+			_samplesDropped += walk->droppedSamples;
+			buffer = walk;
+			break;
+		}
+	}
+
+	if (NULL == buffer) {
+		buffer = (OMR_SampleBuffer *)omrmem_allocate_memory(
+			offsetof(OMR_SampleBuffer, slots) + (_capacity * sizeof(uintptr_t)), OMRMEM_CATEGORY_OMRTI);
+		if (NULL != buffer) {
+			buffer->head = 0;
+			buffer->tail = 0;
+			buffer->capacity = _capacity;
+			buffer->vmThread = NULL;
+			buffer->next = _buffers;
+			/* The signal handler walks the list without the lock */
+			VM_AtomicSupport::writeBarrier();
+			_buffers = buffer;
+		}
+	}
+
+	if (NULL != buffer) {
+		buffer->cursor = buffer->head;
+		buffer->depth = 0;
+		buffer->recording = false;
+		buffer->overflowed = false;
+		buffer->droppedSamples = 0;
+		buffer->vmThread = NULL;
+#if defined(LINUX)
+		buffer->timerCreated = false;
+#endif /* defined(LINUX) */
+	}
+	return buffer;
+}
+
+omr_error_t
+OMR_Sampler::attachThread(OMR_VMThread *vmThread)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	omrthread_monitor_enter(_lock);
+	OMR_SampleBuffer *buffer = allocateBuffer();
+	if (NULL != buffer) {
+		buffer->vmThread = vmThread;
+		rc = startTimer(buffer);
+		if (OMR_ERROR_NONE == rc) {
+			vmThread->_sampleBuffer = buffer;
+		} else {
+			buffer->vmThread = NULL;
+		}
+	} else {
+		rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	omrthread_monitor_exit(_lock);
+
+	return rc;
+}
+
+void
+OMR_Sampler::detachThread(OMR_VMThread *vmThread)
+{
+	omrthread_monitor_enter(_lock);
+	OMR_SampleBuffer *buffer = (OMR_SampleBuffer *)vmThread->_sampleBuffer;
+	if (NULL != buffer) {
+		/* A timer signal still pending for the thread finds no thread to ask for a sample */
+		buffer->vmThread = NULL;
+		VM_AtomicSupport::writeBarrier();
+		stopTimer(buffer);
+		vmThread->_sampleBuffer = NULL;
+
+		/* The samples of the thread are kept; the buffer is reused once they are aggregated */
+		drain(buffer);
+	}
+	omrthread_monitor_exit(_lock);
+}
+
+omr_error_t
+OMR_Sampler::startTimer(OMR_SampleBuffer *buffer)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+#if defined(LINUX)
+	/* Each thread is sampled at the given interval of the CPU time it consumes, so idle threads
+	 * cost nothing and busy threads are sampled regardless of how many others are running.
+	 */
+	omrthread_t osThread = buffer->vmThread->_os_thread;
+	clockid_t clockId = 0;
+	int result = pthread_getcpuclockid((pthread_t)omrthread_get_handle(osThread), &clockId);
+	if (0 == result) {
+		struct sigevent event;
+		memset(&event, 0, sizeof(event));
+		event.sigev_notify = SIGEV_THREAD_ID;
+		event.sigev_signo = SIGPROF;
+		event.sigev_value.sival_ptr = buffer;
+		event.sigev_notify_thread_id = (pid_t)omrthread_get_osId(osThread);
+		if (0 == timer_create(clockId, &event, &buffer->timer)) {
+			struct itimerspec interval;
+			interval.it_interval.tv_sec = _intervalMicros / 1000000;
+			interval.it_interval.tv_nsec = (_intervalMicros % 1000000) * 1000;
+			interval.it_value = interval.it_interval;
+			buffer->timerCreated = true;
+			if (0 != timer_settime(buffer->timer, 0, &interval, NULL)) {
+				result = errno;
+			}
+		} else {
+			result = errno;
+		}
+	}
+	if (0 != result) {
+		Trc_OMRPROF_samplerTimerFailed(buffer->vmThread, result);
+		stopTimer(buffer);
+		rc = OMR_ERROR_NOT_AVAILABLE;
+	}
+#endif /* defined(LINUX) */
+	return rc;
+}
+
+void
+OMR_Sampler::stopTimer(OMR_SampleBuffer *buffer)
+{
+#if defined(LINUX)
+	if (buffer->timerCreated) {
+		timer_delete(buffer->timer);
+		buffer->timerCreated = false;
+	}
+#endif /* defined(LINUX) */
+}
+
+bool
+OMR_Sampler::isActive()
+{
+	return NULL != activeSampler;
+}
+
+void
+OMR_Sampler::requestSample(OMR_SampleBuffer *signalledBuffer)
+{
+	/* A signal of a timer deleted by an earlier sampler may arrive late, so the buffer is
+	 * only used if it is one of this sampler's.  Only ask for a sample; the runtime takes it at
+	 * its next check of the backoff counter, where the stack is known to be walkable.
+	 */
+	for (OMR_SampleBuffer *buffer = _buffers; NULL != buffer; buffer = buffer->next) {
+		if (buffer == signalledBuffer) {
+			OMR_VMThread *vmThread = buffer->vmThread;
+			if (NULL != vmThread) {
+				vmThread->_sampleStackBackoff = 0;
+			}
+			break;
+		}
+	}
+}
+
+void
+OMR_Sampler::recordFrame(OMR_VMThread *vmThread, const void *methodKey, bool topMostFrame)
+{
+	OMR_SampleBuffer *buffer = (OMR_SampleBuffer *)vmThread->_sampleBuffer;
+	if (NULL == buffer) {
+		return;
+	}
+	if (topMostFrame) {
+		/* The depth word is filled in when the sample ends */
+		buffer->recording = true;
+		buffer->overflowed = false;
+		buffer->depth = 0;
+		buffer->cursor = buffer->head + 1;
+	}
+	if (buffer->recording && !buffer->overflowed) {
+		if ((buffer->cursor + 1 - buffer->tail) > buffer->capacity) {
+			buffer->overflowed = true;
+		} else {
+			buffer->slots[buffer->cursor & (buffer->capacity - 1)] = (uintptr_t)methodKey;
+			buffer->cursor += 1;
+			buffer->depth += 1;
+		}
+	}
+}
+
+void
+OMR_Sampler::endSample(OMR_VMThread *vmThread)
+{
+	OMR_SampleBuffer *buffer = (OMR_SampleBuffer *)vmThread->_sampleBuffer;
+	if ((NULL != buffer) && buffer->recording) {
+		buffer->recording = false;
+		if (buffer->overflowed) {
+			buffer->droppedSamples += 1;
+		} else {
+			uintptr_t head = buffer->head;
+			buffer->slots[head & (buffer->capacity - 1)] = buffer->depth;
+			/* The frames must be visible before the sampler can see the new head */
+			VM_AtomicSupport::writeBarrier();
+			buffer->head = buffer->cursor;
+		}
+	}
+}
+
+void
+OMR_Sampler::drain(OMR_SampleBuffer *buffer)
+{
+	uintptr_t mask = buffer->capacity - 1;
+	uintptr_t head = buffer->head;
+	VM_AtomicSupport::readBarrier();
+	uintptr_t tail = buffer->tail;
+
+	while (tail != head) {
+		uintptr_t depth = buffer->slots[tail & mask];
+		for (uintptr_t i = 0; i < depth; i++) {
+			_scratch[i] = buffer->slots[(tail + 1 + i) & mask];
+		}
+		if (OMR_ERROR_NONE != addSample(_scratch, depth)) {
+			_samplesDropped += 1;
+		}
+		tail += depth + 1;
+	}
+
+	/* The slots must have been read before the owning thread may overwrite them */
+	VM_AtomicSupport::readWriteBarrier();
+	buffer->tail = tail;
+}
+
+void
+OMR_Sampler::drainAll()
+{
+	for (OMR_SampleBuffer *buffer = _buffers; NULL != buffer; buffer = buffer->next) {
+		drain(buffer);
+	}
+}
+
+omr_error_t
+OMR_Sampler::addSample(uintptr_t *frames, uintptr_t depth)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	OMR_SampledStack search;
+	search.depth = depth;
+	search.frames = frames;
+	search.hash = stackHash(&search, NULL);
+
+	OMR_SampledStack *stack = (OMR_SampledStack *)hashTableFind(_stacks, &search);
+	if (NULL == stack) {
+		OMRPORT_ACCESS_FROM_OMRVM(_vm);
+		search.count = 0;
+		search.frames = (uintptr_t *)omrmem_allocate_memory(depth * sizeof(uintptr_t) + 1, OMRMEM_CATEGORY_OMRTI);
+		if (NULL != search.frames) {
+			memcpy(search.frames, frames, depth * sizeof(uintptr_t));
+			stack = (OMR_SampledStack *)hashTableAdd(_stacks, &search);
+			if (NULL == stack) {
+				omrmem_free_memory(search.frames);
+			}
+		}
+	}
+
+	if (NULL != stack) {
+		stack->count += 1;
+		_samplesAggregated += 1;
+	} else {
+		rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	return rc;
+}
+
+omr_error_t
+OMR_Sampler::writeCollapsedStacks(OMR_VMThread *vmThread, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_vm);
+	OMR_CollapsedStackWriter writer;
+	writer.vm = _vm;
+	writer.vmThread = vmThread;
+	writer.rc = OMR_ERROR_NONE;
+	writer.fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == writer.fd) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	omrthread_monitor_enter(_lock);
+	drainAll();
+	hashTableForEachDo(_stacks, OMR_Sampler::writeStack, &writer);
+	omrthread_monitor_exit(_lock);
+
+	if (0 != omrfile_close(writer.fd)) {
+		writer.rc = OMR_ERROR_INTERNAL;
+	}
+	return writer.rc;
+}
+
+uintptr_t
+OMR_Sampler::stackHash(void *entry, void *userData)
+{
+	OMR_SampledStack *stack = (OMR_SampledStack *)entry;
+	uintptr_t hash = stack->depth;
+	for (uintptr_t i = 0; i < stack->depth; i++) {
+		hash = (hash * 31) ^ (stack->frames[i] >> 3);
+	}
+	return hash;
+}
+
+uintptr_t
+OMR_Sampler::stackEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	OMR_SampledStack *left = (OMR_SampledStack *)leftEntry;
+	OMR_SampledStack *right = (OMR_SampledStack *)rightEntry;
+	return (left->hash == right->hash)
+		&& (left->depth == right->depth)
+		&& (0 == memcmp(left->frames, right->frames, left->depth * sizeof(uintptr_t)));
+}
+
+uintptr_t
+OMR_Sampler::freeStack(void *entry, void *userData)
+{
+	OMR_Sampler *sampler = (OMR_Sampler *)userData;
+	OMRPORT_ACCESS_FROM_OMRVM(sampler->_vm);
+	omrmem_free_memory(((OMR_SampledStack *)entry)->frames);
+	return FALSE; /* don't remove */
+}
+
+uintptr_t
+OMR_Sampler::writeStack(void *entry, void *userData)
+{
+	OMR_SampledStack *stack = (OMR_SampledStack *)entry;
+	OMR_CollapsedStackWriter *writer = (OMR_CollapsedStackWriter *)userData;
+	OMR_MethodDictionary *methodDictionary = (OMR_MethodDictionary *)writer->vm->_methodDictionary;
+	OMRPORT_ACCESS_FROM_OMRVM(writer->vm);
+	char name[OMR_SAMPLER_MAX_NAME_LENGTH];
+
+	/* Collapsed stacks list the frames root first, separated by ';', then the sample count */
+	for (uintptr_t i = stack->depth; i > 0; i--) {
+		const void *methodKey = (const void *)stack->frames[i - 1];
+		if ((NULL == methodDictionary) || !methodDictionary->getMethodName(methodKey, name, sizeof(name))) {
+			omrstr_printf(name, sizeof(name), "%p", methodKey);
+		}
+		for (char *cursor = name; '\0' != *cursor; cursor++) {
+			if ((';' == *cursor) || ('\n' == *cursor)) {
+				*cursor = '_';
+			}
+		}
+		omrfile_printf(writer->fd, "%s%s", name, (1 == i) ? "" : ";");
+	}
+	omrfile_printf(writer->fd, " %" OMR_PRIu64 "\n", (uint64_t)stack->count);
+	return FALSE; /* don't remove */
+}
+
+#else /* defined(OMR_RAS_SAMPLER) */
+
+omr_error_t
+omr_ras_startSampler(OMR_VM *vm, uint32_t intervalMicros, size_t framesPerThread)
+{
+	return OMR_ERROR_NOT_AVAILABLE;
+}
+
+void
+omr_ras_stopSampler(OMR_VM *vm)
+{
+}
+
+omr_error_t
+omr_ras_writeCollapsedStacks(OMR_VMThread *vmThread, const char *fileName)
+{
+	return OMR_ERROR_NOT_AVAILABLE;
+}
+
+omr_error_t
+omr_ras_samplerAttachThread(OMR_VMThread *vmThread)
+{
+	return OMR_ERROR_NONE;
+}
+
+void
+omr_ras_samplerDetachThread(OMR_VMThread *vmThread)
+{
+}
+
+#endif /* defined(OMR_RAS_SAMPLER) */
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#if !defined(OMR_SAMPLER_HPP_INCLUDED)
+#define OMR_SAMPLER_HPP_INCLUDED
+
+#include "omr.h"
+#include "omrprofiler.h"
+#include "hashtable_api.h"
+#include "thread_api.h"
+
+#if defined(LINUX)
+#include <time.h>
+#endif /* defined(LINUX) */
+
+/**
+ * Per-thread ring buffer of sampled stacks.
+ *
+ * A sample is stored as its depth followed by the method keys of its frames,
+ * top-most frame first.  Only the owning thread writes samples; it publishes a
+ * completed sample by advancing head.  Only the sampler advances tail, after it
+ * has aggregated the samples before it, so neither side ever takes a lock.
+ * A sample that does not fit in the space left is dropped.
+ */
+struct OMR_SampleBuffer {
+	volatile uintptr_t head; /* end of the published samples, written by the owning thread */
+	volatile uintptr_t tail; /* start of the samples not yet aggregated, written by the sampler */
+	uintptr_t cursor; /* next slot of the sample being recorded */
+	uintptr_t depth; /* frames in the sample being recorded */
+	bool recording;
+	bool overflowed;
+	volatile uintptr_t droppedSamples;
+	OMR_VMThread * volatile vmThread; /* NULL once the thread has detached */
+#if defined(LINUX)
+	timer_t timer;
+	bool timerCreated;
+#endif /* defined(LINUX) */
+	OMR_SampleBuffer *next;
+	uintptr_t capacity; /* power of two */
+	uintptr_t slots[1];
+};
+
+class OMR_Sampler
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	OMR_VM *_vm;
+	omrthread_monitor_t _lock;
+	J9HashTable *_stacks;
+	OMR_SampleBuffer * volatile _buffers; /* only prepended to, and only freed by cleanup() */
+	uintptr_t _capacity;
+	uint32_t _intervalMicros;
+	uintptr_t _samplesAggregated;
+	uintptr_t _samplesDropped;
+	uintptr_t *_scratch; /* a sample copied out of a ring buffer, capacity slots */
+	void *_oldSignalHandler;
+	bool _signalHandlerInstalled;
+
+/*
+ * Function members
+ */
+public:
+	omr_error_t init(OMR_VM *vm, uint32_t intervalMicros, size_t framesPerThread);
+	void cleanup();
+
+	omr_error_t attachThread(OMR_VMThread *vmThread);
+	void detachThread(OMR_VMThread *vmThread);
+
+	omr_error_t writeCollapsedStacks(OMR_VMThread *vmThread, const char *fileName);
+
+	void requestSample(OMR_SampleBuffer *signalledBuffer);
+
+	static bool isActive();
+	static void recordFrame(OMR_VMThread *vmThread, const void *methodKey, bool topMostFrame);
+	static void endSample(OMR_VMThread *vmThread);
+
+protected:
+
+private:
+	OMR_SampleBuffer *allocateBuffer();
+	omr_error_t startTimer(OMR_SampleBuffer *buffer);
+	void stopTimer(OMR_SampleBuffer *buffer);
+	void drain(OMR_SampleBuffer *buffer);
+	void drainAll();
+	omr_error_t addSample(uintptr_t *frames, uintptr_t depth);
+
+	static uintptr_t stackHash(void *entry, void *userData);
+	static uintptr_t stackEquals(void *leftEntry, void *rightEntry, void *userData);
+	static uintptr_t freeStack(void *entry, void *userData);
+	static uintptr_t writeStack(void *entry, void *userData);
+};
+
+#endif /* defined(OMR_SAMPLER_HPP_INCLUDED) */
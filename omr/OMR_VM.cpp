@@ -29,6 +29,7 @@
 #if defined(OMR_GC)
 #include "mminitcore.h"
 #endif /* OMR_GC */
+#include "omrprofiler.h"
 #include "omrtrace.h"
 #include "ut_omrvm.h"
 #include "omrutil.h"
@@ -98,6 +99,10 @@ attachThread(OMR_VM *vm, OMR_VMThread *vmthread)
 		} else {
 			vm->_languageThreadCount += 1;
 		}
+#if defined(OMR_RAS_SAMPLER)
+		/* A thread that cannot be sampled still runs */
+		omr_ras_samplerAttachThread(vmthread);
+#endif /* OMR_RAS_SAMPLER */
 	} else {
 		rc = OMR_ERROR_MAXIMUM_THREAD_COUNT_EXCEEDED;
 	}
@@ -121,6 +126,9 @@ detachThread(OMR_VM *vm, OMR_VMThread *vmthread)
 		vm->_languageThreadCount -= 1;
 	}
 	J9_LINKED_LIST_REMOVE(vm->_vmThreadList, vmthread);
+#if defined(OMR_RAS_SAMPLER)
+	omr_ras_samplerDetachThread(vmthread);
+#endif /* OMR_RAS_SAMPLER */
 	/* Set the TLS for vmthread, NOT the current thread */
 	omrthread_tls_set(vmthread->_os_thread, vm->_vmThreadKey, NULL);
 	omrthread_monitor_exit(vm->_vmThreadListMutex);
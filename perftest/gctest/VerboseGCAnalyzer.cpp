@@ -0,0 +1,693 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "VerboseGCAnalyzer.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrthread.h"
+
+LatencyHistogram::LatencyHistogram()
+	: _count(0)
+	, _total(0.0)
+	, _minimum(0.0)
+	, _maximum(0.0)
+{
+	memset(_buckets, 0, sizeof(_buckets));
+}
+
+uintptr_t
+LatencyHistogram::bucketOf(uint64_t micros)
+{
+	if (micros < LINEAR_BUCKETS) {
+		return (uintptr_t)micros;
+	}
+
+	uintptr_t highestBit = 6;
+	while ((micros >> (highestBit + 1)) != 0) {
+		highestBit += 1;
+	}
+	if (highestBit >= MAXIMUM_BITS) {
+		return BUCKETS - 1;
+	}
+
+	uintptr_t subBucket = (uintptr_t)(micros >> (highestBit - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+	return LINEAR_BUCKETS + ((highestBit - 6) * SUB_BUCKETS) + subBucket;
+}
+
+double
+LatencyHistogram::bucketMillis(uintptr_t bucket)
+{
+	if (bucket < LINEAR_BUCKETS) {
+		return bucket / 1000.0;
+	}
+
+	/* the middle of the bucket */
+	uintptr_t highestBit = 6 + ((bucket - LINEAR_BUCKETS) / SUB_BUCKETS);
+	uint64_t width = (uint64_t)1 << (highestBit - SUB_BUCKET_BITS);
+	uint64_t low = ((uint64_t)1 << highestBit) + (((bucket - LINEAR_BUCKETS) % SUB_BUCKETS) * width);
+	return (low + (width / 2)) / 1000.0;
+}
+
+void
+LatencyHistogram::add(double millis)
+{
+	if (millis < 0.0) {
+		millis = 0.0;
+	}
+	_buckets[bucketOf((uint64_t)((millis * 1000.0) + 0.5))] += 1;
+	if ((0 == _count) || (millis < _minimum)) {
+		_minimum = millis;
+	}
+	if ((0 == _count) || (millis > _maximum)) {
+		_maximum = millis;
+	}
+	_count += 1;
+	_total += millis;
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram &other)
+{
+	if (0 == other._count) {
+		return;
+	}
+	for (uintptr_t i = 0; i < BUCKETS; i++) {
+		_buckets[i] += other._buckets[i];
+	}
+	if ((0 == _count) || (other._minimum < _minimum)) {
+		_minimum = other._minimum;
+	}
+	if ((0 == _count) || (other._maximum > _maximum)) {
+		_maximum = other._maximum;
+	}
+	_count += other._count;
+	_total += other._total;
+}
+
+double
+LatencyHistogram::percentile(double percent) const
+{
+	if (0 == _count) {
+		return 0.0;
+	}
+
+	uint64_t rank = (uint64_t)((percent / 100.0) * _count);
+	if ((double)rank < ((percent / 100.0) * _count)) {
+		rank += 1;
+	}
+	if (0 == rank) {
+		rank = 1;
+	} else if (rank >= _count) {
+		return _maximum;
+	}
+
+	uint64_t seen = 0;
+	for (uintptr_t i = 0; i < BUCKETS; i++) {
+		seen += _buckets[i];
+		if (seen >= rank) {
+			double value = bucketMillis(i);
+			/* the extremes are known exactly */
+			if (value < _minimum) {
+				value = _minimum;
+			} else if (value > _maximum) {
+				value = _maximum;
+			}
+			return value;
+		}
+	}
+	return _maximum;
+}
+
+void
+HeapTimeline::add(const Sample &sample)
+{
+	if (0 == _pending) {
+		_samples.push_back(sample);
+		if (MAXIMUM_SAMPLES == _samples.size()) {
+			/* keep every other sample, now and from here on */
+			for (uintptr_t i = 1; i < (MAXIMUM_SAMPLES / 2); i++) {
+				_samples[i] = _samples[2 * i];
+			}
+			_samples.resize(MAXIMUM_SAMPLES / 2);
+			_stride *= 2;
+		}
+	}
+	_pending = (_pending + 1) % _stride;
+}
+
+void
+HeapTimeline::append(const HeapTimeline &other)
+{
+	for (std::vector<Sample>::const_iterator it = other._samples.begin(); it != other._samples.end(); ++it) {
+		add(*it);
+	}
+}
+
+LatencyHistogram *
+VerboseGCStatistics::find(LatencyBreakdown *breakdown, const char *type)
+{
+	for (LatencyBreakdown::iterator it = breakdown->begin(); it != breakdown->end(); ++it) {
+		if (it->first == type) {
+			return &it->second;
+		}
+	}
+	breakdown->push_back(std::make_pair(std::string(type), LatencyHistogram()));
+	return &breakdown->back().second;
+}
+
+void
+VerboseGCStatistics::merge(const VerboseGCStatistics &other)
+{
+	stanzas += other.stanzas;
+	pauses.merge(other.pauses);
+	for (LatencyBreakdown::const_iterator it = other.collections.begin(); it != other.collections.end(); ++it) {
+		find(&collections, it->first.c_str())->merge(it->second);
+	}
+	for (LatencyBreakdown::const_iterator it = other.phases.begin(); it != other.phases.end(); ++it) {
+		find(&phases, it->first.c_str())->merge(it->second);
+	}
+	allocatedBytes += other.allocatedBytes;
+	if ((-1 == firstTimestamp) || ((-1 != other.firstTimestamp) && (other.firstTimestamp < firstTimestamp))) {
+		firstTimestamp = other.firstTimestamp;
+	}
+	if (other.lastTimestamp > lastTimestamp) {
+		lastTimestamp = other.lastTimestamp;
+	}
+	timeline.append(other.timeline);
+}
+
+double
+VerboseGCStatistics::allocationRate() const
+{
+	if ((-1 == firstTimestamp) || (lastTimestamp <= firstTimestamp)) {
+		return 0.0;
+	}
+	return (allocatedBytes * 1000.0) / (double)(lastTimestamp - firstTimestamp);
+}
+
+bool
+VerboseGCReader::parseFile(OMRPortLibrary *portLibrary, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+
+	char *chunk = (char *)omrmem_allocate_memory(CHUNK_SIZE, OMRMEM_CATEGORY_MM);
+	bool result = (NULL != chunk);
+	while (result) {
+		intptr_t count = omrfile_read(fd, chunk, CHUNK_SIZE);
+		if (count <= 0) {
+			/* end of file is -1 */
+			break;
+		}
+		parse(chunk, (uintptr_t)count);
+	}
+
+	omrmem_free_memory(chunk);
+	omrfile_close(fd);
+	return result;
+}
+
+void
+VerboseGCReader::parse(const char *data, uintptr_t length)
+{
+	const char *cursor = data;
+	const char *end = data + length;
+
+	while (cursor < end) {
+		if (!_inTag) {
+			const char *open = (const char *)memchr(cursor, '<', end - cursor);
+			if (NULL == open) {
+				break;
+			}
+			_inTag = true;
+			_quote = '\0';
+			_tag.clear();
+			cursor = open + 1;
+			continue;
+		}
+
+		/* copy up to the next character that matters inside a tag */
+		const char *run = cursor;
+		if ('\0' != _quote) {
+			while ((cursor < end) && (_quote != *cursor)) {
+				cursor += 1;
+			}
+		} else {
+			while ((cursor < end) && ('>' != *cursor) && ('"' != *cursor) && ('\'' != *cursor)) {
+				cursor += 1;
+			}
+		}
+		if ((_tag.size() + (cursor - run)) <= MAXIMUM_TAG_LENGTH) {
+			_tag.append(run, cursor - run);
+		} else {
+			/* remember that the tag is incomplete */
+			_tag.assign(1, '\0');
+		}
+		if (cursor == end) {
+			break;
+		}
+
+		char c = *cursor;
+		cursor += 1;
+		bool markup = !_tag.empty() && (('!' == _tag[0]) || ('?' == _tag[0]));
+		if ('\0' != _quote) {
+			_quote = '\0';
+		} else if ('>' != c) {
+			/* quotes only delimit attribute values in elements */
+			if (!markup) {
+				_quote = c;
+			}
+		} else if ((0 == _tag.compare(0, 3, "!--")) && ((_tag.size() < 5) || (0 != _tag.compare(_tag.size() - 2, 2, "--")))) {
+			/* a comment only ends with --> */
+		} else {
+			_inTag = false;
+			processTag();
+			continue;
+		}
+		if (_tag.size() < MAXIMUM_TAG_LENGTH) {
+			_tag.push_back(c);
+		}
+	}
+}
+
+static void
+unescape(char *value)
+{
+	static const struct { const char *entity; char character; } entities[] = {
+		{ "&lt;", '<' }, { "&gt;", '>' }, { "&amp;", '&' }, { "&quot;", '"' }, { "&apos;", '\'' }
+	};
+	char *to = value;
+
+	for (char *from = value; '\0' != *from;) {
+		bool replaced = false;
+		if ('&' == *from) {
+			for (uintptr_t i = 0; i < sizeof(entities) / sizeof(entities[0]); i++) {
+				uintptr_t length = strlen(entities[i].entity);
+				if (0 == strncmp(from, entities[i].entity, length)) {
+					*to++ = entities[i].character;
+					from += length;
+					replaced = true;
+					break;
+				}
+			}
+		}
+		if (!replaced) {
+			*to++ = *from++;
+		}
+	}
+	*to = '\0';
+}
+
+static bool
+isSpace(char c)
+{
+	return (' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c);
+}
+
+void
+VerboseGCReader::processTag()
+{
+	if (_tag.empty() || ('\0' == _tag[0])) {
+		_skippedTags += 1;
+		return;
+	}
+	if (('!' == _tag[0]) || ('?' == _tag[0])) {
+		return;
+	}
+
+	char *cursor = &_tag[0];
+	if ('/' == *cursor) {
+		char *name = cursor + 1;
+		char *nameEnd = name;
+		while (('\0' != *nameEnd) && !isSpace(*nameEnd)) {
+			nameEnd += 1;
+		}
+		*nameEnd = '\0';
+		_handler->endElement(name);
+		return;
+	}
+
+	char *name = cursor;
+	while (('\0' != *cursor) && !isSpace(*cursor) && ('/' != *cursor)) {
+		cursor += 1;
+	}
+	bool selfClosing = false;
+	const char *attributes[2 * MAXIMUM_ATTRIBUTES];
+	uintptr_t attributeCount = 0;
+
+	while (true) {
+		char separator = *cursor;
+		if ('\0' != separator) {
+			*cursor++ = '\0';
+		}
+		while (isSpace(separator) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ('/' == separator) {
+			selfClosing = true;
+			break;
+		}
+		if (('\0' == separator) || ('\0' == *cursor)) {
+			break;
+		}
+		if ('/' == *cursor) {
+			selfClosing = true;
+			break;
+		}
+
+		/* name="value" */
+		char *attribute = cursor;
+		while (('\0' != *cursor) && ('=' != *cursor) && !isSpace(*cursor)) {
+			cursor += 1;
+		}
+		char *attributeEnd = cursor;
+		while (isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ('=' != *cursor) {
+			_skippedTags += 1;
+			return;
+		}
+		cursor += 1;
+		while (isSpace(*cursor)) {
+			cursor += 1;
+		}
+		char quote = *cursor;
+		if (('"' != quote) && ('\'' != quote)) {
+			_skippedTags += 1;
+			return;
+		}
+		char *value = cursor + 1;
+		char *valueEnd = strchr(value, quote);
+		if (NULL == valueEnd) {
+			_skippedTags += 1;
+			return;
+		}
+		*attributeEnd = '\0';
+		cursor = valueEnd + 1;
+		*valueEnd = '\0';
+		unescape(value);
+		if (attributeCount < MAXIMUM_ATTRIBUTES) {
+			attributes[2 * attributeCount] = attribute;
+			attributes[(2 * attributeCount) + 1] = value;
+			attributeCount += 1;
+		}
+		if (!isSpace(*cursor) && ('/' != *cursor) && ('\0' != *cursor)) {
+			_skippedTags += 1;
+			return;
+		}
+	}
+
+	_handler->startElement(name, attributes, attributeCount);
+	if (selfClosing) {
+		_handler->endElement(name);
+	}
+}
+
+static const char *
+findAttribute(const char **attributes, uintptr_t attributeCount, const char *name)
+{
+	for (uintptr_t i = 0; i < attributeCount; i++) {
+		if (0 == strcmp(attributes[2 * i], name)) {
+			return attributes[(2 * i) + 1];
+		}
+	}
+	return NULL;
+}
+
+static double
+doubleAttribute(const char **attributes, uintptr_t attributeCount, const char *name)
+{
+	const char *value = findAttribute(attributes, attributeCount, name);
+	return (NULL == value) ? 0.0 : strtod(value, NULL);
+}
+
+static uint64_t
+integerAttribute(const char **attributes, uintptr_t attributeCount, const char *name)
+{
+	const char *value = findAttribute(attributes, attributeCount, name);
+	return (NULL == value) ? 0 : (uint64_t)strtoull(value, NULL, 0);
+}
+
+int64_t
+VerboseGCAnalyzer::parseTimestamp(const char *timestamp)
+{
+	int year = 0;
+	int month = 0;
+	int day = 0;
+	int hour = 0;
+	int minute = 0;
+	int second = 0;
+	int millis = 0;
+
+	if (7 != sscanf(timestamp, "%4d-%2d-%2dT%2d:%2d:%2d.%3d", &year, &month, &day, &hour, &minute, &second, &millis)) {
+		return -1;
+	}
+
+	/* days since 1970-01-01 in the proleptic Gregorian calendar */
+	int64_t y = year - ((month <= 2) ? 1 : 0);
+	int64_t era = ((y >= 0) ? y : (y - 399)) / 400;
+	int64_t yearOfEra = y - (era * 400);
+	int64_t dayOfYear = (((153 * (month + ((month > 2) ? -3 : 9))) + 2) / 5) + day - 1;
+	int64_t dayOfEra = (yearOfEra * 365) + (yearOfEra / 4) - (yearOfEra / 100) + dayOfYear;
+	int64_t days = (era * 146097) + dayOfEra - 719468;
+
+	return (((((days * 24) + hour) * 60 + minute) * 60 + second) * 1000) + millis;
+}
+
+void
+VerboseGCAnalyzer::startElement(const char *name, const char **attributes, uintptr_t attributeCount)
+{
+	if ((0 == _depth) && (0 == strcmp(name, "verbosegc"))) {
+		_stanzaDepth = 1;
+	} else if (_depth == _stanzaDepth) {
+		_statistics->stanzas += 1;
+		_stanza = name;
+
+		const char *timestamp = findAttribute(attributes, attributeCount, "timestamp");
+		_stanzaTimestamp = (NULL == timestamp) ? -1 : parseTimestamp(timestamp);
+		if (-1 != _stanzaTimestamp) {
+			if ((-1 == _statistics->firstTimestamp) || (_stanzaTimestamp < _statistics->firstTimestamp)) {
+				_statistics->firstTimestamp = _stanzaTimestamp;
+			}
+			if (_stanzaTimestamp > _statistics->lastTimestamp) {
+				_statistics->lastTimestamp = _stanzaTimestamp;
+			}
+		}
+
+		const char *type = findAttribute(attributes, attributeCount, "type");
+		if (0 == strcmp(name, "exclusive-end")) {
+			_statistics->pauses.add(doubleAttribute(attributes, attributeCount, "durationms"));
+		} else if ((0 == strcmp(name, "gc-end")) && (NULL != type)) {
+			VerboseGCStatistics::find(&_statistics->collections, type)->add(doubleAttribute(attributes, attributeCount, "durationms"));
+		} else if ((0 == strcmp(name, "gc-op")) && (NULL != type)) {
+			VerboseGCStatistics::find(&_statistics->phases, type)->add(doubleAttribute(attributes, attributeCount, "timems"));
+		} else if ((0 == strcmp(name, "heap-resize")) && (NULL != type)) {
+			std::string phase("resize-");
+			phase += type;
+			VerboseGCStatistics::find(&_statistics->phases, phase.c_str())->add(doubleAttribute(attributes, attributeCount, "timems"));
+		} else if (0 == strcmp(name, "allocation-stats")) {
+			_statistics->allocatedBytes += integerAttribute(attributes, attributeCount, "totalBytes");
+		}
+	} else if ((_depth == (_stanzaDepth + 1)) && (0 == strcmp(name, "mem-info")) && (("gc-start" == _stanza) || ("gc-end" == _stanza))) {
+		HeapTimeline::Sample sample;
+		uint64_t total = integerAttribute(attributes, attributeCount, "total");
+		uint64_t free = integerAttribute(attributes, attributeCount, "free");
+		sample.timestamp = _stanzaTimestamp;
+		sample.total = total;
+		sample.used = (free < total) ? (total - free) : 0;
+		sample.afterCollection = ("gc-end" == _stanza);
+		_statistics->timeline.add(sample);
+	}
+
+	_depth += 1;
+}
+
+void
+VerboseGCAnalyzer::endElement(const char *name)
+{
+	if (0 != _depth) {
+		_depth -= 1;
+	}
+}
+
+bool
+VerboseGCAnalyzer::analyzeFile(OMRPortLibrary *portLibrary, const char *fileName, VerboseGCStatistics *statistics)
+{
+	VerboseGCAnalyzer analyzer(statistics);
+	VerboseGCReader reader(&analyzer);
+	return reader.parseFile(portLibrary, fileName);
+}
+
+/**
+ * Work shared by the analysis threads.
+ */
+struct AnalysisWork
+{
+	OMRPortLibrary *portLibrary;
+	const std::vector<std::string> *fileNames;
+	std::vector<VerboseGCStatistics> *results;
+	omrthread_monitor_t monitor;
+	uintptr_t nextFile;
+	uintptr_t runningThreads;
+	bool success;
+};
+
+static int J9THREAD_PROC
+analysisThread(void *argument)
+{
+	AnalysisWork *work = (AnalysisWork *)argument;
+
+	omrthread_monitor_enter(work->monitor);
+	while (work->nextFile < work->fileNames->size()) {
+		uintptr_t file = work->nextFile;
+		work->nextFile += 1;
+		omrthread_monitor_exit(work->monitor);
+
+		bool success = VerboseGCAnalyzer::analyzeFile(work->portLibrary, (*work->fileNames)[file].c_str(), &(*work->results)[file]);
+
+		omrthread_monitor_enter(work->monitor);
+		work->success = work->success && success;
+	}
+	work->runningThreads -= 1;
+	omrthread_monitor_notify_all(work->monitor);
+	omrthread_exit(work->monitor);
+	return 0;
+}
+
+bool
+VerboseGCAnalyzer::analyzeFiles(OMRPortLibrary *portLibrary, const std::vector<std::string> &fileNames, uintptr_t threadCount, std::vector<VerboseGCStatistics> *results)
+{
+	AnalysisWork work = { portLibrary, &fileNames, results, NULL, 0, 0, true };
+
+	results->clear();
+	results->resize(fileNames.size());
+	if (threadCount > fileNames.size()) {
+		threadCount = fileNames.size();
+	}
+
+	if ((threadCount > 1) && (0 == omrthread_monitor_init_with_name(&work.monitor, 0, "VerboseGCAnalyzer::analyzeFiles"))) {
+		omrthread_monitor_enter(work.monitor);
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			if (0 == omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, analysisThread, &work)) {
+				work.runningThreads += 1;
+			}
+		}
+		while (0 != work.runningThreads) {
+			omrthread_monitor_wait(work.monitor);
+		}
+		omrthread_monitor_exit(work.monitor);
+		omrthread_monitor_destroy(work.monitor);
+	}
+
+	/* analyze anything left over on this thread */
+	for (; work.nextFile < fileNames.size(); work.nextFile++) {
+		work.success = analyzeFile(portLibrary, fileNames[work.nextFile].c_str(), &(*results)[work.nextFile]) && work.success;
+	}
+
+	return work.success;
+}
+
+static void
+printLatencies(OMRPortLibrary *portLibrary, const char *label, const char *type, const LatencyHistogram &histogram)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char name[64];
+
+	omrstr_printf(name, sizeof(name), "%s%s", label, type);
+	omrtty_printf("%-24s %8llu %12.3f %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+		name, (unsigned long long)histogram.count(), histogram.total(), histogram.mean(),
+		histogram.percentile(50.0), histogram.percentile(90.0), histogram.percentile(99.0), histogram.percentile(99.9),
+		histogram.maximum());
+}
+
+void
+printVerboseGCReport(OMRPortLibrary *portLibrary, const char *title, const VerboseGCStatistics &statistics)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	double seconds = 0.0;
+
+	if ((-1 != statistics.firstTimestamp) && (statistics.lastTimestamp > statistics.firstTimestamp)) {
+		seconds = (statistics.lastTimestamp - statistics.firstTimestamp) / 1000.0;
+	}
+
+	omrtty_printf("\nResults for : %s\n", title);
+	omrtty_printf("%zu stanzas over %.3f s, %llu bytes allocated (%.3f MB/s)\n\n",
+		statistics.stanzas, seconds, (unsigned long long)statistics.allocatedBytes, statistics.allocationRate() / (1024.0 * 1024.0));
+
+	omrtty_printf("%-24s %8s %12s %10s %10s %10s %10s %10s %10s\n", "(ms)", "count", "total", "mean", "p50", "p90", "p99", "p99.9", "max");
+	omrtty_printf("-------------------------------------------------------------------------------------------------------------\n");
+	printLatencies(portLibrary, "pause", "", statistics.pauses);
+	for (LatencyBreakdown::const_iterator it = statistics.collections.begin(); it != statistics.collections.end(); ++it) {
+		printLatencies(portLibrary, "gc ", it->first.c_str(), it->second);
+	}
+	for (LatencyBreakdown::const_iterator it = statistics.phases.begin(); it != statistics.phases.end(); ++it) {
+		printLatencies(portLibrary, "  ", it->first.c_str(), it->second);
+	}
+
+	const std::vector<HeapTimeline::Sample> &samples = statistics.timeline.samples();
+	uint64_t minimumLive = 0;
+	uint64_t maximumLive = 0;
+	uint64_t maximumTotal = 0;
+	bool first = true;
+	for (std::vector<HeapTimeline::Sample>::const_iterator it = samples.begin(); it != samples.end(); ++it) {
+		if (it->total > maximumTotal) {
+			maximumTotal = it->total;
+		}
+		if (it->afterCollection) {
+			if (first || (it->used < minimumLive)) {
+				minimumLive = it->used;
+			}
+			if (first || (it->used > maximumLive)) {
+				maximumLive = it->used;
+			}
+			first = false;
+		}
+	}
+	omrtty_printf("\nHeap occupancy after collection: %llu to %llu bytes, largest heap %llu bytes (%zu timeline samples)\n",
+		(unsigned long long)minimumLive, (unsigned long long)maximumLive, (unsigned long long)maximumTotal, samples.size());
+}
+
+bool
+writeHeapTimeline(OMRPortLibrary *portLibrary, const char *fileName, const VerboseGCStatistics &statistics)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		return false;
+	}
+
+	omrfile_printf(fd, "timestampms,event,usedbytes,totalbytes\n");
+	const std::vector<HeapTimeline::Sample> &samples = statistics.timeline.samples();
+	for (std::vector<HeapTimeline::Sample>::const_iterator it = samples.begin(); it != samples.end(); ++it) {
+		omrfile_printf(fd, "%lld,%s,%llu,%llu\n", (long long)it->timestamp, it->afterCollection ? "gc-end" : "gc-start",
+			(unsigned long long)it->used, (unsigned long long)it->total);
+	}
+
+	omrfile_close(fd);
+	return true;
+}
@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCANALYZER_HPP_)
+#define VERBOSEGCANALYZER_HPP_
+
+#include <string>
+#include <vector>
+
+#include "omrcomp.h"
+#include "omrport.h"
+
+/**
+ * Streaming analysis of verbose GC logs.
+ *
+ * Logs are read in fixed size chunks by a SAX style reader, so memory use does not depend on
+ * the size of a log: durations go into log-linear histograms and the heap occupancy timeline is
+ * thinned out as it grows. Rotated logs are analyzed in parallel and the results merged in order.
+ */
+
+/**
+ * Histogram of durations with a relative error of about 3%, from one microsecond to days.
+ */
+class LatencyHistogram
+{
+public:
+	LatencyHistogram();
+
+	void add(double millis);
+	void merge(const LatencyHistogram &other);
+
+	/**
+	 * @param[in] percent the percentile, between 0 and 100
+	 * @return the duration in milliseconds below which percent of the durations are
+	 */
+	double percentile(double percent) const;
+
+	uint64_t count() const { return _count; }
+	double total() const { return _total; }
+	double minimum() const { return _minimum; }
+	double maximum() const { return _maximum; }
+	double mean() const { return (0 == _count) ? 0.0 : (_total / _count); }
+
+private:
+	enum {
+		LINEAR_BUCKETS = 64, /**< values below this many microseconds are exact */
+		SUB_BUCKET_BITS = 5,
+		SUB_BUCKETS = 1 << SUB_BUCKET_BITS,
+		MAXIMUM_BITS = 48,
+		BUCKETS = LINEAR_BUCKETS + ((MAXIMUM_BITS - 6) * SUB_BUCKETS)
+	};
+
+	static uintptr_t bucketOf(uint64_t micros);
+	static double bucketMillis(uintptr_t bucket);
+
+	uint64_t _buckets[BUCKETS];
+	uint64_t _count;
+	double _total;
+	double _minimum;
+	double _maximum;
+};
+
+/**
+ * Heap occupancy at the start and end of collections, with at most MAXIMUM_SAMPLES samples:
+ * when it is full every other sample is dropped and only every other later one is kept.
+ */
+class HeapTimeline
+{
+public:
+	struct Sample {
+		int64_t timestamp; /**< milliseconds since the epoch */
+		uint64_t used; /**< bytes */
+		uint64_t total; /**< bytes */
+		bool afterCollection;
+	};
+
+	enum { MAXIMUM_SAMPLES = 4096 };
+
+	HeapTimeline() : _stride(1), _pending(0) {}
+
+	void add(const Sample &sample);
+	void append(const HeapTimeline &other);
+	const std::vector<Sample> &samples() const { return _samples; }
+
+private:
+	std::vector<Sample> _samples;
+	uintptr_t _stride; /**< one in this many samples is kept */
+	uintptr_t _pending; /**< samples seen since the last one kept */
+};
+
+/**
+ * Durations by type, such as mark and sweep for collection phases.
+ */
+typedef std::vector<std::pair<std::string, LatencyHistogram> > LatencyBreakdown;
+
+/**
+ * Everything computed from one log, or from several merged.
+ */
+struct VerboseGCStatistics
+{
+	uintptr_t stanzas; /**< top level elements */
+	LatencyHistogram pauses; /**< exclusive access, that is stop the world, durations */
+	LatencyBreakdown collections; /**< collection durations by collection type */
+	LatencyBreakdown phases; /**< gc-op durations by operation type, heap-resize ones as resize-<type> */
+	uint64_t allocatedBytes; /**< from the allocation statistics of every collection */
+	int64_t firstTimestamp; /**< milliseconds since the epoch, or -1 */
+	int64_t lastTimestamp;
+	HeapTimeline timeline;
+
+	VerboseGCStatistics() : stanzas(0), allocatedBytes(0), firstTimestamp(-1), lastTimestamp(-1) {}
+
+	static LatencyHistogram *find(LatencyBreakdown *breakdown, const char *type);
+
+	/**
+	 * Add the statistics of a log that follows this one.
+	 */
+	void merge(const VerboseGCStatistics &other);
+
+	/**
+	 * @return bytes allocated per second between the first and last timestamp, or 0
+	 */
+	double allocationRate() const;
+};
+
+/**
+ * Minimal streaming XML reader. Elements are reported with their attributes, which are only
+ * valid during the callback; text content, comments and declarations are skipped.
+ */
+class VerboseGCReader
+{
+public:
+	class Handler
+	{
+	public:
+		/**
+		 * @param[in] name the element name
+		 * @param[in] attributes attribute names and values, alternating
+		 * @param[in] attributeCount the number of attributes
+		 */
+		virtual void startElement(const char *name, const char **attributes, uintptr_t attributeCount) = 0;
+		virtual void endElement(const char *name) = 0;
+		virtual ~Handler() {}
+	};
+
+	enum {
+		CHUNK_SIZE = 64 * 1024,
+		MAXIMUM_TAG_LENGTH = 1024 * 1024, /**< longer tags are skipped */
+		MAXIMUM_ATTRIBUTES = 64
+	};
+
+	VerboseGCReader(Handler *handler) : _handler(handler), _inTag(false), _quote('\0'), _skippedTags(0) {}
+
+	/**
+	 * Read a file in chunks.
+	 * @return false if the file could not be read
+	 */
+	bool parseFile(OMRPortLibrary *portLibrary, const char *fileName);
+
+	/**
+	 * Feed the next part of a document, which may end anywhere.
+	 */
+	void parse(const char *data, uintptr_t length);
+
+	/**
+	 * @return tags that were too long or malformed
+	 */
+	uintptr_t skippedTags() const { return _skippedTags; }
+
+private:
+	void processTag();
+
+	Handler *_handler;
+	std::string _tag; /**< the tag being read, without its angle brackets */
+	bool _inTag;
+	char _quote; /**< the quote of the attribute value being read, or NUL */
+	uintptr_t _skippedTags;
+};
+
+/**
+ * Collects VerboseGCStatistics from the elements of a log.
+ */
+class VerboseGCAnalyzer : public VerboseGCReader::Handler
+{
+public:
+	VerboseGCAnalyzer(VerboseGCStatistics *statistics)
+		: _statistics(statistics), _depth(0), _stanzaDepth(0), _stanzaTimestamp(-1)
+	{}
+
+	virtual void startElement(const char *name, const char **attributes, uintptr_t attributeCount);
+	virtual void endElement(const char *name);
+
+	/**
+	 * Analyze a whole log.
+	 * @return false if the log could not be read
+	 */
+	static bool analyzeFile(OMRPortLibrary *portLibrary, const char *fileName, VerboseGCStatistics *statistics);
+
+	/**
+	 * Analyze logs on up to threadCount threads, one log per thread at a time.
+	 * @param[out] results the statistics of each log, in the order of fileNames
+	 * @return false if any log could not be read
+	 */
+	static bool analyzeFiles(OMRPortLibrary *portLibrary, const std::vector<std::string> &fileNames, uintptr_t threadCount, std::vector<VerboseGCStatistics> *results);
+
+	/**
+	 * Parse a verbose GC timestamp such as 2015-01-26T20:24:55.123.
+	 * @return milliseconds since the epoch, or -1
+	 */
+	static int64_t parseTimestamp(const char *timestamp);
+
+private:
+	VerboseGCStatistics *_statistics;
+	uintptr_t _depth; /**< elements currently open */
+	uintptr_t _stanzaDepth; /**< depth of the top level elements: 1 inside a verbosegc element */
+	std::string _stanza; /**< name of the current top level element */
+	int64_t _stanzaTimestamp;
+};
+
+/**
+ * Print a report of statistics to the terminal.
+ */
+void printVerboseGCReport(OMRPortLibrary *portLibrary, const char *title, const VerboseGCStatistics &statistics);
+
+/**
+ * Write the heap occupancy timeline as CSV: timestamp in milliseconds, event, used and total bytes.
+ * @return false if the file could not be written
+ */
+bool writeHeapTimeline(OMRPortLibrary *portLibrary, const char *fileName, const VerboseGCStatistics &statistics);
+
+#endif /* VERBOSEGCANALYZER_HPP_ */
@@ -20,37 +20,55 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <algorithm>
+#include <string>
 #include <vector>
-#include <iterator>
-#include <numeric>
-#include <stdio.h>
-
-#include "pugixml.hpp"
 
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
 
-const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
-const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
-const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
-const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+#include "VerboseGCAnalyzer.hpp"
+
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
-double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
+static void
+usage(void)
+{
+	fprintf(stderr, "usage: omrperfgctest [-j <threads>] [-timeline <csv file>] [<verbose GC log>...]\n");
+	fprintf(stderr, "  Without logs, the VerboseGC* logs in the current directory are analyzed and deleted.\n");
+	fprintf(stderr, "  Several logs, such as rotated ones, are also reported together in the order given.\n");
+}
 
-int main(void)
+int main(int argc, char **argv)
 {
-	int32_t totalFiles = 0;
 	intptr_t rc = 0;
 	char resultBuffer[128];
 	uintptr_t rcFile;
 	uintptr_t handle;
 	OMRPortLibrary portLibrary;
+	std::vector<std::string> fileNames;
+	uintptr_t threadCount = 0;
+	const char *timelineFileName = NULL;
+	bool analyzeTestLogs = true;
+
+	for (int i = 1; i < argc; i++) {
+		if ((0 == strcmp(argv[i], "-j")) && ((i + 1) < argc)) {
+			threadCount = (uintptr_t)strtoul(argv[++i], NULL, 10);
+		} else if ((0 == strcmp(argv[i], "-timeline")) && ((i + 1) < argc)) {
+			timelineFileName = argv[++i];
+		} else if ('-' == argv[i][0]) {
+			usage();
+			return -1;
+		} else {
+			fileNames.push_back(argv[i]);
+			analyzeTestLogs = false;
+		}
+	}
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
 	if (0 != rc) {
@@ -66,142 +84,59 @@ int main(void)
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
-	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
+	if (analyzeTestLogs) {
+		rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
-	if(rcFile == (uintptr_t)-1) {
-		fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
-		return -1;
-	}
+		if(rcFile == (uintptr_t)-1) {
+			fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
+			return -1;
+		}
 
-	while ((uintptr_t)-1 != rcFile) {
-		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
-			totalFiles++;
-			/* Clean up verbose log file */
-			omrfile_unlink(resultBuffer);
+		while ((uintptr_t)-1 != rcFile) {
+			if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
+				fileNames.push_back(resultBuffer);
+			}
+			rcFile = omrfile_findnext(handle, resultBuffer);
 		}
-		rcFile = omrfile_findnext(handle, resultBuffer);
-	}
-	if (handle != (uintptr_t)-1) {
-		omrfile_findclose(handle);
+		if (handle != (uintptr_t)-1) {
+			omrfile_findclose(handle);
+		}
+		std::sort(fileNames.begin(), fileNames.end());
 	}
 
-	if(totalFiles < 1) {
+	if (fileNames.empty()) {
 		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
-	}
-
-	portLibrary.port_shutdown_library(&portLibrary);
-	omrthread_detach(NULL);
-}
-
-double
-getAvg(std::vector<double> v)
-{
-	double sum = std::accumulate(v.begin(), v.end(), 0.0);
-	double avg = sum / v.size();
-	return avg;
-}
-
-void
-analyze(char* fileName, OMRPortLibrary portLibrary)
-{
-	std::vector<double> mark_values;
-	std::vector<double> sweep_values;
-	std::vector<double> expand_values;
-	std::vector<double> gcduration_values;
-
-	pugi::xpath_node_set markTimes;
-	pugi::xpath_node_set sweepTimes;
-	pugi::xpath_node_set expandTimes;
-	pugi::xpath_node_set gcTimes;
-
-	double maxMark = 0;
-	double minMark = 0;
-	double avgMark = 0;
-
-	double maxSweep = 0;
-	double minSweep = 0;
-	double avgSweep = 0;
-
-	double maxExpand = 0;
-	double minExpand = 0;
-	double avgExpand = 0;
-
-	double maxGCDuration = 0;
-	double minGCDuration = 0;
-	double avgGCDuration = 0;
-
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
-
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
-	if(!result) {
-		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
 	} else {
-		omrtty_printf("\nResults for : %s\n",fileName);
-	}
-
-	markTimes = doc.select_nodes(XPATH_GET_ALL_MARK_TIME);
-	for (pugi::xpath_node_set::const_iterator it = markTimes.begin(); it != markTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    mark_values.push_back(value);
-	}
-
-	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
-	for (pugi::xpath_node_set::const_iterator it = sweepTimes.begin(); it != sweepTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    sweep_values.push_back(value);
-	}
-
-	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
-	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    expand_values.push_back(value);
-	}
-
-	gcTimes = doc.select_nodes(XPATH_GET_TOTAL_GC_TIME);
-	for (pugi::xpath_node_set::const_iterator it = gcTimes.begin(); it != gcTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("durationms").as_double();
-	    gcduration_values.push_back(value);
-	}
-
-	if (!mark_values.empty()) {
-		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
-		minMark = *std::min_element(mark_values.begin(), mark_values.end());
-		avgMark = getAvg(mark_values);
-	}
+		if (0 == threadCount) {
+			threadCount = (uintptr_t)omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE);
+		}
 
-	if (!sweep_values.empty()) {
-		maxSweep = *std::max_element(sweep_values.begin(), sweep_values.end());
-		minSweep = *std::min_element(sweep_values.begin(), sweep_values.end());
-		avgSweep = getAvg(sweep_values);
-	}
+		std::vector<VerboseGCStatistics> results;
+		if (!VerboseGCAnalyzer::analyzeFiles(&portLibrary, fileNames, threadCount, &results)) {
+			rc = -1;
+		}
 
-	if (!expand_values.empty()) {
-		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
-		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
-		avgExpand = getAvg(expand_values);
-	}
+		VerboseGCStatistics combined;
+		for (uintptr_t i = 0; i < fileNames.size(); i++) {
+			printVerboseGCReport(&portLibrary, fileNames[i].c_str(), results[i]);
+			combined.merge(results[i]);
+			if (analyzeTestLogs) {
+				/* Clean up verbose log file */
+				omrfile_unlink(fileNames[i].c_str());
+			}
+		}
+		/* the test logs come from unrelated runs */
+		if (!analyzeTestLogs && (fileNames.size() > 1)) {
+			printVerboseGCReport(&portLibrary, "all logs", combined);
+		}
 
-	if (!gcduration_values.empty()) {
-		maxGCDuration = *std::max_element(gcduration_values.begin(), gcduration_values.end());
-		minGCDuration = *std::min_element(gcduration_values.begin(), gcduration_values.end());
-		avgGCDuration = getAvg(gcduration_values);
+		if ((NULL != timelineFileName) && !writeHeapTimeline(&portLibrary, timelineFileName, combined)) {
+			omrtty_printf("Failed to write heap timeline : %s\n", timelineFileName);
+			rc = -1;
+		}
 	}
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
-
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
-
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return (int)rc;
 }
@@ -46,4 +46,8 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+# Set GC_BENCHMARK_BASELINE to the results of an earlier run to fail on regressions
+omr_gcbenchmark:
+	./omrgctest --gtest_filter="gcBenchmark*" -benchmarkResults=gcbenchmark.json $(if $(GC_BENCHMARK_BASELINE),-benchmarkBaseline=$(GC_BENCHMARK_BASELINE))
+
+.PHONY: all test omr_perfgctest omr_gcbenchmark 
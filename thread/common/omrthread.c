@@ -950,6 +950,7 @@ postForkResetMonitors(omrthread_t self)
 					entry->owner = NULL;
 #if defined(OMR_THR_ADAPTIVE_SPIN)
 					entry->sampleCounter = 0;
+					entry->spinBudget = 0;
 #endif /* defined(OMR_THR_ADAPTIVE_SPIN) */
 					entry->pinCount = 0;
 #if defined(OMR_THR_THREE_TIER_LOCKING)
@@ -3747,6 +3748,10 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	/* Nothing learned yet; the first contended acquire may use the full spin counts. */
+	monitor->spinBudget = 0;
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) */
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
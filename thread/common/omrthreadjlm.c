@@ -191,6 +191,9 @@ jlm_adaptive_spin_init(void)
 	if (0 != *(uintptr_t *)omrthread_global("adaptSpinSlowPercentEnable")) {
 		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED;
 	}
+	if (0 != *(uintptr_t *)omrthread_global("adaptSpinBudgetEnable")) {
+		adaptiveFlags |= J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_BUDGET_ENABLED;
+	}
 
 #if defined(OMR_THR_CUSTOM_SPIN_OPTIONS)
 	if (0 != *(uintptr_t *)omrthread_global("customAdaptSpinEnabled")) {
@@ -418,7 +418,33 @@ enum {
 	(((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_ENABLED) || \
 	 (IS_ADAPT_SAMPLING_ENABLED((thread), (monitor)) && (0 == (monitor)->sampleCounter)))
 
+/* MACROS FOR ADAPTIVE SPIN BUDGET
+ *
+ * The spin budget is the number of tier-2 spin iterations a thread will make on a
+ * monitor's spinlock before blocking. It is learned per monitor: a contended acquire
+ * that succeeds while spinning moves the budget towards twice the number of iterations
+ * it needed, and an acquire that exhausts the budget halves it.
+ */
+#define IS_ADAPT_SPIN_BUDGET_ENABLED(thread, monitor) \
+	(IS_ADAPTIVE_SPIN_REQUIRED(monitor) && OMR_ARE_ALL_BITS_SET((thread)->library->flags, J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_BUDGET_ENABLED))
+
+/* Smallest budget the heuristic will shrink to */
+#define ADAPT_SPIN_BUDGET_MIN 8
+/* A successful spin moves the budget 1/(2^ADAPT_SPIN_BUDGET_SMOOTHING_SHIFT) of the way to its target */
+#define ADAPT_SPIN_BUDGET_SMOOTHING_SHIFT 3
+/* Spinning is abandoned when the owner has any of these flags set, since it cannot release the lock soon */
+#define ADAPT_SPIN_OWNER_NOT_RUNNING_FLAGS \
+	(J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_WAITING | J9THREAD_FLAG_SLEEPING | J9THREAD_FLAG_PARKED | J9THREAD_FLAG_SUSPENDED)
+
+#define JLM_CLEAR_ADAPT_SPIN_BUDGET_COUNTS(monitor) \
+	do { \
+		(monitor)->tracing->spin_acquire_count = 0; \
+		(monitor)->tracing->spin_budget_exhausted_count = 0; \
+		(monitor)->tracing->spin_owner_blocked_count = 0; \
+	} while (0)
+
 #else /* OMR_THR_ADAPTIVE_SPIN */
+#define JLM_CLEAR_ADAPT_SPIN_BUDGET_COUNTS(monitor)
 #define DO_ADAPT_CHECK(thread, monitor)
 #define ADAPT_DISABLE_SPIN_CHECK(thread, monitor)
 #define TAKE_JLM_SAMPLE(thread, monitor) IS_JLM_ENABLED(thread)
@@ -469,6 +495,7 @@ enum {
 				(monitor)->tracing->holdtime_avg = 0; \
 				(monitor)->tracing->spin2_count = 0; \
 				(monitor)->tracing->yield_count = 0; \
+				JLM_CLEAR_ADAPT_SPIN_BUDGET_COUNTS(monitor); \
 			} \
 			if (isSlowEnter) { \
 				(monitor)->tracing->slow_count++; \
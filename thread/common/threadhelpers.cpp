@@ -88,6 +88,25 @@ omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monitor)
 	uintptr_t spinCount3 = spinCount3Init;
 	uintptr_t spinCount2 = spinCount2Init;
 
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	BOOLEAN budgetEnabled = IS_ADAPT_SPIN_BUDGET_ENABLED(self, monitor);
+#if defined(OMR_THR_SPIN_WAKE_CONTROL)
+	/* Don't learn from acquires whose spin counts were forced down by the spinning thread bound */
+	budgetEnabled = budgetEnabled && spinning;
+#endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+	uintptr_t const spinBudgetMax = spinCount3Init * spinCount2Init;
+	uintptr_t spinBudget = spinBudgetMax;
+	uintptr_t spinAttempts = 0;
+	BOOLEAN ownerBlocked = FALSE;
+	if (budgetEnabled) {
+		/* A budget of 0 means nothing has been learned yet, so allow the full spin */
+		spinBudget = monitor->spinBudget;
+		if ((0 == spinBudget) || (spinBudget > spinBudgetMax)) {
+			spinBudget = spinBudgetMax;
+		}
+	}
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) */
+
 	for (; spinCount3 > 0; spinCount3--) {
 		for (spinCount2 = spinCount2Init; spinCount2 > 0; spinCount2--) {
 			/* Try to put 0 into the target field (-1 indicates free)'. */
@@ -100,6 +119,22 @@ omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monitor)
 			if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_DISABLE_SPINNING)) {
 				goto update_jlm;
 			}
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+			if (budgetEnabled) {
+				spinAttempts += 1;
+				if (spinAttempts >= spinBudget) {
+					goto update_jlm;
+				}
+				/* The owner is read without synchronization; a stale value only costs one
+				 * extra spin iteration or an early block, either of which is harmless.
+				 */
+				omrthread_t owner = monitor->owner;
+				if ((NULL != owner) && OMR_ARE_ANY_BITS_SET(owner->flags, ADAPT_SPIN_OWNER_NOT_RUNNING_FLAGS)) {
+					ownerBlocked = TRUE;
+					goto update_jlm;
+				}
+			}
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) */
 			VM_AtomicSupport::yieldCPU();
 			/* begin tight loop */
 			for (uintptr_t spinCount1 = spinCount1Init; spinCount1 > 0; spinCount1--)	{
@@ -136,6 +171,34 @@ update_jlm:
 	}
 #endif /* OMR_THR_JLM */
 
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	if (budgetEnabled && (0 != spinAttempts)) {
+		BOOLEAN budgetExhausted = (0 != result) && (spinAttempts >= spinBudget);
+		if (0 == result) {
+			/* Move the budget towards twice what this acquire needed */
+			intptr_t budgetTarget = (intptr_t)OMR_MIN((2 * spinAttempts) + ADAPT_SPIN_BUDGET_MIN, spinBudgetMax);
+			spinBudget = (uintptr_t)((intptr_t)spinBudget + ((budgetTarget - (intptr_t)spinBudget) / (1 << ADAPT_SPIN_BUDGET_SMOOTHING_SHIFT)));
+		} else if (budgetExhausted) {
+			spinBudget = OMR_MAX(spinBudget >> 1, ADAPT_SPIN_BUDGET_MIN);
+		}
+		/* Racing updates from other spinners may be lost, which only slows down learning */
+		monitor->spinBudget = spinBudget;
+
+#if defined(OMR_THR_JLM)
+		if (NULL != tracing) {
+			tracing->spin_budget = spinBudget;
+			if (0 == result) {
+				VM_AtomicSupport::add(&tracing->spin_acquire_count, 1);
+			} else if (ownerBlocked) {
+				VM_AtomicSupport::add(&tracing->spin_owner_blocked_count, 1);
+			} else if (budgetExhausted) {
+				VM_AtomicSupport::add(&tracing->spin_budget_exhausted_count, 1);
+			}
+		}
+#endif /* OMR_THR_JLM */
+	}
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) */
+
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	if (spinning && (OMRTHREAD_IGNORE_SPIN_THREAD_BOUND != lib->maxSpinThreads)) {
 		VM_AtomicSupport::subtract(&monitor->spinThreads, 1);